@@ -23,12 +23,12 @@
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonDocument>
-#include <QtCore/QSaveFile>
 #include <QtCore/QString>
 #include <QtGui/QImageReader>
 #include <QtCore/QVector>
 #include <QtCore/QUrlQuery>
 
+#include <AssetChunkStore.h>
 #include <ClientServerUtils.h>
 #include <NodeType.h>
 #include <SharedUtil.h>
@@ -117,7 +117,7 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
     qDebug() << "Starting bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, _chunkStore);
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
@@ -293,6 +293,7 @@ void updateConsumedCores() {
 
 AssetServer::AssetServer(ReceivedMessage& message) :
     ThreadedAssignment(message),
+    _chunkGarbageCollectionTimer(this),
     _transferTaskPool(this),
     _bakingTaskPool(this),
     _filesizeLimit(AssetUtils::MAX_UPLOAD_SIZE)
@@ -306,6 +307,12 @@ AssetServer::AssetServer(ReceivedMessage& message) :
     _transferTaskPool.setMaxThreadCount(TASK_POOL_THREAD_COUNT);
     _bakingTaskPool.setMaxThreadCount(1);
 
+    // deletes tend to come in bursts, so coalesce chunk garbage collection after them
+    static const int CHUNK_GARBAGE_COLLECTION_DELAY_MS = 60 * 1000;
+    _chunkGarbageCollectionTimer.setSingleShot(true);
+    _chunkGarbageCollectionTimer.setInterval(CHUNK_GARBAGE_COLLECTION_DELAY_MS);
+    connect(&_chunkGarbageCollectionTimer, &QTimer::timeout, this, &AssetServer::collectChunkGarbage);
+
     // Queue all requests until the Asset Server is fully setup
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListenerForTypes({ PacketType::AssetGet, PacketType::AssetGetInfo, PacketType::AssetUpload, PacketType::AssetMappingOperation },
@@ -364,6 +371,7 @@ void AssetServer::run() {
 }
 
 static const QString ASSET_FILES_SUBDIR = "files";
+static const QString ASSET_CHUNKS_SUBDIR = "chunk_store";
 
 void AssetServer::completeSetup() {
     auto nodeList = DependencyManager::get<NodeList>();
@@ -425,6 +433,22 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    static const QString CHUNK_STORE_ENABLED_OPTION = "chunk_store_enabled";
+    _isChunkStoreEnabled = assetServerObject[CHUNK_STORE_ENABLED_OPTION].toBool(false);
+
+    // keep serving previously chunked assets even if the store has since been disabled
+    QDir chunkStoreDirectory { _resourcesDirectory.absoluteFilePath(ASSET_CHUNKS_SUBDIR) };
+    if (_isChunkStoreEnabled || chunkStoreDirectory.exists()) {
+        _chunkStore = std::make_shared<AssetChunkStore>(chunkStoreDirectory);
+        if (!chunkStoreDirectory.mkpath(".") || !_chunkStore->initialize()) {
+            qCCritical(asset_server) << "Unable to create the asset chunk store. Stopping assignment.";
+            setFinished(true);
+            return;
+        }
+        qCInfo(asset_server) << "Chunk store at" << chunkStoreDirectory.path()
+            << (_isChunkStoreEnabled ? "is enabled for uploads." : "is serving existing assets only.");
+    }
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -436,12 +460,17 @@ void AssetServer::completeSetup() {
         auto hashedFiles = files.filter(hashFileRegex);
 
         qCInfo(asset_server) << "There are" << hashedFiles.size() << "asset files in the asset directory.";
+        if (_chunkStore) {
+            qCInfo(asset_server) << "There are" << _chunkStore->getAssetHashes().size() << "assets in the chunk store.";
+        }
 
         if (_fileMappings.size() > 0) {
             cleanupUnmappedFiles();
             cleanupBakedFilesForDeletedAssets();
         }
 
+        collectChunkGarbage();
+
         nodeList->addSetOfNodeTypesToNodeInterestSet({ NodeType::Agent, NodeType::EntityScriptServer });
 
         bakeAssets();
@@ -525,25 +554,18 @@ void AssetServer::replayRequests() {
 void AssetServer::cleanupUnmappedFiles() {
     QRegExp hashFileRegex { AssetUtils::ASSET_HASH_REGEX_STRING };
 
-    auto files = _filesDirectory.entryInfoList(QDir::Files);
+    auto files = _filesDirectory.entryList(QDir::Files);
+    if (_chunkStore) {
+        files += _chunkStore->getAssetHashes();
+    }
 
     qCInfo(asset_server) << "Performing unmapped asset cleanup.";
 
-    for (const auto& fileInfo : files) {
-        auto filename = fileInfo.fileName();
+    for (const auto& filename : files) {
         if (hashFileRegex.exactMatch(filename)) {
-            bool matched { false };
-            for (auto& pair : _fileMappings) {
-                if (pair.second == filename) {
-                    matched = true;
-                    break;
-                }
-            }
-            if (!matched) {
+            if (!_fileMappings.isHashMapped(filename)) {
                 // remove the unmapped file
-                QFile removeableFile { fileInfo.absoluteFilePath() };
-
-                if (removeableFile.remove()) {
+                if (removeAssetFile(filename)) {
                     qCDebug(asset_server) << "\tDeleted" << filename << "from asset files directory since it is unmapped.";
 
                     removeBakedPathsForDeletedAsset(filename);
@@ -560,27 +582,21 @@ void AssetServer::cleanupBakedFilesForDeletedAssets() {
 
     std::set<AssetUtils::AssetHash> bakedHashes;
 
-    for (const auto& it : _fileMappings) {
-        // check if this is a mapping to baked content
-        if (it.first.startsWith(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER)) {
-            // extract the hash from the baked mapping
-            AssetUtils::AssetHash hash = it.first.mid(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER.length(),
-                                                      AssetUtils::SHA256_HASH_HEX_LENGTH);
+    // only look at the mappings to baked content
+    auto bakedRange = _fileMappings.getMappingsWithPrefix(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER);
+    for (auto it = bakedRange.first; it != bakedRange.second; ++it) {
+        // extract the hash from the baked mapping
+        AssetUtils::AssetHash hash = it->first.mid(AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER.length(),
+                                                   AssetUtils::SHA256_HASH_HEX_LENGTH);
 
-            // add the hash to our set of hashes for which we have baked content
-            bakedHashes.insert(hash);
-        }
+        // add the hash to our set of hashes for which we have baked content
+        bakedHashes.insert(hash);
     }
 
     // enumerate the hashes for which we have baked content
     for (const auto& hash : bakedHashes) {
         // check if we have a mapping that points to this hash
-        auto matchingMapping = std::find_if(std::begin(_fileMappings), std::end(_fileMappings),
-                                            [&hash](const std::pair<AssetUtils::AssetPath, AssetUtils::AssetHash> mappingPair) {
-            return mappingPair.second == hash;
-        });
-
-        if (matchingMapping == std::end(_fileMappings)) {
+        if (!_fileMappings.isHashMapped(hash)) {
             // we didn't find a mapping for this hash, remove any baked content we still have for it
             removeBakedPathsForDeletedAsset(hash);
         }
@@ -853,6 +869,10 @@ void AssetServer::handleAssetGetInfo(QSharedPointer<ReceivedMessage> message, Sh
         qCDebug(asset_server) << "Opening file: " << fileInfo.filePath();
         replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
         replyPacket->writePrimitive(fileInfo.size());
+    } else if (_chunkStore && _chunkStore->hasAsset(fileName)) {
+        qCDebug(asset_server) << "Opening chunked asset: " << fileName;
+        replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+        replyPacket->writePrimitive((qint64)_chunkStore->getAssetSize(fileName));
     } else {
         qCDebug(asset_server) << "Asset not found: " << QString(hexHash);
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
@@ -872,7 +892,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _chunkStore);
     _transferTaskPool.start(task);
 }
 
@@ -886,7 +906,8 @@ void AssetServer::handleAssetUpload(QSharedPointer<ReceivedMessage> message, Sha
     if (canWriteToAssetServer) {
         qCDebug(asset_server) << "Starting an UploadAssetTask for upload from" << message->getSourceID();
 
-        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit);
+        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit,
+                                        _isChunkStoreEnabled ? _chunkStore : nullptr);
         _transferTaskPool.start(task);
     } else {
         // this is a node the domain told us is not allowed to rez entities
@@ -965,97 +986,36 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    if (_chunkStore) {
+        static const float BYTES_PER_MEGABYTE = 1000.0f * 1000.0f;
+        static const float USECS_PER_SECOND = 1000.0f * 1000.0f;
+        auto stats = _chunkStore->getStats();
+
+        QJsonObject chunkStoreStats;
+        chunkStoreStats["1. Assets"] = (double)stats.numManifests;
+        chunkStoreStats["2. Chunks"] = (double)stats.numChunks;
+        chunkStoreStats["3. Logical (MB)"] = stats.logicalBytes / BYTES_PER_MEGABYTE;
+        chunkStoreStats["4. Stored (MB)"] = stats.storedBytes / BYTES_PER_MEGABYTE;
+        chunkStoreStats["5. Saved (MB)"] = ((double)stats.logicalBytes - (double)stats.storedBytes) / BYTES_PER_MEGABYTE;
+        chunkStoreStats["6. Ingested (MB)"] = stats.ingestedBytes / BYTES_PER_MEGABYTE;
+        chunkStoreStats["7. New Chunk Data (MB)"] = stats.writtenChunkBytes / BYTES_PER_MEGABYTE;
+        chunkStoreStats["8. Ingest (MB/s)"] = stats.ingestUsecs > 0
+            ? (stats.ingestedBytes / BYTES_PER_MEGABYTE) / (stats.ingestUsecs / USECS_PER_SECOND) : 0.0f;
+        serverStats["Chunk Store"] = chunkStoreStats;
+    }
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
 
 static const QString MAP_FILE_NAME = "map.json";
+static const QString MAP_LOG_FILE_NAME = "map.log";
 
 bool AssetServer::loadMappingsFromFile() {
-
-    auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
-
-    QFile mapFile { mapFilePath };
-    if (mapFile.exists()) {
-        if (mapFile.open(QIODevice::ReadOnly)) {
-            QJsonParseError error;
-
-            auto jsonDocument = QJsonDocument::fromJson(mapFile.readAll(), &error);
-
-            if (error.error == QJsonParseError::NoError) {
-                if (!jsonDocument.isObject()) {
-                    qCWarning(asset_server) << "Failed to read mapping file, root value in" << mapFilePath << "is not an object";
-                    return false;
-                }
-
-                //_fileMappings = jsonDocument.object().toVariantHash();
-                auto root = jsonDocument.object();
-                for (auto it = root.begin(); it != root.end(); ++it) {
-                    auto key = it.key();
-                    auto value = it.value();
-
-                    if (!value.isString()) {
-                        qCWarning(asset_server) << "Skipping" << key << ":" << value << "because it is not a string";
-                        continue;
-                    }
-
-                    if (!AssetUtils::isValidFilePath(key)) {
-                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it is not a valid path.";
-                        continue;
-                    }
-
-                    if (!AssetUtils::isValidHash(value.toString())) {
-                        qCWarning(asset_server) << "Will not keep mapping for" << key << "since it does not have a valid hash.";
-                        continue;
-                    }
-
-
-                    qDebug() << "Added " << key << value.toString();
-                    _fileMappings[key] = value.toString();
-                }
-
-                qCInfo(asset_server) << "Loaded" << _fileMappings.size() << "mappings from map file at" << mapFilePath;
-                return true;
-            }
-        }
-
-        qCCritical(asset_server) << "Failed to read mapping file at" << mapFilePath;
-        return false;
-    } else {
-        qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << mapFilePath;
-    }
-
-    return true;
-}
-
-bool AssetServer::writeMappingsToFile() {
     auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
+    auto mapLogFilePath = _resourcesDirectory.absoluteFilePath(MAP_LOG_FILE_NAME);
 
-    QSaveFile mapFile { mapFilePath };
-    if (mapFile.open(QIODevice::WriteOnly)) {
-        QJsonObject root;
-
-        for (auto it : _fileMappings) {
-            root[it.first] = it.second;
-        }
-
-        QJsonDocument jsonDocument { root };
-
-        if (mapFile.write(jsonDocument.toJson()) != -1) {
-            if (mapFile.commit()) {
-                qCDebug(asset_server) << "Wrote JSON mappings to file at" << mapFilePath;
-                return true;
-            } else {
-                qCWarning(asset_server) << "Failed to commit JSON mappings to file at" << mapFilePath;
-            }
-        } else {
-            qCWarning(asset_server) << "Failed to write JSON mappings to file at" << mapFilePath;
-        }
-    } else {
-        qCWarning(asset_server) << "Failed to open map file at" << mapFilePath;
-    }
-
-    return false;
+    return _fileMappings.load(mapFilePath, mapLogFilePath);
 }
 
 bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash) {
@@ -1071,29 +1031,16 @@ bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash h
         return false;
     }
 
-    // remember what the old mapping was in case persistence fails
-    auto it = _fileMappings.find(path);
-    auto oldMapping = it != _fileMappings.end() ? it->second : "";
-
-    // update the in memory QHash
-    _fileMappings[path] = hash;
+    AssetMappingStore::Transaction transaction;
+    transaction.setMapping(path, hash);
 
-    // attempt to write to file
-    if (writeMappingsToFile()) {
-        // persistence succeeded, we are good to go
+    // the store only applies the mapping once it is persisted, so there is nothing to roll back on failure
+    if (_fileMappings.commit(transaction)) {
         qCDebug(asset_server) << "Set mapping:" << path << "=>" << hash;
         maybeBake(path, hash);
         return true;
     } else {
-        // failed to persist this mapping to file - put back the old one in our in-memory representation
-        if (oldMapping.isEmpty()) {
-            _fileMappings.erase(_fileMappings.find(path));
-        } else {
-            _fileMappings[path] = oldMapping;
-        }
-
         qCWarning(asset_server) << "Failed to persist mapping:" << path << "=>" << hash;
-
         return false;
     }
 }
@@ -1115,35 +1062,33 @@ void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
 }
 
 bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
-    // take a copy of the current mappings in case persistence of these deletes fails
-    auto oldMappings = _fileMappings;
+    AssetMappingStore::Transaction transaction;
 
     QSet<QString> hashesToCheckForDeletion;
+    QSet<QString> pathsToDelete;
 
-    // enumerate the paths to delete and remove them all
+    // enumerate the paths to delete and collect every mapping they cover
     for (const auto& rawPath : paths) {
         auto path = rawPath.trimmed();
 
         // figure out if this path will delete a file or folder
         if (pathIsFolder(path)) {
-            // enumerate the in memory file mappings and remove anything that matches
-            auto it = _fileMappings.begin();
-            auto sizeBefore = _fileMappings.size();
+            // the mappings are sorted by path, so a folder is a contiguous range
+            auto range = _fileMappings.getMappingsWithPrefix(path);
+            int numDeleted = 0;
 
-            while (it != _fileMappings.end()) {
-                if (it->first.startsWith(path)) {
+            for (auto it = range.first; it != range.second; ++it) {
+                if (!pathsToDelete.contains(it->first)) {
                     // add this hash to the list we need to check for asset removal from the server
                     hashesToCheckForDeletion << it->second;
-
-                    it = _fileMappings.erase(it);
-                } else {
-                    ++it;
+                    pathsToDelete << it->first;
+                    transaction.deleteMapping(it->first);
+                    ++numDeleted;
                 }
             }
 
-            auto sizeNow = _fileMappings.size();
-            if (sizeBefore != sizeNow) {
-                qCDebug(asset_server) << "Deleted" << sizeBefore - sizeNow << "mappings in folder: " << path;
+            if (numDeleted > 0) {
+                qCDebug(asset_server) << "Deleted" << numDeleted << "mappings in folder: " << path;
             } else {
                 qCDebug(asset_server) << "Did not find any mappings to delete in folder:" << path;
             }
@@ -1151,36 +1096,32 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
         } else {
             auto it = _fileMappings.find(path);
             if (it != _fileMappings.end()) {
-                // add this hash to the list we need to check for asset removal from server
-                hashesToCheckForDeletion << it->second;
+                if (!pathsToDelete.contains(path)) {
+                    // add this hash to the list we need to check for asset removal from server
+                    hashesToCheckForDeletion << it->second;
+                    pathsToDelete << path;
+                    transaction.deleteMapping(path);
+                }
 
                 qCDebug(asset_server) << "Deleted a mapping:" << path << "=>" << it->second;
-
-                _fileMappings.erase(it);
             } else {
                 qCDebug(asset_server) << "Unable to delete a mapping that was not found:" << path;
             }
         }
     }
 
-    // deleted the old mappings, attempt to persist to file
-    if (writeMappingsToFile()) {
+    // persist all of the deletes as a single transaction
+    if (_fileMappings.commit(transaction)) {
         // persistence succeeded we are good to go
 
-        // TODO iterate through hashesToCheckForDeletion instead
-        for (auto& pair : _fileMappings) {
-            auto it = hashesToCheckForDeletion.find(pair.second);
-            if (it != hashesToCheckForDeletion.end()) {
-                hashesToCheckForDeletion.erase(it);
+        // we now have a set of hashes that may be unmapped - we will delete those asset files
+        for (auto& hash : hashesToCheckForDeletion) {
+            if (_fileMappings.isHashMapped(hash)) {
+                continue;
             }
-        }
 
-        // we now have a set of hashes that are unmapped - we will delete those asset files
-        for (auto& hash : hashesToCheckForDeletion) {
             // remove the unmapped file
-            QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
-
-            if (removeableFile.remove()) {
+            if (removeAssetFile(hash)) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
 
                 removeBakedPathsForDeletedAsset(hash);
@@ -1191,12 +1132,34 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
         return true;
     } else {
-        qCWarning(asset_server) << "Failed to persist deleted mappings, rolling back";
+        qCWarning(asset_server) << "Failed to persist deleted mappings, leaving mappings unchanged";
+        return false;
+    }
+}
 
-        // we didn't delete the previous mapping, put it back in our in-memory representation
-        _fileMappings = oldMappings;
+bool AssetServer::removeAssetFile(const AssetUtils::AssetHash& hash) {
+    // no-op unless this was a meta file
+    _metaFileCache.remove(hash);
 
-        return false;
+    QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
+    bool removed = removeableFile.remove();
+
+    if (_chunkStore && _chunkStore->removeAsset(hash)) {
+        removed = true;
+        if (!_chunkGarbageCollectionTimer.isActive()) {
+            _chunkGarbageCollectionTimer.start();
+        }
+    }
+
+    return removed;
+}
+
+void AssetServer::collectChunkGarbage() {
+    if (_chunkStore) {
+        auto chunkStore = _chunkStore;
+        _transferTaskPool.start([chunkStore] {
+            chunkStore->collectGarbage();
+        });
     }
 }
 
@@ -1211,6 +1174,8 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
         return false;
     }
 
+    AssetMappingStore::Transaction transaction;
+
     // figure out if this rename is for a file or folder
     if (pathIsFolder(oldPath)) {
         if (!pathIsFolder(newPath)) {
@@ -1220,35 +1185,24 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take a copy of the old mappings
-        auto oldMappings = _fileMappings;
-
-        // iterate the current mappings and adjust any that matches the renamed folder
-        auto it = oldMappings.begin();
-
-        while (it != oldMappings.end()) {
-            auto& oldKey = it->first;
-            if (oldKey.startsWith(oldPath)) {
-                auto newKey = oldKey;
-                newKey.replace(0, oldPath.size(), newPath);
-
-                // remove the old version from the in memory file mappings
-                _fileMappings.erase(_fileMappings.find(oldKey));
-                _fileMappings[newKey] = it->second;
-            }
-
-            ++it;
+        // adjust every mapping inside the renamed folder; deletes go first so a mapping that is
+        // renamed onto another path from the same folder isn't removed again afterwards
+        auto range = _fileMappings.getMappingsWithPrefix(oldPath);
+        for (auto it = range.first; it != range.second; ++it) {
+            transaction.deleteMapping(it->first);
+        }
+        for (auto it = range.first; it != range.second; ++it) {
+            auto newKey = it->first;
+            newKey.replace(0, oldPath.size(), newPath);
+            transaction.setMapping(newKey, it->second);
         }
 
-        if (writeMappingsToFile()) {
+        if (_fileMappings.commit(transaction)) {
             // persisted the changed mappings, return success
             qCDebug(asset_server) << "Renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return true;
         } else {
-            // couldn't persist the renamed paths, rollback and return failure
-            _fileMappings = oldMappings;
-
             qCWarning(asset_server) << "Failed to persist renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return false;
@@ -1261,40 +1215,23 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take the old hash to remove the old mapping
         auto it = _fileMappings.find(oldPath);
-        auto oldSourceMapping = it->second;
-        _fileMappings.erase(it);
-
-        // in case we're overwriting, keep the current destination mapping for potential rollback
-        auto oldDestinationIt = _fileMappings.find(newPath);
-
-        if (!oldSourceMapping.isEmpty()) {
-            _fileMappings[newPath] = oldSourceMapping;
-
-            if (writeMappingsToFile()) {
-                // persisted the renamed mapping, return success
-                qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
-
-                return true;
-            } else {
-                // we couldn't persist the renamed mapping, rollback and return failure
-                _fileMappings[oldPath] = oldSourceMapping;
+        if (it == _fileMappings.end()) {
+            // failed to find a mapping that was to be renamed, return failure
+            return false;
+        }
 
-                if (oldDestinationIt != _fileMappings.end()) {
-                    // put back the overwritten mapping for the destination path
-                    _fileMappings[newPath] = oldDestinationIt->second;
-                } else {
-                    // clear the new mapping
-                    _fileMappings.erase(_fileMappings.find(newPath));
-                }
+        transaction.deleteMapping(oldPath);
+        transaction.setMapping(newPath, it->second);
 
-                qCDebug(asset_server) << "Failed to persist renamed mapping:" << oldPath << "=>" << newPath;
+        if (_fileMappings.commit(transaction)) {
+            // persisted the renamed mapping, return success
+            qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
 
-                return false;
-            }
+            return true;
         } else {
-            // failed to find a mapping that was to be renamed, return failure
+            qCDebug(asset_server) << "Failed to persist renamed mapping:" << oldPath << "=>" << newPath;
+
             return false;
         }
     }
@@ -1491,6 +1428,10 @@ std::pair<bool, AssetMeta> AssetServer::readMetaFile(AssetUtils::AssetHash hash)
 
     auto metaFileHash = it->second;
 
+    if (auto cached = _metaFileCache.object(metaFileHash)) {
+        return { true, *cached };
+    }
+
     QFile metaFile(_filesDirectory.absoluteFilePath(metaFileHash));
 
     if (metaFile.open(QIODevice::ReadOnly)) {
@@ -1518,6 +1459,7 @@ std::pair<bool, AssetMeta> AssetServer::readMetaFile(AssetUtils::AssetHash hash)
                 meta.lastBakeErrors = lastBakeErrors.toString();
                 meta.redirectTarget = redirectTarget.toString();
 
+                _metaFileCache.insert(metaFileHash, new AssetMeta(meta));
                 return { true, meta };
             } else {
                 qCWarning(asset_server) << "Metafile for" << hash << "has either missing or malformed data.";
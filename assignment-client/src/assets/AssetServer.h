@@ -12,12 +12,17 @@
 #ifndef hifi_AssetServer_h
 #define hifi_AssetServer_h
 
+#include <memory>
+
+#include <QtCore/QCache>
 #include <QtCore/QDir>
 #include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
 #include <QRunnable>
 
 #include <ThreadedAssignment.h>
 
+#include "AssetMappingStore.h"
 #include "AssetUtils.h"
 #include "ReceivedMessage.h"
 
@@ -68,6 +73,7 @@ struct AssetMeta {
     QString redirectTarget;
 };
 
+class AssetChunkStore;
 class BakeAssetTask;
 
 class AssetServer : public ThreadedAssignment {
@@ -106,7 +112,6 @@ private:
 
     // Mapping file operations must be called from main assignment thread only
     bool loadMappingsFromFile();
-    bool writeMappingsToFile();
 
     /// Set the mapping for path to hash
     bool setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash);
@@ -125,6 +130,12 @@ private:
     /// Delete any baked files for assets removed from the local asset directory
     void cleanupBakedFilesForDeletedAssets();
 
+    /// Remove the file or chunk manifest for `hash`. Returns `true` if either was removed.
+    bool removeAssetFile(const AssetUtils::AssetHash& hash);
+
+    /// Reclaim chunks no longer referenced by any manifest, on the transfer pool
+    void collectChunkGarbage();
+
     QString getPathToAssetHash(const AssetUtils::AssetHash& assetHash);
 
     std::pair<AssetUtils::BakingStatus, QString> getAssetStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
@@ -148,11 +159,23 @@ private:
     /// Remove baked paths when the original asset is deleteds
     void removeBakedPathsForDeletedAsset(AssetUtils::AssetHash originalAssetHash);
 
-    AssetUtils::Mappings _fileMappings;
+    AssetMappingStore _fileMappings;
+
+    /// Parsed meta files, keyed by the hash of the meta file itself. Meta files are content addressed,
+    /// so an entry can never go stale; a rewritten meta file simply gets a new hash. The least recently
+    /// read entries are dropped past MAX_CACHED_META_FILES, and deleted meta files are dropped right away.
+    static const int MAX_CACHED_META_FILES = 10000;
+    QCache<AssetUtils::AssetHash, AssetMeta> _metaFileCache { MAX_CACHED_META_FILES };
 
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Optional content-defined chunk store. It exists whenever there are chunked assets to serve,
+    /// new uploads only go to it while it is enabled in the domain settings.
+    std::shared_ptr<AssetChunkStore> _chunkStore;
+    bool _isChunkStoreEnabled { false };
+    QTimer _chunkGarbageCollectionTimer;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
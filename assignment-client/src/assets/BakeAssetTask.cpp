@@ -16,6 +16,7 @@
 #include <QtCore/QThread>
 #include <QCoreApplication>
 
+#include <AssetChunkStore.h>
 #include <PathUtils.h>
 
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
@@ -24,10 +25,12 @@ static const int OVEN_STATUS_CODE_ABORT { 2 };
 
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             std::shared_ptr<AssetChunkStore> chunkStore) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _chunkStore(chunkStore)
 {
 
     std::call_once(registerMetaTypesFlag, []() {
@@ -55,7 +58,13 @@ void BakeAssetTask::run() {
     // Copy file to bake the temporary dir and give a name the oven can work with
     auto assetName = _assetPath.split("/").last();
     auto tempAssetPath = tempOutputDir + "/" + assetName;
-    auto success = QFile::copy(_filePath, tempAssetPath);
+    bool success;
+    if (_chunkStore && !QFile::exists(_filePath)) {
+        // chunked assets have no file of their own, reassemble one for the oven
+        success = _chunkStore->copyAssetToFile(_assetHash, tempAssetPath);
+    } else {
+        success = QFile::copy(_filePath, tempAssetPath);
+    }
     if (!success) {
         QString errors = "Couldn't copy file to bake to temporary directory";
         emit bakeFailed(_assetHash, _assetPath, errors);
@@ -22,15 +22,18 @@
 #include <NodeList.h>
 #include <udt/Packet.h>
 
+#include "AssetChunkStore.h"
 #include "AssetUtils.h"
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             std::shared_ptr<AssetChunkStore> chunkStore) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _chunkStore(chunkStore)
 {
     
 }
@@ -105,6 +108,30 @@ void SendAssetTask::run() {
                 qCDebug(networking) << "Sending asset: " << hexHash;
             }
             file.close();
+        } else if (_chunkStore && _chunkStore->hasAsset(hexHash)) {
+            auto assetSize = _chunkStore->getAssetSize(hexHash);
+            byteRange.fixupRange(assetSize);
+
+            if (assetSize < byteRange.fromInclusive || assetSize < byteRange.toExclusive) {
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
+                qCDebug(networking) << "Bad byte range: " << hexHash << " "
+                    << byteRange.fromInclusive << ":" << byteRange.toExclusive;
+            } else {
+                // a negative range reads back from the end of the asset, same as for whole files
+                auto offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : assetSize + byteRange.fromInclusive;
+                auto size = byteRange.size();
+                auto data = _chunkStore->readRange(hexHash, offset, size);
+
+                if (data.size() == size) {
+                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                    replyPacketList->writePrimitive(size);
+                    replyPacketList->write(data);
+                    qCDebug(networking) << "Sending chunked asset: " << hexHash;
+                } else {
+                    qCDebug(networking) << "Failed to read chunked asset: " << hexHash;
+                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
+                }
+            }
         } else {
             qCDebug(networking) << "Asset not found: " << filePath << "(" << hexHash << ")";
             replyPacketList->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
@@ -12,6 +12,8 @@
 #ifndef hifi_SendAssetTask_h
 #define hifi_SendAssetTask_h
 
+#include <memory>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QString>
@@ -21,11 +23,13 @@
 #include "AssetServer.h"
 #include "Node.h"
 
+class AssetChunkStore;
 class NLPacket;
 
 class SendAssetTask : public QRunnable {
 public:
-    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir);
+    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                  std::shared_ptr<AssetChunkStore> chunkStore = nullptr);
 
     void run() override;
 
@@ -33,6 +37,7 @@ private:
     QSharedPointer<ReceivedMessage> _message;
     SharedNodePointer _senderNode;
     QDir _resourcesDir;
+    std::shared_ptr<AssetChunkStore> _chunkStore;
 };
 
 #endif
@@ -14,18 +14,24 @@
 #include <QtCore/QBuffer>
 #include <QtCore/QFile>
 
+#include <AssetChunkStore.h>
 #include <AssetUtils.h>
 #include <NodeList.h>
 #include <NLPacketList.h>
 
 #include "ClientServerUtils.h"
 
+// feed the chunk store in slices so the whole-asset hash is computed while chunks are cut, without a second copy
+static const qint64 CHUNK_STORE_FEED_SIZE = 64 * 1024;
+
 UploadAssetTask::UploadAssetTask(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode,
-                                 const QDir& resourcesDir, uint64_t filesizeLimit) :
+                                 const QDir& resourcesDir, uint64_t filesizeLimit,
+                                 std::shared_ptr<AssetChunkStore> chunkStore) :
     _receivedMessage(receivedMessage),
     _senderNode(senderNode),
     _resourcesDir(resourcesDir),
-    _filesizeLimit(filesizeLimit)
+    _filesizeLimit(filesizeLimit),
+    _chunkStore(chunkStore)
 {
     
 }
@@ -54,58 +60,23 @@ void UploadAssetTask::run() {
     if (fileSize > _filesizeLimit) {
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetTooLarge);
     } else {
-        QByteArray fileData = buffer.read(fileSize);
-        
-        auto hash = AssetUtils::hashData(fileData);
-        auto hexHash = hash.toHex();
+        QByteArray hash;
+        bool success;
 
-        if (_senderNode) {
-            qDebug() << "Hash for uploaded file from" << uuidStringWithoutCurlyBraces(_senderNode->getUUID()) << "is: (" << hexHash << ")";
+        if (_chunkStore) {
+            auto available = (uint64_t)(data.size() - buffer.pos());
+            success = available >= fileSize && writeToChunkStore(data.constData() + buffer.pos(), fileSize, hash);
         } else {
-            qDebug() << "Hash for uploaded file from" << _receivedMessage->getSenderSockAddr() << "is: (" << hexHash << ")";
-        }
-        
-        QFile file { _resourcesDir.filePath(QString(hexHash)) };
-
-        bool existingCorrectFile = false;
-        
-        if (file.exists()) {
-            // check if the local file has the correct contents, otherwise we overwrite
-            if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
-                qDebug() << "Not overwriting existing verified file: " << hexHash;
-
-                existingCorrectFile = true;
-
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
-                replyPacket->write(hash);
-            } else {
-                qDebug() << "Overwriting an existing file whose contents did not match the expected hash: " << hexHash;
-                file.close();
-            }
+            QByteArray fileData = buffer.read(fileSize);
+            success = (uint64_t)fileData.size() == fileSize && writeToFile(fileData, hash);
         }
 
-        if (!existingCorrectFile) {
-            if (file.open(QIODevice::WriteOnly) && file.write(fileData) == qint64(fileSize)) {
-                qDebug() << "Wrote file" << hexHash << "to disk. Upload complete";
-                file.close();
-
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
-                replyPacket->write(hash);
-            } else {
-                qWarning() << "Failed to upload or write to file" << hexHash << " - upload failed.";
-
-                // upload has failed - remove the file and return an error
-                auto removed = file.remove();
-
-                if (!removed) {
-                    qWarning() << "Removal of failed upload file" << hexHash << "failed.";
-                }
-                
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
-            }
+        if (success) {
+            replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+            replyPacket->write(hash);
+        } else {
+            replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
         }
-
-
     }
     
     auto nodeList = DependencyManager::get<NodeList>();
@@ -115,3 +86,69 @@ void UploadAssetTask::run() {
         nodeList->sendPacket(std::move(replyPacket), _receivedMessage->getSenderSockAddr());
     }
 }
+
+bool UploadAssetTask::writeToChunkStore(const char* fileData, uint64_t fileSize, QByteArray& hash) {
+    AssetChunkStore::Writer writer { *_chunkStore };
+
+    for (uint64_t offset = 0; offset < fileSize; offset += CHUNK_STORE_FEED_SIZE) {
+        auto sliceSize = std::min<qint64>(CHUNK_STORE_FEED_SIZE, fileSize - offset);
+        if (!writer.addData(fileData + offset, sliceSize)) {
+            qWarning() << "Failed to write uploaded data to the chunk store - upload failed.";
+            return false;
+        }
+    }
+
+    hash = writer.finish();
+    if (hash.isEmpty()) {
+        qWarning() << "Failed to commit upload to the chunk store - upload failed.";
+        return false;
+    }
+
+    if (_senderNode) {
+        qDebug() << "Hash for uploaded file from" << uuidStringWithoutCurlyBraces(_senderNode->getUUID()) << "is: (" << hash.toHex() << ")";
+    } else {
+        qDebug() << "Hash for uploaded file from" << _receivedMessage->getSenderSockAddr() << "is: (" << hash.toHex() << ")";
+    }
+    qDebug() << "Stored" << hash.toHex() << "in the chunk store. Upload complete";
+    return true;
+}
+
+bool UploadAssetTask::writeToFile(const QByteArray& fileData, QByteArray& hash) {
+    hash = AssetUtils::hashData(fileData);
+    auto hexHash = hash.toHex();
+
+    if (_senderNode) {
+        qDebug() << "Hash for uploaded file from" << uuidStringWithoutCurlyBraces(_senderNode->getUUID()) << "is: (" << hexHash << ")";
+    } else {
+        qDebug() << "Hash for uploaded file from" << _receivedMessage->getSenderSockAddr() << "is: (" << hexHash << ")";
+    }
+    
+    QFile file { _resourcesDir.filePath(QString(hexHash)) };
+
+    if (file.exists()) {
+        // check if the local file has the correct contents, otherwise we overwrite
+        if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
+            qDebug() << "Not overwriting existing verified file: " << hexHash;
+            return true;
+        } else {
+            qDebug() << "Overwriting an existing file whose contents did not match the expected hash: " << hexHash;
+            file.close();
+        }
+    }
+
+    if (file.open(QIODevice::WriteOnly) && file.write(fileData) == fileData.size()) {
+        qDebug() << "Wrote file" << hexHash << "to disk. Upload complete";
+        file.close();
+        return true;
+    }
+
+    qWarning() << "Failed to upload or write to file" << hexHash << " - upload failed.";
+
+    // upload has failed - remove the file and return an error
+    auto removed = file.remove();
+
+    if (!removed) {
+        qWarning() << "Removal of failed upload file" << hexHash << "failed.";
+    }
+    return false;
+}
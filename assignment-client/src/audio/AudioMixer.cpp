@@ -416,6 +416,8 @@ void AudioMixer::start() {
         parseSettingsObject(settingsObject);
     }
 
+    _workerSharedData.packetLatencyUsecs = &_packetLatencyUsecs;
+
     // mix state
     unsigned int frame = 1;
 
@@ -428,6 +430,7 @@ void AudioMixer::start() {
             auto timer = _checkTimeTiming.timer();
             auto frameDuration = timeFrame();
             throttle(frameDuration, frame);
+            _frameUsecs.record(frameDuration.count());
         }
 
         auto frameTimer = _frameTiming.timer();
@@ -461,11 +464,13 @@ void AudioMixer::start() {
         if (_throttlingRatio > EPSILON) {
             numToRetain = nodeList->size() * (1.0f - _throttlingRatio);
         }
+        auto mixStart = p_high_resolution_clock::now();
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
             _slavePool.mix(cbegin, cend, frame, numToRetain);
         });
+        _mixUsecs.record(chrono::duration_cast<chrono::microseconds>(p_high_resolution_clock::now() - mixStart).count());
 
         // gather stats
         _slavePool.each([&](AudioMixerSlave& slave) {
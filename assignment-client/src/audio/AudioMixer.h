@@ -138,6 +138,11 @@ private:
     Timer _eventsTiming;
     Timer _packetsTiming;
 
+    MetricHistogram& _frameUsecs { getMetrics().histogram("frame_usecs", "Time spent on each mix frame, not counting sleep") };
+    MetricHistogram& _mixUsecs { getMetrics().histogram("mix_usecs", "Time spent mixing and sending each frame") };
+    MetricHistogram& _packetLatencyUsecs {
+        getMetrics().histogram("packet_latency_usecs", "Time from receiving an audio packet to processing it") };
+
     static int _numStaticJitterFrames; // -1 denotes dynamic jitter buffering
     static float _noiseMutingThreshold;
     static float _attenuationPerDoublingInDistance;
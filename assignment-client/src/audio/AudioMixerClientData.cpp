@@ -57,14 +57,23 @@ void AudioMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message,
     _packetQueue.push(message);
 }
 
-int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
+int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams, MetricHistogram* packetLatencyUsecs) {
     SharedNodePointer node = _packetQueue.node;
     assert(_packetQueue.empty() || node);
     _packetQueue.node.clear();
 
+    // taken once, packets queued while we drain can be newer than this
+    quint64 now = _packetQueue.empty() ? 0 :
+        std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+
     while (!_packetQueue.empty()) {
         auto& packet = _packetQueue.front();
 
+        if (packetLatencyUsecs) {
+            quint64 receiveTime = packet->getFirstPacketReceiveTime();
+            packetLatencyUsecs->record(now > receiveTime ? now - receiveTime : 0);
+        }
+
         switch (packet->getType()) {
             case PacketType::MicrophoneAudioNoEcho:
             case PacketType::MicrophoneAudioWithEcho:
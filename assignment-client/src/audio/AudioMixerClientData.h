@@ -24,6 +24,7 @@
 #include <AABox.h>
 #include <AudioHRTF.h>
 #include <AudioLimiter.h>
+#include <MetricsRegistry.h>
 #include <UUIDHasher.h>
 
 #include <plugins/Forward.h>
@@ -53,7 +54,8 @@ public:
     using AudioStreamVector = std::vector<SharedStreamPointer>;
 
     void queuePacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer node);
-    int processPackets(ConcurrentAddedStreams& addedStreams); // returns the number of available streams this frame
+    // returns the number of available streams this frame, records how long each packet waited in packetLatencyUsecs
+    int processPackets(ConcurrentAddedStreams& addedStreams, MetricHistogram* packetLatencyUsecs);
 
     AudioStreamVector& getAudioStreams() { return _audioStreams; }
     AvatarAudioStream* getAvatarAudioStream();
@@ -59,7 +59,7 @@ void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
     if (data) {
         // process packets and collect the number of streams available for this frame
-        stats.sumStreams += data->processPackets(_sharedData.addedStreams);
+        stats.sumStreams += data->processPackets(_sharedData.addedStreams, _sharedData.packetLatencyUsecs);
     }
 }
 
@@ -39,6 +39,7 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        MetricHistogram* packetLatencyUsecs { nullptr };
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -62,6 +62,8 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
     ThreadedAssignment(message),
     _slavePool(&_slaveSharedData)
 {
+    _slaveSharedData.packetLatencyUsecs = &_packetLatencyUsecs;
+
     DependencyManager::registerInheritance<EntityDynamicFactoryInterface, AssignmentDynamicFactory>();
     DependencyManager::set<AssignmentDynamicFactory>();
     DependencyManager::set<ModelFormatRegistry>();
@@ -265,6 +267,7 @@ void AvatarMixer::start() {
 
         auto frameDuration = timeFrame(frameTimestamp); // calculates last frame duration and sleeps remainder of target amount
         throttle(frameDuration, frame); // determines _throttlingRatio for upcoming mix frame
+        _frameUsecs.record(frameDuration.count());
 
         int lockWait, nodeTransform, functor;
 
@@ -341,6 +344,7 @@ void AvatarMixer::start() {
             }, &lockWait, &nodeTransform, &functor);
             auto end = usecTimestampNow();
             _broadcastAvatarDataElapsedTime += (end - start);
+            _broadcastUsecs.record(end - start);
 
             _broadcastAvatarDataLockWait += lockWait;
             _broadcastAvatarDataNodeTransform += nodeTransform;
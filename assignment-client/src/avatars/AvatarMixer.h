@@ -151,6 +151,12 @@ private:
 
     RateCounter<> _loopRate; // this is the rate that the main thread tight loop runs
 
+    MetricHistogram& _frameUsecs { getMetrics().histogram("frame_usecs", "Time spent on each frame, not counting sleep") };
+    MetricHistogram& _broadcastUsecs {
+        getMetrics().histogram("broadcast_usecs", "Time spent sending avatar data to every node each frame") };
+    MetricHistogram& _packetLatencyUsecs {
+        getMetrics().histogram("packet_latency_usecs", "Time from receiving an avatar packet to processing it") };
+
     AvatarMixerSlavePool _slavePool;
     SlaveSharedData _slaveSharedData;
 };
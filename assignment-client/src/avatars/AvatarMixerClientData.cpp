@@ -15,6 +15,7 @@
 #include <udt/PacketHeaders.h>
 
 #include <DependencyManager.h>
+#include <MetricsRegistry.h>
 #include <NodeList.h>
 #include <EntityTree.h>
 #include <ZoneEntityItem.h>
@@ -58,11 +59,20 @@ int AvatarMixerClientData::processPackets(const SlaveSharedData& slaveSharedData
     assert(_packetQueue.empty() || node);
     _packetQueue.node.clear();
 
+    // taken once, packets queued while we drain can be newer than this
+    quint64 now = _packetQueue.empty() ? 0 :
+        std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+
     while (!_packetQueue.empty()) {
         auto& packet = _packetQueue.front();
 
         packetsProcessed++;
 
+        if (slaveSharedData.packetLatencyUsecs) {
+            quint64 receiveTime = packet->getFirstPacketReceiveTime();
+            slaveSharedData.packetLatencyUsecs->record(now > receiveTime ? now - receiveTime : 0);
+        }
+
         switch (packet->getType()) {
             case PacketType::AvatarData:
                 parseData(*packet, slaveSharedData);
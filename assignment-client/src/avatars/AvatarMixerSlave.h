@@ -95,11 +95,13 @@ public:
 
 class EntityTree;
 using EntityTreePointer = std::shared_ptr<EntityTree>;
+class MetricHistogram;
 
 struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    MetricHistogram* packetLatencyUsecs { nullptr };
 };
 
 class AvatarMixerSlave {
@@ -11,12 +11,15 @@
 
 #include "MessagesMixer.h"
 
+#include <algorithm>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonObject>
 #include <QBuffer>
 #include <LogHandler.h>
 #include <MessagesClient.h>
 #include <NodeList.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 
 const QString MESSAGES_MIXER_LOGGING_NAME = "messages-mixer";
@@ -35,59 +38,84 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    auto localID = killedNode->getLocalID();
+    for (auto& channel : _channels) {
+        auto& subscribers = channel.subscribers;
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), localID), subscribers.end());
     }
 }
 
 void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
+    QString channelName, message;
     QByteArray data;
     QUuid senderID;
     bool isText;
     auto senderUUID = senderNode->getUUID();
-    MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+    MessagesClient::decodeMessagesPacket(receivedMessage, channelName, isText, message, data, senderID);
 
     auto nodeList = DependencyManager::get<NodeList>();
 
+    auto channel = _channels.find(channelName);
+
     auto itr = _allSubscribers.find(senderUUID);
     if (itr == _allSubscribers.end()) {
         _allSubscribers[senderUUID] = 1;
     } else if (*itr >= _maxMessagesPerSecond) {
+        if (channel != _channels.end()) {
+            ++channel->numDropped;
+        }
         return;
     } else {
         *itr += 1;
     }
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
+    if (channel == _channels.end()) {
+        return;
+    }
+    ++channel->numMessages;
+    channel->numBytes += receivedMessage->getSize();
+
+    // every recipient needs its own reliable packet list, but they can all copy the same payload
+    QByteArray payload;
+    for (auto localID : channel->subscribers) {
+        auto node = nodeList->nodeWithLocalID(localID);
+        if (!node || !node->getActiveSocket()) {
+            ++channel->numUndeliverable;
+            continue;
+        }
+        if (payload.isEmpty()) {
+            payload = MessagesClient::encodeMessagesPayload(channelName, isText, isText ? message.toUtf8() : data, senderID);
+        }
+        auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+        packetList->write(payload);
         nodeList->sendPacketList(std::move(packetList), *node);
-    });
+        ++channel->numSent;
+    }
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto senderUUID = senderNode->getUUID();
-    QString channel = QString::fromUtf8(message->getMessage());
+    auto localID = senderNode->getLocalID();
+    QString channelName = QString::fromUtf8(message->getMessage());
 
-    _channelSubscribers[channel] << senderUUID;
+    auto& subscribers = _channels[channelName].subscribers;
+    if (std::find(subscribers.begin(), subscribers.end(), localID) == subscribers.end()) {
+        subscribers.push_back(localID);
+    }
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto senderUUID = senderNode->getUUID();
-    QString channel = QString::fromUtf8(message->getMessage());
+    auto localID = senderNode->getLocalID();
+    QString channelName = QString::fromUtf8(message->getMessage());
 
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderUUID);
+    auto channel = _channels.find(channelName);
+    if (channel != _channels.end()) {
+        auto& subscribers = channel->subscribers;
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), localID), subscribers.end());
     }
 }
 
 void MessagesMixer::sendStatsPacket() {
-    QJsonObject statsObject, messagesMixerObject;
+    QJsonObject statsObject, messagesMixerObject, channelsObject;
 
     // add stats for each listerner
     DependencyManager::get<NodeList>()->eachNode([&](const SharedNodePointer& node) {
@@ -98,7 +126,36 @@ void MessagesMixer::sendStatsPacket() {
         messagesMixerObject[uuidStringWithoutCurlyBraces(node->getUUID())] = clientStats;
     });
 
+    // add stats for each channel with subscribers or traffic since the last stats packet, and forget the rest
+    float secondsSinceLastStats = (float)_channelStatsTimer.restart() / MSECS_PER_SECOND;
+    auto channel = _channels.begin();
+    while (channel != _channels.end()) {
+        if (channel->subscribers.empty() && channel->numMessages == 0 && channel->numDropped == 0) {
+            channel = _channels.erase(channel);
+            continue;
+        }
+
+        QJsonObject channelStats;
+        channelStats["subscribers"] = (int)channel->subscribers.size();
+        if (secondsSinceLastStats > 0.0f) {
+            channelStats["messages_per_second"] = channel->numMessages / secondsSinceLastStats;
+            channelStats["inbound_kbps"] = channel->numBytes * BITS_IN_BYTE / BYTES_PER_KILOBYTE / secondsSinceLastStats;
+            channelStats["sent_per_second"] = channel->numSent / secondsSinceLastStats;
+            channelStats["dropped_per_second"] = channel->numDropped / secondsSinceLastStats;
+            channelStats["undeliverable_per_second"] = channel->numUndeliverable / secondsSinceLastStats;
+        }
+        channelsObject[channel.key()] = channelStats;
+
+        channel->numMessages = 0;
+        channel->numBytes = 0;
+        channel->numSent = 0;
+        channel->numDropped = 0;
+        channel->numUndeliverable = 0;
+        ++channel;
+    }
+
     statsObject["messages"] = messagesMixerObject;
+    statsObject["channels"] = channelsObject;
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
@@ -110,6 +167,8 @@ void MessagesMixer::run() {
 
     ThreadedAssignment::commonInit(MESSAGES_MIXER_LOGGING_NAME, NodeType::MessagesMixer);
 
+    _channelStatsTimer.start();
+
     startMaxMessagesProcessor();
 }
 
@@ -15,6 +15,10 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+
 #include <ThreadedAssignment.h>
 
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
@@ -40,13 +44,26 @@ private slots:
     void processMaxMessagesContainer();
 
 private:
-    QHash<QString, QSet<QUuid>> _channelSubscribers;
+    struct Channel {
+        std::vector<Node::LocalID> subscribers;
+
+        // since the last stats packet
+        quint64 numMessages { 0 };
+        quint64 numBytes { 0 };
+        quint64 numSent { 0 };
+        quint64 numDropped { 0 }; // over the sender's rate limit
+        quint64 numUndeliverable { 0 }; // subscribers without an active socket
+    };
+
+    // looked up once per message, then its subscribers are sent the message without going through every node
+    QHash<QString, Channel> _channels;
     QHash<QUuid, int> _allSubscribers;
 
     const int DEFAULT_NODE_MESSAGES_PER_SECOND = 1000;
     int _maxMessagesPerSecond { 0 };
 
     QTimer* _maxMessagesTimer { nullptr };
+    QElapsedTimer _channelStatsTimer;
 };
 
 #endif // hifi_MessagesMixer_h
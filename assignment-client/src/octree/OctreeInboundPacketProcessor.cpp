@@ -31,6 +31,9 @@ OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServe
     _totalLockWaitTime(0),
     _totalElementsInPacket(0),
     _totalPackets(0),
+    _transitUsecs(myServer->getMetrics().histogram("edit_transit_usecs", "Time from sending an edit packet to receiving it")),
+    _editLockWaitUsecs(myServer->getMetrics().histogram("edit_lock_wait_usecs", "Time each edit waited for the tree lock")),
+    _editProcessUsecs(myServer->getMetrics().histogram("edit_process_usecs", "Time spent applying each edit to the tree")),
     _lastNackTime(usecTimestampNow()),
     _shuttingDown(false)
 {
@@ -125,6 +128,7 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
         }
 
         quint64 transitTime = arrivedAt - sentAt;
+        _transitUsecs.record(transitTime);
         int editsInPacket = 0;
         quint64 processTime = 0;
         quint64 lockWaitTime = 0;
@@ -189,6 +193,8 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
             quint64 thisLockWaitTime = startProcess - startLock;
             processTime += thisProcessTime;
             lockWaitTime += thisLockWaitTime;
+            _editProcessUsecs.record(thisProcessTime);
+            _editLockWaitUsecs.record(thisLockWaitTime);
 
             // skip to next edit record in the packet
             message->seek(message->getPosition() + editDataBytesRead);
@@ -18,6 +18,7 @@
 
 #include "SequenceNumberStats.h"
 
+class MetricHistogram;
 class OctreeServer;
 
 class SingleSenderStats {
@@ -99,6 +100,10 @@ private:
     std::atomic<uint64_t> _totalLockWaitTime;
     std::atomic<uint64_t> _totalElementsInPacket;
     std::atomic<uint64_t> _totalPackets;
+
+    MetricHistogram& _transitUsecs;
+    MetricHistogram& _editLockWaitUsecs;
+    MetricHistogram& _editProcessUsecs;
     
     NodeToSenderStatsMap _singleSenderStats;
     QReadWriteLock _senderStatsLock;
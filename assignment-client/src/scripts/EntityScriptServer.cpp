@@ -21,6 +21,7 @@
 #include <EntityScriptingInterface.h>
 #include <LogHandler.h>
 #include <MessagesClient.h>
+#include <NumericalConstants.h>
 #include <plugins/CodecPlugin.h>
 #include <plugins/PluginManager.h>
 #include <ResourceManager.h>
@@ -54,7 +55,35 @@ void messageHandler(QtMsgType type, const QMessageLogContext& context, const QSt
 
 int EntityScriptServer::_entitiesScriptEngineCount = 0;
 
-EntityScriptServer::EntityScriptServer(ReceivedMessage& message) : ThreadedAssignment(message) {
+static const int MAX_SCRIPT_SHARDS = 64;
+static const int NUM_REPORTED_SCRIPT_TIMINGS = 10;
+
+// Routes calls coming through the EntityScriptingInterface to the engine that owns the entity's script
+class ShardedEntitiesScriptEngineProvider : public EntitiesScriptEngineProvider {
+public:
+    ShardedEntitiesScriptEngineProvider(const std::vector<ScriptEnginePointer>& engines) : _engines(engines) {}
+
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params, const QUuid& remoteCallerID) override {
+        getEngine(entityID)->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    }
+
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override {
+        return getEngine(entityID)->getLocalEntityScriptDetails(entityID);
+    }
+
+private:
+    const ScriptEnginePointer& getEngine(const EntityItemID& entityID) const {
+        return _engines[qHash(entityID) % _engines.size()];
+    }
+
+    std::vector<ScriptEnginePointer> _engines;
+};
+
+EntityScriptServer::EntityScriptServer(ReceivedMessage& message) :
+    ThreadedAssignment(message),
+    _entityTreeUpdateTimer(this)
+{
     qInstallMessageHandler(messageHandler);
 
     DependencyManager::registerInheritance<EntityDynamicFactoryInterface, AssignmentDynamicFactory>();
@@ -130,7 +159,8 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
+        auto scriptEngine = getEntitiesScriptEngine(entityID);
+        if (scriptEngine && scriptEngine->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -172,10 +202,41 @@ void EntityScriptServer::handleSettings() {
 
     qDebug() << QString("Received entity script server settings, Max Entity PPS: %1, Entity PPS Per Entity Script: %2")
                 .arg(_maxEntityPPS).arg(_entityPPSPerScript);
+
+    static const QString SCRIPT_SHARDS_OPTION = "script_shards";
+    int numScriptShards = std::min(std::max(1, entityScriptServerSettings[SCRIPT_SHARDS_OPTION].toInt(1)), MAX_SCRIPT_SHARDS);
+
+    if (numScriptShards != _numScriptShards && !_shuttingDown) {
+        qCInfo(entity_script_server) << "Running entity scripts on" << numScriptShards << "script engines";
+
+        // remember what was running so it can be loaded again, on whichever shard now owns it
+        QList<EntityItemID> runningEntityIDs;
+        for (const auto& scriptEngine : _entitiesScriptEngines) {
+            runningEntityIDs += scriptEngine->getListOfEntityScriptIDs();
+            scriptEngine->unloadAllEntityScripts();
+            scriptEngine->stop();
+            scriptEngine->waitTillDoneRunning();
+        }
+
+        _numScriptShards = numScriptShards;
+        resetEntitiesScriptEngines();
+
+        for (const auto& entityID : runningEntityIDs) {
+            checkAndCallPreload(entityID);
+        }
+    }
+}
+
+int EntityScriptServer::getNumRunningEntityScripts() const {
+    int numRunningScripts = 0;
+    for (const auto& scriptEngine : _entitiesScriptEngines) {
+        numRunningScripts += scriptEngine->getNumRunningEntityScripts();
+    }
+    return numRunningScripts;
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptEngine->getNumRunningEntityScripts();
+    int numRunningScripts = getNumRunningEntityScripts();
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -236,7 +297,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptEngine && _entityViewer.getTree() && !_shuttingDown) {
+    if (!_entitiesScriptEngines.empty() && _entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -250,7 +311,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptEngine->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        getEntitiesScriptEngine(entityID)->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -281,8 +342,8 @@ void EntityScriptServer::run() {
         NodeType::EntityServer, NodeType::MessagesMixer, NodeType::AssetServer
     });
 
-    // Setup Script Engine
-    resetEntitiesScriptEngine();
+    // Setup Script Engines
+    resetEntitiesScriptEngines();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     entityScriptingInterface->init();
@@ -319,6 +380,19 @@ void EntityScriptServer::run() {
     connect(tree, &EntityTree::deletingEntity, this, &EntityScriptServer::deletingEntity, Qt::QueuedConnection);
     connect(tree, &EntityTree::addingEntity, this, &EntityScriptServer::addingEntity, Qt::QueuedConnection);
     connect(tree, &EntityTree::entityServerScriptChanging, this, &EntityScriptServer::entityServerScriptChanging, Qt::QueuedConnection);
+
+    // the tree is driven at the script frame rate from here, independent of how many engines there are
+    _entityTreeUpdateTimer.setInterval((int)(MSECS_PER_SECOND / SCRIPT_FPS));
+    connect(&_entityTreeUpdateTimer, &QTimer::timeout, this, &EntityScriptServer::updateEntityTree);
+    _entityTreeUpdateTimer.start();
+}
+
+void EntityScriptServer::updateEntityTree() {
+    if (_entityViewer.getTree() && !_shuttingDown) {
+        _entityViewer.queryOctree();
+        _entityViewer.getTree()->preUpdate();
+        _entityViewer.getTree()->update();
+    }
 }
 
 void EntityScriptServer::cleanupOldKilledListeners() {
@@ -444,7 +518,7 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
+ScriptEnginePointer EntityScriptServer::createEntitiesScriptEngine() {
     auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
     auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
 
@@ -461,59 +535,80 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
     connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
 
-    connect(newEngine.data(), &ScriptEngine::update, this, [this] {
-        _entityViewer.queryOctree();
-        _entityViewer.getTree()->preUpdate();
-        _entityViewer.getTree()->update();
-    });
+    newEngine->setEntityScriptTimingEnabled(true);
 
     scriptEngines->runScriptInitializers(newEngine);
     newEngine->runInThread();
-    auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
-    // On the entity script server, these are the same
-    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(newEngineSP);
-    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(newEngineSP);
 
-    if (_entitiesScriptEngine) {
-        disconnect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
+    connect(newEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
+            this, &EntityScriptServer::updateEntityPPS);
+
+    return newEngine;
+}
+
+void EntityScriptServer::resetEntitiesScriptEngines() {
+    for (const auto& oldEngine : _entitiesScriptEngines) {
+        disconnect(oldEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
                    this, &EntityScriptServer::updateEntityPPS);
     }
 
-    _entitiesScriptEngine.swap(newEngine);
-    connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    std::vector<ScriptEnginePointer> newEngines;
+    for (int i = 0; i < _numScriptShards; ++i) {
+        newEngines.push_back(createEntitiesScriptEngine());
+    }
+
+    // a single engine is its own provider, as it always was; shards need their calls routed
+    QSharedPointer<EntitiesScriptEngineProvider> provider;
+    if (newEngines.size() == 1) {
+        provider = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngines.front());
+    } else {
+        provider = QSharedPointer<ShardedEntitiesScriptEngineProvider>::create(newEngines);
+    }
+
+    // On the entity script server, these are the same
+    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(provider);
+    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(provider);
+
+    _entitiesScriptEngines.swap(newEngines);
 }
 
+ScriptEnginePointer EntityScriptServer::getEntitiesScriptEngine(const EntityItemID& entityID) const {
+    if (_entitiesScriptEngines.empty()) {
+        return ScriptEnginePointer();
+    }
+    return _entitiesScriptEngines[qHash(entityID) % _entitiesScriptEngines.size()];
+}
 
 void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptEngine) {
+    // unload and stop the engines
+    for (const auto& scriptEngine : _entitiesScriptEngines) {
         // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptEngine->unloadAllEntityScripts();
-        _entitiesScriptEngine->stop();
-        _entitiesScriptEngine->waitTillDoneRunning();
+        scriptEngine->unloadAllEntityScripts();
+        scriptEngine->stop();
+        scriptEngine->waitTillDoneRunning();
     }
 
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
-        resetEntitiesScriptEngine();
+        resetEntitiesScriptEngines();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptEngine) {
-        _entitiesScriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    for (const auto& scriptEngine : _entitiesScriptEngines) {
+        scriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
     }
     _shuttingDown = true;
+    _entityTreeUpdateTimer.stop();
 
     clear(); // always clear() on shutdown
 
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptEngine.clear();
+    _entitiesScriptEngines.clear();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -531,8 +626,8 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
-        _entitiesScriptEngine->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown && !_entitiesScriptEngines.empty()) {
+        getEntitiesScriptEngine(entityID)->unloadEntityScript(entityID, true);
     }
 }
 
@@ -543,20 +638,21 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
+    if (_entityViewer.getTree() && !_shuttingDown && !_entitiesScriptEngines.empty()) {
 
+        auto scriptEngine = getEntitiesScriptEngine(entityID);
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptEngine->getEntityScriptDetails(entityID, details);
+        bool isRunning = scriptEngine->getEntityScriptDetails(entityID, details);
         if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
             if (isRunning) {
-                _entitiesScriptEngine->unloadEntityScript(entityID, true);
+                scriptEngine->unloadEntityScript(entityID, true);
             }
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                scriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
             }
         }
     }
@@ -572,12 +668,47 @@ void EntityScriptServer::sendStatsPacket() {
     statsObject["octree_stats"] = octreeStats;
 
     QJsonObject scriptEngineStats;
-    int numberRunningScripts = 0;
-    const auto scriptEngine = _entitiesScriptEngine;
-    if (scriptEngine) {
-        numberRunningScripts = scriptEngine->getNumRunningEntityScripts();
+    scriptEngineStats["number_running_scripts"] = getNumRunningEntityScripts();
+    scriptEngineStats["number_script_shards"] = (int)_entitiesScriptEngines.size();
+
+    auto now = usecTimestampNow();
+    float statsPeriodSecs = _lastScriptTimingsUsecs > 0 ? (float)(now - _lastScriptTimingsUsecs) / USECS_PER_SECOND : 1.0f;
+    _lastScriptTimingsUsecs = now;
+
+    // report each shard's load and its most expensive scripts over the last stats period
+    QJsonObject shardsObject;
+    for (size_t i = 0; i < _entitiesScriptEngines.size(); ++i) {
+        const auto& scriptEngine = _entitiesScriptEngines[i];
+        auto timings = scriptEngine->takeEntityScriptTimings();
+
+        quint64 totalUsecs = 0;
+        std::vector<std::pair<EntityItemID, EntityScriptTiming>> sortedTimings;
+        sortedTimings.reserve(timings.size());
+        for (auto it = timings.cbegin(); it != timings.cend(); ++it) {
+            totalUsecs += it.value().usecs;
+            sortedTimings.emplace_back(it.key(), it.value());
+        }
+
+        auto numReported = std::min<size_t>(NUM_REPORTED_SCRIPT_TIMINGS, sortedTimings.size());
+        std::partial_sort(sortedTimings.begin(), sortedTimings.begin() + numReported, sortedTimings.end(),
+                          [](const auto& a, const auto& b) { return a.second.usecs > b.second.usecs; });
+
+        QJsonObject topScriptsObject;
+        for (size_t j = 0; j < numReported; ++j) {
+            QJsonObject scriptObject;
+            scriptObject["script_ms/s"] = (float)sortedTimings[j].second.usecs / USECS_PER_MSEC / statsPeriodSecs;
+            scriptObject["calls/s"] = (float)sortedTimings[j].second.calls / statsPeriodSecs;
+            topScriptsObject[uuidStringWithoutCurlyBraces(sortedTimings[j].first)] = scriptObject;
+        }
+
+        QJsonObject shardObject;
+        shardObject["number_running_scripts"] = scriptEngine->getNumRunningEntityScripts();
+        // the share of one core this shard spent inside entity scripts
+        shardObject["script_load_%"] = 100.0f * (float)totalUsecs / USECS_PER_SECOND / statsPeriodSecs;
+        shardObject["top_scripts"] = topScriptsObject;
+        shardsObject[QString("shard_%1").arg(i)] = shardObject;
     }
-    scriptEngineStats["number_running_scripts"] = numberRunningScripts;
+    scriptEngineStats["shards"] = shardsObject;
     statsObject["script_engine_stats"] = scriptEngineStats;
     
 
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include <QtCore/QObject>
+#include <QtCore/QTimer>
 #include <QtCore/QUuid>
 
 #include <EntityEditPacketSender.h>
@@ -61,7 +62,10 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    void resetEntitiesScriptEngines();
+    ScriptEnginePointer createEntitiesScriptEngine();
+    ScriptEnginePointer getEntitiesScriptEngine(const EntityItemID& entityID) const;
+    int getNumRunningEntityScripts() const;
     void clear();
     void shutdownScriptEngine();
 
@@ -71,14 +75,21 @@ private:
     void checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload = false);
 
     void cleanupOldKilledListeners();
+    void updateEntityTree();
 
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptEnginePointer _entitiesScriptEngine;
+
+    // Entity scripts are spread over these engines (each on its own thread) by a hash of the entity ID,
+    // so a slow script only delays the scripts that share its shard.
+    std::vector<ScriptEnginePointer> _entitiesScriptEngines;
+    int _numScriptShards { 1 };
+    quint64 _lastScriptTimingsUsecs { 0 };
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
+    QTimer _entityTreeUpdateTimer;
 
     int _maxEntityPPS { DEFAULT_MAX_ENTITY_PPS };
     int _entityPPSPerScript { DEFAULT_ENTITY_PPS_PER_SCRIPT };
@@ -791,6 +791,8 @@ void DomainServer::setupNodeListAndAssignments() {
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processPathQueryPacket));
     packetReceiver.registerListener(PacketType::NodeJsonStats,
         PacketReceiver::makeSourcedListenerReference<DomainServer>(this, &DomainServer::processNodeJSONStatsPacket));
+    packetReceiver.registerListener(PacketType::NodeMetrics,
+        PacketReceiver::makeSourcedListenerReference<DomainServer>(this, &DomainServer::processNodeMetricsPacket));
     packetReceiver.registerListener(PacketType::DomainDisconnectRequest,
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processNodeDisconnectRequestPacket));
     packetReceiver.registerListener(PacketType::AvatarZonePresence,
@@ -1134,9 +1136,17 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
         safeInterestSet.remove(NodeType::Agent);
     }
 
+    // a node whose interests changed hasn't been sent all the nodes it now wants, so it gets a full list
+    bool interestSetChanged = nodeData->getNodeInterestSet() != safeInterestSet;
+
     // update the NodeInterestSet in case there have been any changes
     nodeData->setNodeInterestSet(safeInterestSet);
 
+    nodeData->setDomainListVersion(interestSetChanged ? NodeRoster::NO_VERSION : nodeRequestData.domainListVersion);
+
+    // catch changes to what other nodes are sent about this one, whether from this check-in or elsewhere
+    updateRosterEntry(sendingNode);
+
     // update the connecting hostname in case it has changed
     nodeData->setPlaceName(nodeRequestData.placeName);
 
@@ -1220,6 +1230,7 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
         qDebug() << "Setting node to replicated: " << newNode->getUUID();
         newNode->setIsReplicated(true);
     }
+    updateRosterEntry(newNode);
 
     // send out this node to our other connected nodes
     broadcastNewNode(newNode);
@@ -1229,12 +1240,50 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
         NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
 
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
+    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+
+    // collect the entries first, the node needs to know how many make up the list before it can acknowledge it
+    std::vector<SharedNodePointer> addedNodes;
+    std::vector<QUuid> removedNodes;
+    NodeRoster::Version rosterVersion = NodeRoster::NO_VERSION;
+    NodeRoster::Version baseRosterVersion = NodeRoster::NO_VERSION;
+
+    // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
+    if (nodeInterestSet.size() > 0 && nodeData->isAuthenticated()) {
+        rosterVersion = _nodeRoster.getVersion();
+
+        std::vector<NodeRoster::Change> changes;
+        if (!newConnection && _nodeRoster.changesSince(nodeData->getDomainListVersion(), changes)) {
+            // only what changed since the last list this node received in full
+            baseRosterVersion = nodeData->getDomainListVersion();
+            for (const auto& change : changes) {
+                if (change.nodeID == node->getUUID() || !nodeInterestSet.contains(change.nodeType)) {
+                    continue;
+                }
+                if (change.removed) {
+                    removedNodes.push_back(change.nodeID);
+                } else if (auto otherNode = limitedNodeList->nodeWithUUID(change.nodeID)) {
+                    addedNodes.push_back(otherNode);
+                }
+            }
+        } else {
+            // if this authenticated node has any interest types, send back those nodes as well
+            limitedNodeList->eachNode([this, node, &addedNodes](const SharedNodePointer& otherNode) {
+                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
+                    addedNodes.push_back(otherNode);
+                }
+            });
+        }
+    }
+
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
     QByteArray extendedHeader(NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES, 0);
     QDataStream extendedHeaderStream(&extendedHeader, QIODevice::WriteOnly);
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
@@ -1246,35 +1295,19 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    NodeRoster::writeListHeader(extendedHeaderStream, { rosterVersion, baseRosterVersion, ++_numDomainListsSent,
+                                                        quint32(addedNodes.size() + removedNodes.size()) });
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
-
-    if (nodeInterestSet.size() > 0) {
-
-        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
-
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
-
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
-
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
-        }
+    for (const auto& otherNode : addedNodes) {
+        // pack the secret that these two nodes will use to communicate with each other along with the node
+        NodeRoster::writeNode(*domainListPackets, domainListStream, *otherNode, connectionSecretForNodes(node, otherNode));
+    }
+    for (const auto& removedNodeID : removedNodes) {
+        NodeRoster::writeRemovedNode(*domainListPackets, domainListStream, removedNodeID);
     }
 
     // send an empty list to the node, in case there were no other nodes
@@ -1344,6 +1377,22 @@ void DomainServer::broadcastNewNode(const SharedNodePointer& addedNode) {
     );
 }
 
+void DomainServer::updateRosterEntry(const SharedNodePointer& node) {
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    if (!nodeData) {
+        return;
+    }
+
+    QByteArray rosterEntry;
+    QDataStream rosterEntryStream(&rosterEntry, QIODevice::WriteOnly);
+    rosterEntryStream << *node;
+
+    if (rosterEntry != nodeData->getRosterEntry()) {
+        nodeData->setRosterEntry(rosterEntry);
+        _nodeRoster.nodeChanged(node->getUUID(), node->getType());
+    }
+}
+
 void DomainServer::processRequestAssignmentPacket(QSharedPointer<ReceivedMessage> message) {
     // construct the requested assignment from the packet data
     Assignment requestAssignment(*message);
@@ -1928,6 +1977,13 @@ void DomainServer::processNodeJSONStatsPacket(QSharedPointer<ReceivedMessage> pa
     }
 }
 
+void DomainServer::processNodeMetricsPacket(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer sendingNode) {
+    auto nodeData = static_cast<DomainServerNodeData*>(sendingNode->getLinkedData());
+    if (nodeData) {
+        nodeData->updateMetrics(packetList->getMessage());
+    }
+}
+
 QJsonObject DomainServer::jsonForSocket(const SockAddr& socket) {
     QJsonObject socketJSON;
 
@@ -3240,9 +3296,13 @@ bool DomainServer::isAssetServerEnabled() {
 void DomainServer::nodeAdded(SharedNodePointer node) {
     // we don't use updateNodeWithData, so add the DomainServerNodeData to the node here
     node->setLinkedData(std::unique_ptr<DomainServerNodeData> { new DomainServerNodeData() });
+
+    _nodeRoster.nodeChanged(node->getUUID(), node->getType());
 }
 
 void DomainServer::nodeKilled(SharedNodePointer node) {
+    _nodeRoster.nodeRemoved(node->getUUID(), node->getType());
+
     // if this peer connected via ICE then remove them from our ICE peers hash
     _gatekeeper.cleanupICEPeerForNode(node->getUUID());
 
@@ -27,6 +27,7 @@
 #include <Assignment.h>
 #include <HTTPSConnection.h>
 #include <LimitedNodeList.h>
+#include <NodeRoster.h>
 
 #include "AssetsBackupHandler.h"
 #include "DomainGatekeeper.h"
@@ -97,6 +98,7 @@ private slots:
     void processRequestAssignmentPacket(QSharedPointer<ReceivedMessage> packet);
     void processListRequestPacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer sendingNode);
     void processNodeJSONStatsPacket(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer sendingNode);
+    void processNodeMetricsPacket(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer sendingNode);
     void processPathQueryPacket(QSharedPointer<ReceivedMessage> packet);
     void processNodeDisconnectRequestPacket(QSharedPointer<ReceivedMessage> message);
     void processICEServerHeartbeatDenialPacket(QSharedPointer<ReceivedMessage> message);
@@ -192,6 +194,7 @@ private:
 
     QUuid connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
     void broadcastNewNode(const SharedNodePointer& node);
+    void updateRosterEntry(const SharedNodePointer& node);
 
     void parseAssignmentConfigs(QSet<Assignment::Type>& excludedTypes);
     void addStaticAssignmentToAssignmentHash(Assignment* newAssignment);
@@ -243,6 +246,9 @@ private:
     DomainGatekeeper _gatekeeper;
     DomainServerExporter _exporter;
 
+    NodeRoster _nodeRoster;
+    quint32 _numDomainListsSent { 0 };
+
     HTTPManager _httpManager;
     HTTPManager* _httpExporterManager { nullptr };
     HTTPManager* _httpMetadataExporterManager { nullptr };
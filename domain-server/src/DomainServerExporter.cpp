@@ -238,6 +238,12 @@ static const QMap<QString, DomainServerExporter::MetricType> TYPE_MAP {
     { "entity_server_io_stats_outbound_kbps"                                                      , DomainServerExporter::MetricType::Gauge },
     { "entity_server_io_stats_outbound_pps"                                                       , DomainServerExporter::MetricType::Gauge },
     { "messages_mixer_assignment_stats_num_queued_check_ins"                                      , DomainServerExporter::MetricType::Gauge },
+    { "messages_mixer_channels_dropped_per_second"                                                , DomainServerExporter::MetricType::Gauge },
+    { "messages_mixer_channels_inbound_kbps"                                                      , DomainServerExporter::MetricType::Gauge },
+    { "messages_mixer_channels_messages_per_second"                                               , DomainServerExporter::MetricType::Gauge },
+    { "messages_mixer_channels_sent_per_second"                                                   , DomainServerExporter::MetricType::Gauge },
+    { "messages_mixer_channels_subscribers"                                                       , DomainServerExporter::MetricType::Gauge },
+    { "messages_mixer_channels_undeliverable_per_second"                                          , DomainServerExporter::MetricType::Gauge },
     { "messages_mixer_io_stats_inbound_kbps"                                                      , DomainServerExporter::MetricType::Gauge },
     { "messages_mixer_io_stats_inbound_pps"                                                       , DomainServerExporter::MetricType::Gauge },
     { "messages_mixer_io_stats_outbound_kbps"                                                     , DomainServerExporter::MetricType::Gauge },
@@ -285,6 +291,12 @@ static const QSet<QString> BLACKLIST = {
     "messages_mixer_messages_username"                          // Username
 };
 
+// Objects whose keys are names chosen by users rather than stats, such as messages channels. The metrics inside them
+// are exported once, with the key as a label.
+static const QMap<QString, QString> LABEL_OBJECTS = {
+    { "messages_mixer_channels", "channel" }
+};
+
 DomainServerExporter::DomainServerExporter() {
 }
 
@@ -343,7 +355,8 @@ QString DomainServerExporter::escapeName(const QString& name) {
 }
 
 void DomainServerExporter::generateMetricsForNode(QTextStream& stream, const SharedNodePointer& node) {
-    QJsonObject statsObject = static_cast<DomainServerNodeData*>(node->getLinkedData())->getStatsJSONObject();
+    auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    QJsonObject statsObject = nodeData->getStatsJSONObject();
     QString nodeType = NodeType::getNodeTypeName(static_cast<NodeType_t>(node->getType()));
 
     stream << "\n\n\n";
@@ -352,6 +365,36 @@ void DomainServerExporter::generateMetricsForNode(QTextStream& stream, const Sha
     stream << "###############################################################\n";
 
     generateMetricsFromJson(stream, nodeType, escapeName(nodeType), QHash<QString, QString>(), statsObject);
+    generateMetricsFromSnapshots(stream, escapeName(nodeType), nodeData->getMetrics());
+}
+
+void DomainServerExporter::generateMetricsFromSnapshots(QTextStream& stream, QString path,
+                                                        const std::vector<MetricSnapshot>& metrics) {
+    for (const auto& metric : metrics) {
+        auto metricName = path + "_" + escapeName(metric.name);
+
+        stream << QString("\n# HELP %1 %2\n").arg(metricName).arg(metric.help);
+
+        if (metric.type == MetricSnapshot::Counter) {
+            stream << "# TYPE " << metricName << " counter\n";
+            stream << metricName << " " << metric.value << "\n";
+            continue;
+        }
+
+        // Only the buckets that have ever been hit are listed. Counts never go down, so once a bucket shows up
+        // it stays, and each one keeps the same bound from one scrape to the next.
+        stream << "# TYPE " << metricName << " histogram\n";
+        quint64 cumulativeCount = 0;
+        for (const auto& bucket : metric.buckets) {
+            cumulativeCount += bucket.second;
+            // values are integers, so the last one in the bucket is its inclusive upper bound
+            stream << metricName << "_bucket{le=\"" << (quint64)(MetricHistogram::bucketUpperBound(bucket.first) - 1) << "\"} "
+                   << cumulativeCount << "\n";
+        }
+        stream << metricName << "_bucket{le=\"+Inf\"} " << metric.count << "\n";
+        stream << metricName << "_sum " << metric.value << "\n";
+        stream << metricName << "_count " << metric.count << "\n";
+    }
 }
 
 void DomainServerExporter::generateMetricsFromJson(QTextStream& stream,
@@ -368,7 +411,10 @@ void DomainServerExporter::generateMetricsFromJson(QTextStream& stream,
         if (metricValue.isObject()) {
             QUuid possible_uuid = QUuid::fromString(iter.key());
 
-            if (possible_uuid.isNull()) {
+            if (LABEL_OBJECTS.contains(path)) {
+                labels.insert(LABEL_OBJECTS[path], iter.key());
+                generateMetricsFromJson(stream, originalPath, path, labels, iter.value().toObject());
+            } else if (possible_uuid.isNull()) {
                 generateMetricsFromJson(stream, originalPath + " -> " + iter.key(), path + "_" + escapedKey, labels,
                                         iter.value().toObject());
             } else {
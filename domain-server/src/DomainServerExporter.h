@@ -22,6 +22,8 @@
 #include <QRegularExpression>
 #include <QHash>
 
+#include <MetricsRegistry.h>
+
 
 
 /**
@@ -50,6 +52,7 @@ private:
     QString escapeName(const QString &name);
     void generateMetricsForNode(QTextStream& stream, const SharedNodePointer& node);
     void generateMetricsFromJson(QTextStream& stream, QString originalPath, QString path, QHash<QString, QString> labels, const QJsonObject& obj);
+    void generateMetricsFromSnapshots(QTextStream& stream, QString path, const std::vector<MetricSnapshot>& metrics);
 };
 
 #endif // DOMAINSERVEREXPORTER_H
@@ -18,6 +18,7 @@
 #include <QtCore/QUuid>
 #include <QtCore/QJsonObject>
 
+#include <MetricsRegistry.h>
 #include <SockAddr.h>
 #include <NLPacket.h>
 #include <NodeData.h>
@@ -31,6 +32,9 @@ public:
 
     void updateJSONStats(QByteArray statsByteArray);
 
+    const std::vector<MetricSnapshot>& getMetrics() const { return _metrics; }
+    void updateMetrics(const QByteArray& metricsByteArray) { _metrics = MetricsRegistry::fromByteArray(metricsByteArray); }
+
     void setAssignmentUUID(const QUuid& assignmentUUID) { _assignmentUUID = assignmentUUID; }
     const QUuid& getAssignmentUUID() const { return _assignmentUUID; }
 
@@ -76,6 +80,14 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
+
+    // the roster version of the last DomainList this node received in full, or NodeRoster::NO_VERSION for a full list
+    quint32 getDomainListVersion() const { return _domainListVersion; }
+    void setDomainListVersion(quint32 domainListVersion) { _domainListVersion = domainListVersion; }
+
+    // what the roster last recorded for this node, to notice changes to it at its next check-in
+    const QByteArray& getRosterEntry() const { return _rosterEntry; }
+    void setRosterEntry(const QByteArray& rosterEntry) { _rosterEntry = rosterEntry; }
     
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
@@ -89,6 +101,7 @@ private:
     
     using StringPairHash = QHash<QPair<QString, QString>, QString>;
     QJsonObject _statsJSONObject;
+    std::vector<MetricSnapshot> _metrics;
     static StringPairHash _overrideHash;
     
     SockAddr _sendingSockAddr;
@@ -103,6 +116,9 @@ private:
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    quint32 _domainListVersion { 0 };
+    QByteArray _rosterEntry;
 };
 
 #endif // hifi_DomainServerNodeData_h
@@ -30,6 +30,7 @@ public:
     SockAddr senderSockAddr;
     QList<NodeType_t> interestList;
     QString placeName;
+    quint32 domainListVersion { 0 }; // roster version of the last DomainList the node received in full
     QString hardwareAddress;
     QUuid machineFingerprint;
     QString SystemInfo;
@@ -5723,8 +5723,12 @@ void Application::init() {
         return atan2(maxSize, distance);
     });
 
+    auto shapeCache = std::make_shared<CollisionShapeCache>();
+    shapeCache->initialize();
+    _shapeManager.setShapeCache(shapeCache);
     ObjectMotionState::setShapeManager(&_shapeManager);
     _physicsEngine->init();
+    _physicsEngine->setMultithreaded(Menu::getInstance()->isOptionChecked(MenuOption::PhysicsMultithreaded));
 
     EntityTreePointer tree = getEntities()->getTree();
     _entitySimulation->init(tree, _physicsEngine, &_entityEditSender);
@@ -9204,6 +9208,10 @@ void Application::setShowBulletConstraintLimits(bool value) {
     _physicsEngine->setShowBulletConstraintLimits(value);
 }
 
+void Application::setMultithreadedPhysics(bool value) {
+    _physicsEngine->setMultithreaded(value);
+}
+
 void Application::confirmConnectWithoutAvatarEntities() {
 
     if (_confirmConnectWithoutAvatarEntitiesDialog) {
@@ -157,6 +157,7 @@ namespace MenuOption {
     const QString PhysicsShowBulletContactPoints = "Show Bullet Contact Points";
     const QString PhysicsShowBulletConstraints = "Show Bullet Constraints";
     const QString PhysicsShowBulletConstraintLimits = "Show Bullet Constraint Limits";
+    const QString PhysicsMultithreaded = "Multithreaded Physics";
     const QString PipelineWarnings = "Log Render Pipeline Warnings";
     const QString Preferences = "General...";
     const QString Quit =  "Quit";
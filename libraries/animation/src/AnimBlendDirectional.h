@@ -26,7 +26,7 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setAlphaVar(const QString& alphaVar) { _alphaVar = alphaVar; }
+    void setAlphaVar(const QString& alphaVar) { _alphaVar = AnimVariantKey(alphaVar); }
 
     bool lookupChildIds();
 
@@ -47,7 +47,7 @@ protected:
     QString _downLeftId;
     QString _downRightId;
 
-    QString _alphaVar;
+    AnimVariantKey _alphaVar;
 
     int _childIndices[3][3];
 
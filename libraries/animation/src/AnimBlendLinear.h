@@ -32,7 +32,7 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setAlphaVar(const QString& alphaVar) { _alphaVar = alphaVar; }
+    void setAlphaVar(const QString& alphaVar) { _alphaVar = AnimVariantKey(alphaVar); }
 
 protected:
     // for AnimDebugDraw rendering
@@ -46,7 +46,7 @@ protected:
     float _alpha;
     AnimBlendType _blendType;
 
-    QString _alphaVar;
+    AnimVariantKey _alphaVar;
 
     // no copies
     AnimBlendLinear(const AnimBlendLinear&) = delete;
@@ -19,13 +19,29 @@ AnimBlendLinearMove::AnimBlendLinearMove(const QString& id, float alpha, float d
     _alpha(alpha),
     _desiredSpeed(desiredSpeed),
     _characteristicSpeeds(characteristicSpeeds) {
-
+    setAlphaVar(QString());
 }
 
 AnimBlendLinearMove::~AnimBlendLinearMove() {
 
 }
 
+void AnimBlendLinearMove::setAlphaVar(const QString& alphaVar) {
+    static const AnimVariantKey MOVE_LATERAL_SPEED("moveLateralSpeed");
+    static const AnimVariantKey MOVE_BACKWARD_SPEED("moveBackwardSpeed");
+    static const AnimVariantKey MOVE_FORWARD_SPEED("moveForwardSpeed");
+
+    _alphaVar = alphaVar;
+    if (_alphaVar.contains("Lateral")) {
+        _speedVar = MOVE_LATERAL_SPEED;
+    } else if (_alphaVar.contains("Backward")) {
+        _speedVar = MOVE_BACKWARD_SPEED;
+    } else {
+        //this is forward movement
+        _speedVar = MOVE_FORWARD_SPEED;
+    }
+}
+
 static float calculateAlpha(const float speed, const std::vector<float>& characteristicSpeeds) {
 
     assert(characteristicSpeeds.size() > 0);
@@ -52,15 +68,7 @@ const AnimPoseVec& AnimBlendLinearMove::evaluate(const AnimVariantMap& animVars,
 
     _desiredSpeed = animVars.lookup(_desiredSpeedVar, _desiredSpeed);
 
-    float speed = 0.0f;
-    if (_alphaVar.contains("Lateral")) {
-        speed = animVars.lookup("moveLateralSpeed", speed);
-    } else if (_alphaVar.contains("Backward")) {
-        speed = animVars.lookup("moveBackwardSpeed", speed);
-    } else {
-        //this is forward movement
-        speed = animVars.lookup("moveForwardSpeed", speed);
-    }
+    float speed = animVars.lookup(_speedVar, 0.0f);
     _alpha = calculateAlpha(speed, _characteristicSpeeds);
     float parentDebugAlpha = context.getDebugAlpha(_id);
 
@@ -111,8 +119,8 @@ void AnimBlendLinearMove::evaluateAndBlendChildren(const AnimVariantMap& animVar
         _poses = _children[prevPoseIndex]->evaluate(animVars, context, prevDeltaTime, triggersOut);
     } else {
         // need to eval and blend between two children.
-        auto prevPoses = _children[prevPoseIndex]->evaluate(animVars, context, prevDeltaTime, triggersOut);
-        auto nextPoses = _children[nextPoseIndex]->evaluate(animVars, context, nextDeltaTime, triggersOut);
+        const auto& prevPoses = _children[prevPoseIndex]->evaluate(animVars, context, prevDeltaTime, triggersOut);
+        const auto& nextPoses = _children[nextPoseIndex]->evaluate(animVars, context, nextDeltaTime, triggersOut);
 
         if (prevPoses.size() > 0 && prevPoses.size() == nextPoses.size()) {
             _poses.resize(prevPoses.size());
@@ -263,49 +263,51 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
     // poll network anim to see if it's finished loading yet.
     if (_blendType == AnimBlendType_Normal) {
         if (_networkAnim && _networkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+            // loading is complete, copy & retarget animation, unless another clip already did it for this skeleton.
+            _clipData = DependencyManager::get<AnimationCache>()->getClipData(getClipDataKey(), [&] {
+                return std::make_shared<AnimClipData>(copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton));
+            });
 
             // we no longer need the actual animation resource anymore.
             _networkAnim.reset();
 
             // mirrorAnim will be re-built on demand, if needed.
-            _mirrorAnim.clear();
+            _mirrorClipData.reset();
 
             _poses.resize(_skeleton->getNumJoints());
         }
     } else {
         // an additive blend type
         if (_networkAnim && _networkAnim->isLoaded() && _baseNetworkAnim && _baseNetworkAnim->isLoaded() && _skeleton) {
-            // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+            // loading is complete, copy & retarget animation and baseAnim, then bake the deltas.
+            _clipData = DependencyManager::get<AnimationCache>()->getClipData(getClipDataKey(), [&] {
+                auto anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+                auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
+                if (_blendType == AnimBlendType_AddAbsolute) {
+                    bakeAbsoluteDeltaAnim(anim, baseAnim[(int)_baseFrame], _skeleton);
+                } else {
+                    // AnimBlendType_AddRelative
+                    bakeRelativeDeltaAnim(anim, baseAnim[(int)_baseFrame]);
+                }
+                return std::make_shared<AnimClipData>(anim);
+            });
 
             // we no longer need the actual animation resource anymore.
             _networkAnim.reset();
 
             // mirrorAnim will be re-built on demand, if needed.
             // TODO: handle mirrored relative animations.
-            _mirrorAnim.clear();
+            _mirrorClipData.reset();
 
             _poses.resize(_skeleton->getNumJoints());
-
-            // copy & retarget baseAnim!
-            auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
-
-            if (_blendType == AnimBlendType_AddAbsolute) {
-                bakeAbsoluteDeltaAnim(_anim, baseAnim[(int)_baseFrame], _skeleton);
-            } else {
-                // AnimBlendType_AddRelative
-                bakeRelativeDeltaAnim(_anim, baseAnim[(int)_baseFrame]);
-            }
         }
     }
 
-    if (_anim.size()) {
+    if (_clipData && _clipData->getNumFrames() > 0) {
 
-        // lazy creation of mirrored animation frames.
-        if (_mirrorFlag && _anim.size() != _mirrorAnim.size()) {
-            buildMirrorAnim();
+        // lazy creation of mirrored animation frames, shared with the other clips like the unmirrored ones.
+        if (_mirrorFlag && !_mirrorClipData) {
+            _mirrorClipData = _clipData->getMirrored(*_skeleton);
         }
 
         int prevIndex = (int)glm::floor(_frame);
@@ -318,15 +320,18 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
 
         // It can be quite possible for the user to set _startFrame and _endFrame to
         // values before or past valid ranges.  We clamp the frames here.
-        int frameCount = (int)_anim.size();
+        int frameCount = (int)_clipData->getNumFrames();
         prevIndex = std::min(std::max(0, prevIndex), frameCount - 1);
         nextIndex = std::min(std::max(0, nextIndex), frameCount - 1);
 
-        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : _anim[prevIndex];
-        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : _anim[nextIndex];
+        const AnimClipData& clipData = _mirrorFlag ? *_mirrorClipData : *_clipData;
+        clipData.decodeFrame(prevIndex, _prevFrame);
+        if (nextIndex != prevIndex) {
+            clipData.decodeFrame(nextIndex, _nextFrame);
+        }
         float alpha = glm::fract(_frame);
 
-        ::blend(_poses.size(), &prevFrame[0], &nextFrame[0], alpha, &_poses[0]);
+        AnimPoseBuffer::blend(_prevFrame, nextIndex != prevIndex ? _nextFrame : _prevFrame, alpha, _poses);
     }
 
     processOutputJoints(triggersOut);
@@ -341,15 +346,12 @@ void AnimClip::setCurrentFrameInternal(float frame) {
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame + _startFrame, dt, _loopFlag, _id, triggers);
 }
 
-void AnimClip::buildMirrorAnim() {
-    assert(_skeleton);
-
-    _mirrorAnim.clear();
-    _mirrorAnim.reserve(_anim.size());
-    for (auto& relPoses : _anim) {
-        _mirrorAnim.push_back(relPoses);
-        _skeleton->mirrorRelativePoses(_mirrorAnim.back());
+QString AnimClip::getClipDataKey() const {
+    QString key = _url + "|" + QString::number((int)_blendType);
+    if (_blendType != AnimBlendType_Normal) {
+        key += "|" + _baseURL + "|" + QString::number((int)_baseFrame);
     }
+    return key + "|" + _skeleton->getFingerprint().toHex();
 }
 
 const AnimPoseVec& AnimClip::getPosesInternal() const {
@@ -14,6 +14,7 @@
 #include <string>
 #include "AnimationCache.h"
 #include "AnimNode.h"
+#include "AnimClipData.h"
 
 // Playback a single animation timeline.
 // url determines the location of the fbx file to use within this clip.
@@ -31,12 +32,12 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setStartFrameVar(const QString& startFrameVar) { _startFrameVar = startFrameVar; }
-    void setEndFrameVar(const QString& endFrameVar) { _endFrameVar = endFrameVar; }
-    void setTimeScaleVar(const QString& timeScaleVar) { _timeScaleVar = timeScaleVar; }
-    void setLoopFlagVar(const QString& loopFlagVar) { _loopFlagVar = loopFlagVar; }
-    void setMirrorFlagVar(const QString& mirrorFlagVar) { _mirrorFlagVar = mirrorFlagVar; }
-    void setFrameVar(const QString& frameVar) { _frameVar = frameVar; }
+    void setStartFrameVar(const QString& startFrameVar) { _startFrameVar = AnimVariantKey(startFrameVar); }
+    void setEndFrameVar(const QString& endFrameVar) { _endFrameVar = AnimVariantKey(endFrameVar); }
+    void setTimeScaleVar(const QString& timeScaleVar) { _timeScaleVar = AnimVariantKey(timeScaleVar); }
+    void setLoopFlagVar(const QString& loopFlagVar) { _loopFlagVar = AnimVariantKey(loopFlagVar); }
+    void setMirrorFlagVar(const QString& mirrorFlagVar) { _mirrorFlagVar = AnimVariantKey(mirrorFlagVar); }
+    void setFrameVar(const QString& frameVar) { _frameVar = AnimVariantKey(frameVar); }
 
     float getStartFrame() const { return _startFrame; }
     void setStartFrame(float startFrame) { _startFrame = startFrame; }
@@ -61,7 +62,7 @@ protected:
 
     virtual void setCurrentFrameInternal(float frame) override;
 
-    void buildMirrorAnim();
+    QString getClipDataKey() const;
 
     // for AnimDebugDraw rendering
     virtual const AnimPoseVec& getPosesInternal() const override;
@@ -71,9 +72,13 @@ protected:
 
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
-    std::vector<AnimPoseVec> _mirrorAnim;
+    // retargeted frames, shared with every other clip playing the same url on the same skeleton
+    std::shared_ptr<const AnimClipData> _clipData;
+    std::shared_ptr<const AnimClipData> _mirrorClipData;
+
+    // the two frames around _frame, decoded from _clipData
+    AnimPoseBuffer _prevFrame;
+    AnimPoseBuffer _nextFrame;
 
     QString _url;
     float _startFrame;
@@ -86,12 +91,12 @@ protected:
     QString _baseURL;
     float _baseFrame;
 
-    QString _startFrameVar;
-    QString _endFrameVar;
-    QString _timeScaleVar;
-    QString _loopFlagVar;
-    QString _mirrorFlagVar;
-    QString _frameVar;
+    AnimVariantKey _startFrameVar;
+    AnimVariantKey _endFrameVar;
+    AnimVariantKey _timeScaleVar;
+    AnimVariantKey _loopFlagVar;
+    AnimVariantKey _mirrorFlagVar;
+    AnimVariantKey _frameVar;
 
     // no copies
     AnimClip(const AnimClip&) = delete;
@@ -0,0 +1,167 @@
+//
+//  AnimClipData.cpp
+//  libraries/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimClipData.h"
+
+#include <assert.h>
+#include <algorithm>
+
+#include "AnimSkeleton.h"
+
+static const int ROTATION_BITS = 15;
+static const float ROTATION_RANGE = (float)((1 << ROTATION_BITS) - 1);
+static const float SQRT_2 = 1.41421356f;
+
+AnimClipData::AnimClipData(const std::vector<AnimPoseVec>& frames) {
+    _numFrames = frames.size();
+    _numJoints = _numFrames > 0 ? frames[0].size() : 0;
+    if (_numFrames == 0) {
+        return;
+    }
+
+    _rotations.resize(_numFrames * _numJoints * 3);
+    for (size_t frame = 0; frame < _numFrames; frame++) {
+        assert(frames[frame].size() == _numJoints);
+        for (size_t joint = 0; joint < _numJoints; joint++) {
+            encodeRotation(frames[frame][joint].rot(), &_rotations[(frame * _numJoints + joint) * 3]);
+        }
+    }
+
+    auto layout = [&](std::vector<Track>& tracks, std::vector<uint32_t>& offsets, std::vector<glm::vec3>& constants,
+                      std::vector<glm::vec3>& animated, size_t& numAnimated, const glm::vec3& (AnimPose::*get)() const) {
+        // a track is constant when every frame matches the first one exactly
+        std::vector<uint8_t> isAnimated(_numJoints, 0);
+        for (size_t joint = 0; joint < _numJoints; joint++) {
+            const glm::vec3& first = (frames[0][joint].*get)();
+            for (size_t frame = 1; frame < _numFrames; frame++) {
+                if ((frames[frame][joint].*get)() != first) {
+                    isAnimated[joint] = 1;
+                    break;
+                }
+            }
+        }
+
+        tracks.resize(_numJoints);
+        offsets.resize(_numJoints);
+        numAnimated = 0;
+        for (size_t joint = 0; joint < _numJoints; joint++) {
+            if (isAnimated[joint]) {
+                tracks[joint] = Track::Animated;
+                offsets[joint] = (uint32_t)numAnimated++;
+            } else {
+                tracks[joint] = Track::Constant;
+                offsets[joint] = (uint32_t)constants.size();
+                constants.push_back((frames[0][joint].*get)());
+            }
+        }
+
+        animated.reserve(numAnimated * _numFrames);
+        for (size_t frame = 0; frame < _numFrames; frame++) {
+            for (size_t joint = 0; joint < _numJoints; joint++) {
+                if (isAnimated[joint]) {
+                    animated.push_back((frames[frame][joint].*get)());
+                }
+            }
+        }
+    };
+    layout(_scaleTracks, _scaleOffsets, _constantScales, _animatedScales, _numAnimatedScales, &AnimPose::scale);
+    layout(_transTracks, _transOffsets, _constantTrans, _animatedTrans, _numAnimatedTrans, &AnimPose::trans);
+}
+
+void AnimClipData::decodeFrame(size_t frame, AnimPoseBuffer& result) const {
+    assert(frame < _numFrames);
+    if (result.size() != _numJoints) {
+        result.resize(_numJoints);
+    }
+
+    const uint16_t* rotations = _rotations.data() + frame * _numJoints * 3;
+    const glm::vec3* animatedScales = _animatedScales.data() + frame * _numAnimatedScales;
+    const glm::vec3* animatedTrans = _animatedTrans.data() + frame * _numAnimatedTrans;
+    for (size_t joint = 0; joint < _numJoints; joint++) {
+        uint32_t scaleOffset = _scaleOffsets[joint];
+        uint32_t transOffset = _transOffsets[joint];
+        const glm::vec3& scale = _scaleTracks[joint] == Track::Animated ? animatedScales[scaleOffset] : _constantScales[scaleOffset];
+        const glm::vec3& trans = _transTracks[joint] == Track::Animated ? animatedTrans[transOffset] : _constantTrans[transOffset];
+        result.setPose(joint, AnimPose(scale, decodeRotation(rotations + joint * 3), trans));
+    }
+}
+
+void AnimClipData::decodeFrame(size_t frame, AnimPoseVec& result) const {
+    AnimPoseBuffer buffer;
+    decodeFrame(frame, buffer);
+    buffer.getPoses(result);
+}
+
+AnimClipData::Pointer AnimClipData::getMirrored(const AnimSkeleton& skeleton) const {
+    std::lock_guard<std::mutex> lock(_mirroredMutex);
+    if (!_mirrored) {
+        std::vector<AnimPoseVec> frames(_numFrames);
+        for (size_t frame = 0; frame < _numFrames; frame++) {
+            decodeFrame(frame, frames[frame]);
+            skeleton.mirrorRelativePoses(frames[frame]);
+        }
+        _mirrored = std::make_shared<AnimClipData>(frames);
+    }
+    return _mirrored;
+}
+
+size_t AnimClipData::getMemoryUsage() const {
+    return sizeof(AnimClipData) +
+        _rotations.size() * sizeof(uint16_t) +
+        (_scaleTracks.size() + _transTracks.size()) * sizeof(Track) +
+        (_scaleOffsets.size() + _transOffsets.size()) * sizeof(uint32_t) +
+        (_constantScales.size() + _animatedScales.size() + _constantTrans.size() + _animatedTrans.size()) * sizeof(glm::vec3);
+}
+
+// smallest three: drop the largest component, made positive so it can be rebuilt from the other three,
+// which all fit in [-1 / sqrt(2), 1 / sqrt(2)].  The dropped index goes in the top bit of the first two words.
+void AnimClipData::encodeRotation(const glm::quat& rot, uint16_t* result) {
+    glm::quat q = glm::normalize(rot);
+    float components[4] = { q.x, q.y, q.z, q.w };
+
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (fabsf(components[i]) > fabsf(components[largest])) {
+            largest = i;
+        }
+    }
+    float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+    int word = 0;
+    for (int i = 0; i < 4; i++) {
+        if (i == largest) {
+            continue;
+        }
+        float normalized = glm::clamp(sign * components[i] * SQRT_2 * 0.5f + 0.5f, 0.0f, 1.0f);
+        result[word++] = (uint16_t)(normalized * ROTATION_RANGE + 0.5f);
+    }
+    result[0] |= (uint16_t)((largest >> 1) << ROTATION_BITS);
+    result[1] |= (uint16_t)((largest & 1) << ROTATION_BITS);
+}
+
+glm::quat AnimClipData::decodeRotation(const uint16_t* data) {
+    const uint16_t VALUE_MASK = (1 << ROTATION_BITS) - 1;
+    int largest = ((data[0] >> ROTATION_BITS) << 1) | (data[1] >> ROTATION_BITS);
+
+    float components[4];
+    float sumOfSquares = 0.0f;
+    int word = 0;
+    for (int i = 0; i < 4; i++) {
+        if (i == largest) {
+            continue;
+        }
+        float value = ((float)(data[word++] & VALUE_MASK) / ROTATION_RANGE - 0.5f) * 2.0f / SQRT_2;
+        components[i] = value;
+        sumOfSquares += value * value;
+    }
+    components[largest] = sqrtf(std::max(0.0f, 1.0f - sumOfSquares));
+    return glm::normalize(glm::quat(components[3], components[0], components[1], components[2]));
+}
@@ -0,0 +1,79 @@
+//
+//  AnimClipData.h
+//  libraries/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimClipData_h
+#define hifi_AnimClipData_h
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AnimPoseBuffer.h"
+
+class AnimSkeleton;
+
+// The retargeted frames of an animation, compressed and immutable so that every AnimClip playing the same url on the
+// same skeleton can share one copy through the AnimationCache.
+//
+// Rotations are stored in 48 bits each, as the three smallest components of the quat with 15 bits apiece and the
+// index of the dropped one.  Scale and translation are kept as floats, but a joint whose scale or translation
+// never changes stores it once instead of once per frame, which is most joints other than the hips.
+class AnimClipData {
+public:
+    using Pointer = std::shared_ptr<const AnimClipData>;
+
+    // frames[frame][joint], every frame must have the same number of joints.
+    explicit AnimClipData(const std::vector<AnimPoseVec>& frames);
+
+    size_t getNumFrames() const { return _numFrames; }
+    size_t getNumJoints() const { return _numJoints; }
+
+    void decodeFrame(size_t frame, AnimPoseBuffer& result) const;
+    void decodeFrame(size_t frame, AnimPoseVec& result) const;
+
+    // the same frames mirrored with AnimSkeleton::mirrorRelativePoses, built the first time it is asked for.
+    Pointer getMirrored(const AnimSkeleton& skeleton) const;
+
+    // bytes used by the frames, not counting a mirrored copy
+    size_t getMemoryUsage() const;
+
+    static void encodeRotation(const glm::quat& rot, uint16_t* result);
+    static glm::quat decodeRotation(const uint16_t* data);
+
+protected:
+    enum class Track : uint8_t {
+        Constant,
+        Animated
+    };
+
+    size_t _numFrames { 0 };
+    size_t _numJoints { 0 };
+
+    std::vector<uint16_t> _rotations;  // 3 per joint per frame, [frame][joint]
+
+    std::vector<Track> _scaleTracks;  // per joint
+    std::vector<uint32_t> _scaleOffsets;  // index into _constantScales or into each frame of _animatedScales
+    std::vector<glm::vec3> _constantScales;
+    std::vector<glm::vec3> _animatedScales;  // [frame][animated joint]
+    size_t _numAnimatedScales { 0 };
+
+    std::vector<Track> _transTracks;
+    std::vector<uint32_t> _transOffsets;
+    std::vector<glm::vec3> _constantTrans;
+    std::vector<glm::vec3> _animatedTrans;
+    size_t _numAnimatedTrans { 0 };
+
+    mutable std::mutex _mirroredMutex;
+    mutable Pointer _mirrored;
+};
+
+#endif // hifi_AnimClipData_h
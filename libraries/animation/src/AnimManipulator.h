@@ -25,7 +25,7 @@ public:
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
     virtual const AnimPoseVec& overlay(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut, const AnimPoseVec& underPoses) override;
 
-    void setAlphaVar(const QString& alphaVar) { _alphaVar = alphaVar; }
+    void setAlphaVar(const QString& alphaVar) { _alphaVar = AnimVariantKey(alphaVar); }
 
     virtual void setSkeletonInternal(AnimSkeleton::ConstPointer skeleton) override;
 
@@ -42,8 +42,8 @@ public:
         QString jointName = "";
         Type rotationType = Type::Absolute;
         Type translationType = Type::Absolute;
-        QString rotationVar = "";
-        QString translationVar = "";
+        AnimVariantKey rotationVar;
+        AnimVariantKey translationVar;
 
         int jointIndex = -1;
         bool hasPerformedJointLookup = false;
@@ -62,7 +62,7 @@ protected:
 
     AnimPoseVec _poses;
     float _alpha;
-    QString _alphaVar;
+    AnimVariantKey _alphaVar;
 
     std::vector<JointVar> _jointVars;
 
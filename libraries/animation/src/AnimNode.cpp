@@ -67,18 +67,23 @@ void AnimNode::setActive(bool active) {
     }
 }
 
+void AnimNode::addOutputJoint(const QString& outputJointName) {
+    _outputJoints.push_back({ outputJointName, AnimVariantKey(_id + outputJointName + "Rotation"),
+                              AnimVariantKey(_id + outputJointName + "Position") });
+}
+
 void AnimNode::processOutputJoints(AnimVariantMap& triggersOut) const {
     if (!_skeleton) {
         return;
     }
 
-    for (auto&& jointName : _outputJointNames) {
+    for (auto&& outputJoint : _outputJoints) {
         // TODO: cache the jointIndices
-        int jointIndex = _skeleton->nameToJointIndex(jointName);
+        int jointIndex = _skeleton->nameToJointIndex(outputJoint.name);
         if (jointIndex >= 0) {
             AnimPose pose = _skeleton->getAbsolutePose(jointIndex, getPosesInternal());
-            triggersOut.set(_id + jointName + "Rotation", pose.rot());
-            triggersOut.set(_id + jointName + "Position", pose.trans());
+            triggersOut.set(outputJoint.rotationVar, pose.rot());
+            triggersOut.set(outputJoint.positionVar, pose.trans());
         }
     }
 }
@@ -51,7 +51,7 @@ public:
     const QString& getID() const { return _id; }
     Type getType() const { return _type; }
 
-    void addOutputJoint(const QString& outputJointName) { _outputJointNames.push_back(outputJointName); }
+    void addOutputJoint(const QString& outputJointName);
 
     // hierarchy accessors
     Pointer getParent();
@@ -126,7 +126,12 @@ protected:
     std::vector<AnimNode::Pointer> _children;
     AnimSkeleton::ConstPointer _skeleton;
     std::weak_ptr<AnimNode> _parent;
-    std::vector<QString> _outputJointNames;
+    struct OutputJoint {
+        QString name;
+        AnimVariantKey rotationVar;
+        AnimVariantKey positionVar;
+    };
+    std::vector<OutputJoint> _outputJoints;
     bool _active { false };
 
     // no copies
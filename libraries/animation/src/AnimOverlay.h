@@ -78,8 +78,8 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setBoneSetVar(const QString& boneSetVar) { _boneSetVar = boneSetVar; }
-    void setAlphaVar(const QString& alphaVar) { _alphaVar = alphaVar; }
+    void setBoneSetVar(const QString& boneSetVar) { _boneSetVar = AnimVariantKey(boneSetVar); }
+    void setAlphaVar(const QString& alphaVar) { _alphaVar = AnimVariantKey(alphaVar); }
 
  protected:
     void buildBoneSet(BoneSet boneSet);
@@ -93,8 +93,8 @@ public:
     float _alpha;
     std::vector<float> _boneSetVec;
 
-    QString _boneSetVar;
-    QString _alphaVar;
+    AnimVariantKey _boneSetVar;
+    AnimVariantKey _alphaVar;
 
     void buildFullBodyBoneSet();
     void buildUpperBodyBoneSet();
@@ -52,8 +52,8 @@ protected:
     QString _midJointName;
     QString _tipJointName;
 
-    QString _enabledVar;
-    QString _poleVectorVar;
+    AnimVariantKey _enabledVar;
+    AnimVariantKey _poleVectorVar;
 
     int _baseParentJointIndex { -1 };
     int _baseJointIndex { -1 };
@@ -67,7 +67,33 @@ glm::vec3 AnimPose::xformVectorFast(const glm::vec3& rhs) const {
     return _rot * (_scale * rhs);
 }
 
+// quat_cast returns the quat whose largest component is positive, match that so both paths of operator* agree.
+static glm::quat matchQuatCastSign(const glm::quat& q) {
+    float biggest = fabsf(q.w);
+    float sign = q.w;
+    if (fabsf(q.x) > biggest) {
+        biggest = fabsf(q.x);
+        sign = q.x;
+    }
+    if (fabsf(q.y) > biggest) {
+        biggest = fabsf(q.y);
+        sign = q.y;
+    }
+    if (fabsf(q.z) > biggest) {
+        sign = q.z;
+    }
+    return sign < 0.0f ? -q : q;
+}
+
 AnimPose AnimPose::operator*(const AnimPose& rhs) const {
+    // a parent with uniform positive scale keeps the product a plain scale, rotation and translation,
+    // which skips the matrix multiply and decomposition below.  This is the common case for skeletons.
+    if (_scale.x == _scale.y && _scale.x == _scale.z && _scale.x > 0.0f &&
+        rhs._scale.x > 0.0f && rhs._scale.y > 0.0f && rhs._scale.z > 0.0f &&
+        glm::abs(glm::length2(_rot) - 1.0f) <= EPSILON && glm::abs(glm::length2(rhs._rot) - 1.0f) <= EPSILON) {
+        return AnimPose(_scale.x * rhs._scale, matchQuatCastSign(_rot * rhs._rot), _trans + _rot * (_scale.x * rhs._trans));
+    }
+
     glm::mat4 result;
     glm_mat4u_mul(*this, rhs, result);
     return AnimPose(result);
@@ -0,0 +1,192 @@
+//
+//  AnimPoseBuffer.cpp
+//  libraries/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseBuffer.h"
+
+#include <assert.h>
+#include <algorithm>
+
+#include <GLMHelpers.h>
+
+#include "AnimUtil.h"
+
+static const size_t LANES = 4;
+static const float IDENTITY_COMPONENTS[] = { 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f };
+
+void AnimPoseBuffer::resize(size_t size) {
+    size_t oldSize = _size;
+    size_t oldStride = _stride;
+    std::vector<float> oldData;
+    oldData.swap(_data);
+
+    _size = size;
+    _stride = (size + LANES - 1) & ~(LANES - 1);
+    _data.resize(NUM_COMPONENTS * _stride);
+
+    size_t numKept = std::min(oldSize, size);
+    for (int c = 0; c < NUM_COMPONENTS; c++) {
+        float* dst = component(c);
+        if (numKept > 0) {
+            std::copy(oldData.begin() + c * oldStride, oldData.begin() + c * oldStride + numKept, dst);
+        }
+        std::fill(dst + numKept, dst + _stride, IDENTITY_COMPONENTS[c]);
+    }
+}
+
+void AnimPoseBuffer::setPoses(const AnimPoseVec& poses) {
+    if (poses.size() != _size) {
+        _size = 0;
+        _stride = 0;
+        _data.clear();
+        resize(poses.size());
+    }
+    for (size_t i = 0; i < poses.size(); i++) {
+        setPose(i, poses[i]);
+    }
+}
+
+void AnimPoseBuffer::getPoses(AnimPoseVec& poses) const {
+    poses.resize(_size);
+    for (size_t i = 0; i < _size; i++) {
+        poses[i] = getPose(i);
+    }
+}
+
+AnimPose AnimPoseBuffer::getPose(size_t index) const {
+    assert(index < _size);
+    return AnimPose(glm::vec3(component(SCALE_X)[index], component(SCALE_Y)[index], component(SCALE_Z)[index]),
+                    glm::quat(component(ROT_W)[index], component(ROT_X)[index], component(ROT_Y)[index], component(ROT_Z)[index]),
+                    glm::vec3(component(TRANS_X)[index], component(TRANS_Y)[index], component(TRANS_Z)[index]));
+}
+
+void AnimPoseBuffer::setPose(size_t index, const AnimPose& pose) {
+    assert(index < _size);
+    component(SCALE_X)[index] = pose.scale().x;
+    component(SCALE_Y)[index] = pose.scale().y;
+    component(SCALE_Z)[index] = pose.scale().z;
+    component(ROT_X)[index] = pose.rot().x;
+    component(ROT_Y)[index] = pose.rot().y;
+    component(ROT_Z)[index] = pose.rot().z;
+    component(ROT_W)[index] = pose.rot().w;
+    component(TRANS_X)[index] = pose.trans().x;
+    component(TRANS_Y)[index] = pose.trans().y;
+    component(TRANS_Z)[index] = pose.trans().z;
+}
+
+// blends the four joints starting at index of a and b, which share the same stride, into out[component][lane].
+// Padding lanes are identity in both, so blocks never need a scalar tail.
+static void blendLanes(const float* a, const float* b, size_t stride, size_t index, float alpha, float out[][LANES]) {
+    const int NUM_LINEAR = 6;
+    const size_t LINEAR_COMPONENTS[NUM_LINEAR] = {
+        AnimPoseBuffer::SCALE_X, AnimPoseBuffer::SCALE_Y, AnimPoseBuffer::SCALE_Z,
+        AnimPoseBuffer::TRANS_X, AnimPoseBuffer::TRANS_Y, AnimPoseBuffer::TRANS_Z
+    };
+    const size_t RX = AnimPoseBuffer::ROT_X * stride + index;
+    const size_t RY = AnimPoseBuffer::ROT_Y * stride + index;
+    const size_t RZ = AnimPoseBuffer::ROT_Z * stride + index;
+    const size_t RW = AnimPoseBuffer::ROT_W * stride + index;
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    const __m128 ZERO = _mm_setzero_ps();
+    const __m128 ONE = _mm_set1_ps(1.0f);
+    const __m128 SIGN_BIT = _mm_set1_ps(-0.0f);
+    const __m128 t = _mm_set1_ps(alpha);
+    const __m128 oneMinusT = _mm_set1_ps(1.0f - alpha);
+
+    // scale and translation, x * (1 - a) + y * a
+    for (int j = 0; j < NUM_LINEAR; j++) {
+        size_t c = LINEAR_COMPONENTS[j];
+        __m128 x = _mm_loadu_ps(a + c * stride + index);
+        __m128 y = _mm_loadu_ps(b + c * stride + index);
+        _mm_storeu_ps(out[c], _mm_add_ps(_mm_mul_ps(x, oneMinusT), _mm_mul_ps(y, t)));
+    }
+
+    __m128 ax = _mm_loadu_ps(a + RX);
+    __m128 ay = _mm_loadu_ps(a + RY);
+    __m128 az = _mm_loadu_ps(a + RZ);
+    __m128 aw = _mm_loadu_ps(a + RW);
+    __m128 bx = _mm_loadu_ps(b + RX);
+    __m128 by = _mm_loadu_ps(b + RY);
+    __m128 bz = _mm_loadu_ps(b + RZ);
+    __m128 bw = _mm_loadu_ps(b + RW);
+
+    // flip b onto a's hemisphere
+    __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)),
+                            _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+    __m128 flip = _mm_and_ps(_mm_cmplt_ps(dot, ZERO), SIGN_BIT);
+    bx = _mm_xor_ps(bx, flip);
+    by = _mm_xor_ps(by, flip);
+    bz = _mm_xor_ps(bz, flip);
+    bw = _mm_xor_ps(bw, flip);
+
+    __m128 rx = _mm_add_ps(_mm_mul_ps(ax, oneMinusT), _mm_mul_ps(bx, t));
+    __m128 ry = _mm_add_ps(_mm_mul_ps(ay, oneMinusT), _mm_mul_ps(by, t));
+    __m128 rz = _mm_add_ps(_mm_mul_ps(az, oneMinusT), _mm_mul_ps(bz, t));
+    __m128 rw = _mm_add_ps(_mm_mul_ps(aw, oneMinusT), _mm_mul_ps(bw, t));
+
+    // normalize, degenerate quats become identity like they do in glm::normalize
+    __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)),
+                                           _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw))));
+    __m128 valid = _mm_cmpgt_ps(length, ZERO);
+    __m128 oneOverLength = _mm_div_ps(ONE, length);
+    _mm_storeu_ps(out[AnimPoseBuffer::ROT_X], _mm_and_ps(valid, _mm_mul_ps(rx, oneOverLength)));
+    _mm_storeu_ps(out[AnimPoseBuffer::ROT_Y], _mm_and_ps(valid, _mm_mul_ps(ry, oneOverLength)));
+    _mm_storeu_ps(out[AnimPoseBuffer::ROT_Z], _mm_and_ps(valid, _mm_mul_ps(rz, oneOverLength)));
+    _mm_storeu_ps(out[AnimPoseBuffer::ROT_W],
+                  _mm_or_ps(_mm_and_ps(valid, _mm_mul_ps(rw, oneOverLength)), _mm_andnot_ps(valid, ONE)));
+#else
+    for (size_t lane = 0; lane < LANES; lane++) {
+        for (int j = 0; j < NUM_LINEAR; j++) {
+            size_t c = LINEAR_COMPONENTS[j];
+            out[c][lane] = lerp(a[c * stride + index + lane], b[c * stride + index + lane], alpha);
+        }
+        glm::quat aRot(a[RW + lane], a[RX + lane], a[RY + lane], a[RZ + lane]);
+        glm::quat bRot(b[RW + lane], b[RX + lane], b[RY + lane], b[RZ + lane]);
+        glm::quat rot = safeLerp(aRot, bRot, alpha);
+        out[AnimPoseBuffer::ROT_X][lane] = rot.x;
+        out[AnimPoseBuffer::ROT_Y][lane] = rot.y;
+        out[AnimPoseBuffer::ROT_Z][lane] = rot.z;
+        out[AnimPoseBuffer::ROT_W][lane] = rot.w;
+    }
+#endif
+}
+
+void AnimPoseBuffer::blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha, AnimPoseBuffer& result) {
+    assert(a.size() == b.size());
+    if (result.size() != a.size()) {
+        result.resize(a.size());
+    }
+
+    float out[NUM_COMPONENTS][LANES];
+    for (size_t i = 0; i < a._stride; i += LANES) {
+        blendLanes(a._data.data(), b._data.data(), a._stride, i, alpha, out);
+        for (int c = 0; c < NUM_COMPONENTS; c++) {
+            std::copy(out[c], out[c] + LANES, result.component(c) + i);
+        }
+    }
+}
+
+void AnimPoseBuffer::blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha, AnimPoseVec& result) {
+    assert(a.size() == b.size());
+    result.resize(a.size());
+
+    float out[NUM_COMPONENTS][LANES];
+    for (size_t i = 0; i < a._stride; i += LANES) {
+        blendLanes(a._data.data(), b._data.data(), a._stride, i, alpha, out);
+        size_t numLanes = std::min(LANES, a._size - i);
+        for (size_t lane = 0; lane < numLanes; lane++) {
+            AnimPose& pose = result[i + lane];
+            pose.scale() = glm::vec3(out[SCALE_X][lane], out[SCALE_Y][lane], out[SCALE_Z][lane]);
+            pose.rot() = glm::quat(out[ROT_W][lane], out[ROT_X][lane], out[ROT_Y][lane], out[ROT_Z][lane]);
+            pose.trans() = glm::vec3(out[TRANS_X][lane], out[TRANS_Y][lane], out[TRANS_Z][lane]);
+        }
+    }
+}
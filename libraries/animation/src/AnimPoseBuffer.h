@@ -0,0 +1,61 @@
+//
+//  AnimPoseBuffer.h
+//  libraries/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimPoseBuffer_h
+#define hifi_AnimPoseBuffer_h
+
+#include <vector>
+
+#include "AnimPose.h"
+
+// A set of poses stored as one array per component (scale x, y, z, rot x, y, z, w, trans x, y, z), so the per joint
+// kernels can work on four joints at a time.  Each array is padded to a multiple of four with identity poses.
+//
+// AnimPoseVec is still what nodes hand to each other, this is for data that is blended over and over again,
+// like the frames of an AnimClip.
+class AnimPoseBuffer {
+public:
+    enum Component {
+        SCALE_X = 0, SCALE_Y, SCALE_Z,
+        ROT_X, ROT_Y, ROT_Z, ROT_W,
+        TRANS_X, TRANS_Y, TRANS_Z,
+        NUM_COMPONENTS
+    };
+
+    AnimPoseBuffer() {}
+    explicit AnimPoseBuffer(const AnimPoseVec& poses) { setPoses(poses); }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // new poses are identity
+    void resize(size_t size);
+
+    void setPoses(const AnimPoseVec& poses);
+    void getPoses(AnimPoseVec& poses) const;
+
+    AnimPose getPose(size_t index) const;
+    void setPose(size_t index, const AnimPose& pose);
+
+    // same as ::blend(), scale and translation are lerped and rotations are nlerped along the shortest arc.
+    static void blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha, AnimPoseBuffer& result);
+    static void blend(const AnimPoseBuffer& a, const AnimPoseBuffer& b, float alpha, AnimPoseVec& result);
+
+protected:
+    float* component(int c) { return _data.data() + c * _stride; }
+    const float* component(int c) const { return _data.data() + c * _stride; }
+
+    std::vector<float> _data;  // NUM_COMPONENTS arrays of _stride floats each
+    size_t _size { 0 };
+    size_t _stride { 0 };
+};
+
+#endif // hifi_AnimPoseBuffer_h
@@ -71,7 +71,7 @@ protected:
             friend AnimRandomSwitch;
             Transition(const QString& var, RandomSwitchState::Pointer randomState) : _var(var), _randomSwitchState(randomState) {}
         protected:
-            QString _var;
+            AnimVariantKey _var;
             RandomSwitchState::Pointer _randomSwitchState;
         };
 
@@ -86,9 +86,9 @@ protected:
             _resume(resume){
         }
 
-        void setInterpTargetVar(const QString& interpTargetVar) { _interpTargetVar = interpTargetVar; }
-        void setInterpDurationVar(const QString& interpDurationVar) { _interpDurationVar = interpDurationVar; }
-        void setInterpTypeVar(const QString& interpTypeVar) { _interpTypeVar = interpTypeVar; }
+        void setInterpTargetVar(const QString& interpTargetVar) { _interpTargetVar = AnimVariantKey(interpTargetVar); }
+        void setInterpDurationVar(const QString& interpDurationVar) { _interpDurationVar = AnimVariantKey(interpDurationVar); }
+        void setInterpTypeVar(const QString& interpTypeVar) { _interpTypeVar = AnimVariantKey(interpTypeVar); }
 
         int getChildIndex() const { return _childIndex; }
         float getPriority() const { return _priority; }
@@ -113,9 +113,9 @@ protected:
         float _priority {0.0f};
         bool _resume {false};
 
-        QString _interpTargetVar;
-        QString _interpDurationVar;
-        QString _interpTypeVar;
+        AnimVariantKey _interpTargetVar;
+        AnimVariantKey _interpDurationVar;
+        AnimVariantKey _interpTypeVar;
 
         std::vector<Transition> _transitions;
 
@@ -132,15 +132,15 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setCurrentStateVar(QString& currentStateVar) { _currentStateVar = currentStateVar; }
+    void setCurrentStateVar(QString& currentStateVar) { _currentStateVar = AnimVariantKey(currentStateVar); }
 
 protected:
 
     void setCurrentState(RandomSwitchState::Pointer randomState);
-    void setTriggerRandomSwitchVar(const QString& triggerRandomSwitchVar) { _triggerRandomSwitchVar = triggerRandomSwitchVar; }
+    void setTriggerRandomSwitchVar(const QString& triggerRandomSwitchVar) { _triggerRandomSwitchVar = AnimVariantKey(triggerRandomSwitchVar); }
     void setRandomSwitchTimeMin(float randomSwitchTimeMin) { _randomSwitchTimeMin = randomSwitchTimeMin; }
     void setRandomSwitchTimeMax(float randomSwitchTimeMax) { _randomSwitchTimeMax = randomSwitchTimeMax; }
-    void setTransitionVar(const QString& transitionVar) { _transitionVar = transitionVar; }
+    void setTransitionVar(const QString& transitionVar) { _transitionVar = AnimVariantKey(transitionVar); }
     void setTriggerTimeMin(float triggerTimeMin) { _triggerTimeMin = triggerTimeMin; }
     void setTriggerTimeMax(float triggerTimeMax) { _triggerTimeMax = triggerTimeMax; }
 
@@ -169,9 +169,9 @@ protected:
     RandomSwitchState::Pointer _previousState;
     std::vector<RandomSwitchState::Pointer> _randomStates;
 
-    QString _currentStateVar;
-    QString _triggerRandomSwitchVar;
-    QString _transitionVar;
+    AnimVariantKey _currentStateVar;
+    AnimVariantKey _triggerRandomSwitchVar;
+    AnimVariantKey _transitionVar;
     float _triggerTimeMin { 10.0f };
     float _triggerTimeMax { 20.0f };
     float _triggerTime { 0.0f };
@@ -10,6 +10,8 @@
 
 #include "AnimSkeleton.h"
 
+#include <QCryptographicHash>
+
 #include <glm/gtx/transform.hpp>
 
 #include <GLMHelpers.h>
@@ -294,6 +296,18 @@ void AnimSkeleton::buildSkeletonFromJoints(const std::vector<HFMJoint>& joints,
             _mirrorMap.push_back(i);
         }
     }
+
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    for (int i = 0; i < _jointsSize; i++) {
+        hash.addData(_joints[i].name.toUtf8());
+        hash.addData((const char*)&_parentIndices[i], sizeof(int));
+        const AnimPose& pose = _relativeDefaultPoses[i];
+        hash.addData((const char*)&pose.scale(), sizeof(glm::vec3));
+        hash.addData((const char*)&pose.rot(), sizeof(glm::quat));
+        hash.addData((const char*)&pose.trans(), sizeof(glm::vec3));
+    }
+    hash.addData((const char*)&_geometryOffset, sizeof(glm::mat4));
+    _fingerprint = hash.result();
 }
 
 void AnimSkeleton::dump(bool verbose) const {
@@ -70,6 +70,9 @@ public:
     void dump(const AnimPoseVec& poses) const;
 
     std::vector<int> lookUpJointIndices(const std::vector<QString>& jointNames) const;
+
+    // hash of everything animations are retargeted against, skeletons with the same fingerprint can share them.
+    const QByteArray& getFingerprint() const { return _fingerprint; }
     const HFMCluster getClusterBindMatricesOriginalValues(const int meshIndex, const int clusterIndex) const { return _clusterBindMatrixOriginalValues[meshIndex][clusterIndex]; }
 
 protected:
@@ -88,6 +91,7 @@ protected:
     QHash<QString, int> _jointIndicesByName;
     std::vector<std::vector<HFMCluster>> _clusterBindMatrixOriginalValues;
     glm::mat4 _geometryOffset;
+    QByteArray _fingerprint;
 
     // no copies
     AnimSkeleton(const AnimSkeleton&) = delete;
@@ -59,14 +59,14 @@ protected:
     QString _baseJointName;
     QString _midJointName;
     QString _tipJointName;
-    QString _basePositionVar;
-    QString _baseRotationVar;
-    QString _midPositionVar;
-    QString _midRotationVar;
-    QString _tipPositionVar;
-    QString _tipRotationVar;
-    QString _alphaVar;  // float - (0, 1) 0 means underPoses only, 1 means IK only.
-    QString _enabledVar;
+    AnimVariantKey _basePositionVar;
+    AnimVariantKey _baseRotationVar;
+    AnimVariantKey _midPositionVar;
+    AnimVariantKey _midRotationVar;
+    AnimVariantKey _tipPositionVar;
+    AnimVariantKey _tipRotationVar;
+    AnimVariantKey _alphaVar;  // float - (0, 1) 0 means underPoses only, 1 means IK only.
+    AnimVariantKey _enabledVar;
 
     float _tipTargetFlexCoefficients[MAX_NUMBER_FLEX_VARIABLES];
     float _midTargetFlexCoefficients[MAX_NUMBER_FLEX_VARIABLES];
@@ -67,7 +67,7 @@ protected:
             friend AnimStateMachine;
             Transition(const QString& var, State::Pointer state) : _var(var), _state(state) {}
         protected:
-            QString _var;
+            AnimVariantKey _var;
             State::Pointer _state;
         };
 
@@ -79,9 +79,9 @@ protected:
             _interpType(interpType),
             _easingType(easingType) {}
 
-        void setInterpTargetVar(const QString& interpTargetVar) { _interpTargetVar = interpTargetVar; }
-        void setInterpDurationVar(const QString& interpDurationVar) { _interpDurationVar = interpDurationVar; }
-        void setInterpTypeVar(const QString& interpTypeVar) { _interpTypeVar = interpTypeVar; }
+        void setInterpTargetVar(const QString& interpTargetVar) { _interpTargetVar = AnimVariantKey(interpTargetVar); }
+        void setInterpDurationVar(const QString& interpDurationVar) { _interpDurationVar = AnimVariantKey(interpDurationVar); }
+        void setInterpTypeVar(const QString& interpTypeVar) { _interpTypeVar = AnimVariantKey(interpTypeVar); }
 
         int getChildIndex() const { return _childIndex; }
         const QString& getID() const { return _id; }
@@ -100,9 +100,9 @@ protected:
         InterpType _interpType;
         EasingType _easingType;
 
-        QString _interpTargetVar;
-        QString _interpDurationVar;
-        QString _interpTypeVar;
+        AnimVariantKey _interpTargetVar;
+        AnimVariantKey _interpDurationVar;
+        AnimVariantKey _interpTypeVar;
 
         std::vector<Transition> _transitions;
 
@@ -119,7 +119,7 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setCurrentStateVar(QString& currentStateVar) { _currentStateVar = currentStateVar; }
+    void setCurrentStateVar(QString& currentStateVar) { _currentStateVar = AnimVariantKey(currentStateVar); }
     const QString& getCurrentStateID() const;
 
 protected:
@@ -149,7 +149,7 @@ protected:
     State::Pointer _previousState;
     std::vector<State::Pointer> _states;
 
-    QString _currentStateVar;
+    AnimVariantKey _currentStateVar;
 
 private:
     // no copies
@@ -11,6 +11,8 @@
 
 #include "AnimVariant.h" // which has AnimVariant/AnimVariantMap
 
+#include <QHash>
+#include <QReadWriteLock>
 #include <QScriptEngine>
 #include <QScriptValueIterator>
 #include <QThread>
@@ -18,6 +20,90 @@
 
 const AnimVariant AnimVariant::False = AnimVariant();
 
+namespace {
+
+// Names are only ever added, so an index stays valid for the lifetime of the process.
+struct KeyTable {
+    QReadWriteLock lock;
+    QHash<QString, int> indices;
+    std::vector<QString> names;
+};
+
+KeyTable& getKeyTable() {
+    static KeyTable table;
+    return table;
+}
+
+}
+
+AnimVariantKey::AnimVariantKey(const QString& name) {
+    if (name.isEmpty()) {
+        return;
+    }
+
+    auto& table = getKeyTable();
+    {
+        QReadLocker locker(&table.lock);
+        auto iter = table.indices.constFind(name);
+        if (iter != table.indices.constEnd()) {
+            _index = iter.value();
+            _name = table.names[_index];
+            return;
+        }
+    }
+
+    QWriteLocker locker(&table.lock);
+    auto iter = table.indices.constFind(name);
+    if (iter != table.indices.constEnd()) {
+        _index = iter.value();
+    } else {
+        _index = (int)table.names.size();
+        table.names.push_back(name);
+        table.indices.insert(name, _index);
+    }
+    _name = table.names[_index];
+}
+
+AnimVariantKey AnimVariantKey::find(const QString& name) {
+    if (name.isEmpty()) {
+        return AnimVariantKey();
+    }
+
+    auto& table = getKeyTable();
+    QReadLocker locker(&table.lock);
+    auto iter = table.indices.constFind(name);
+    if (iter != table.indices.constEnd()) {
+        return AnimVariantKey(iter.value(), table.names[iter.value()]);
+    } else {
+        return AnimVariantKey();
+    }
+}
+
+int AnimVariantKey::getNumKeys() {
+    auto& table = getKeyTable();
+    QReadLocker locker(&table.lock);
+    return (int)table.names.size();
+}
+
+QString AnimVariantKey::getName(int index) {
+    auto& table = getKeyTable();
+    QReadLocker locker(&table.lock);
+    return index >= 0 && index < (int)table.names.size() ? table.names[index] : QString();
+}
+
+QDebug operator<<(QDebug debug, const AnimVariantKey& key) {
+    debug << key.getName();
+    return debug;
+}
+
+void AnimVariantMap::unset(const AnimVariantKey& key) {
+    int index = key.getIndex();
+    if (index >= 0 && index < (int)_isSet.size() && _isSet[index]) {
+        _values[index] = AnimVariant();
+        _isSet[index] = false;
+    }
+}
+
 QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const {
     if (QThread::currentThread() != engine->thread()) {
         qCWarning(animation) << "Cannot create Javacript object from non-script thread" << QThread::currentThread();
@@ -52,25 +138,32 @@ QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine,
     };
     if (useNames) { // copy only the requested names
         for (const QString& name : names) {
-            auto search = _map.find(name);
-            if (search != _map.end()) {
-                setOne(name, search->second);
-            } else if (_triggers.count(name) == 1) {
-                target.setProperty(name, true);
+            auto variant = find(AnimVariantKey::find(name));
+            if (variant) {
+                setOne(name, *variant);
             } // scripts are allowed to request names that do not exist
         }
 
     } else {  // copy all of them
-        for (auto& pair : _map) {
-            setOne(pair.first, pair.second);
+        for (int i = 0; i < (int)_isSet.size(); i++) {
+            if (_isSet[i]) {
+                setOne(AnimVariantKey::getName(i), _values[i]);
+            }
         }
     }
     return target;
 }
 
 void AnimVariantMap::copyVariantsFrom(const AnimVariantMap& other) {
-    for (auto& pair : other._map) {
-        _map[pair.first] = pair.second;
+    if (other._isSet.size() > _isSet.size()) {
+        _values.resize(other._isSet.size());
+        _isSet.resize(other._isSet.size(), false);
+    }
+    for (size_t i = 0; i < other._isSet.size(); i++) {
+        if (other._isSet[i]) {
+            _values[i] = other._values[i];
+            _isSet[i] = true;
+        }
     }
 }
 
@@ -128,21 +221,26 @@ void AnimVariantMap::animVariantMapFromScriptValue(const QScriptValue& source) {
 
 std::map<QString, QString> AnimVariantMap::toDebugMap() const {
     std::map<QString, QString> result;
-    for (auto& pair : _map) {
-        switch (pair.second.getType()) {
+    for (int i = 0; i < (int)_isSet.size(); i++) {
+        if (!_isSet[i]) {
+            continue;
+        }
+        const QString name = AnimVariantKey::getName(i);
+        const AnimVariant& variant = _values[i];
+        switch (variant.getType()) {
         case AnimVariant::Type::Bool:
-            result[pair.first] = QString("%1").arg(pair.second.getBool());
+            result[name] = QString("%1").arg(variant.getBool());
             break;
         case AnimVariant::Type::Int:
-            result[pair.first] = QString("%1").arg(pair.second.getInt());
+            result[name] = QString("%1").arg(variant.getInt());
             break;
         case AnimVariant::Type::Float:
-            result[pair.first] = QString::number(pair.second.getFloat(), 'f', 3);
+            result[name] = QString::number(variant.getFloat(), 'f', 3);
             break;
         case AnimVariant::Type::Vec3: {
             // To prevent filling up debug stats, don't show vec3 values
-            glm::vec3 value = pair.second.getVec3();
-            result[pair.first] = QString("(%1, %2, %3)").
+            glm::vec3 value = variant.getVec3();
+            result[name] = QString("(%1, %2, %3)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3));
@@ -150,8 +248,8 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::Quat: {
             // To prevent filling up the anim stats, don't show quat values
-            glm::quat value = pair.second.getQuat();
-            result[pair.first] = QString("(%1, %2, %3, %4)").
+            glm::quat value = variant.getQuat();
+            result[name] = QString("(%1, %2, %3, %4)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3)).
@@ -160,7 +258,7 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::String:
             // To prevent filling up anim stats, don't show string values
-            result[pair.first] = pair.second.getString();
+            result[name] = variant.getString();
             break;
         default:
             // invalid AnimVariant::Type
@@ -169,3 +267,12 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
     }
     return result;
 }
+
+#ifndef NDEBUG
+void AnimVariantMap::dump() const {
+    qCDebug(animation) << "AnimVariantMap =";
+    for (auto& pair : toDebugMap()) {
+        qCDebug(animation) << "    " << pair.first << "=" << pair.second;
+    }
+}
+#endif
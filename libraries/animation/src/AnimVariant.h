@@ -11,12 +11,13 @@
 #ifndef hifi_AnimVariant_h
 #define hifi_AnimVariant_h
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <map>
-#include <set>
+#include <vector>
 #include <QScriptValue>
 #include <StreamUtils.h>
 #include <GLMHelpers.h>
@@ -114,119 +115,145 @@ protected:
     } _val;
 };
 
+// The name of an AnimVariantMap variable, interned into a process wide table so that maps can be addressed by index
+// instead of hashing and comparing strings. Anim nodes intern the variables they read when the graph is loaded, and
+// code that sets the same variables every frame should keep its keys around rather than build them from strings.
+class AnimVariantKey {
+public:
+    AnimVariantKey() {}
+    explicit AnimVariantKey(const QString& name);
+
+    // Returns the key of a name that has already been interned, or an empty key, without adding the name to the table.
+    static AnimVariantKey find(const QString& name);
+
+    // Number of names interned so far, all key indices are below it.
+    static int getNumKeys();
+    static QString getName(int index);
+
+    bool isEmpty() const { return _index < 0; }
+    int getIndex() const { return _index; }
+    const QString& getName() const { return _name; }
+
+    bool operator==(const AnimVariantKey& other) const { return _index == other._index; }
+    bool operator!=(const AnimVariantKey& other) const { return _index != other._index; }
+
+private:
+    AnimVariantKey(int index, const QString& name) : _index(index), _name(name) {}
+
+    int _index { -1 };
+    QString _name;
+};
+
+QDebug operator<<(QDebug debug, const AnimVariantKey& key);
+
 class AnimVariantMap {
 public:
 
-    bool lookup(const QString& key, bool defaultValue) const {
-        // check triggers first, then map
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else if (_triggers.find(key) != _triggers.end()) {
-            return true;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getBool() : defaultValue;
-        }
+    bool lookup(const AnimVariantKey& key, bool defaultValue) const {
+        auto variant = find(key);
+        return variant ? variant->getBool() : defaultValue;
     }
 
-    int lookup(const QString& key, int defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getInt() : defaultValue;
-        }
+    int lookup(const AnimVariantKey& key, int defaultValue) const {
+        auto variant = find(key);
+        return variant ? variant->getInt() : defaultValue;
     }
 
-    float lookup(const QString& key, float defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getFloat() : defaultValue;
-        }
+    float lookup(const AnimVariantKey& key, float defaultValue) const {
+        auto variant = find(key);
+        return variant ? variant->getFloat() : defaultValue;
     }
 
-    const glm::vec3& lookupRaw(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getVec3() : defaultValue;
-        }
+    const glm::vec3& lookupRaw(const AnimVariantKey& key, const glm::vec3& defaultValue) const {
+        auto variant = find(key);
+        return variant ? variant->getVec3() : defaultValue;
     }
 
-    glm::vec3 lookupRigToGeometry(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformPoint(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+    glm::vec3 lookupRigToGeometry(const AnimVariantKey& key, const glm::vec3& defaultValue) const {
+        auto variant = find(key);
+        return variant ? transformPoint(_rigToGeometryMat, variant->getVec3()) : defaultValue;
     }
 
-    glm::vec3 lookupRigToGeometryVector(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformVectorFast(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+    glm::vec3 lookupRigToGeometryVector(const AnimVariantKey& key, const glm::vec3& defaultValue) const {
+        auto variant = find(key);
+        return variant ? transformVectorFast(_rigToGeometryMat, variant->getVec3()) : defaultValue;
     }
 
-    const glm::quat& lookupRaw(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getQuat() : defaultValue;
-        }
+    const glm::quat& lookupRaw(const AnimVariantKey& key, const glm::quat& defaultValue) const {
+        auto variant = find(key);
+        return variant ? variant->getQuat() : defaultValue;
     }
 
-    glm::quat lookupRigToGeometry(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? _rigToGeometryRot * iter->second.getQuat() : defaultValue;
-        }
+    glm::quat lookupRigToGeometry(const AnimVariantKey& key, const glm::quat& defaultValue) const {
+        auto variant = find(key);
+        return variant ? _rigToGeometryRot * variant->getQuat() : defaultValue;
+    }
+
+    const QString& lookup(const AnimVariantKey& key, const QString& defaultValue) const {
+        auto variant = find(key);
+        return variant ? variant->getString() : defaultValue;
     }
 
+    void set(const AnimVariantKey& key, bool value) { insert(key, AnimVariant(value)); }
+    void set(const AnimVariantKey& key, int value) { insert(key, AnimVariant(value)); }
+    void set(const AnimVariantKey& key, float value) { insert(key, AnimVariant(value)); }
+    void set(const AnimVariantKey& key, const glm::vec3& value) { insert(key, AnimVariant(value)); }
+    void set(const AnimVariantKey& key, const glm::quat& value) { insert(key, AnimVariant(value)); }
+    void set(const AnimVariantKey& key, const QString& value) { insert(key, AnimVariant(value)); }
+    void unset(const AnimVariantKey& key);
+
+    void setTrigger(const AnimVariantKey& key) { insert(key, AnimVariant(true)); }
+
+    bool hasKey(const AnimVariantKey& key) const { return find(key) != nullptr; }
+
+    const AnimVariant& get(const AnimVariantKey& key) const {
+        auto variant = find(key);
+        return variant ? *variant : AnimVariant::False;
+    }
+
+    // String based access, for scripts and for variables that aren't known until runtime.
+    // Looking up a name that was never interned doesn't intern it.
+    bool lookup(const QString& key, bool defaultValue) const { return lookup(AnimVariantKey::find(key), defaultValue); }
+    int lookup(const QString& key, int defaultValue) const { return lookup(AnimVariantKey::find(key), defaultValue); }
+    float lookup(const QString& key, float defaultValue) const { return lookup(AnimVariantKey::find(key), defaultValue); }
+    const glm::vec3& lookupRaw(const QString& key, const glm::vec3& defaultValue) const {
+        return lookupRaw(AnimVariantKey::find(key), defaultValue);
+    }
+    glm::vec3 lookupRigToGeometry(const QString& key, const glm::vec3& defaultValue) const {
+        return lookupRigToGeometry(AnimVariantKey::find(key), defaultValue);
+    }
+    glm::vec3 lookupRigToGeometryVector(const QString& key, const glm::vec3& defaultValue) const {
+        return lookupRigToGeometryVector(AnimVariantKey::find(key), defaultValue);
+    }
+    const glm::quat& lookupRaw(const QString& key, const glm::quat& defaultValue) const {
+        return lookupRaw(AnimVariantKey::find(key), defaultValue);
+    }
+    glm::quat lookupRigToGeometry(const QString& key, const glm::quat& defaultValue) const {
+        return lookupRigToGeometry(AnimVariantKey::find(key), defaultValue);
+    }
     const QString& lookup(const QString& key, const QString& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getString() : defaultValue;
-        }
+        return lookup(AnimVariantKey::find(key), defaultValue);
     }
 
-    void set(const QString& key, bool value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, int value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, float value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::vec3& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::quat& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const QString& value) { _map[key] = AnimVariant(value); }
-    void unset(const QString& key) { _map.erase(key); }
+    void set(const QString& key, bool value) { set(AnimVariantKey(key), value); }
+    void set(const QString& key, int value) { set(AnimVariantKey(key), value); }
+    void set(const QString& key, float value) { set(AnimVariantKey(key), value); }
+    void set(const QString& key, const glm::vec3& value) { set(AnimVariantKey(key), value); }
+    void set(const QString& key, const glm::quat& value) { set(AnimVariantKey(key), value); }
+    void set(const QString& key, const QString& value) { set(AnimVariantKey(key), value); }
+    void unset(const QString& key) { unset(AnimVariantKey::find(key)); }
+
+    void setTrigger(const QString& key) { setTrigger(AnimVariantKey(key)); }
 
-    void setTrigger(const QString& key) { _map[key] = AnimVariant(true); }
+    bool hasKey(const QString& key) const { return hasKey(AnimVariantKey::find(key)); }
+    const AnimVariant& get(const QString& key) const { return get(AnimVariantKey::find(key)); }
 
     void setRigToGeometryTransform(const glm::mat4& rigToGeometry) {
         _rigToGeometryMat = rigToGeometry;
         _rigToGeometryRot = glmExtractRotation(rigToGeometry);
     }
 
-    void clearMap() { _map.clear(); _triggers.clear(); }
-    bool hasKey(const QString& key) const { return _map.find(key) != _map.end(); }
-
-    const AnimVariant& get(const QString& key) const {
-        auto iter = _map.find(key);
-        if (iter != _map.end()) {
-            return iter->second;
-        } else {
-            return AnimVariant::False;
-        }
-    }
+    void clearMap() { _values.clear(); _isSet.clear(); }
 
     // Answer a Plain Old Javascript Object (for the given engine) all of our values set as properties.
     QScriptValue animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const;
@@ -238,38 +265,37 @@ public:
     std::map<QString, QString> toDebugMap() const;
 
 #ifndef NDEBUG
-    void dump() const {
-        qCDebug(animation) << "AnimVariantMap =";
-        for (auto& pair : _map) {
-            switch (pair.second.getType()) {
-            case AnimVariant::Type::Bool:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getBool();
-                break;
-            case AnimVariant::Type::Int:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getInt();
-                break;
-            case AnimVariant::Type::Float:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getFloat();
-                break;
-            case AnimVariant::Type::Vec3:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getVec3();
-                break;
-            case AnimVariant::Type::Quat:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getQuat();
-                break;
-            case AnimVariant::Type::String:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getString();
-                break;
-            default:
-                assert(false);
-            }
-        }
-    }
+    void dump() const;
 #endif
 
 protected:
-    std::map<QString, AnimVariant> _map;
-    std::set<QString> _triggers;
+    const AnimVariant* find(const AnimVariantKey& key) const {
+        int index = key.getIndex();
+        if (index >= 0 && index < (int)_isSet.size() && _isSet[index]) {
+            return &_values[index];
+        } else {
+            return nullptr;
+        }
+    }
+
+    void insert(const AnimVariantKey& key, AnimVariant&& value) {
+        int index = key.getIndex();
+        if (index < 0) {
+            return;
+        }
+        if (index >= (int)_isSet.size()) {
+            // grow to every key known so far, so a map that is filled every frame only grows once
+            size_t size = std::max(index + 1, AnimVariantKey::getNumKeys());
+            _values.resize(size);
+            _isSet.resize(size, false);
+        }
+        _values[index] = std::move(value);
+        _isSet[index] = true;
+    }
+
+    // indexed by AnimVariantKey::getIndex()
+    std::vector<AnimVariant> _values;
+    std::vector<uint8_t> _isSet;
     glm::mat4 _rigToGeometryMat;
     glm::quat _rigToGeometryRot;
 };
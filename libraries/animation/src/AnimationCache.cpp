@@ -20,6 +20,7 @@
 #include <Profile.h>
 
 #include "AnimationLogging.h"
+#include "AnimClipData.h"
 #include <FBXSerializer.h>
 
 int animationPointerMetaTypeId = qRegisterMetaType<AnimationPointer>();
@@ -36,6 +37,41 @@ AnimationPointer AnimationCache::getAnimation(const QUrl& url) {
     return getResource(url).staticCast<Animation>();
 }
 
+AnimClipDataPointer AnimationCache::getClipData(const QString& key, const std::function<AnimClipDataPointer()>& build) {
+    {
+        std::lock_guard<std::mutex> lock(_clipDataMutex);
+        auto iter = _clipData.find(key);
+        if (iter != _clipData.end()) {
+            if (auto clipData = iter.value().lock()) {
+                return clipData;
+            }
+        }
+    }
+
+    // retargeting takes a while, so don't hold the lock.  If two clips race to build the same key, the first one
+    // in wins and the other copy is dropped.
+    AnimClipDataPointer clipData = build();
+    if (!clipData) {
+        return clipData;
+    }
+
+    std::lock_guard<std::mutex> lock(_clipDataMutex);
+    auto& entry = _clipData[key];
+    if (auto existing = entry.lock()) {
+        return existing;
+    }
+    entry = clipData;
+
+    for (auto iter = _clipData.begin(); iter != _clipData.end();) {
+        if (iter.value().expired()) {
+            iter = _clipData.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    return clipData;
+}
+
 QSharedPointer<Resource> AnimationCache::createResource(const QUrl& url) {
     return QSharedPointer<Resource>(new Animation(url), &Resource::deleter);
 }
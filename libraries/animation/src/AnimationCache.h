@@ -12,6 +12,11 @@
 #ifndef hifi_AnimationCache_h
 #define hifi_AnimationCache_h
 
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QHash>
 #include <QtCore/QRunnable>
 #include <QtScript/QScriptEngine>
 #include <QtScript/QScriptValue>
@@ -21,8 +26,10 @@
 #include <ResourceCache.h>
 
 class Animation;
+class AnimClipData;
 
 using AnimationPointer = QSharedPointer<Animation>;
+using AnimClipDataPointer = std::shared_ptr<const AnimClipData>;
 
 class AnimationCache : public ResourceCache, public Dependency  {
     Q_OBJECT
@@ -33,6 +40,10 @@ public:
     Q_INVOKABLE AnimationPointer getAnimation(const QString& url) { return getAnimation(QUrl(url)); }
     Q_INVOKABLE AnimationPointer getAnimation(const QUrl& url);
 
+    /// Retargeted clips are shared by every AnimClip with the same key while any of them is alive.  build is
+    /// only called when there is no live clip for the key, and may be called from any thread.
+    AnimClipDataPointer getClipData(const QString& key, const std::function<AnimClipDataPointer()>& build);
+
 protected:
     virtual QSharedPointer<Resource> createResource(const QUrl& url) override;
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
@@ -41,6 +52,9 @@ private:
     explicit AnimationCache(QObject* parent = NULL);
     virtual ~AnimationCache() { }
 
+    std::mutex _clipDataMutex;
+    QHash<QString, std::weak_ptr<const AnimClipData>> _clipData;
+
 };
 
 Q_DECLARE_METATYPE(AnimationPointer)
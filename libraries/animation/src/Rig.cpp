@@ -62,32 +62,127 @@ const glm::vec3 DEFAULT_HEAD_POS(0.0f, 0.75f, 0.0f);
 
 static const QString LEFT_FOOT_POSITION("leftFootPosition");
 static const QString LEFT_FOOT_ROTATION("leftFootRotation");
-static const QString LEFT_FOOT_IK_POSITION_VAR("leftFootIKPositionVar");
-static const QString LEFT_FOOT_IK_ROTATION_VAR("leftFootIKRotationVar");
+static const AnimVariantKey LEFT_FOOT_IK_POSITION_VAR("leftFootIKPositionVar");
+static const AnimVariantKey LEFT_FOOT_IK_ROTATION_VAR("leftFootIKRotationVar");
 static const QString MAIN_STATE_MACHINE_LEFT_FOOT_POSITION("mainStateMachineLeftFootPosition");
 static const QString MAIN_STATE_MACHINE_LEFT_FOOT_ROTATION("mainStateMachineLeftFootRotation");
 
 static const QString RIGHT_FOOT_POSITION("rightFootPosition");
 static const QString RIGHT_FOOT_ROTATION("rightFootRotation");
-static const QString RIGHT_FOOT_IK_POSITION_VAR("rightFootIKPositionVar");
-static const QString RIGHT_FOOT_IK_ROTATION_VAR("rightFootIKRotationVar");
+static const AnimVariantKey RIGHT_FOOT_IK_POSITION_VAR("rightFootIKPositionVar");
+static const AnimVariantKey RIGHT_FOOT_IK_ROTATION_VAR("rightFootIKRotationVar");
 static const QString MAIN_STATE_MACHINE_RIGHT_FOOT_ROTATION("mainStateMachineRightFootRotation");
 static const QString MAIN_STATE_MACHINE_RIGHT_FOOT_POSITION("mainStateMachineRightFootPosition");
 
 static const QString LEFT_HAND_POSITION("leftHandPosition");
 static const QString LEFT_HAND_ROTATION("leftHandRotation");
-static const QString LEFT_HAND_IK_POSITION_VAR("leftHandIKPositionVar");
-static const QString LEFT_HAND_IK_ROTATION_VAR("leftHandIKRotationVar");
+static const AnimVariantKey LEFT_HAND_IK_POSITION_VAR("leftHandIKPositionVar");
+static const AnimVariantKey LEFT_HAND_IK_ROTATION_VAR("leftHandIKRotationVar");
 static const QString MAIN_STATE_MACHINE_LEFT_HAND_POSITION("mainStateMachineLeftHandPosition");
 static const QString MAIN_STATE_MACHINE_LEFT_HAND_ROTATION("mainStateMachineLeftHandRotation");
 
 static const QString RIGHT_HAND_POSITION("rightHandPosition");
 static const QString RIGHT_HAND_ROTATION("rightHandRotation");
-static const QString RIGHT_HAND_IK_POSITION_VAR("rightHandIKPositionVar");
-static const QString RIGHT_HAND_IK_ROTATION_VAR("rightHandIKRotationVar");
+static const AnimVariantKey RIGHT_HAND_IK_POSITION_VAR("rightHandIKPositionVar");
+static const AnimVariantKey RIGHT_HAND_IK_ROTATION_VAR("rightHandIKRotationVar");
 static const QString MAIN_STATE_MACHINE_RIGHT_HAND_ROTATION("mainStateMachineRightHandRotation");
 static const QString MAIN_STATE_MACHINE_RIGHT_HAND_POSITION("mainStateMachineRightHandPosition");
 
+// Variables that are set every frame, interned up front so that setting them doesn't hash their names
+static const AnimVariantKey DEFAULT_POSE_OVERLAY_ALPHA_KEY("defaultPoseOverlayAlpha");
+static const AnimVariantKey DEFAULT_POSE_OVERLAY_BONE_SET_KEY("defaultPoseOverlayBoneSet");
+static const AnimVariantKey HEAD_POSITION_KEY("headPosition");
+static const AnimVariantKey HEAD_ROTATION_KEY("headRotation");
+static const AnimVariantKey HEAD_TYPE_KEY("headType");
+static const AnimVariantKey HEAD_WEIGHT_KEY("headWeight");
+static const AnimVariantKey HIPS_POSITION_KEY("hipsPosition");
+static const AnimVariantKey HIPS_ROTATION_KEY("hipsRotation");
+static const AnimVariantKey HIPS_TYPE_KEY("hipsType");
+static const AnimVariantKey IDLE_OVERLAY_ALPHA_KEY("idleOverlayAlpha");
+static const AnimVariantKey IK_OVERLAY_ALPHA_KEY("ikOverlayAlpha");
+static const AnimVariantKey IN_AIR_ALPHA_KEY("inAirAlpha");
+static const AnimVariantKey IS_FLYING_KEY("isFlying");
+static const AnimVariantKey IS_IN_AIR_RUN_KEY("isInAirRun");
+static const AnimVariantKey IS_IN_AIR_STAND_KEY("isInAirStand");
+static const AnimVariantKey IS_INPUT_BACKWARD_KEY("isInputBackward");
+static const AnimVariantKey IS_INPUT_FORWARD_KEY("isInputForward");
+static const AnimVariantKey IS_INPUT_LEFT_KEY("isInputLeft");
+static const AnimVariantKey IS_INPUT_RIGHT_KEY("isInputRight");
+static const AnimVariantKey IS_MOVING_BACKWARD_KEY("isMovingBackward");
+static const AnimVariantKey IS_MOVING_FORWARD_KEY("isMovingForward");
+static const AnimVariantKey IS_MOVING_LEFT_KEY("isMovingLeft");
+static const AnimVariantKey IS_MOVING_LEFT_HMD_KEY("isMovingLeftHmd");
+static const AnimVariantKey IS_MOVING_RIGHT_KEY("isMovingRight");
+static const AnimVariantKey IS_MOVING_RIGHT_HMD_KEY("isMovingRightHmd");
+static const AnimVariantKey IS_NOT_FLYING_KEY("isNotFlying");
+static const AnimVariantKey IS_NOT_IN_AIR_KEY("isNotInAir");
+static const AnimVariantKey IS_NOT_INPUT_KEY("isNotInput");
+static const AnimVariantKey IS_NOT_INPUT_NO_MOMENTUM_KEY("isNotInputNoMomentum");
+static const AnimVariantKey IS_NOT_INPUT_SLOW_KEY("isNotInputSlow");
+static const AnimVariantKey IS_NOT_MOVING_KEY("isNotMoving");
+static const AnimVariantKey IS_NOT_SEATED_KEY("isNotSeated");
+static const AnimVariantKey IS_NOT_TAKEOFF_KEY("isNotTakeoff");
+static const AnimVariantKey IS_NOT_TURNING_KEY("isNotTurning");
+static const AnimVariantKey IS_SEATED_KEY("isSeated");
+static const AnimVariantKey IS_SEATED_NOT_TURNING_KEY("isSeatedNotTurning");
+static const AnimVariantKey IS_SEATED_TURNING_LEFT_KEY("isSeatedTurningLeft");
+static const AnimVariantKey IS_SEATED_TURNING_RIGHT_KEY("isSeatedTurningRight");
+static const AnimVariantKey IS_TAKEOFF_RUN_KEY("isTakeoffRun");
+static const AnimVariantKey IS_TAKEOFF_STAND_KEY("isTakeoffStand");
+static const AnimVariantKey IS_TURNING_LEFT_KEY("isTurningLeft");
+static const AnimVariantKey IS_TURNING_RIGHT_KEY("isTurningRight");
+static const AnimVariantKey LEFT_FOOT_IK_ENABLED_KEY("leftFootIKEnabled");
+static const AnimVariantKey LEFT_FOOT_POLE_VECTOR_KEY("leftFootPoleVector");
+static const AnimVariantKey LEFT_FOOT_POLE_VECTOR_ENABLED_KEY("leftFootPoleVectorEnabled");
+static const AnimVariantKey LEFT_FOOT_POSITION_KEY("leftFootPosition");
+static const AnimVariantKey LEFT_FOOT_ROTATION_KEY("leftFootRotation");
+static const AnimVariantKey LEFT_HAND_ANIM_A_KEY("leftHandAnimA");
+static const AnimVariantKey LEFT_HAND_ANIM_B_KEY("leftHandAnimB");
+static const AnimVariantKey LEFT_HAND_ANIM_NONE_KEY("leftHandAnimNone");
+static const AnimVariantKey LEFT_HAND_IK_ENABLED_KEY("leftHandIKEnabled");
+static const AnimVariantKey LEFT_HAND_POLE_REFERENCE_VECTOR_KEY("leftHandPoleReferenceVector");
+static const AnimVariantKey LEFT_HAND_POLE_VECTOR_KEY("leftHandPoleVector");
+static const AnimVariantKey LEFT_HAND_POLE_VECTOR_ENABLED_KEY("leftHandPoleVectorEnabled");
+static const AnimVariantKey LEFT_HAND_POSITION_KEY("leftHandPosition");
+static const AnimVariantKey LEFT_HAND_ROTATION_KEY("leftHandRotation");
+static const AnimVariantKey LEFT_HAND_TYPE_KEY("leftHandType");
+static const AnimVariantKey MOVE_BACKWARD_SPEED_KEY("moveBackwardSpeed");
+static const AnimVariantKey MOVE_FORWARD_SPEED_KEY("moveForwardSpeed");
+static const AnimVariantKey MOVE_LATERAL_SPEED_KEY("moveLateralSpeed");
+static const AnimVariantKey REACTION_APPLAUD_DISABLED_KEY("reactionApplaudDisabled");
+static const AnimVariantKey REACTION_APPLAUD_ENABLED_KEY("reactionApplaudEnabled");
+static const AnimVariantKey REACTION_NEGATIVE_TRIGGER_KEY("reactionNegativeTrigger");
+static const AnimVariantKey REACTION_POINT_DISABLED_KEY("reactionPointDisabled");
+static const AnimVariantKey REACTION_POINT_ENABLED_KEY("reactionPointEnabled");
+static const AnimVariantKey REACTION_POSITIVE_TRIGGER_KEY("reactionPositiveTrigger");
+static const AnimVariantKey REACTION_RAISE_HAND_DISABLED_KEY("reactionRaiseHandDisabled");
+static const AnimVariantKey REACTION_RAISE_HAND_ENABLED_KEY("reactionRaiseHandEnabled");
+static const AnimVariantKey RIGHT_FOOT_IK_ENABLED_KEY("rightFootIKEnabled");
+static const AnimVariantKey RIGHT_FOOT_POLE_VECTOR_KEY("rightFootPoleVector");
+static const AnimVariantKey RIGHT_FOOT_POLE_VECTOR_ENABLED_KEY("rightFootPoleVectorEnabled");
+static const AnimVariantKey RIGHT_FOOT_POSITION_KEY("rightFootPosition");
+static const AnimVariantKey RIGHT_FOOT_ROTATION_KEY("rightFootRotation");
+static const AnimVariantKey RIGHT_HAND_ANIM_A_KEY("rightHandAnimA");
+static const AnimVariantKey RIGHT_HAND_ANIM_B_KEY("rightHandAnimB");
+static const AnimVariantKey RIGHT_HAND_ANIM_NONE_KEY("rightHandAnimNone");
+static const AnimVariantKey RIGHT_HAND_IK_ENABLED_KEY("rightHandIKEnabled");
+static const AnimVariantKey RIGHT_HAND_POLE_REFERENCE_VECTOR_KEY("rightHandPoleReferenceVector");
+static const AnimVariantKey RIGHT_HAND_POLE_VECTOR_KEY("rightHandPoleVector");
+static const AnimVariantKey RIGHT_HAND_POLE_VECTOR_ENABLED_KEY("rightHandPoleVectorEnabled");
+static const AnimVariantKey RIGHT_HAND_POSITION_KEY("rightHandPosition");
+static const AnimVariantKey RIGHT_HAND_ROTATION_KEY("rightHandRotation");
+static const AnimVariantKey RIGHT_HAND_TYPE_KEY("rightHandType");
+static const AnimVariantKey SINE_KEY("sine");
+static const AnimVariantKey SOLUTION_SOURCE_KEY("solutionSource");
+static const AnimVariantKey SPINE2_POSITION_KEY("spine2Position");
+static const AnimVariantKey SPINE2_ROTATION_KEY("spine2Rotation");
+static const AnimVariantKey SPINE2_TYPE_KEY("spine2Type");
+static const AnimVariantKey SPLINE_IK_ENABLED_KEY("splineIKEnabled");
+static const AnimVariantKey TALK_OVERLAY_ALPHA_KEY("talkOverlayAlpha");
+static const AnimVariantKey USER_ANIM_A_KEY("userAnimA");
+static const AnimVariantKey USER_ANIM_B_KEY("userAnimB");
+static const AnimVariantKey USER_ANIM_NONE_KEY("userAnimNone");
+
 
 /*@jsdoc
  * <p>An <code>AnimStateDictionary</code> object may have the following properties. It may also have other properties, set by 
@@ -355,9 +450,9 @@ void Rig::overrideAnimation(const QString& url, float fps, bool loop, float firs
     _userAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
 
     // notify the userAnimStateMachine the desired state.
-    _animVars.set("userAnimNone", false);
-    _animVars.set("userAnimA", clipNodeEnum == UserAnimState::A);
-    _animVars.set("userAnimB", clipNodeEnum == UserAnimState::B);
+    _animVars.set(USER_ANIM_NONE_KEY, false);
+    _animVars.set(USER_ANIM_A_KEY, clipNodeEnum == UserAnimState::A);
+    _animVars.set(USER_ANIM_B_KEY, clipNodeEnum == UserAnimState::B);
 }
 
 void Rig::restoreAnimation() {
@@ -365,9 +460,9 @@ void Rig::restoreAnimation() {
         _userAnimState.clipNodeEnum = UserAnimState::None;
 
         // notify the userAnimStateMachine the desired state.
-        _animVars.set("userAnimNone", true);
-        _animVars.set("userAnimA", false);
-        _animVars.set("userAnimB", false);
+        _animVars.set(USER_ANIM_NONE_KEY, true);
+        _animVars.set(USER_ANIM_A_KEY, false);
+        _animVars.set(USER_ANIM_B_KEY, false);
     }
 }
 
@@ -419,15 +514,15 @@ void Rig::overrideHandAnimation(bool isLeft, const QString& url, float fps, bool
     if (isLeft) {
         // store current hand anim state.
         _leftHandAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
-        _animVars.set("leftHandAnimNone", false);
-        _animVars.set("leftHandAnimA", clipNodeEnum == HandAnimState::A);
-        _animVars.set("leftHandAnimB", clipNodeEnum == HandAnimState::B);
+        _animVars.set(LEFT_HAND_ANIM_NONE_KEY, false);
+        _animVars.set(LEFT_HAND_ANIM_A_KEY, clipNodeEnum == HandAnimState::A);
+        _animVars.set(LEFT_HAND_ANIM_B_KEY, clipNodeEnum == HandAnimState::B);
     } else {
         // store current hand anim state.
         _rightHandAnimState = { clipNodeEnum, url, fps, loop, firstFrame, lastFrame };
-        _animVars.set("rightHandAnimNone", false);
-        _animVars.set("rightHandAnimA", clipNodeEnum == HandAnimState::A);
-        _animVars.set("rightHandAnimB", clipNodeEnum == HandAnimState::B);
+        _animVars.set(RIGHT_HAND_ANIM_NONE_KEY, false);
+        _animVars.set(RIGHT_HAND_ANIM_A_KEY, clipNodeEnum == HandAnimState::A);
+        _animVars.set(RIGHT_HAND_ANIM_B_KEY, clipNodeEnum == HandAnimState::B);
     }
 }
 
@@ -437,18 +532,18 @@ void Rig::restoreHandAnimation(bool isLeft) {
             _leftHandAnimState.clipNodeEnum = HandAnimState::None;
 
             // notify the handAnimStateMachine the desired state.
-            _animVars.set("leftHandAnimNone", true);
-            _animVars.set("leftHandAnimA", false);
-            _animVars.set("leftHandAnimB", false);
+            _animVars.set(LEFT_HAND_ANIM_NONE_KEY, true);
+            _animVars.set(LEFT_HAND_ANIM_A_KEY, false);
+            _animVars.set(LEFT_HAND_ANIM_B_KEY, false);
         }
     } else {
         if (_rightHandAnimState.clipNodeEnum != HandAnimState::None) {
             _rightHandAnimState.clipNodeEnum = HandAnimState::None;
 
             // notify the handAnimStateMachine the desired state.
-            _animVars.set("rightHandAnimNone", true);
-            _animVars.set("rightHandAnimA", false);
-            _animVars.set("rightHandAnimB", false);
+            _animVars.set(RIGHT_HAND_ANIM_NONE_KEY, true);
+            _animVars.set(RIGHT_HAND_ANIM_A_KEY, false);
+            _animVars.set(RIGHT_HAND_ANIM_B_KEY, false);
         }
     }
 }
@@ -1083,10 +1178,10 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
 
         // sine wave LFO var for testing.
         static float t = 0.0f;
-        _animVars.set("sine", 2.0f * 0.5f * sinf(t) + 0.5f);
-        _animVars.set("moveForwardSpeed", _averageForwardSpeed.getAverage());
-        _animVars.set("moveBackwardSpeed", -_averageForwardSpeed.getAverage());
-        _animVars.set("moveLateralSpeed", fabsf(_averageLateralSpeed.getAverage()));
+        _animVars.set(SINE_KEY, 2.0f * 0.5f * sinf(t) + 0.5f);
+        _animVars.set(MOVE_FORWARD_SPEED_KEY, _averageForwardSpeed.getAverage());
+        _animVars.set(MOVE_BACKWARD_SPEED_KEY, -_averageForwardSpeed.getAverage());
+        _animVars.set(MOVE_LATERAL_SPEED_KEY, fabsf(_averageLateralSpeed.getAverage()));
 
         const float MOVE_ENTER_SPEED_THRESHOLD = 0.2f; // m/sec
         const float MOVE_EXIT_SPEED_THRESHOLD = 0.07f;  // m/sec
@@ -1184,228 +1279,228 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
                 if (fabsf(forwardSpeed) > 0.5f * fabsf(lateralSpeed)) {
                     if (forwardSpeed > 0.0f) {
                         // forward
-                        _animVars.set("isMovingForward", true);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isMovingRight", false);
-                        _animVars.set("isMovingLeft", false);
-                        _animVars.set("isMovingRightHmd", false);
-                        _animVars.set("isMovingLeftHmd", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD_KEY, true);
+                        _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+                        _animVars.set(IS_MOVING_RIGHT_KEY, false);
+                        _animVars.set(IS_MOVING_LEFT_KEY, false);
+                        _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+                        _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+                        _animVars.set(IS_NOT_MOVING_KEY, false);
 
                     } else {
                         // backward
-                        _animVars.set("isMovingBackward", true);
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingRight", false);
-                        _animVars.set("isMovingLeft", false);
-                        _animVars.set("isMovingRightHmd", false);
-                        _animVars.set("isMovingLeftHmd", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_BACKWARD_KEY, true);
+                        _animVars.set(IS_MOVING_FORWARD_KEY, false);
+                        _animVars.set(IS_MOVING_RIGHT_KEY, false);
+                        _animVars.set(IS_MOVING_LEFT_KEY, false);
+                        _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+                        _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+                        _animVars.set(IS_NOT_MOVING_KEY, false);
                     }
                 } else {
                     if (lateralSpeed > 0.0f) {
                         // right
                         if (!_headEnabled) {
-                            _animVars.set("isMovingRight", true);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT_KEY, true);
+                            _animVars.set(IS_MOVING_LEFT_KEY, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
                         } else {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", true);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+                            _animVars.set(IS_MOVING_LEFT_KEY, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, true);
+                            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
                         }
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD_KEY, false);
+                        _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+                        _animVars.set(IS_NOT_MOVING_KEY, false);
                     } else {
                         // left
                         if (!_headEnabled) {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", true);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", false);
+                            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+                            _animVars.set(IS_MOVING_LEFT_KEY, true);
+                            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
                         } else {
-                            _animVars.set("isMovingRight", false);
-                            _animVars.set("isMovingLeft", false);
-                            _animVars.set("isMovingRightHmd", false);
-                            _animVars.set("isMovingLeftHmd", true);
+                            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+                            _animVars.set(IS_MOVING_LEFT_KEY, false);
+                            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+                            _animVars.set(IS_MOVING_LEFT_HMD_KEY, true);
                         }
-                        _animVars.set("isMovingForward", false);
-                        _animVars.set("isMovingBackward", false);
-                        _animVars.set("isNotMoving", false);
+                        _animVars.set(IS_MOVING_FORWARD_KEY, false);
+                        _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+                        _animVars.set(IS_NOT_MOVING_KEY, false);
                     }
                 }
             }
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_NOT_TURNING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, false);
+            _animVars.set(IS_NOT_FLYING_KEY, true);
+            _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+            _animVars.set(IS_TAKEOFF_RUN_KEY, false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, true);
+            _animVars.set(IS_IN_AIR_STAND_KEY, false);
+            _animVars.set(IS_IN_AIR_RUN_KEY, false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, true);
+            _animVars.set(IS_SEATED_KEY, false);
+            _animVars.set(IS_NOT_SEATED_KEY, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
 
         } else if (_state == RigRole::Turn) {
             if (turningSpeed > 0.0f) {
                 // turning right
-                _animVars.set("isTurningRight", true);
-                _animVars.set("isTurningLeft", false);
-                _animVars.set("isNotTurning", false);
+                _animVars.set(IS_TURNING_RIGHT_KEY, true);
+                _animVars.set(IS_TURNING_LEFT_KEY, false);
+                _animVars.set(IS_NOT_TURNING_KEY, false);
             } else {
                 // turning left
-                _animVars.set("isTurningRight", false);
-                _animVars.set("isTurningLeft", true);
-                _animVars.set("isNotTurning", false);
+                _animVars.set(IS_TURNING_RIGHT_KEY, false);
+                _animVars.set(IS_TURNING_LEFT_KEY, true);
+                _animVars.set(IS_NOT_TURNING_KEY, false);
             }
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD_KEY, false);
+            _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+            _animVars.set(IS_NOT_MOVING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, false);
+            _animVars.set(IS_NOT_FLYING_KEY, true);
+            _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+            _animVars.set(IS_TAKEOFF_RUN_KEY, false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, true);
+            _animVars.set(IS_IN_AIR_STAND_KEY, false);
+            _animVars.set(IS_IN_AIR_RUN_KEY, false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, true);
+            _animVars.set(IS_SEATED_KEY, false);
+            _animVars.set(IS_NOT_SEATED_KEY, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
 
         } else if (_state == RigRole::Idle) {
             // default anim vars to notMoving and notTurning
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD_KEY, false);
+            _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+            _animVars.set(IS_NOT_MOVING_KEY, true);
+            _animVars.set(IS_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_NOT_TURNING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, false);
+            _animVars.set(IS_NOT_FLYING_KEY, true);
+            _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+            _animVars.set(IS_TAKEOFF_RUN_KEY, false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, true);
+            _animVars.set(IS_IN_AIR_STAND_KEY, false);
+            _animVars.set(IS_IN_AIR_RUN_KEY, false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, true);
+            _animVars.set(IS_SEATED_KEY, false);
+            _animVars.set(IS_NOT_SEATED_KEY, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
 
         } else if (_state == RigRole::Hover) {
             // flying.
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", true);
-            _animVars.set("isNotFlying", false);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD_KEY, false);
+            _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+            _animVars.set(IS_NOT_MOVING_KEY, true);
+            _animVars.set(IS_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_NOT_TURNING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, true);
+            _animVars.set(IS_NOT_FLYING_KEY, false);
+            _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+            _animVars.set(IS_TAKEOFF_RUN_KEY, false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, true);
+            _animVars.set(IS_IN_AIR_STAND_KEY, false);
+            _animVars.set(IS_IN_AIR_RUN_KEY, false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, true);
+            _animVars.set(IS_SEATED_KEY, false);
+            _animVars.set(IS_NOT_SEATED_KEY, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
 
         } else if (_state == RigRole::Takeoff) {
             // jumping in-air
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
+            _animVars.set(IS_MOVING_FORWARD_KEY, false);
+            _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+            _animVars.set(IS_NOT_MOVING_KEY, true);
+            _animVars.set(IS_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_NOT_TURNING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, false);
+            _animVars.set(IS_NOT_FLYING_KEY, true);
 
             bool takeOffRun = forwardSpeed > 0.1f;
             if (takeOffRun) {
-                _animVars.set("isTakeoffStand", false);
-                _animVars.set("isTakeoffRun", true);
+                _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+                _animVars.set(IS_TAKEOFF_RUN_KEY, true);
             } else {
-                _animVars.set("isTakeoffStand", true);
-                _animVars.set("isTakeoffRun", false);
+                _animVars.set(IS_TAKEOFF_STAND_KEY, true);
+                _animVars.set(IS_TAKEOFF_RUN_KEY, false);
             }
 
-            _animVars.set("isNotTakeoff", false);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", false);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, false);
+            _animVars.set(IS_IN_AIR_STAND_KEY, false);
+            _animVars.set(IS_IN_AIR_RUN_KEY, false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, false);
+            _animVars.set(IS_SEATED_KEY, false);
+            _animVars.set(IS_NOT_SEATED_KEY, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
 
         } else if (_state == RigRole::InAir) {
             // jumping in-air
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", true);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isSeated", false);
-            _animVars.set("isNotSeated", true);
-            _animVars.set("isSeatedTurningRight", false);
-            _animVars.set("isSeatedTurningLeft", false);
-            _animVars.set("isSeatedNotTurning", false);
+            _animVars.set(IS_MOVING_FORWARD_KEY, false);
+            _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+            _animVars.set(IS_NOT_MOVING_KEY, true);
+            _animVars.set(IS_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_NOT_TURNING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, false);
+            _animVars.set(IS_NOT_FLYING_KEY, true);
+            _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+            _animVars.set(IS_TAKEOFF_RUN_KEY, false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, true);
+            _animVars.set(IS_SEATED_KEY, false);
+            _animVars.set(IS_NOT_SEATED_KEY, true);
+            _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
 
             bool inAirRun = forwardSpeed > 0.1f;
             if (inAirRun) {
-                _animVars.set("isInAirStand", false);
-                _animVars.set("isInAirRun", true);
+                _animVars.set(IS_IN_AIR_STAND_KEY, false);
+                _animVars.set(IS_IN_AIR_RUN_KEY, true);
             } else {
-                _animVars.set("isInAirStand", true);
-                _animVars.set("isInAirRun", false);
+                _animVars.set(IS_IN_AIR_STAND_KEY, true);
+                _animVars.set(IS_IN_AIR_RUN_KEY, false);
             }
-            _animVars.set("isNotInAir", false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, false);
 
             // We want to preserve the apparent jump height in sensor space.
             const float jumpHeight = std::max(sensorToWorldScale * DEFAULT_AVATAR_JUMP_HEIGHT, DEFAULT_AVATAR_MIN_JUMP_HEIGHT);
@@ -1416,62 +1511,62 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
             // compute inAirAlpha blend based on velocity
             float alpha = glm::clamp((-workingVelocity.y * sensorToWorldScale) / jumpSpeed, -1.0f, 1.0f) + 1.0f;
 
-            _animVars.set("inAirAlpha", alpha);
+            _animVars.set(IN_AIR_ALPHA_KEY, alpha);
         } else if (_state == RigRole::Seated) {
             if (fabsf(_previousControllerParameters.inputX) <= INPUT_DEADZONE_THRESHOLD) {
                 // seated not turning
-                _animVars.set("isSeatedTurningRight", false);
-                _animVars.set("isSeatedTurningLeft", false);
-                _animVars.set("isSeatedNotTurning", true);
+                _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+                _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+                _animVars.set(IS_SEATED_NOT_TURNING_KEY, true);
             } else if (_previousControllerParameters.inputX > 0.0f) {
                 // seated turning right
-                _animVars.set("isSeatedTurningRight", true);
-                _animVars.set("isSeatedTurningLeft", false);
-                _animVars.set("isSeatedNotTurning", false);
+                _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, true);
+                _animVars.set(IS_SEATED_TURNING_LEFT_KEY, false);
+                _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
             } else {
                 // seated turning left
-                _animVars.set("isSeatedTurningRight", false);
-                _animVars.set("isSeatedTurningLeft", true);
-                _animVars.set("isSeatedNotTurning", false);
+                _animVars.set(IS_SEATED_TURNING_RIGHT_KEY, false);
+                _animVars.set(IS_SEATED_TURNING_LEFT_KEY, true);
+                _animVars.set(IS_SEATED_NOT_TURNING_KEY, false);
             }
 
-            _animVars.set("isMovingForward", false);
-            _animVars.set("isMovingBackward", false);
-            _animVars.set("isMovingRight", false);
-            _animVars.set("isMovingLeft", false);
-            _animVars.set("isMovingRightHmd", false);
-            _animVars.set("isMovingLeftHmd", false);
-            _animVars.set("isNotMoving", false);
-            _animVars.set("isTurningRight", false);
-            _animVars.set("isTurningLeft", false);
-            _animVars.set("isNotTurning", true);
-            _animVars.set("isFlying", false);
-            _animVars.set("isNotFlying", true);
-            _animVars.set("isTakeoffStand", false);
-            _animVars.set("isTakeoffRun", false);
-            _animVars.set("isNotTakeoff", true);
-            _animVars.set("isInAirStand", false);
-            _animVars.set("isInAirRun", false);
-            _animVars.set("isNotInAir", true);
-            _animVars.set("isSeated", true);
-            _animVars.set("isNotSeated", false);
+            _animVars.set(IS_MOVING_FORWARD_KEY, false);
+            _animVars.set(IS_MOVING_BACKWARD_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_KEY, false);
+            _animVars.set(IS_MOVING_RIGHT_HMD_KEY, false);
+            _animVars.set(IS_MOVING_LEFT_HMD_KEY, false);
+            _animVars.set(IS_NOT_MOVING_KEY, false);
+            _animVars.set(IS_TURNING_RIGHT_KEY, false);
+            _animVars.set(IS_TURNING_LEFT_KEY, false);
+            _animVars.set(IS_NOT_TURNING_KEY, true);
+            _animVars.set(IS_FLYING_KEY, false);
+            _animVars.set(IS_NOT_FLYING_KEY, true);
+            _animVars.set(IS_TAKEOFF_STAND_KEY, false);
+            _animVars.set(IS_TAKEOFF_RUN_KEY, false);
+            _animVars.set(IS_NOT_TAKEOFF_KEY, true);
+            _animVars.set(IS_IN_AIR_STAND_KEY, false);
+            _animVars.set(IS_IN_AIR_RUN_KEY, false);
+            _animVars.set(IS_NOT_IN_AIR_KEY, true);
+            _animVars.set(IS_SEATED_KEY, true);
+            _animVars.set(IS_NOT_SEATED_KEY, false);
         }
 
         t += deltaTime;
 
         if (_enableInverseKinematics) {
-            _animVars.set("ikOverlayAlpha", 1.0f);
+            _animVars.set(IK_OVERLAY_ALPHA_KEY, 1.0f);
         } else {
-            _animVars.set("ikOverlayAlpha", 0.0f);
-            _animVars.set("splineIKEnabled", false);
-            _animVars.set("leftHandIKEnabled", false);
-            _animVars.set("rightHandIKEnabled", false);
-            _animVars.set("leftFootIKEnabled", false);
-            _animVars.set("rightFootIKEnabled", false);
-            _animVars.set("leftHandPoleVectorEnabled", false);
-            _animVars.set("rightHandPoleVectorEnabled", false);
-            _animVars.set("leftFootPoleVectorEnabled", false);
-            _animVars.set("rightFootPoleVectorEnabled", false);
+            _animVars.set(IK_OVERLAY_ALPHA_KEY, 0.0f);
+            _animVars.set(SPLINE_IK_ENABLED_KEY, false);
+            _animVars.set(LEFT_HAND_IK_ENABLED_KEY, false);
+            _animVars.set(RIGHT_HAND_IK_ENABLED_KEY, false);
+            _animVars.set(LEFT_FOOT_IK_ENABLED_KEY, false);
+            _animVars.set(RIGHT_FOOT_IK_ENABLED_KEY, false);
+            _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED_KEY, false);
+            _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED_KEY, false);
+            _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED_KEY, false);
+            _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED_KEY, false);
         }
         _lastEnableInverseKinematics = _enableInverseKinematics;
 
@@ -1490,31 +1585,31 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
                 }
 
 
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
+                _animVars.set(IS_INPUT_FORWARD_KEY, false);
+                _animVars.set(IS_INPUT_BACKWARD_KEY, false);
+                _animVars.set(IS_INPUT_RIGHT_KEY, false);
+                _animVars.set(IS_INPUT_LEFT_KEY, false);
 
                 // directly reflects input
-                _animVars.set("isNotInput", true);  
+                _animVars.set(IS_NOT_INPUT_KEY, true);  
 
                 // no input + speed drops to SLOW_SPEED_THRESHOLD
                 // (don't transition run->idle - slow to walk first)
-                _animVars.set("isNotInputSlow", _isMovingWithMomentum);
+                _animVars.set(IS_NOT_INPUT_SLOW_KEY, _isMovingWithMomentum);
 
                 // no input + speed didn't get above HAS_MOMENTUM_THRESHOLD since last idle
                 // (brief inputs and movement adjustments)
-                _animVars.set("isNotInputNoMomentum", !_isMovingWithMomentum);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM_KEY, !_isMovingWithMomentum);
 
 
             } else {
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", true);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD_KEY, false);
+                _animVars.set(IS_INPUT_BACKWARD_KEY, false);
+                _animVars.set(IS_INPUT_RIGHT_KEY, false);
+                _animVars.set(IS_INPUT_LEFT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_KEY, true);
+                _animVars.set(IS_NOT_INPUT_SLOW_KEY, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM_KEY, false);
             }
         } else if (fabsf(_previousControllerParameters.inputZ) >= fabsf(_previousControllerParameters.inputX)) {
             if (fabsf(forwardSpeed) > HAS_MOMENTUM_THRESHOLD) {
@@ -1523,22 +1618,22 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
 
             if (_previousControllerParameters.inputZ > 0.0f) {
                 // forward
-                _animVars.set("isInputForward", true);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD_KEY, true);
+                _animVars.set(IS_INPUT_BACKWARD_KEY, false);
+                _animVars.set(IS_INPUT_RIGHT_KEY, false);
+                _animVars.set(IS_INPUT_LEFT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_SLOW_KEY, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM_KEY, false);
             } else {
                 // backward
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", true);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD_KEY, false);
+                _animVars.set(IS_INPUT_BACKWARD_KEY, true);
+                _animVars.set(IS_INPUT_RIGHT_KEY, false);
+                _animVars.set(IS_INPUT_LEFT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_SLOW_KEY, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM_KEY, false);
             }
         } else {
             if (fabsf(lateralSpeed) > HAS_MOMENTUM_THRESHOLD) {
@@ -1548,31 +1643,31 @@ void Rig::computeMotionAnimationState(float deltaTime, const glm::vec3& worldPos
             if (_previousControllerParameters.inputX > 0.0f) {
                 // right
                 if (!_headEnabled) {
-                    _animVars.set("isInputRight", true);
+                    _animVars.set(IS_INPUT_RIGHT_KEY, true);
                 } else {
-                    _animVars.set("isInputRight", false);
+                    _animVars.set(IS_INPUT_RIGHT_KEY, false);
                 }
 
-                _animVars.set("isInputLeft", false);
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_LEFT_KEY, false);
+                _animVars.set(IS_INPUT_FORWARD_KEY, false);
+                _animVars.set(IS_INPUT_BACKWARD_KEY, false);
+                _animVars.set(IS_NOT_INPUT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_SLOW_KEY, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM_KEY, false);
             } else {
                 // left
                 if (!_headEnabled) {
-                    _animVars.set("isInputLeft", true);
+                    _animVars.set(IS_INPUT_LEFT_KEY, true);
                 } else {
-                    _animVars.set("isInputLeft", false);
+                    _animVars.set(IS_INPUT_LEFT_KEY, false);
                 }
 
-                _animVars.set("isInputForward", false);
-                _animVars.set("isInputBackward", false);
-                _animVars.set("isInputRight", false);
-                _animVars.set("isNotInput", false);
-                _animVars.set("isNotInputSlow", false);
-                _animVars.set("isNotInputNoMomentum", false);
+                _animVars.set(IS_INPUT_FORWARD_KEY, false);
+                _animVars.set(IS_INPUT_BACKWARD_KEY, false);
+                _animVars.set(IS_INPUT_RIGHT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_KEY, false);
+                _animVars.set(IS_NOT_INPUT_SLOW_KEY, false);
+                _animVars.set(IS_NOT_INPUT_NO_MOMENTUM_KEY, false);
             }
         }
 
@@ -1710,8 +1805,9 @@ void Rig::updateAnimations(float deltaTime, const glm::mat4& rootTransform, cons
                 alpha = _computeNetworkAnimation ? (_networkAnimState.blendTime / TOTAL_BLEND_TIME) : (1.0f - (_networkAnimState.blendTime / TOTAL_BLEND_TIME));
                 alpha = glm::clamp(alpha, 0.0f, 1.0f);
                 size_t numJoints = std::min(_networkPoseSet._relativePoses.size(), _internalPoseSet._relativePoses.size());
-                for (size_t i = 0; i < numJoints; i++) {
-                    _networkPoseSet._relativePoses[i].blend(_internalPoseSet._relativePoses[i], alpha);
+                if (numJoints > 0) {
+                    ::blend(numJoints, &_internalPoseSet._relativePoses[0], &_networkPoseSet._relativePoses[0], alpha,
+                            &_networkPoseSet._relativePoses[0]);
                 }
             }
         }
@@ -1723,9 +1819,9 @@ void Rig::updateAnimations(float deltaTime, const glm::mat4& rootTransform, cons
             // animations haven't fully loaded yet.
             _networkPoseSet._relativePoses = _animSkeleton->getRelativeDefaultPoses();
         }
-        _lastAnimVars = _animVars;
-        _animVars = triggersOut;
-        _networkVars = networkTriggersOut;
+        _lastAnimVars = std::move(_animVars);
+        _animVars = std::move(triggersOut);
+        _networkVars = std::move(networkTriggersOut);
         _lastContext = context;
     }
     
@@ -1785,25 +1881,25 @@ void Rig::computeHeadFromHMD(const AnimPose& hmdPose, glm::vec3& headPositionOut
 void Rig::updateHead(bool headEnabled, bool hipsEnabled, const AnimPose& headPose) {
     if (_animSkeleton) {
         if (headEnabled) {
-            _animVars.set("splineIKEnabled", true);
-            _animVars.set("headPosition", headPose.trans());
-            _animVars.set("headRotation", headPose.rot());
+            _animVars.set(SPLINE_IK_ENABLED_KEY, true);
+            _animVars.set(HEAD_POSITION_KEY, headPose.trans());
+            _animVars.set(HEAD_ROTATION_KEY, headPose.rot());
             if (hipsEnabled) {
                 // Since there is an explicit hips ik target, switch the head to use the more flexible Spline IK chain type.
                 // this will allow the spine to compress/expand and bend more natrually, ensuring that it can reach the head target position.
-                _animVars.set("headType", (int)IKTarget::Type::Spline);
-                _animVars.unset("headWeight");  // use the default weight for this target.
+                _animVars.set(HEAD_TYPE_KEY, (int)IKTarget::Type::Spline);
+                _animVars.unset(HEAD_WEIGHT_KEY);  // use the default weight for this target.
             } else {
                 // When there is no hips IK target, use the HmdHead IK chain type.  This will make the spine very stiff,
                 // but because the IK _hipsOffset is enabled, the hips will naturally follow underneath the head.
-                _animVars.set("headType", (int)IKTarget::Type::HmdHead);
-                _animVars.set("headWeight", 8.0f);
+                _animVars.set(HEAD_TYPE_KEY, (int)IKTarget::Type::HmdHead);
+                _animVars.set(HEAD_WEIGHT_KEY, 8.0f);
             }
         } else {
-            _animVars.set("splineIKEnabled", false);
-            _animVars.unset("headPosition");
-            _animVars.set("headRotation", headPose.rot());
-            _animVars.set("headType", (int)IKTarget::Type::Unknown);
+            _animVars.set(SPLINE_IK_ENABLED_KEY, false);
+            _animVars.unset(HEAD_POSITION_KEY);
+            _animVars.set(HEAD_ROTATION_KEY, headPose.rot());
+            _animVars.set(HEAD_TYPE_KEY, (int)IKTarget::Type::Unknown);
         }
     }
 }
@@ -1876,12 +1972,12 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
 
     if (headEnabled) {
         // always do IK if head is enabled
-        _animVars.set("leftHandIKEnabled", true);
-        _animVars.set("rightHandIKEnabled", true);
+        _animVars.set(LEFT_HAND_IK_ENABLED_KEY, true);
+        _animVars.set(RIGHT_HAND_IK_ENABLED_KEY, true);
     } else {
         // only do IK if we have a valid foot.
-        _animVars.set("leftHandIKEnabled", leftHandEnabled);
-        _animVars.set("rightHandIKEnabled", rightHandEnabled);
+        _animVars.set(LEFT_HAND_IK_ENABLED_KEY, leftHandEnabled);
+        _animVars.set(RIGHT_HAND_IK_ENABLED_KEY, rightHandEnabled);
     }
 
     if (leftHandEnabled) {
@@ -1898,9 +1994,9 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             handPosition = deflectHandFromTorso(handPosition, hipsShapeInfo, spineShapeInfo, spine1ShapeInfo, spine2ShapeInfo);
         }
 
-        _animVars.set("leftHandPosition", handPosition);
-        _animVars.set("leftHandRotation", handRotation);
-        _animVars.set("leftHandType", (int)IKTarget::Type::RotationAndPosition);
+        _animVars.set(LEFT_HAND_POSITION_KEY, handPosition);
+        _animVars.set(LEFT_HAND_ROTATION_KEY, handRotation);
+        _animVars.set(LEFT_HAND_TYPE_KEY, (int)IKTarget::Type::RotationAndPosition);
 
         // compute pole vector
         int handJointIndex = _animSkeleton->nameToJointIndex("LeftHand");
@@ -1912,29 +2008,29 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             bool usePoleVector = calculateElbowPoleVector(handJointIndex, elbowJointIndex, armJointIndex, oppositeArmJointIndex, poleVector);
             if (usePoleVector) {
                 glm::vec3 sensorPoleVector = transformVectorFast(rigToSensorMatrix, poleVector);
-                _animVars.set("leftHandPoleVectorEnabled", true);
-                _animVars.set("leftHandPoleReferenceVector", Vectors::UNIT_X);
-                _animVars.set("leftHandPoleVector", transformVectorFast(sensorToRigMatrix, sensorPoleVector));
+                _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED_KEY, true);
+                _animVars.set(LEFT_HAND_POLE_REFERENCE_VECTOR_KEY, Vectors::UNIT_X);
+                _animVars.set(LEFT_HAND_POLE_VECTOR_KEY, transformVectorFast(sensorToRigMatrix, sensorPoleVector));
             } else {
-                _animVars.set("leftHandPoleVectorEnabled", false);
+                _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED_KEY, false);
             }
         } else {
-            _animVars.set("leftHandPoleVectorEnabled", false);
+            _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED_KEY, false);
         }
     } else {
         // need this for two bone ik
         _animVars.set(LEFT_HAND_IK_POSITION_VAR, MAIN_STATE_MACHINE_LEFT_HAND_POSITION);
         _animVars.set(LEFT_HAND_IK_ROTATION_VAR, MAIN_STATE_MACHINE_LEFT_HAND_ROTATION);
 
-        _animVars.set("leftHandPoleVectorEnabled", false);
-        _animVars.unset("leftHandPosition");
-        _animVars.unset("leftHandRotation");
+        _animVars.set(LEFT_HAND_POLE_VECTOR_ENABLED_KEY, false);
+        _animVars.unset(LEFT_HAND_POSITION_KEY);
+        _animVars.unset(LEFT_HAND_ROTATION_KEY);
 
         if (headEnabled) {
-            _animVars.set("leftHandType", (int)IKTarget::Type::HipsRelativeRotationAndPosition);
+            _animVars.set(LEFT_HAND_TYPE_KEY, (int)IKTarget::Type::HipsRelativeRotationAndPosition);
         } else {
             // disable hand IK for desktop mode
-            _animVars.set("leftHandType", (int)IKTarget::Type::Unknown);
+            _animVars.set(LEFT_HAND_TYPE_KEY, (int)IKTarget::Type::Unknown);
         }
     }
 
@@ -1952,9 +2048,9 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             handPosition = deflectHandFromTorso(handPosition, hipsShapeInfo, spineShapeInfo, spine1ShapeInfo, spine2ShapeInfo);
         }
 
-        _animVars.set("rightHandPosition", handPosition);
-        _animVars.set("rightHandRotation", handRotation);
-        _animVars.set("rightHandType", (int)IKTarget::Type::RotationAndPosition);
+        _animVars.set(RIGHT_HAND_POSITION_KEY, handPosition);
+        _animVars.set(RIGHT_HAND_ROTATION_KEY, handRotation);
+        _animVars.set(RIGHT_HAND_TYPE_KEY, (int)IKTarget::Type::RotationAndPosition);
 
         // compute pole vector
         int handJointIndex = _animSkeleton->nameToJointIndex("RightHand");
@@ -1967,14 +2063,14 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
             bool usePoleVector = calculateElbowPoleVector(handJointIndex, elbowJointIndex, armJointIndex, oppositeArmJointIndex, poleVector);
             if (usePoleVector) {
                 glm::vec3 sensorPoleVector = transformVectorFast(rigToSensorMatrix, poleVector);
-                _animVars.set("rightHandPoleVectorEnabled", true);
-                _animVars.set("rightHandPoleReferenceVector", -Vectors::UNIT_X);
-                _animVars.set("rightHandPoleVector", transformVectorFast(sensorToRigMatrix, sensorPoleVector));
+                _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED_KEY, true);
+                _animVars.set(RIGHT_HAND_POLE_REFERENCE_VECTOR_KEY, -Vectors::UNIT_X);
+                _animVars.set(RIGHT_HAND_POLE_VECTOR_KEY, transformVectorFast(sensorToRigMatrix, sensorPoleVector));
             } else {
-                _animVars.set("rightHandPoleVectorEnabled", false);
+                _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED_KEY, false);
             }
         } else {
-            _animVars.set("rightHandPoleVectorEnabled", false);
+            _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED_KEY, false);
         }
     } else {
 
@@ -1982,15 +2078,15 @@ void Rig::updateHands(bool leftHandEnabled, bool rightHandEnabled, bool hipsEnab
         _animVars.set(RIGHT_HAND_IK_POSITION_VAR, MAIN_STATE_MACHINE_RIGHT_HAND_POSITION);
         _animVars.set(RIGHT_HAND_IK_ROTATION_VAR, MAIN_STATE_MACHINE_RIGHT_HAND_ROTATION);
 
-        _animVars.set("rightHandPoleVectorEnabled", false);
-        _animVars.unset("rightHandPosition");
-        _animVars.unset("rightHandRotation");
+        _animVars.set(RIGHT_HAND_POLE_VECTOR_ENABLED_KEY, false);
+        _animVars.unset(RIGHT_HAND_POSITION_KEY);
+        _animVars.unset(RIGHT_HAND_ROTATION_KEY);
 
         if (headEnabled) {
-            _animVars.set("rightHandType", (int)IKTarget::Type::HipsRelativeRotationAndPosition);
+            _animVars.set(RIGHT_HAND_TYPE_KEY, (int)IKTarget::Type::HipsRelativeRotationAndPosition);
         } else {
             // disable hand IK for desktop mode
-            _animVars.set("rightHandType", (int)IKTarget::Type::Unknown);
+            _animVars.set(RIGHT_HAND_TYPE_KEY, (int)IKTarget::Type::Unknown);
         }
     }
 }
@@ -2006,18 +2102,18 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
 
     if (headEnabled && !isSeated) {
         // enable leg IK if head is enabled and we arent sitting down.
-        _animVars.set("leftFootIKEnabled", true);
-        _animVars.set("rightFootIKEnabled", true);
+        _animVars.set(LEFT_FOOT_IK_ENABLED_KEY, true);
+        _animVars.set(RIGHT_FOOT_IK_ENABLED_KEY, true);
     } else {
         // only do IK if we have a valid foot.
-        _animVars.set("leftFootIKEnabled", leftFootEnabled);
-        _animVars.set("rightFootIKEnabled", rightFootEnabled);
+        _animVars.set(LEFT_FOOT_IK_ENABLED_KEY, leftFootEnabled);
+        _animVars.set(RIGHT_FOOT_IK_ENABLED_KEY, rightFootEnabled);
     }
 
     if (leftFootEnabled) {
 
-        _animVars.set(LEFT_FOOT_POSITION, leftFootPose.trans());
-        _animVars.set(LEFT_FOOT_ROTATION, leftFootPose.rot());
+        _animVars.set(LEFT_FOOT_POSITION_KEY, leftFootPose.trans());
+        _animVars.set(LEFT_FOOT_ROTATION_KEY, leftFootPose.rot());
 
         // We want to drive the IK directly from the trackers.
         _animVars.set(LEFT_FOOT_IK_POSITION_VAR, LEFT_FOOT_POSITION);
@@ -2038,8 +2134,8 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         glm::quat smoothDeltaRot = safeMix(deltaRot, Quaternions::IDENTITY, KNEE_POLE_VECTOR_BLEND_FACTOR);
         _prevLeftFootPoleVector = smoothDeltaRot * _prevLeftFootPoleVector;
 
-        _animVars.set("leftFootPoleVectorEnabled", true);
-        _animVars.set("leftFootPoleVector", transformVectorFast(sensorToRigMatrix, _prevLeftFootPoleVector));
+        _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED_KEY, true);
+        _animVars.set(LEFT_FOOT_POLE_VECTOR_KEY, transformVectorFast(sensorToRigMatrix, _prevLeftFootPoleVector));
     } else {
         // We want to drive the IK from the underlying animation.
         // This gives us the ability to squat while in the HMD, without the feet from dipping under the floor.
@@ -2047,13 +2143,13 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         _animVars.set(LEFT_FOOT_IK_ROTATION_VAR, MAIN_STATE_MACHINE_LEFT_FOOT_ROTATION);
 
         // We want to match the animated knee pose as close as possible, so don't use poleVectors
-        _animVars.set("leftFootPoleVectorEnabled", false);
+        _animVars.set(LEFT_FOOT_POLE_VECTOR_ENABLED_KEY, false);
         _prevLeftFootPoleVectorValid = false;
     }
 
     if (rightFootEnabled) {
-        _animVars.set(RIGHT_FOOT_POSITION, rightFootPose.trans());
-        _animVars.set(RIGHT_FOOT_ROTATION, rightFootPose.rot());
+        _animVars.set(RIGHT_FOOT_POSITION_KEY, rightFootPose.trans());
+        _animVars.set(RIGHT_FOOT_ROTATION_KEY, rightFootPose.rot());
 
         // We want to drive the IK directly from the trackers.
         _animVars.set(RIGHT_FOOT_IK_POSITION_VAR, RIGHT_FOOT_POSITION);
@@ -2074,8 +2170,8 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         glm::quat smoothDeltaRot = safeMix(deltaRot, Quaternions::IDENTITY, KNEE_POLE_VECTOR_BLEND_FACTOR);
         _prevRightFootPoleVector = smoothDeltaRot * _prevRightFootPoleVector;
 
-        _animVars.set("rightFootPoleVectorEnabled", true);
-        _animVars.set("rightFootPoleVector", transformVectorFast(sensorToRigMatrix, _prevRightFootPoleVector));
+        _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED_KEY, true);
+        _animVars.set(RIGHT_FOOT_POLE_VECTOR_KEY, transformVectorFast(sensorToRigMatrix, _prevRightFootPoleVector));
     } else {
         // We want to drive the IK from the underlying animation.
         // This gives us the ability to squat while in the HMD, without the feet from dipping under the floor.
@@ -2083,7 +2179,7 @@ void Rig::updateFeet(bool leftFootEnabled, bool rightFootEnabled, bool headEnabl
         _animVars.set(RIGHT_FOOT_IK_ROTATION_VAR, MAIN_STATE_MACHINE_RIGHT_FOOT_ROTATION);
 
         // We want to match the animated knee pose as close as possible, so don't use poleVectors
-        _animVars.set("rightFootPoleVectorEnabled", false);
+        _animVars.set(RIGHT_FOOT_POLE_VECTOR_ENABLED_KEY, false);
         _prevRightFootPoleVectorValid = false;
     }
 }
@@ -2092,29 +2188,29 @@ void Rig::updateReactions(const ControllerParameters& params) {
 
     // trigger reactions
     if (params.reactionTriggers[AVATAR_REACTION_POSITIVE]) {
-        _animVars.set("reactionPositiveTrigger", true);
+        _animVars.set(REACTION_POSITIVE_TRIGGER_KEY, true);
     } else {
-        _animVars.set("reactionPositiveTrigger", false);
+        _animVars.set(REACTION_POSITIVE_TRIGGER_KEY, false);
     }
 
     if (params.reactionTriggers[AVATAR_REACTION_NEGATIVE]) {
-        _animVars.set("reactionNegativeTrigger", true);
+        _animVars.set(REACTION_NEGATIVE_TRIGGER_KEY, true);
     } else {
-        _animVars.set("reactionNegativeTrigger", false);
+        _animVars.set(REACTION_NEGATIVE_TRIGGER_KEY, false);
     }
 
     // begin end reactions
     bool enabled = params.reactionEnabledFlags[AVATAR_REACTION_RAISE_HAND];
-    _animVars.set("reactionRaiseHandEnabled", enabled);
-    _animVars.set("reactionRaiseHandDisabled", !enabled);
+    _animVars.set(REACTION_RAISE_HAND_ENABLED_KEY, enabled);
+    _animVars.set(REACTION_RAISE_HAND_DISABLED_KEY, !enabled);
 
     enabled = params.reactionEnabledFlags[AVATAR_REACTION_APPLAUD];
-    _animVars.set("reactionApplaudEnabled", enabled);
-    _animVars.set("reactionApplaudDisabled", !enabled);
+    _animVars.set(REACTION_APPLAUD_ENABLED_KEY, enabled);
+    _animVars.set(REACTION_APPLAUD_DISABLED_KEY, !enabled);
 
     enabled = params.reactionEnabledFlags[AVATAR_REACTION_POINT];
-    _animVars.set("reactionPointEnabled", enabled);
-    _animVars.set("reactionPointDisabled", !enabled);
+    _animVars.set(REACTION_POINT_ENABLED_KEY, enabled);
+    _animVars.set(REACTION_POINT_DISABLED_KEY, !enabled);
 
     // determine if we should ramp off IK
     if (_enableInverseKinematics) {
@@ -2132,7 +2228,7 @@ void Rig::updateReactions(const ControllerParameters& params) {
         if ((reactionPlaying || isSeated) && !hmdMode) {
             // TODO: make this smooth.
             // disable head IK while reaction is playing, but only in "desktop" mode.
-            _animVars.set("headType", (int)IKTarget::Type::Unknown);
+            _animVars.set(HEAD_TYPE_KEY, (int)IKTarget::Type::Unknown);
         }
     }
 }
@@ -2293,11 +2389,11 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
                 _talkIdleInterpTime = 1.0f;
             }
             float easeOutInValue = _talkIdleInterpTime < 0.5f ? 4.0f * powf(_talkIdleInterpTime, 3.0f) : 4.0f * powf((_talkIdleInterpTime - 1.0f), 3.0f) + 1.0f;
-            _animVars.set("talkOverlayAlpha", easeOutInValue);
-            _animVars.set("idleOverlayAlpha", easeOutInValue);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA_KEY, easeOutInValue);
+            _animVars.set(IDLE_OVERLAY_ALPHA_KEY, easeOutInValue);  // backward compatibility for older anim graphs.
         } else {
-            _animVars.set("talkOverlayAlpha", 1.0f);
-            _animVars.set("idleOverlayAlpha", 1.0f);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA_KEY, 1.0f);
+            _animVars.set(IDLE_OVERLAY_ALPHA_KEY, 1.0f);  // backward compatibility for older anim graphs.
         }
     } else {
         if (_talkIdleInterpTime < 1.0f) {
@@ -2307,11 +2403,11 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
             }
             float easeOutInValue = _talkIdleInterpTime < 0.5f ? 4.0f * powf(_talkIdleInterpTime, 3.0f) : 4.0f * powf((_talkIdleInterpTime - 1.0f), 3.0f) + 1.0f;
             float talkAlpha = 1.0f - easeOutInValue;
-            _animVars.set("talkOverlayAlpha", talkAlpha);
-            _animVars.set("idleOverlayAlpha", talkAlpha);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA_KEY, talkAlpha);
+            _animVars.set(IDLE_OVERLAY_ALPHA_KEY, talkAlpha);  // backward compatibility for older anim graphs.
         } else {
-            _animVars.set("talkOverlayAlpha", 0.0f);
-            _animVars.set("idleOverlayAlpha", 0.0f);  // backward compatibility for older anim graphs.
+            _animVars.set(TALK_OVERLAY_ALPHA_KEY, 0.0f);
+            _animVars.set(IDLE_OVERLAY_ALPHA_KEY, 0.0f);  // backward compatibility for older anim graphs.
         }
     }
 
@@ -2343,21 +2439,21 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
 
     if (_headEnabled) {
         // Blend IK chains toward the joint limit centers, this should stablize head and hand ik.
-        _animVars.set("solutionSource", (int)AnimInverseKinematics::SolutionSource::RelaxToLimitCenterPoses);
+        _animVars.set(SOLUTION_SOURCE_KEY, (int)AnimInverseKinematics::SolutionSource::RelaxToLimitCenterPoses);
     } else {
         // Blend IK chains toward the UnderPoses, so some of the animaton motion is present in the IK solution.
-        _animVars.set("solutionSource", (int)AnimInverseKinematics::SolutionSource::RelaxToUnderPoses);
+        _animVars.set(SOLUTION_SOURCE_KEY, (int)AnimInverseKinematics::SolutionSource::RelaxToUnderPoses);
     }
 
     // if the hips or the feet are being controlled.
     if (hipsEnabled || rightFootEnabled || leftFootEnabled) {
         // replace the feet animation with the default pose, this is to prevent unexpected toe wiggling.
-        _animVars.set("defaultPoseOverlayAlpha", 1.0f);
-        _animVars.set("defaultPoseOverlayBoneSet", (int)AnimOverlay::BothFeetBoneSet);
+        _animVars.set(DEFAULT_POSE_OVERLAY_ALPHA_KEY, 1.0f);
+        _animVars.set(DEFAULT_POSE_OVERLAY_BONE_SET_KEY, (int)AnimOverlay::BothFeetBoneSet);
     } else {
         // feet should follow source animation
-        _animVars.unset("defaultPoseOverlayAlpha");
-        _animVars.unset("defaultPoseOverlayBoneSet");
+        _animVars.unset(DEFAULT_POSE_OVERLAY_ALPHA_KEY);
+        _animVars.unset(DEFAULT_POSE_OVERLAY_BONE_SET_KEY);
     }
 
     if (hipsEnabled) {
@@ -2378,19 +2474,19 @@ void Rig::updateFromControllerParameters(const ControllerParameters& params, flo
 
         AnimPose hips = _hipsBlendHelper.update(params.primaryControllerPoses[PrimaryControllerType_Hips], dt);
 
-        _animVars.set("hipsType", (int)IKTarget::Type::RotationAndPosition);
-        _animVars.set("hipsPosition", hips.trans());
-        _animVars.set("hipsRotation", hips.rot());
+        _animVars.set(HIPS_TYPE_KEY, (int)IKTarget::Type::RotationAndPosition);
+        _animVars.set(HIPS_POSITION_KEY, hips.trans());
+        _animVars.set(HIPS_ROTATION_KEY, hips.rot());
     } else {
-        _animVars.set("hipsType", (int)IKTarget::Type::Unknown);
+        _animVars.set(HIPS_TYPE_KEY, (int)IKTarget::Type::Unknown);
     }
 
     if (hipsEnabled && spine2Enabled) {
-        _animVars.set("spine2Type", (int)IKTarget::Type::Spline);
-        _animVars.set("spine2Position", params.primaryControllerPoses[PrimaryControllerType_Spine2].trans());
-        _animVars.set("spine2Rotation", params.primaryControllerPoses[PrimaryControllerType_Spine2].rot());
+        _animVars.set(SPINE2_TYPE_KEY, (int)IKTarget::Type::Spline);
+        _animVars.set(SPINE2_POSITION_KEY, params.primaryControllerPoses[PrimaryControllerType_Spine2].trans());
+        _animVars.set(SPINE2_ROTATION_KEY, params.primaryControllerPoses[PrimaryControllerType_Spine2].rot());
     } else {
-        _animVars.set("spine2Type", (int)IKTarget::Type::Unknown);
+        _animVars.set(SPINE2_TYPE_KEY, (int)IKTarget::Type::Unknown);
     }
 
     // set secondary targets
@@ -213,7 +213,14 @@ void ModelBaker::bakeSourceCopy() {
         handleError("Error opening " + _originalOutputModelPath + " for reading");
         return;
     }
-    hifi::ByteArray modelData = modelFile.readAll();
+    // Map the file rather than reading it, the serializers copy out whatever they keep
+    hifi::ByteArray modelData;
+    auto mappedData = modelFile.map(0, modelFile.size());
+    if (mappedData) {
+        modelData = hifi::ByteArray::fromRawData((const char*)mappedData, modelFile.size());
+    } else {
+        modelData = modelFile.readAll();
+    }
 
     std::vector<hifi::ByteArray> dracoMeshes;
     std::vector<std::vector<hifi::ByteArray>> dracoMaterialLists; // Material order for per-mesh material lookup used by dracoMeshes
@@ -239,6 +246,8 @@ void ModelBaker::bakeSourceCopy() {
 
         baker::Baker baker(loadedModel, serializerMapping, _mappingURL);
         auto config = baker.getConfiguration();
+        // Run the independent jobs (normals, tangents, draco meshes...) concurrently
+        config->setParallel(true);
         // Enable compressed draco mesh generation
         config->getJobConfig("BuildDracoMesh")->setEnabled(true);
         // Do not permit potentially lossy modification of joint data meant for runtime
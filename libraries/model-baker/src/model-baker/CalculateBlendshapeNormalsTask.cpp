@@ -11,60 +11,69 @@
 
 #include "CalculateBlendshapeNormalsTask.h"
 
+#include <atomic>
+
+#include <QElapsedTimer>
+
+#include <NumericalConstants.h>
+
 #include "ModelMath.h"
+#include "ModelBakerLogging.h"
 
 void CalculateBlendshapeNormalsTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
     const auto& blendshapesPerMesh = input.get0();
     const auto& meshes = input.get1();
     auto& normalsPerBlendshapePerMeshOut = output;
 
-    normalsPerBlendshapePerMeshOut.reserve(blendshapesPerMesh.size());
+    QElapsedTimer timer;
+    timer.start();
+    std::atomic<int> numCalculated { 0 };
+
+    normalsPerBlendshapePerMeshOut.clear();
+    normalsPerBlendshapePerMeshOut.resize(blendshapesPerMesh.size());
     for (size_t i = 0; i < blendshapesPerMesh.size(); i++) {
-        const auto& mesh = meshes[i];
-        const auto& blendshapes = blendshapesPerMesh[i];
-        normalsPerBlendshapePerMeshOut.emplace_back();
-        auto& normalsPerBlendshapeOut = normalsPerBlendshapePerMeshOut[normalsPerBlendshapePerMeshOut.size()-1];
+        normalsPerBlendshapePerMeshOut[i].resize(blendshapesPerMesh[i].size());
+    }
 
-        normalsPerBlendshapeOut.reserve(blendshapes.size());
-        for (size_t j = 0; j < blendshapes.size(); j++) {
-            const auto& blendshape = blendshapes[j];
-            const auto& normalsIn = blendshape.normals;
-            // Check if normals are already defined. Otherwise, calculate them from existing blendshape vertices.
-            if (!normalsIn.empty()) {
-                normalsPerBlendshapeOut.push_back(normalsIn.toStdVector());
-            } else {
-                // Create lookup to get index in blendshape from vertex index in mesh
-                std::vector<int> reverseIndices;
-                reverseIndices.resize(mesh.vertices.size());
-                std::iota(reverseIndices.begin(), reverseIndices.end(), 0);
-                for (int indexInBlendShape = 0; indexInBlendShape < blendshape.indices.size(); ++indexInBlendShape) {
-                    auto indexInMesh = blendshape.indices[indexInBlendShape];
-                    reverseIndices[indexInMesh] = indexInBlendShape;
-                }
+    // Blendshapes are independent of each other, so spread them all over the thread pool rather than going mesh by mesh
+    const auto blendshapeIndices = baker::listBlendshapes(blendshapesPerMesh);
+    baker::parallelFor(blendshapeIndices.size(), [&](size_t b) {
+        const auto i = blendshapeIndices[b].first;
+        const auto j = blendshapeIndices[b].second;
+        const auto& mesh = meshes[i];
+        const auto& blendshape = blendshapesPerMesh[i][j];
+        const auto& normalsIn = blendshape.normals;
+        auto& normals = normalsPerBlendshapePerMeshOut[i][j];
+        // Check if normals are already defined. Otherwise, calculate them from existing blendshape vertices.
+        if (!normalsIn.empty()) {
+            normals = normalsIn.toStdVector();
+        } else {
+            const auto reverseIndices = baker::calculateReverseIndices(mesh, blendshape);
 
-                normalsPerBlendshapeOut.emplace_back();
-                auto& normals = normalsPerBlendshapeOut[normalsPerBlendshapeOut.size()-1];
-                normals.resize(mesh.vertices.size());
-                baker::calculateNormals(mesh,
-                    [&reverseIndices, &blendshape, &normals](int normalIndex) /* NormalAccessor */ {
-                        const auto lookupIndex = reverseIndices[normalIndex];
-                        if (lookupIndex < blendshape.vertices.size()) {
-                            return &normals[lookupIndex];
-                        } else {
-                            // Index isn't in the blendshape. Request that the normal not be calculated.
-                            return (glm::vec3*)nullptr;
-                        }
-                    },
-                    [&mesh, &reverseIndices, &blendshape](int vertexIndex, glm::vec3& outVertex) /* VertexSetter */ {
-                        const auto lookupIndex = reverseIndices[vertexIndex];
-                        if (lookupIndex < blendshape.vertices.size()) {
-                            outVertex = blendshape.vertices[lookupIndex];
-                        } else {
-                            // Index isn't in the blendshape, so return vertex from mesh
-                            outVertex = baker::safeGet(mesh.vertices, lookupIndex);
-                        }
-                    });
-            }
+            normals.resize(mesh.vertices.size());
+            baker::calculateNormals(mesh,
+                [&reverseIndices, &blendshape, &normals](int normalIndex) /* NormalAccessor */ {
+                    const auto lookupIndex = reverseIndices[normalIndex];
+                    if (lookupIndex < blendshape.vertices.size()) {
+                        return &normals[lookupIndex];
+                    } else {
+                        // Index isn't in the blendshape. Request that the normal not be calculated.
+                        return (glm::vec3*)nullptr;
+                    }
+                },
+                [&mesh, &reverseIndices, &blendshape](int vertexIndex, glm::vec3& outVertex) /* VertexSetter */ {
+                    const auto lookupIndex = reverseIndices[vertexIndex];
+                    if (lookupIndex < blendshape.vertices.size()) {
+                        outVertex = blendshape.vertices[lookupIndex];
+                    } else {
+                        // Index isn't in the blendshape, so return vertex from mesh
+                        outVertex = baker::safeGet(mesh.vertices, lookupIndex);
+                    }
+                });
+            ++numCalculated;
         }
-    }
+    });
+
+    qCDebug(model_baker) << "Calculated normals for" << numCalculated.load() << "of" << blendshapeIndices.size()
+        << "blendshapes in" << timer.nsecsElapsed() / NSECS_PER_USEC << "usecs";
 }
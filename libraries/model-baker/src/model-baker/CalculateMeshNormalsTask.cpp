@@ -11,17 +11,28 @@
 
 #include "CalculateMeshNormalsTask.h"
 
+#include <atomic>
+
+#include <QElapsedTimer>
+
+#include <NumericalConstants.h>
+
 #include "ModelMath.h"
+#include "ModelBakerLogging.h"
 
 void CalculateMeshNormalsTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
     const auto& meshes = input;
     auto& normalsPerMeshOut = output;
 
-    normalsPerMeshOut.reserve(meshes.size());
-    for (int i = 0; i < (int)meshes.size(); i++) {
+    QElapsedTimer timer;
+    timer.start();
+    std::atomic<int> numCalculated { 0 };
+
+    normalsPerMeshOut.clear();
+    normalsPerMeshOut.resize(meshes.size());
+    baker::parallelFor(meshes.size(), [&](size_t i) {
         const auto& mesh = meshes[i];
-        normalsPerMeshOut.emplace_back();
-        auto& normalsOut = normalsPerMeshOut[normalsPerMeshOut.size()-1];
+        auto& normalsOut = normalsPerMeshOut[i];
         // Only calculate normals if this mesh doesn't already have them
         if (!mesh.normals.empty()) {
             normalsOut = mesh.normals.toStdVector();
@@ -35,6 +46,10 @@ void CalculateMeshNormalsTask::run(const baker::BakeContextPointer& context, con
                     outVertex = baker::safeGet(mesh.vertices, vertexIndex);
                 }
             );
+            ++numCalculated;
         }
-    }
+    });
+
+    qCDebug(model_baker) << "Calculated normals for" << numCalculated.load() << "of" << meshes.size() << "meshes in"
+        << timer.nsecsElapsed() / NSECS_PER_USEC << "usecs";
 }
@@ -11,20 +11,31 @@
 
 #include "CalculateMeshTangentsTask.h"
 
+#include <atomic>
+
+#include <QElapsedTimer>
+
+#include <NumericalConstants.h>
+
 #include "ModelMath.h"
+#include "ModelBakerLogging.h"
 
 void CalculateMeshTangentsTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
     const auto& normalsPerMesh = input.get0();
     const std::vector<hfm::Mesh>& meshes = input.get1();
     auto& tangentsPerMeshOut = output;
 
-    tangentsPerMeshOut.reserve(meshes.size());
-    for (int i = 0; i < (int)meshes.size(); i++) {
+    QElapsedTimer timer;
+    timer.start();
+    std::atomic<int> numCalculated { 0 };
+
+    tangentsPerMeshOut.clear();
+    tangentsPerMeshOut.resize(meshes.size());
+    baker::parallelFor(meshes.size(), [&](size_t i) {
         const auto& mesh = meshes[i];
         const auto& tangentsIn = mesh.tangents;
         const auto& normals = baker::safeGet(normalsPerMesh, i);
-        tangentsPerMeshOut.emplace_back();
-        auto& tangentsOut = tangentsPerMeshOut[tangentsPerMeshOut.size()-1];
+        auto& tangentsOut = tangentsPerMeshOut[i];
 
         // Check if we already have tangents and therefore do not need to do any calculation
         // Otherwise confirm if we have the normals and texcoords needed
@@ -41,6 +52,10 @@ void CalculateMeshTangentsTask::run(const baker::BakeContextPointer& context, co
                 outTexCoords[1] = mesh.texCoords[secondIndex];
                 return &(tangentsOut[firstIndex]);
             });
+            ++numCalculated;
         }
-    }
+    });
+
+    qCDebug(model_baker) << "Calculated tangents for" << numCalculated.load() << "of" << meshes.size() << "meshes in"
+        << timer.nsecsElapsed() / NSECS_PER_USEC << "usecs";
 }
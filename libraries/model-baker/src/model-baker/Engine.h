@@ -19,6 +19,8 @@ namespace baker {
     class BakeContext : public task::JobContext {
     public:
         // No context settings yet for model prep
+
+        std::shared_ptr<task::JobContext> cloneForJob() const override { return std::make_shared<BakeContext>(*this); }
     };
     using BakeContextPointer = std::shared_ptr<BakeContext>;
 
@@ -11,7 +11,10 @@
 
 #include "ModelMath.h"
 
+#include <numeric>
+
 #include <LogHandler.h>
+#include <TBBHelpers.h>
 #include "ModelBakerLogging.h"
 
 namespace baker {
@@ -117,5 +120,33 @@ namespace baker {
             }
         }
     }
-}
 
+    void parallelFor(size_t count, const std::function<void(size_t index)>& work) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, count), [&work](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                work(i);
+            }
+        });
+    }
+
+    std::vector<BlendshapeIndex> listBlendshapes(const BlendshapesPerMesh& blendshapesPerMesh) {
+        std::vector<BlendshapeIndex> blendshapeIndices;
+        for (size_t i = 0; i < blendshapesPerMesh.size(); i++) {
+            for (size_t j = 0; j < blendshapesPerMesh[i].size(); j++) {
+                blendshapeIndices.emplace_back(i, j);
+            }
+        }
+        return blendshapeIndices;
+    }
+
+    std::vector<int> calculateReverseIndices(const hfm::Mesh& mesh, const hfm::Blendshape& blendshape) {
+        std::vector<int> reverseIndices;
+        reverseIndices.resize(mesh.vertices.size());
+        std::iota(reverseIndices.begin(), reverseIndices.end(), 0);
+        for (int indexInBlendShape = 0; indexInBlendShape < blendshape.indices.size(); ++indexInBlendShape) {
+            auto indexInMesh = blendshape.indices[indexInBlendShape];
+            reverseIndices[indexInMesh] = indexInBlendShape;
+        }
+        return reverseIndices;
+    }
+}
@@ -53,4 +53,17 @@ namespace baker {
     using IndexAccessor = std::function<glm::vec3*(int firstIndex, int secondIndex, glm::vec3* outVertices, glm::vec2* outTexCoords, glm::vec3& outNormal)>;
 
     void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor);
+
+    // Calls work(i) for every i in [0, count) on the thread pool. Each call must only write to outputs of its own index,
+    // so that the result is the same as a serial loop.
+    void parallelFor(size_t count, const std::function<void(size_t index)>& work);
+
+    // (mesh index, blendshape index) of every blendshape in the model, so that per blendshape passes are spread over
+    // threads regardless of how the blendshapes are distributed among the meshes
+    using BlendshapeIndex = std::pair<size_t, size_t>;
+    std::vector<BlendshapeIndex> listBlendshapes(const BlendshapesPerMesh& blendshapesPerMesh);
+
+    // Lookup to get the index in the blendshape from a vertex index in the mesh.
+    // Vertices which aren't in the blendshape keep their mesh index.
+    std::vector<int> calculateReverseIndices(const hfm::Mesh& mesh, const hfm::Blendshape& blendshape);
 };
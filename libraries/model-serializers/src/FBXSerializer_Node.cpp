@@ -11,7 +11,12 @@
 
 #include "FBXSerializer.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+
+#include <zlib.h>
+
 #include <QtCore/QBuffer>
 #include <QtCore/QDataStream>
 #include <QtCore/QIODevice>
@@ -24,186 +29,148 @@
 #include <shared/NsightHelpers.h>
 #include <hfm/ModelFormatLogging.h>
 
-template<class T>
-int streamSize() {
-    return sizeof(T);
-}
+namespace {
 
-template<bool>
-int streamSize() {
-    return 1;
+template <class T>
+T fromLittleEndian(const char* source) {
+    T value;
+    memcpy(&value, source, sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    std::reverse((char*)&value, (char*)&value + sizeof(T));
+#endif
+    return value;
 }
 
-template<class T>
-QVariant readBinaryArray(QDataStream& in, int& position) {
-    quint32 arrayLength;
-    quint32 encoding;
-    quint32 compressedLength;
+// Reads binary FBX straight out of the file's bytes, which can be a memory mapped file: arrays are inflated or copied
+// once, directly into the vectors the serializer uses, and nothing else but node names and strings is copied.
+// see http://code.blender.org/index.php/2013/08/fbx-binary-file-format-specification/ for an explanation
+// of the FBX binary format
+class BinaryFBXReader {
+public:
+    // node end offsets are from the start of the data, parsing can start further in
+    BinaryFBXReader(const hifi::ByteArray& data, qint64 start = 0) :
+        _begin(data.constData()),
+        _end(data.constData() + data.size()),
+        _position(data.constData() + start) {}
+
+    FBXNode parse();
 
-    in >> arrayLength;
+private:
+    const char* readRaw(quint64 length);
+    template <class T> T read() { return fromLittleEndian<T>(readRaw(sizeof(T))); }
+    template <class T> QVariant readArray();
+    QVariant readProperty();
+    FBXNode readNode();
+
+    const char* const _begin;
+    const char* const _end;
+    const char* _position;
+    bool _has64BitPositions { false };
+};
+
+const char* BinaryFBXReader::readRaw(quint64 length) {
+    if (length > (quint64)(_end - _position)) {
+        throw QString("FBX file most likely corrupt: unexpected end of file");
+    }
+    const char* data = _position;
+    _position += length;
+    return data;
+}
+
+template <class T>
+QVariant BinaryFBXReader::readArray() {
+    quint32 arrayLength = read<quint32>();
     if (arrayLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
         throw QString("FBX file most likely corrupt: binary data exceeds data limits");
     }
-    in >> encoding;
-    in >> compressedLength;
-    if (compressedLength > std::numeric_limits<int>::max() / sizeof(T)) { // Upcoming byte containers are limited to max signed int
-        throw QString("FBX file most likely corrupt: compressed binary data exceeds data limits");
-    }
-    position += sizeof(quint32) * 3;
-
-    QVector<T> values;
-    if ((int)QSysInfo::ByteOrder == (int)in.byteOrder()) {
-        values.resize(arrayLength);
-        hifi::ByteArray arrayData;
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            arrayData = qUncompress(compressed);
-            if (arrayData.isEmpty() ||
-                (unsigned int)arrayData.size() != (sizeof(T) * arrayLength)) { // answers empty byte array if corrupt
+    quint32 encoding = read<quint32>();
+    quint32 compressedLength = read<quint32>();
+
+    QVector<T> values(arrayLength);
+    uLongf numBytes = arrayLength * sizeof(T);
+    if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
+        const char* compressed = readRaw(compressedLength);
+        if (arrayLength > 0) {
+            uLongf inflatedBytes = numBytes;
+            if (uncompress((Bytef*)values.data(), &inflatedBytes, (const Bytef*)compressed, compressedLength) != Z_OK ||
+                inflatedBytes != numBytes) {
                 throw QString("corrupt fbx file");
             }
-        } else {
-            arrayData.resize(sizeof(T) * arrayLength);
-            position += sizeof(T) * arrayLength;
-            in.readRawData(arrayData.data(), arrayData.size());
         }
+    } else if (arrayLength > 0) {
+        memcpy(values.data(), readRaw(numBytes), numBytes);
+    }
 
-        if (arrayData.size() > 0) {
-            memcpy(&values[0], arrayData.constData(), arrayData.size());
-        }
-    } else {
-        values.reserve(arrayLength);
-        if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            hifi::ByteArray uncompressed = qUncompress(compressed);
-            if (uncompressed.isEmpty()) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
-            }
-            QDataStream uncompressedIn(uncompressed);
-            uncompressedIn.setByteOrder(QDataStream::LittleEndian);
-            uncompressedIn.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                uncompressedIn >> value;
-                values.append(value);
-            }
-        } else {
-            for (quint32 i = 0; i < arrayLength; i++) {
-                T value;
-                in >> value;
-                position += streamSize<T>();
-                values.append(value);
-            }
-        }
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    for (auto& value : values) {
+        value = fromLittleEndian<T>((const char*)&value);
     }
+#endif
     return QVariant::fromValue(values);
 }
 
-QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
-    char ch;
-    in.device()->getChar(&ch);
-    position++;
-    switch (ch) {
-        case 'Y': {
-            qint16 value;
-            in >> value;
-            position += sizeof(qint16);
-            return QVariant::fromValue(value);
-        }
-        case 'C': {
-            bool value;
-            in >> value;
-            position++;
-            return QVariant::fromValue(value);
-        }
-        case 'I': {
-            qint32 value;
-            in >> value;
-            position += sizeof(qint32);
-            return QVariant::fromValue(value);
-        }
-        case 'F': {
-            float value;
-            in >> value;
-            position += sizeof(float);
-            return QVariant::fromValue(value);
-        }
-        case 'D': {
-            double value;
-            in >> value;
-            position += sizeof(double);
-            return QVariant::fromValue(value);
-        }
-        case 'L': {
-            qint64 value;
-            in >> value;
-            position += sizeof(qint64);
-            return QVariant::fromValue(value);
-        }
-        case 'f': {
-            return readBinaryArray<float>(in, position);
-        }
-        case 'd': {
-            return readBinaryArray<double>(in, position);
-        }
-        case 'l': {
-            return readBinaryArray<qint64>(in, position);
-        }
-        case 'i': {
-            return readBinaryArray<qint32>(in, position);
-        }
-        case 'b': {
-            return readBinaryArray<bool>(in, position);
-        }
+// bools are stored as bytes that may be anything but 0 or 1
+template <>
+QVariant BinaryFBXReader::readArray<bool>() {
+    QVariant variant = readArray<quint8>();
+    auto bytes = variant.value<QVector<quint8>>();
+    QVector<bool> values(bytes.size());
+    for (int i = 0; i < bytes.size(); i++) {
+        values[i] = bytes[i] != 0;
+    }
+    return QVariant::fromValue(values);
+}
+
+QVariant BinaryFBXReader::readProperty() {
+    char type = read<char>();
+    switch (type) {
+        case 'Y':
+            return QVariant::fromValue(read<qint16>());
+        case 'C':
+            return QVariant::fromValue(read<quint8>() != 0);
+        case 'I':
+            return QVariant::fromValue(read<qint32>());
+        case 'F':
+            return QVariant::fromValue(read<float>());
+        case 'D':
+            return QVariant::fromValue(read<double>());
+        case 'L':
+            return QVariant::fromValue(read<qint64>());
+        case 'f':
+            return readArray<float>();
+        case 'd':
+            return readArray<double>();
+        case 'l':
+            return readArray<qint64>();
+        case 'i':
+            return readArray<qint32>();
+        case 'b':
+            return readArray<bool>();
         case 'S':
         case 'R': {
-            quint32 length;
-            in >> length;
-            position += sizeof(quint32) + length;
-            return QVariant::fromValue(in.device()->read(length));
+            quint32 length = read<quint32>();
+            return QVariant::fromValue(hifi::ByteArray(readRaw(length), length));
         }
         default:
-            throw QString("Unknown property type: ") + ch;
+            throw QString("Unknown property type: ") + type;
     }
 }
 
-FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPositions = false) {
+FBXNode BinaryFBXReader::readNode() {
     qint64 endOffset;
     quint64 propertyCount;
-    quint64 propertyListLength;
-    quint8 nameLength;
 
     // FBX 2016 and beyond uses 64bit positions in the node headers, pre-2016 used 32bit values
-    // our code generally doesn't care about the size that much, so we will use 64bit values
-    // from here on out, but if the file is an older format we read the stream into temp 32bit
-    // values and then assign to our actual 64bit values.
-    if (has64BitPositions) {
-        in >> endOffset;
-        in >> propertyCount;
-        in >> propertyListLength;
-        position += sizeof(quint64) * 3;
+    if (_has64BitPositions) {
+        endOffset = read<qint64>();
+        propertyCount = read<quint64>();
+        read<quint64>(); // property list length
     } else {
-        qint32 tempEndOffset;
-        quint32 tempPropertyCount;
-        quint32 tempPropertyListLength;
-        in >> tempEndOffset;
-        in >> tempPropertyCount;
-        in >> tempPropertyListLength;
-        position += sizeof(quint32) * 3;
-        endOffset = tempEndOffset;
-        propertyCount = tempPropertyCount;
-        propertyListLength = tempPropertyListLength;
-    }
-    in >> nameLength;
-    position += sizeof(quint8);
+        endOffset = read<qint32>();
+        propertyCount = read<quint32>();
+        read<quint32>(); // property list length
+    }
+    quint8 nameLength = read<quint8>();
 
     FBXNode node;
     const int MIN_VALID_OFFSET = 40;
@@ -211,15 +178,20 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
         // use a null name to indicate a null node
         return node;
     }
-    node.name = in.device()->read(nameLength);
-    position += nameLength;
+    if (endOffset > _end - _begin) {
+        throw QString("FBX file most likely corrupt: node ends past the end of file");
+    }
+    node.name = hifi::ByteArray(readRaw(nameLength), nameLength);
 
-    for (quint32 i = 0; i < propertyCount; i++) {
-        node.properties.append(parseBinaryFBXProperty(in, position));
+    // every property takes at least two bytes, don't trust the count beyond what the node can hold
+    const char* nodeEnd = _begin + endOffset;
+    node.properties.reserve((int)std::min<quint64>(propertyCount, std::max<qint64>(nodeEnd - _position, 0) / 2));
+    for (quint64 i = 0; i < propertyCount; i++) {
+        node.properties.append(readProperty());
     }
 
-    while (endOffset > position) {
-        FBXNode child = parseBinaryFBXNode(in, position, has64BitPositions);
+    while (nodeEnd > _position) {
+        FBXNode child = readNode();
         if (!child.name.isNull()) {
             node.children.append(child);
         }
@@ -228,6 +200,33 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
     return node;
 }
 
+FBXNode BinaryFBXReader::parse() {
+    // The first 27 bytes contain the header.
+    //   Bytes 0 - 20: Kaydara FBX Binary  \x00(file - magic, with 2 spaces at the end, then a NULL terminator).
+    //   Bytes 21 - 22: [0x1A, 0x00](unknown but all observed files show these bytes).
+    //   Bytes 23 - 26 : unsigned int, the version number. 7300 for version 7.3 for example.
+    readRaw(FBX_HEADER_BYTES_BEFORE_VERSION);
+    quint32 fileVersion = read<quint32>();
+    _has64BitPositions = (fileVersion >= FBX_VERSION_2016);
+
+    // parse the top-level node, up to the null node or the end of the file
+    const int NODE_HEADER_BYTES = _has64BitPositions ? (3 * sizeof(quint64) + 1) : (3 * sizeof(quint32) + 1);
+    FBXNode top;
+    while (_end - _position >= NODE_HEADER_BYTES) {
+        FBXNode next = readNode();
+        if (next.name.isNull()) {
+            return top;
+
+        } else {
+            top.children.append(next);
+        }
+    }
+
+    return top;
+}
+
+}
+
 class Tokenizer {
 public:
 
@@ -369,37 +368,29 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
         }
         return top;
     }
-    QDataStream in(device);
-    in.setByteOrder(QDataStream::LittleEndian);
-    in.setVersion(QDataStream::Qt_4_5); // for single/double precision switch
 
-    // see http://code.blender.org/index.php/2013/08/fbx-binary-file-format-specification/ for an explanation
-    // of the FBX binary format
-
-    // The first 27 bytes contain the header.
-    //   Bytes 0 - 20: Kaydara FBX Binary  \x00(file - magic, with 2 spaces at the end, then a NULL terminator).
-    //   Bytes 21 - 22: [0x1A, 0x00](unknown but all observed files show these bytes).
-    //   Bytes 23 - 26 : unsigned int, the version number. 7300 for version 7.3 for example.
-    in.skipRawData(FBX_HEADER_BYTES_BEFORE_VERSION);
-    int position = FBX_HEADER_BYTES_BEFORE_VERSION;
-    quint32 fileVersion;
-    in >> fileVersion;
-    position += sizeof(fileVersion);
-    bool has64BitPositions = (fileVersion >= FBX_VERSION_2016);
-
-    // parse the top-level node
-    FBXNode top;
-    while (device->bytesAvailable()) {
-        FBXNode next = parseBinaryFBXNode(in, position, has64BitPositions);
-        if (next.name.isNull()) {
-            return top;
+    // binary files are parsed in memory, without copying the data if it is there already; the node offsets
+    // are from the start of the device, so the bytes before the current position are kept
+    auto buffer = qobject_cast<QBuffer*>(device);
+    if (buffer) {
+        return BinaryFBXReader(buffer->data(), buffer->pos()).parse();
+    }
+    qint64 start = device->isSequential() ? 0 : device->pos();
+    if (start > 0 && !device->seek(0)) {
+        throw QString("FBX file could not be read from the start");
+    }
+    return BinaryFBXReader(device->readAll(), start).parse();
+}
 
-        } else {
-            top.children.append(next);
-        }
+FBXNode FBXSerializer::parseFBX(const hifi::ByteArray& data) {
+    if (!data.startsWith(FBX_BINARY_PROLOG)) {
+        QBuffer buffer(const_cast<hifi::ByteArray*>(&data));
+        buffer.open(QIODevice::ReadOnly);
+        return parseFBX(&buffer);
     }
 
-    return top;
+    PROFILE_RANGE_EX(resource_parse, __FUNCTION__, 0xff0000ff, data.size());
+    return BinaryFBXReader(data).parse();
 }
 
 
@@ -11,9 +11,12 @@
 
 #include "GLTFSerializer.h"
 
+#include <algorithm>
+
 #include <QtCore/QBuffer>
 #include <QtCore/QIODevice>
 #include <QtCore/QEventLoop>
+#include <QtCore/QtEndian>
 #include <QtCore/qjsondocument.h>
 #include <QtCore/qjsonobject.h>
 #include <QtCore/qjsonarray.h>
@@ -148,26 +151,32 @@ bool GLTFSerializer::getObjectArrayVal(const QJsonObject& object, const QString&
 }
 
 hifi::ByteArray GLTFSerializer::setGLBChunks(const hifi::ByteArray& data) {
-    int byte = 4;
-    int jsonStart = data.indexOf("JSON", Qt::CaseSensitive);
-    int binStart = data.indexOf("BIN", Qt::CaseSensitive);
-    int jsonLength, binLength;
-    hifi::ByteArray jsonLengthChunk, binLengthChunk;
-
-    jsonLengthChunk = data.mid(jsonStart - byte, byte);
-    QDataStream tempJsonLen(jsonLengthChunk);
-    tempJsonLen.setByteOrder(QDataStream::LittleEndian);
-    tempJsonLen >> jsonLength;
-    hifi::ByteArray jsonChunk = data.mid(jsonStart + byte, jsonLength);
-
-    if (binStart != -1) {
-        binLengthChunk = data.mid(binStart - byte, byte);
-
-        QDataStream tempBinLen(binLengthChunk);
-        tempBinLen.setByteOrder(QDataStream::LittleEndian);
-        tempBinLen >> binLength;
+    // A 12 byte header (magic, version, length), then chunks made of their length, type and data
+    const int GLB_HEADER_BYTES = 12;
+    const int GLB_CHUNK_HEADER_BYTES = 8;
+    const quint32 GLB_CHUNK_TYPE_JSON = 0x4E4F534A;
+    const quint32 GLB_CHUNK_TYPE_BIN = 0x004E4942;
+
+    // The chunks point into the file rather than being copied out of it
+    _glbData = data;
+    hifi::ByteArray jsonChunk;
+    int position = GLB_HEADER_BYTES;
+    while (position + GLB_CHUNK_HEADER_BYTES <= _glbData.size()) {
+        quint32 chunkLength = qFromLittleEndian<quint32>(_glbData.constData() + position);
+        quint32 chunkType = qFromLittleEndian<quint32>(_glbData.constData() + position + 4);
+        position += GLB_CHUNK_HEADER_BYTES;
+        if (chunkLength > (quint32)(_glbData.size() - position)) {
+            qWarning(modelformat) << "glb chunk runs past the end of the file for model " << _url;
+            break;
+        }
 
-        _glbBinary = data.mid(binStart + byte, binLength);
+        auto chunk = hifi::ByteArray::fromRawData(_glbData.constData() + position, chunkLength);
+        if (chunkType == GLB_CHUNK_TYPE_JSON && jsonChunk.isNull()) {
+            jsonChunk = chunk;
+        } else if (chunkType == GLB_CHUNK_TYPE_BIN && _glbBinary.isNull()) {
+            _glbBinary = chunk;
+        }
+        position += chunkLength;
     }
     return jsonChunk;
 }
@@ -386,6 +395,7 @@ bool GLTFSerializer::addBufferView(const QJsonObject& object) {
     getIntVal(object, "buffer", bufferview.buffer, bufferview.defined);
     getIntVal(object, "byteLength", bufferview.byteLength, bufferview.defined);
     getIntVal(object, "byteOffset", bufferview.byteOffset, bufferview.defined);
+    getIntVal(object, "byteStride", bufferview.byteStride, bufferview.defined);
     getIntVal(object, "target", bufferview.target, bufferview.defined);
 
     _file.bufferviews.push_back(bufferview);
@@ -1805,7 +1815,10 @@ HFMTexture GLTFSerializer::getHFMTexture(const GLTFTexture& texture) {
             int offset = imagesBufferview.byteOffset;
             int length = imagesBufferview.byteLength;
 
-            fbxtex.content = _glbBinary.mid(offset, length);
+            // copied out, the model outlives the file it was read from
+            if (offset >= 0 && length >= 0 && offset <= _glbBinary.size() - length) {
+                fbxtex.content = hifi::ByteArray(_glbBinary.constData() + offset, length);
+            }
             fbxtex.filename = textureUrl.toEncoded().append(texture.source);
         }
 
@@ -1887,15 +1900,9 @@ void GLTFSerializer::setHFMMaterial(HFMMaterial& hfmMat, const GLTFMaterial& mat
 }
 
 template<typename T, typename L>
-bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int count,
+bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
                            QVector<L>& outarray, int accessorType, bool normalized) {
 
-    QDataStream blobstream(bin);
-    blobstream.setByteOrder(QDataStream::LittleEndian);
-    blobstream.setVersion(QDataStream::Qt_5_9);
-    blobstream.setFloatingPointPrecision(QDataStream::FloatingPointPrecision::SinglePrecision);
-    blobstream.skipRawData(byteOffset);
-
     int bufferCount = 0;
     switch (accessorType) {
     case GLTFAccessorType::SCALAR:
@@ -1921,7 +1928,17 @@ bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int c
         break;
     default:
         qWarning(modelformat) << "Unknown accessorType: " << accessorType;
-        blobstream.setDevice(nullptr);
+        return false;
+    }
+
+    // The elements are read in place, from a view of the buffer that can be interleaved with other attributes
+    const int elementBytes = bufferCount * (int)sizeof(T);
+    const int stride = byteStride > 0 ? byteStride : elementBytes;
+    if (count <= 0) {
+        return count == 0;
+    }
+    if (byteOffset < 0 || stride < elementBytes ||
+        (qint64)byteOffset + (qint64)(count - 1) * stride + elementBytes > (qint64)bin.size()) {
         return false;
     }
 
@@ -1930,46 +1947,45 @@ bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int c
         scale = (float)(std::numeric_limits<T>::max)();
     }
 
-    for (int i = 0; i < count; ++i) {
+    outarray.reserve(outarray.size() + count * bufferCount);
+    const char* element = bin.constData() + byteOffset;
+    for (int i = 0; i < count; ++i, element += stride) {
         for (int j = 0; j < bufferCount; ++j) {
-            if (!blobstream.atEnd()) {
-                T value;
-                blobstream >> value;
-                if (normalized) {
-                    outarray.push_back(std::max((float)value / scale, -1.0f));
-                } else {
-                    outarray.push_back(value);
-                }
+            T value;
+            memcpy(&value, element + j * sizeof(T), sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+            std::reverse((char*)&value, (char*)&value + sizeof(T));
+#endif
+            if (normalized) {
+                outarray.push_back(std::max((float)value / scale, -1.0f));
             } else {
-                blobstream.setDevice(nullptr);
-                return false;
+                outarray.push_back(value);
             }
         }
     }
 
-    blobstream.setDevice(nullptr);
     return true;
 }
 template<typename T>
-bool GLTFSerializer::addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int count,
+bool GLTFSerializer::addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
                                 QVector<T>& outarray, int accessorType, int componentType, bool normalized) {
 
     switch (componentType) {
     case GLTFAccessorComponentType::BYTE: {}
     case GLTFAccessorComponentType::UNSIGNED_BYTE: {
-        return readArray<uchar>(bin, byteOffset, count, outarray, accessorType, normalized);
+        return readArray<uchar>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
     }
     case GLTFAccessorComponentType::SHORT: {
-        return readArray<short>(bin, byteOffset, count, outarray, accessorType, normalized);
+        return readArray<short>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
     }
     case GLTFAccessorComponentType::UNSIGNED_INT: {
-        return readArray<uint>(bin, byteOffset, count, outarray, accessorType, normalized);
+        return readArray<uint>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
     }
     case GLTFAccessorComponentType::UNSIGNED_SHORT: {
-        return readArray<ushort>(bin, byteOffset, count, outarray, accessorType, normalized);
+        return readArray<ushort>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
     }
     case GLTFAccessorComponentType::FLOAT: {
-        return readArray<float>(bin, byteOffset, count, outarray, accessorType, normalized);
+        return readArray<float>(bin, byteOffset, byteStride, count, outarray, accessorType, normalized);
     }
     }
     return false;
@@ -1985,8 +2001,8 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
         int accBoffset = accessor.defined["byteOffset"] ? accessor.byteOffset : 0;
 
-        success = addArrayOfType(buffer.blob, bufferview.byteOffset + accBoffset, accessor.count, outarray, accessor.type,
-                                 accessor.componentType, accessor.normalized);
+        success = addArrayOfType(buffer.blob, bufferview.byteOffset + accBoffset, bufferview.byteStride, accessor.count,
+                                 outarray, accessor.type, accessor.componentType, accessor.normalized);
     } else {
         for (int i = 0; i < accessor.count; ++i) {
             T value;
@@ -2004,7 +2020,8 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
             int accSIBoffset = accessor.sparse.indices.defined["byteOffset"] ? accessor.sparse.indices.byteOffset : 0;
 
-            success = addArrayOfType(sparseIndicesBuffer.blob, sparseIndicesBufferview.byteOffset + accSIBoffset,
+            // sparse indices and values are always tightly packed
+            success = addArrayOfType(sparseIndicesBuffer.blob, sparseIndicesBufferview.byteOffset + accSIBoffset, 0,
                                      accessor.sparse.count, out_sparse_indices_array, GLTFAccessorType::SCALAR,
                                      accessor.sparse.indices.componentType, false);
             if (success) {
@@ -2015,7 +2032,7 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
                 int accSVBoffset = accessor.sparse.values.defined["byteOffset"] ? accessor.sparse.values.byteOffset : 0;
 
-                success = addArrayOfType(sparseValuesBuffer.blob, sparseValuesBufferview.byteOffset + accSVBoffset,
+                success = addArrayOfType(sparseValuesBuffer.blob, sparseValuesBufferview.byteOffset + accSVBoffset, 0,
                                          accessor.sparse.count, out_sparse_values_array, accessor.type, accessor.componentType,
                                          accessor.normalized);
 
@@ -206,6 +206,7 @@ struct GLTFBufferView {
     int buffer; //required
     int byteLength; //required
     int byteOffset { 0 };
+    int byteStride { 0 }; // 0 for tightly packed elements
     int target;
     QMap<QString, bool> defined;
     void dump() {
@@ -218,6 +219,9 @@ struct GLTFBufferView {
         if (defined["byteOffset"]) {
             qCDebug(modelformat) << "byteOffset: " << byteOffset;
         }
+        if (defined["byteStride"]) {
+            qCDebug(modelformat) << "byteStride: " << byteStride;
+        }
         if (defined["target"]) {
             qCDebug(modelformat) << "target: " << target;
         }
@@ -770,6 +774,7 @@ public:
 private:
     GLTFFile _file;
     hifi::URL _url;
+    hifi::ByteArray _glbData; // the whole .glb file, kept alive for the chunks pointing into it
     hifi::ByteArray _glbBinary;
 
     glm::mat4 getModelTransform(const GLTFNode& node);
@@ -831,11 +836,11 @@ private:
     bool readBinary(const QString& url, hifi::ByteArray& outdata);
 
     template<typename T, typename L>
-    bool readArray(const hifi::ByteArray& bin, int byteOffset, int count,
+    bool readArray(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
                    QVector<L>& outarray, int accessorType, bool normalized);
 
     template<typename T>
-    bool addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int count,
+    bool addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
                         QVector<T>& outarray, int accessorType, int componentType, bool normalized);
 
     template <typename T>
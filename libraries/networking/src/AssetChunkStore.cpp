@@ -0,0 +1,448 @@
+//
+//  AssetChunkStore.cpp
+//  libraries/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetChunkStore.h"
+
+#include <array>
+#include <string>
+#include <unordered_set>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+
+#include <SharedUtil.h>
+
+#include "NetworkLogging.h"
+
+static const QString CHUNKS_SUBDIR = "chunks";
+static const QString MANIFESTS_SUBDIR = "manifests";
+
+static const quint32 MANIFEST_MAGIC = 0x4d434648; // "HFCM"
+static const quint32 MANIFEST_VERSION = 1;
+
+static const int MAX_CACHED_MANIFESTS = 256;
+
+// With a uniformly distributed rolling hash, testing 16 bits gives a cut point every 64KB on average.
+static const uint64_t CHUNK_BOUNDARY_MASK = (uint64_t)(AssetChunkStore::AVERAGE_CHUNK_SIZE - 1) << 48;
+
+// The gear table must never change once chunks are on disk: changing it moves every chunk boundary
+// and defeats deduplication against everything stored before the change.
+static const std::array<uint64_t, 256>& gearTable() {
+    static const std::array<uint64_t, 256> table = [] {
+        std::array<uint64_t, 256> values;
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (auto& value : values) {
+            // splitmix64
+            state += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            value = z ^ (z >> 31);
+        }
+        return values;
+    }();
+    return table;
+}
+
+int AssetChunkStore::findChunkBoundary(const char* data, int size, uint64_t& rollingHash) {
+    const auto& gear = gearTable();
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    for (int i = 0; i < size; ++i) {
+        rollingHash = (rollingHash << 1) + gear[bytes[i]];
+        if ((rollingHash & CHUNK_BOUNDARY_MASK) == 0) {
+            return i + 1;
+        }
+    }
+    return -1;
+}
+
+AssetChunkStore::Writer::Writer(AssetChunkStore& store) :
+    _store(store),
+    _lock(&store._gcLock),
+    _startUsecs(usecTimestampNow())
+{
+    _currentChunk.reserve(MAX_CHUNK_SIZE);
+}
+
+bool AssetChunkStore::Writer::addData(const char* data, qint64 size) {
+    if (_failed) {
+        return false;
+    }
+
+    _assetHasher.addData(data, (int)size);
+    _manifest.size += size;
+
+    while (size > 0) {
+        int chunkSize = _currentChunk.size();
+        int boundary = -1;
+
+        // nothing before the minimum chunk size can be a cut point, so skip hashing it entirely
+        int skip = (int)std::min<qint64>(size, std::max(0, MIN_CHUNK_SIZE - chunkSize));
+        if (skip > 0) {
+            _currentChunk.append(data, skip);
+            data += skip;
+            size -= skip;
+            chunkSize += skip;
+        }
+
+        int searchSize = (int)std::min<qint64>(size, MAX_CHUNK_SIZE - chunkSize);
+        if (searchSize > 0) {
+            boundary = findChunkBoundary(data, searchSize, _rollingHash);
+            int consumed = boundary >= 0 ? boundary : searchSize;
+            _currentChunk.append(data, consumed);
+            data += consumed;
+            size -= consumed;
+        }
+
+        if (boundary >= 0 || _currentChunk.size() >= MAX_CHUNK_SIZE) {
+            if (!cutChunk()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool AssetChunkStore::Writer::cutChunk() {
+    auto chunkHash = QCryptographicHash::hash(_currentChunk, QCryptographicHash::Sha256);
+    if (!_store.writeChunk(chunkHash, _currentChunk)) {
+        _failed = true;
+        return false;
+    }
+
+    _manifest.chunks.push_back({ chunkHash, (uint32_t)_currentChunk.size() });
+    _currentChunk.resize(0);
+    _rollingHash = 0;
+    return true;
+}
+
+QByteArray AssetChunkStore::Writer::finish() {
+    if (!_failed && _currentChunk.size() > 0) {
+        cutChunk();
+    }
+
+    if (_failed) {
+        return QByteArray();
+    }
+
+    auto assetHash = _assetHasher.result();
+    if (!_store.writeManifest(assetHash, _manifest)) {
+        return QByteArray();
+    }
+
+    _store._ingestedBytes += _manifest.size;
+    _store._ingestUsecs += usecTimestampNow() - _startUsecs;
+    return assetHash;
+}
+
+AssetChunkStore::AssetChunkStore(const QDir& rootDirectory) :
+    _chunksDirectory(rootDirectory),
+    _manifestsDirectory(rootDirectory),
+    _manifestCache(MAX_CACHED_MANIFESTS)
+{
+}
+
+bool AssetChunkStore::initialize() {
+    if (!_chunksDirectory.mkpath(CHUNKS_SUBDIR) || !_chunksDirectory.cd(CHUNKS_SUBDIR)) {
+        qCCritical(asset_client) << "Unable to create chunk directory for the asset chunk store.";
+        return false;
+    }
+    if (!_manifestsDirectory.mkpath(MANIFESTS_SUBDIR) || !_manifestsDirectory.cd(MANIFESTS_SUBDIR)) {
+        qCCritical(asset_client) << "Unable to create manifest directory for the asset chunk store.";
+        return false;
+    }
+
+    // reclaim chunks left behind by uploads that never committed their manifest, and count what is there
+    collectGarbage();
+    return true;
+}
+
+QString AssetChunkStore::getChunkPath(const QByteArray& chunkHash) const {
+    // fan chunks out over 256 sub-directories to keep directory listings short
+    auto hexHash = QString(chunkHash.toHex());
+    return _chunksDirectory.absoluteFilePath(hexHash.left(2) + "/" + hexHash);
+}
+
+QString AssetChunkStore::getManifestPath(const AssetUtils::AssetHash& hexHash) const {
+    return _manifestsDirectory.absoluteFilePath(hexHash.toLower());
+}
+
+bool AssetChunkStore::writeChunk(const QByteArray& chunkHash, const QByteArray& chunkData) {
+    auto chunkPath = getChunkPath(chunkHash);
+    if (QFile::exists(chunkPath)) {
+        return true;
+    }
+
+    QDir().mkpath(QFileInfo(chunkPath).absolutePath());
+
+    // QSaveFile writes to a temporary file and renames it, so concurrent uploads of the same chunk are harmless
+    QSaveFile chunkFile { chunkPath };
+    if (!chunkFile.open(QIODevice::WriteOnly) || chunkFile.write(chunkData) != chunkData.size() || !chunkFile.commit()) {
+        qCWarning(asset_client) << "Failed to write chunk" << chunkHash.toHex();
+        return false;
+    }
+
+    _writtenChunkBytes += chunkData.size();
+
+    // two uploads racing on the same new chunk can both count it, the next collection recounts exactly
+    QMutexLocker totalsLocker { &_totalsMutex };
+    ++_numChunks;
+    _storedBytes += chunkData.size();
+    return true;
+}
+
+bool AssetChunkStore::writeManifest(const QByteArray& assetHash, const Manifest& manifest) {
+    auto hexHash = AssetUtils::AssetHash(assetHash.toHex());
+    auto manifestPath = getManifestPath(hexHash);
+    if (QFile::exists(manifestPath)) {
+        return true;
+    }
+
+    QSaveFile manifestFile { manifestPath };
+    if (!manifestFile.open(QIODevice::WriteOnly)) {
+        qCWarning(asset_client) << "Failed to open manifest for" << hexHash;
+        return false;
+    }
+
+    QDataStream stream { &manifestFile };
+    stream << MANIFEST_MAGIC << MANIFEST_VERSION << (quint64)manifest.size << (quint32)manifest.chunks.size();
+    for (const auto& chunk : manifest.chunks) {
+        stream.writeRawData(chunk.hash.constData(), chunk.hash.size());
+        stream << (quint32)chunk.size;
+    }
+
+    if (stream.status() != QDataStream::Ok || !manifestFile.commit()) {
+        qCWarning(asset_client) << "Failed to commit manifest for" << hexHash;
+        return false;
+    }
+
+    QMutexLocker totalsLocker { &_totalsMutex };
+    ++_numManifests;
+    _logicalBytes += manifest.size;
+    return true;
+}
+
+AssetChunkStore::ManifestPointer AssetChunkStore::getManifest(const AssetUtils::AssetHash& hexHash) {
+    auto key = hexHash.toLower();
+    {
+        QMutexLocker locker { &_manifestCacheMutex };
+        if (auto cached = _manifestCache.object(key)) {
+            return *cached;
+        }
+    }
+
+    QFile manifestFile { getManifestPath(key) };
+    if (!manifestFile.open(QIODevice::ReadOnly)) {
+        return ManifestPointer();
+    }
+
+    QDataStream stream { &manifestFile };
+    quint32 magic { 0 };
+    quint32 version { 0 };
+    quint64 size { 0 };
+    quint32 numChunks { 0 };
+    stream >> magic >> version >> size >> numChunks;
+
+    if (magic != MANIFEST_MAGIC || version != MANIFEST_VERSION) {
+        qCWarning(asset_client) << "Manifest for" << key << "has an unknown format.";
+        return ManifestPointer();
+    }
+
+    auto manifest = std::make_shared<Manifest>();
+    manifest->size = size;
+    manifest->chunks.reserve(numChunks);
+
+    uint64_t chunkTotal = 0;
+    for (quint32 i = 0; i < numChunks; ++i) {
+        ChunkReference chunk;
+        chunk.hash.resize((int)AssetUtils::SHA256_HASH_LENGTH);
+        stream.readRawData(chunk.hash.data(), chunk.hash.size());
+        quint32 chunkSize { 0 };
+        stream >> chunkSize;
+        chunk.size = chunkSize;
+        chunkTotal += chunkSize;
+        manifest->chunks.push_back(chunk);
+    }
+
+    if (stream.status() != QDataStream::Ok || chunkTotal != size) {
+        qCWarning(asset_client) << "Manifest for" << key << "is truncated or corrupt.";
+        return ManifestPointer();
+    }
+
+    ManifestPointer result = manifest;
+    QMutexLocker locker { &_manifestCacheMutex };
+    _manifestCache.insert(key, new ManifestPointer(result));
+    return result;
+}
+
+bool AssetChunkStore::hasAsset(const AssetUtils::AssetHash& hexHash) {
+    QReadLocker lock { &_gcLock };
+    return (bool)getManifest(hexHash);
+}
+
+int64_t AssetChunkStore::getAssetSize(const AssetUtils::AssetHash& hexHash) {
+    QReadLocker lock { &_gcLock };
+    auto manifest = getManifest(hexHash);
+    return manifest ? (int64_t)manifest->size : -1;
+}
+
+QByteArray AssetChunkStore::readRange(const AssetUtils::AssetHash& hexHash, int64_t offset, int64_t size) {
+    QReadLocker lock { &_gcLock };
+
+    auto manifest = getManifest(hexHash);
+    if (!manifest || offset < 0 || size < 0 || (uint64_t)(offset + size) > manifest->size) {
+        return QByteArray();
+    }
+
+    QByteArray result;
+    result.reserve((int)size);
+
+    int64_t chunkStart = 0;
+    for (const auto& chunk : manifest->chunks) {
+        int64_t chunkEnd = chunkStart + chunk.size;
+        if (chunkEnd > offset && (int64_t)result.size() < size) {
+            QFile chunkFile { getChunkPath(chunk.hash) };
+            if (!chunkFile.open(QIODevice::ReadOnly)) {
+                qCWarning(asset_client) << "Missing chunk" << chunk.hash.toHex() << "for asset" << hexHash;
+                return QByteArray();
+            }
+
+            int64_t readOffset = std::max<int64_t>(offset - chunkStart, 0);
+            int64_t readSize = std::min<int64_t>(chunk.size - readOffset, size - result.size());
+            chunkFile.seek(readOffset);
+            auto data = chunkFile.read(readSize);
+            if (data.size() != readSize) {
+                qCWarning(asset_client) << "Short read on chunk" << chunk.hash.toHex() << "for asset" << hexHash;
+                return QByteArray();
+            }
+            result.append(data);
+        }
+
+        if ((int64_t)result.size() >= size) {
+            break;
+        }
+        chunkStart = chunkEnd;
+    }
+
+    return result;
+}
+
+bool AssetChunkStore::copyAssetToFile(const AssetUtils::AssetHash& hexHash, const QString& filePath) {
+    QReadLocker lock { &_gcLock };
+
+    auto manifest = getManifest(hexHash);
+    if (!manifest) {
+        return false;
+    }
+
+    QFile outputFile { filePath };
+    if (!outputFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    for (const auto& chunk : manifest->chunks) {
+        QFile chunkFile { getChunkPath(chunk.hash) };
+        if (!chunkFile.open(QIODevice::ReadOnly) || outputFile.write(chunkFile.readAll()) != chunk.size) {
+            qCWarning(asset_client) << "Failed to reassemble" << hexHash << "at chunk" << chunk.hash.toHex();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AssetChunkStore::removeAsset(const AssetUtils::AssetHash& hexHash) {
+    QReadLocker lock { &_gcLock };
+    auto manifest = getManifest(hexHash);
+    {
+        QMutexLocker locker { &_manifestCacheMutex };
+        _manifestCache.remove(hexHash.toLower());
+    }
+    if (!QFile::remove(getManifestPath(hexHash))) {
+        return false;
+    }
+
+    // the chunks stay on disk, and in the stored totals, until the next collection
+    if (manifest) {
+        QMutexLocker totalsLocker { &_totalsMutex };
+        _numManifests = _numManifests > 0 ? _numManifests - 1 : 0;
+        _logicalBytes = _logicalBytes > manifest->size ? _logicalBytes - manifest->size : 0;
+    }
+    return true;
+}
+
+QStringList AssetChunkStore::getAssetHashes() const {
+    return _manifestsDirectory.entryList(QDir::Files);
+}
+
+void AssetChunkStore::collectGarbage() {
+    QWriteLocker lock { &_gcLock };
+
+    // mark every chunk referenced by a manifest
+    std::unordered_set<std::string> referencedChunks;
+    uint64_t numManifests = 0;
+    uint64_t logicalBytes = 0;
+    for (const auto& hexHash : getAssetHashes()) {
+        auto manifest = getManifest(hexHash);
+        if (!manifest) {
+            continue;
+        }
+        ++numManifests;
+        logicalBytes += manifest->size;
+        for (const auto& chunk : manifest->chunks) {
+            referencedChunks.insert(chunk.hash.toStdString());
+        }
+    }
+
+    // sweep the ones nothing points to anymore
+    uint64_t numChunks = 0;
+    uint64_t storedBytes = 0;
+    uint64_t numRemoved = 0;
+    QDirIterator it(_chunksDirectory.absolutePath(), QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        auto chunkHash = QByteArray::fromHex(it.fileName().toLatin1());
+        if (referencedChunks.find(chunkHash.toStdString()) == referencedChunks.end()) {
+            if (QFile::remove(it.filePath())) {
+                ++numRemoved;
+            }
+        } else {
+            ++numChunks;
+            storedBytes += it.fileInfo().size();
+        }
+    }
+
+    qCDebug(asset_client) << "Chunk store garbage collection removed" << numRemoved << "chunks," << numChunks
+        << "chunks in use by" << numManifests << "assets";
+
+    QMutexLocker totalsLocker { &_totalsMutex };
+    _numManifests = numManifests;
+    _numChunks = numChunks;
+    _logicalBytes = logicalBytes;
+    _storedBytes = storedBytes;
+}
+
+AssetChunkStore::Stats AssetChunkStore::getStats() const {
+    Stats stats;
+    stats.ingestedBytes = _ingestedBytes;
+    stats.writtenChunkBytes = _writtenChunkBytes;
+    stats.ingestUsecs = _ingestUsecs;
+
+    QMutexLocker locker { &_totalsMutex };
+    stats.numManifests = _numManifests;
+    stats.numChunks = _numChunks;
+    stats.logicalBytes = _logicalBytes;
+    stats.storedBytes = _storedBytes;
+    return stats;
+}
@@ -0,0 +1,146 @@
+//
+//  AssetChunkStore.h
+//  libraries/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetChunkStore_h
+#define hifi_AssetChunkStore_h
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QMutex>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QSet>
+
+#include "AssetUtils.h"
+
+/// Content-addressed store that splits assets into content-defined chunks.
+///
+/// Chunk boundaries are picked by a gear rolling hash so that a local edit to a large asset only changes
+/// the chunks around the edit; every other chunk is shared with the previous upload. Each chunk is stored once
+/// under `chunks/` named by its SHA-256, and each asset gets a manifest under `manifests/` named by the
+/// SHA-256 of the whole asset, listing the chunks it is made of.
+///
+/// Uploads and reads take a shared lock, garbage collection takes an exclusive one, so a chunk is never
+/// removed while a writer may still reference it from a manifest it has not committed yet.
+class AssetChunkStore {
+public:
+    static const int MIN_CHUNK_SIZE = 16 * 1024;
+    static const int AVERAGE_CHUNK_SIZE = 64 * 1024;
+    static const int MAX_CHUNK_SIZE = 256 * 1024;
+
+    struct ChunkReference {
+        QByteArray hash; // raw SHA-256
+        uint32_t size { 0 };
+    };
+
+    struct Manifest {
+        uint64_t size { 0 };
+        std::vector<ChunkReference> chunks;
+    };
+    using ManifestPointer = std::shared_ptr<const Manifest>;
+
+    struct Stats {
+        uint64_t ingestedBytes { 0 };
+        uint64_t writtenChunkBytes { 0 };
+        uint64_t ingestUsecs { 0 };
+        uint64_t numManifests { 0 };
+        uint64_t numChunks { 0 };
+        uint64_t logicalBytes { 0 };
+        uint64_t storedBytes { 0 };
+    };
+
+    /// Streams one asset into the store, hashing it incrementally as data arrives.
+    class Writer {
+    public:
+        Writer(AssetChunkStore& store);
+
+        bool addData(const char* data, qint64 size);
+
+        /// Flushes the trailing chunk and commits the manifest. Returns the raw SHA-256 of the whole asset,
+        /// or an empty array if a chunk or the manifest could not be written.
+        QByteArray finish();
+
+    private:
+        bool cutChunk();
+
+        AssetChunkStore& _store;
+        QReadLocker _lock;
+        QCryptographicHash _assetHasher { QCryptographicHash::Sha256 };
+        QByteArray _currentChunk;
+        uint64_t _rollingHash { 0 };
+        Manifest _manifest;
+        quint64 _startUsecs { 0 };
+        bool _failed { false };
+    };
+
+    AssetChunkStore(const QDir& rootDirectory);
+
+    /// Creates the chunk and manifest directories and collects any garbage left from a previous run.
+    /// Returns false if either directory could not be created.
+    bool initialize();
+
+    bool hasAsset(const AssetUtils::AssetHash& hexHash);
+    int64_t getAssetSize(const AssetUtils::AssetHash& hexHash);
+
+    /// Reads `size` bytes starting at `offset`, only touching the chunks that overlap the range.
+    /// Returns a null array if the asset or one of its chunks is missing.
+    QByteArray readRange(const AssetUtils::AssetHash& hexHash, int64_t offset, int64_t size);
+
+    /// Reassembles the full asset into `filePath`, for consumers (like the oven) that need a real file.
+    bool copyAssetToFile(const AssetUtils::AssetHash& hexHash, const QString& filePath);
+
+    /// Removes the manifest for an asset. Chunks it referenced are reclaimed by the next garbage collection.
+    bool removeAsset(const AssetUtils::AssetHash& hexHash);
+
+    QStringList getAssetHashes() const;
+
+    /// Deletes every chunk not referenced by a manifest, and recounts the totals in the stats from disk.
+    /// Uploads and removals keep the totals up to date in between.
+    void collectGarbage();
+
+    Stats getStats() const;
+
+    /// Exposes the rolling hash cut-point search, so the boundary rule is testable without touching disk.
+    static int findChunkBoundary(const char* data, int size, uint64_t& rollingHash);
+
+private:
+    ManifestPointer getManifest(const AssetUtils::AssetHash& hexHash);
+    bool writeManifest(const QByteArray& assetHash, const Manifest& manifest);
+    bool writeChunk(const QByteArray& chunkHash, const QByteArray& chunkData);
+
+    QString getChunkPath(const QByteArray& chunkHash) const;
+    QString getManifestPath(const AssetUtils::AssetHash& hexHash) const;
+
+    QDir _chunksDirectory;
+    QDir _manifestsDirectory;
+
+    QReadWriteLock _gcLock;
+
+    QMutex _manifestCacheMutex;
+    QCache<AssetUtils::AssetHash, ManifestPointer> _manifestCache;
+
+    std::atomic<uint64_t> _ingestedBytes { 0 };
+    std::atomic<uint64_t> _writtenChunkBytes { 0 };
+    std::atomic<uint64_t> _ingestUsecs { 0 };
+
+    mutable QMutex _totalsMutex;
+    uint64_t _numManifests { 0 };
+    uint64_t _numChunks { 0 };
+    uint64_t _logicalBytes { 0 };
+    uint64_t _storedBytes { 0 };
+};
+
+#endif // hifi_AssetChunkStore_h
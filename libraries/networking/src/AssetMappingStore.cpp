@@ -0,0 +1,310 @@
+//
+//  AssetMappingStore.cpp
+//  libraries/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetMappingStore.h"
+
+#include <algorithm>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "NetworkLogging.h"
+
+static const quint32 LOG_RECORD_MAGIC = 0x474f4c4d; // "MLOG"
+static const int LOG_RECORD_HEADER_SIZE = sizeof(quint32) + sizeof(quint32) + sizeof(quint16);
+
+static bool syncToDisk(QFile& file) {
+    if (!file.flush()) {
+        return false;
+    }
+#ifdef Q_OS_WIN
+    return _commit(file.handle()) == 0;
+#else
+    return fsync(file.handle()) == 0;
+#endif
+}
+
+void AssetMappingStore::Transaction::setMapping(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
+    _operations.push_back({ Set, path, hash });
+}
+
+void AssetMappingStore::Transaction::deleteMapping(const AssetUtils::AssetPath& path) {
+    _operations.push_back({ Delete, path, AssetUtils::AssetHash() });
+}
+
+bool AssetMappingStore::load(const QString& snapshotPath, const QString& logPath) {
+    _snapshotPath = snapshotPath;
+    _logFile.setFileName(logPath);
+    _mappings.clear();
+    _hashReferenceCounts.clear();
+    _operationsSinceCompaction = 0;
+    _snapshotSize = 0;
+
+    if (!loadSnapshot() || !replayLog()) {
+        return false;
+    }
+
+    // start every run from a fresh snapshot so the log only ever holds this run's changes
+    if (_operationsSinceCompaction > 0 && !compact()) {
+        return false;
+    }
+
+    if (!_logFile.isOpen() && !_logFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(asset_client) << "Failed to open mapping log at" << logPath;
+        return false;
+    }
+
+    return true;
+}
+
+bool AssetMappingStore::loadSnapshot() {
+    QFile mapFile { _snapshotPath };
+    if (!mapFile.exists()) {
+        qCInfo(asset_client) << "No existing mappings loaded from file since no file was found at" << _snapshotPath;
+        return true;
+    }
+
+    if (!mapFile.open(QIODevice::ReadOnly)) {
+        qCCritical(asset_client) << "Failed to read mapping file at" << _snapshotPath;
+        return false;
+    }
+
+    _snapshotSize = mapFile.size();
+
+    QJsonParseError error;
+    auto jsonDocument = QJsonDocument::fromJson(mapFile.readAll(), &error);
+
+    if (error.error != QJsonParseError::NoError) {
+        qCCritical(asset_client) << "Failed to read mapping file at" << _snapshotPath;
+        return false;
+    }
+
+    if (!jsonDocument.isObject()) {
+        qCWarning(asset_client) << "Failed to read mapping file, root value in" << _snapshotPath << "is not an object";
+        return false;
+    }
+
+    auto root = jsonDocument.object();
+    for (auto it = root.begin(); it != root.end(); ++it) {
+        auto key = it.key();
+        auto value = it.value();
+
+        if (!value.isString()) {
+            qCWarning(asset_client) << "Skipping" << key << ":" << value << "because it is not a string";
+            continue;
+        }
+
+        if (!AssetUtils::isValidFilePath(key)) {
+            qCWarning(asset_client) << "Will not keep mapping for" << key << "since it is not a valid path.";
+            continue;
+        }
+
+        if (!AssetUtils::isValidHash(value.toString())) {
+            qCWarning(asset_client) << "Will not keep mapping for" << key << "since it does not have a valid hash.";
+            continue;
+        }
+
+        insertMapping(key, value.toString());
+    }
+
+    qCInfo(asset_client) << "Loaded" << _mappings.size() << "mappings from map file at" << _snapshotPath;
+    return true;
+}
+
+bool AssetMappingStore::replayLog() {
+    if (!_logFile.exists()) {
+        return true;
+    }
+
+    if (!_logFile.open(QIODevice::ReadOnly)) {
+        qCCritical(asset_client) << "Failed to read mapping log at" << _logFile.fileName();
+        return false;
+    }
+
+    auto data = _logFile.readAll();
+    _logFile.close();
+
+    int numTransactions = 0;
+    int position = 0;
+    while (data.size() - position >= LOG_RECORD_HEADER_SIZE) {
+        QDataStream header { data.mid(position, LOG_RECORD_HEADER_SIZE) };
+        quint32 magic { 0 };
+        quint32 payloadSize { 0 };
+        quint16 checksum { 0 };
+        header >> magic >> payloadSize >> checksum;
+
+        int payloadStart = position + LOG_RECORD_HEADER_SIZE;
+        if (magic != LOG_RECORD_MAGIC || payloadSize > (quint32)(data.size() - payloadStart)
+            || qChecksum(data.constData() + payloadStart, payloadSize) != checksum) {
+            break;
+        }
+
+        Transaction transaction;
+        QDataStream payload { data.mid(payloadStart, payloadSize) };
+        quint32 numOperations { 0 };
+        payload >> numOperations;
+        for (quint32 i = 0; i < numOperations; ++i) {
+            quint8 type { 0 };
+            Transaction::Operation operation;
+            payload >> type >> operation.path >> operation.hash;
+            operation.type = (Transaction::OperationType)type;
+            transaction._operations.push_back(operation);
+        }
+
+        if (payload.status() != QDataStream::Ok) {
+            break;
+        }
+
+        apply(transaction);
+        _operationsSinceCompaction += (int)transaction.size();
+        ++numTransactions;
+        position = payloadStart + payloadSize;
+    }
+
+    if (position < data.size()) {
+        qCWarning(asset_client) << "Discarding" << data.size() - position << "bytes of incomplete mapping log at"
+            << _logFile.fileName();
+    }
+
+    qCInfo(asset_client) << "Replayed" << numTransactions << "mapping transactions from" << _logFile.fileName();
+    return true;
+}
+
+bool AssetMappingStore::commit(const Transaction& transaction) {
+    if (transaction.isEmpty()) {
+        return true;
+    }
+
+    QByteArray payload;
+    {
+        QDataStream stream { &payload, QIODevice::WriteOnly };
+        stream << (quint32)transaction.size();
+        for (const auto& operation : transaction._operations) {
+            stream << (quint8)operation.type << operation.path << operation.hash;
+        }
+    }
+
+    QByteArray record;
+    {
+        QDataStream stream { &record, QIODevice::WriteOnly };
+        stream << LOG_RECORD_MAGIC << (quint32)payload.size() << qChecksum(payload.constData(), payload.size());
+    }
+    record.append(payload);
+
+    auto position = _logFile.pos();
+    if (_logFile.write(record) != record.size() || !syncToDisk(_logFile)) {
+        qCWarning(asset_client) << "Failed to append to mapping log at" << _logFile.fileName();
+
+        // don't leave a partial record behind for the next commit to append after
+        _logFile.resize(position);
+        _logFile.seek(position);
+        return false;
+    }
+
+    apply(transaction);
+
+    // compacting only once the log has caught up with the snapshot keeps the rewrites to a constant factor of
+    // what was logged, however large the mappings get
+    _operationsSinceCompaction += (int)transaction.size();
+    if (_logFile.pos() >= std::max(_minCompactionLogSize, _snapshotSize)) {
+        // the transaction is already durable in the log, a failed compaction is retried on the next commit
+        compact();
+    }
+
+    return true;
+}
+
+bool AssetMappingStore::compact() {
+    QSaveFile mapFile { _snapshotPath };
+    if (!mapFile.open(QIODevice::WriteOnly)) {
+        qCWarning(asset_client) << "Failed to open map file at" << _snapshotPath;
+        return false;
+    }
+
+    QJsonObject root;
+    for (const auto& mapping : _mappings) {
+        root[mapping.first] = mapping.second;
+    }
+
+    auto json = QJsonDocument(root).toJson();
+    if (mapFile.write(json) == -1 || !mapFile.commit()) {
+        qCWarning(asset_client) << "Failed to write JSON mappings to file at" << _snapshotPath;
+        return false;
+    }
+    _snapshotSize = json.size();
+
+    // the snapshot now holds everything in the log, replaying the log on top of it would be a no-op,
+    // so a crash before the truncation below is harmless
+    if (_logFile.isOpen()) {
+        _logFile.close();
+    }
+    if (!_logFile.open(QIODevice::WriteOnly | QIODevice::Truncate) || !syncToDisk(_logFile)) {
+        qCWarning(asset_client) << "Failed to truncate mapping log at" << _logFile.fileName();
+        return false;
+    }
+
+    qCDebug(asset_client) << "Compacted" << _operationsSinceCompaction << "logged mapping operations into" << _snapshotPath;
+    _operationsSinceCompaction = 0;
+    return true;
+}
+
+AssetMappingStore::Range AssetMappingStore::getMappingsWithPrefix(const AssetUtils::AssetPath& prefix) const {
+    auto first = _mappings.lower_bound(prefix);
+    auto last = first;
+    while (last != _mappings.end() && last->first.startsWith(prefix)) {
+        ++last;
+    }
+    return { first, last };
+}
+
+void AssetMappingStore::apply(const Transaction& transaction) {
+    for (const auto& operation : transaction._operations) {
+        if (operation.type == Transaction::Set) {
+            insertMapping(operation.path, operation.hash);
+        } else {
+            eraseMapping(operation.path);
+        }
+    }
+}
+
+void AssetMappingStore::insertMapping(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) {
+    auto result = _mappings.insert({ path, hash });
+    if (!result.second) {
+        if (result.first->second == hash) {
+            return;
+        }
+        auto oldHash = result.first->second;
+        if (--_hashReferenceCounts[oldHash] == 0) {
+            _hashReferenceCounts.remove(oldHash);
+        }
+        result.first->second = hash;
+    }
+    ++_hashReferenceCounts[hash];
+}
+
+void AssetMappingStore::eraseMapping(const AssetUtils::AssetPath& path) {
+    auto it = _mappings.find(path);
+    if (it == _mappings.end()) {
+        return;
+    }
+    if (--_hashReferenceCounts[it->second] == 0) {
+        _hashReferenceCounts.remove(it->second);
+    }
+    _mappings.erase(it);
+}
@@ -0,0 +1,110 @@
+//
+//  AssetMappingStore.h
+//  libraries/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetMappingStore_h
+#define hifi_AssetMappingStore_h
+
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+#include "AssetUtils.h"
+
+/// Crash-safe, indexed store for the asset server's path => hash mappings.
+///
+/// Committed transactions are appended to a log and flushed to disk before they are applied in memory, so a
+/// failed commit leaves the mappings untouched and a crash never loses an acknowledged change. The log is folded
+/// into a JSON snapshot (the historical map.json format) once it grows past the compaction threshold.
+///
+/// Mappings are kept sorted by path, so the contents of a folder are a contiguous range found with a single
+/// lookup, and a per-hash reference count answers "is this hash still mapped?" without a scan.
+class AssetMappingStore {
+public:
+    using const_iterator = AssetUtils::Mappings::const_iterator;
+    using Range = std::pair<const_iterator, const_iterator>;
+
+    /// A batch of mapping changes that is written and applied atomically.
+    class Transaction {
+    public:
+        void setMapping(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
+        void deleteMapping(const AssetUtils::AssetPath& path);
+
+        bool isEmpty() const { return _operations.empty(); }
+        size_t size() const { return _operations.size(); }
+
+    private:
+        friend class AssetMappingStore;
+
+        enum OperationType : uint8_t {
+            Set = 0,
+            Delete
+        };
+
+        struct Operation {
+            OperationType type;
+            AssetUtils::AssetPath path;
+            AssetUtils::AssetHash hash;
+        };
+
+        std::vector<Operation> _operations;
+    };
+
+    // the log is folded into the snapshot once it grows as large as the snapshot, but never before it reaches this
+    static const qint64 DEFAULT_MIN_COMPACTION_LOG_SIZE = 1024 * 1024;
+
+    /// Opens the snapshot and the log, replaying any committed transactions on top of the snapshot.
+    /// A torn record at the end of the log (from a crash mid-write) is discarded.
+    bool load(const QString& snapshotPath, const QString& logPath);
+
+    /// Durably appends the transaction to the log, then applies it. Returns false, without changing any
+    /// mapping, if the log could not be written.
+    bool commit(const Transaction& transaction);
+
+    /// Writes all mappings to the snapshot and truncates the log.
+    bool compact();
+
+    void setMinCompactionLogSize(qint64 numBytes) { _minCompactionLogSize = numBytes; }
+
+    const AssetUtils::Mappings& getMappings() const { return _mappings; }
+
+    /// All mappings whose path starts with `prefix`, in path order.
+    Range getMappingsWithPrefix(const AssetUtils::AssetPath& prefix) const;
+
+    bool isHashMapped(const AssetUtils::AssetHash& hash) const { return _hashReferenceCounts.contains(hash); }
+
+    const_iterator find(const AssetUtils::AssetPath& path) const { return _mappings.find(path); }
+    const_iterator begin() const { return _mappings.cbegin(); }
+    const_iterator end() const { return _mappings.cend(); }
+    const_iterator cbegin() const { return _mappings.cbegin(); }
+    const_iterator cend() const { return _mappings.cend(); }
+    size_t size() const { return _mappings.size(); }
+
+private:
+    bool loadSnapshot();
+    bool replayLog();
+
+    void apply(const Transaction& transaction);
+    void insertMapping(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
+    void eraseMapping(const AssetUtils::AssetPath& path);
+
+    AssetUtils::Mappings _mappings;
+    QHash<AssetUtils::AssetHash, int> _hashReferenceCounts;
+
+    QString _snapshotPath;
+    QFile _logFile;
+    int _operationsSinceCompaction { 0 };
+    qint64 _snapshotSize { 0 };
+    qint64 _minCompactionLogSize { DEFAULT_MIN_COMPACTION_LOG_SIZE };
+};
+
+#endif // hifi_AssetMappingStore_h
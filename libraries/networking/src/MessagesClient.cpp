@@ -101,6 +101,22 @@ std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesDataPacket(QString c
     return packetList;
 }
 
+QByteArray MessagesClient::encodeMessagesPayload(QString channel, bool isText, QByteArray messageOrData, QUuid senderID) {
+    auto channelUtf8 = channel.toUtf8();
+    quint16 channelLength = channelUtf8.length();
+    quint32 dataLength = messageOrData.length();
+
+    QByteArray payload;
+    payload.reserve(sizeof(channelLength) + channelLength + sizeof(isText) + sizeof(dataLength) + dataLength +
+                    NUM_BYTES_RFC4122_UUID);
+    payload.append(reinterpret_cast<const char*>(&channelLength), sizeof(channelLength));
+    payload.append(channelUtf8);
+    payload.append(reinterpret_cast<const char*>(&isText), sizeof(isText));
+    payload.append(reinterpret_cast<const char*>(&dataLength), sizeof(dataLength));
+    payload.append(messageOrData);
+    payload.append(senderID.toRfc4122());
+    return payload;
+}
 
 void MessagesClient::handleMessagesPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
     QString channel, message;
@@ -167,6 +167,9 @@ public:
     static std::unique_ptr<NLPacketList> encodeMessagesPacket(QString channel, QString message, QUuid senderID);
     static std::unique_ptr<NLPacketList> encodeMessagesDataPacket(QString channel, QByteArray data, QUuid senderID);
 
+    // the payload of a MessagesData packet, for writing the same message to the packets for many nodes
+    static QByteArray encodeMessagesPayload(QString channel, bool isText, QByteArray messageOrData, QUuid senderID);
+
 signals:
     /*@jsdoc
      * Triggered when a text message is received.
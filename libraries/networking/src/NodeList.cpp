@@ -123,6 +123,9 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     connect(this, &LimitedNodeList::nodeAdded, this, &NodeList::startNodeHolePunch);
     connect(this, &LimitedNodeList::nodeSocketUpdated, this, &NodeList::startNodeHolePunch);
 
+    // a node we drop on our own won't be in a list of changes from the domain-server, so ask for a full list
+    connect(this, &LimitedNodeList::nodeKilled, this, &NodeList::handleNodeKilledForDomainList);
+
     // anytime we get a new node we may need to re-send our set of ignored node IDs to it
     connect(this, &LimitedNodeList::nodeActivated, this, &NodeList::maybeSendIgnoreSetToNode);
 
@@ -203,6 +206,20 @@ qint64 NodeList::sendStatsToDomainServer(QJsonObject statsObject) {
     return sendStats(statsObject, _domainHandler.getSockAddr());
 }
 
+qint64 NodeList::sendMetricsToDomainServer(QByteArray metrics) {
+    if (thread() != QThread::currentThread()) {
+        QMetaObject::invokeMethod(this, "sendMetricsToDomainServer", Qt::QueuedConnection,
+                                  Q_ARG(QByteArray, metrics));
+        return 0;
+    }
+
+    auto metricsPacketList = NLPacketList::create(PacketType::NodeMetrics, QByteArray(), true, true);
+    metricsPacketList->write(metrics);
+
+    sendPacketList(std::move(metricsPacketList), _domainHandler.getSockAddr());
+    return 0;
+}
+
 void NodeList::timePingReply(ReceivedMessage& message, const SharedNodePointer& sendingNode) {
     PingType_t pingType;
 
@@ -314,6 +331,9 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
         _domainHandler.softReset(reason);
     }
 
+    // the next domain-server has to start us off with a full list
+    _domainListVersion = NodeRoster::NO_VERSION;
+
     // refresh the owner UUID to the NULL UUID
     setSessionUUID(QUuid());
     setSessionLocalID(Node::NULL_LOCAL_ID);
@@ -497,6 +517,11 @@ void NodeList::sendDomainServerCheckIn() {
         packetStream << _ownerType.load() << publicSockAddr << localSockAddr << _nodeTypesOfInterest.toList();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainIsConnected) {
+            // the last DomainList we received in full, the domain-server will only send what changed since
+            packetStream << _domainListVersion.load();
+        }
+
         if (!domainIsConnected) {
 
             // Metaverse account.
@@ -756,6 +781,8 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     bool newConnection;
     packetStream >> newConnection;
 
+    auto listHeader = NodeRoster::readListHeader(packetStream);
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -852,9 +879,34 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
 
+    // a list can span several packets, any of which can be lost
+    if (listHeader.listID != _pendingDomainList.header.listID) {
+        _pendingDomainList = { listHeader, 0 };
+    }
+
     // pull each node in the packet
     while (packetStream.device()->pos() < message->getSize()) {
-        parseNodeFromPacketStream(packetStream);
+        quint8 entryType;
+        packetStream >> entryType;
+
+        if (entryType == NodeRoster::RemovedNodeEntry) {
+            QUuid nodeUUID;
+            packetStream >> nodeUUID;
+
+            _isRemovingDomainServerNode = true;
+            killNodeWithUUID(nodeUUID);
+            _isRemovingDomainServerNode = false;
+            removeDelayedAdd(nodeUUID);
+        } else {
+            parseNodeFromPacketStream(packetStream);
+        }
+        ++_pendingDomainList.numEntriesReceived;
+    }
+
+    // only acknowledge a list once all of it has arrived
+    if (_pendingDomainList.numEntriesReceived == _pendingDomainList.header.numEntries &&
+        NodeRoster::canAcknowledge(_domainListVersion.load(), _pendingDomainList.header)) {
+        _domainListVersion = _pendingDomainList.header.version;
     }
 }
 
@@ -870,10 +922,18 @@ void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> me
     // read the UUID from the packet, remove it if it exists
     QUuid nodeUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
     qCDebug(networking) << "Received packet from domain-server to remove node with UUID" << uuidStringWithoutCurlyBraces(nodeUUID);
+    _isRemovingDomainServerNode = true;
     killNodeWithUUID(nodeUUID);
+    _isRemovingDomainServerNode = false;
     removeDelayedAdd(nodeUUID);
 }
 
+void NodeList::handleNodeKilledForDomainList() {
+    if (!_isRemovingDomainServerNode) {
+        _domainListVersion = NodeRoster::NO_VERSION;
+    }
+}
+
 void NodeList::parseNodeFromPacketStream(QDataStream& packetStream) {
     NewNodeInfo info;
 
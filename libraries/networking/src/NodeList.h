@@ -36,6 +36,7 @@
 #include "DomainHandler.h"
 #include "LimitedNodeList.h"
 #include "Node.h"
+#include "NodeRoster.h"
 
 const quint64 DOMAIN_SERVER_CHECK_IN_MSECS = 1 * 1000;
 
@@ -60,6 +61,7 @@ public:
 
     Q_INVOKABLE qint64 sendStats(QJsonObject statsObject, SockAddr destination);
     Q_INVOKABLE qint64 sendStatsToDomainServer(QJsonObject statsObject);
+    Q_INVOKABLE qint64 sendMetricsToDomainServer(QByteArray metrics);
 
     DomainHandler& getDomainHandler() { return _domainHandler; }
 
@@ -167,6 +169,7 @@ private:
     void sendDSPathQuery(const QString& newPath);
 
     void parseNodeFromPacketStream(QDataStream& packetStream);
+    void handleNodeKilledForDomainList();
 
     void pingPunchForInactiveNode(const SharedNodePointer& node);
 
@@ -182,6 +185,15 @@ private:
 
     bool _sendDomainServerCheckInEnabled { true };
 
+    // the roster version acknowledged in check-ins, so the domain-server only sends what changed since
+    std::atomic<NodeRoster::Version> _domainListVersion { NodeRoster::NO_VERSION };
+    struct PendingDomainList {
+        NodeRoster::ListHeader header;
+        quint32 numEntriesReceived { 0 };
+    };
+    PendingDomainList _pendingDomainList;
+    bool _isRemovingDomainServerNode { false };
+
     mutable QReadWriteLock _ignoredSetLock;
     tbb::concurrent_unordered_set<QUuid, UUIDHasher> _ignoredNodeIDs;
     mutable QReadWriteLock _personalMutedSetLock;
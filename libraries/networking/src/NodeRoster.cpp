@@ -0,0 +1,80 @@
+//
+//  NodeRoster.cpp
+//  libraries/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "NodeRoster.h"
+
+#include <QtCore/QSet>
+
+const NodeRoster::Version NodeRoster::NO_VERSION;
+const size_t NodeRoster::DEFAULT_MAX_LOG_SIZE;
+
+bool NodeRoster::changesSince(Version version, std::vector<Change>& changes) const {
+    changes.clear();
+
+    // versions are handed out one per change, so the log holds exactly the last _log.size() of them
+    if (version == NO_VERSION || version > _version || _version - version > _log.size()) {
+        return false;
+    }
+
+    QSet<QUuid> seen;
+    for (auto itr = _log.rbegin(); itr != _log.rend() && itr->version > version; ++itr) {
+        if (!seen.contains(itr->nodeID)) {
+            seen.insert(itr->nodeID);
+            changes.push_back(*itr);
+        }
+    }
+    return true;
+}
+
+void NodeRoster::writeListHeader(QDataStream& stream, const ListHeader& header) {
+    stream << header.version << header.baseVersion << header.listID << header.numEntries;
+}
+
+NodeRoster::ListHeader NodeRoster::readListHeader(QDataStream& stream) {
+    ListHeader header;
+    stream >> header.version >> header.baseVersion >> header.listID >> header.numEntries;
+    return header;
+}
+
+bool NodeRoster::canAcknowledge(Version currentVersion, const ListHeader& header) {
+    if (header.baseVersion == NO_VERSION) {
+        return header.version >= currentVersion;
+    }
+    return currentVersion != NO_VERSION && header.baseVersion <= currentVersion && header.version > currentVersion;
+}
+
+void NodeRoster::writeNode(NLPacketList& packetList, QDataStream& stream, const Node& node, const QUuid& connectionSecret) {
+    packetList.startSegment();
+    stream << (quint8)NodeEntry;
+    stream << node;
+    stream << connectionSecret;
+    packetList.endSegment();
+}
+
+void NodeRoster::writeRemovedNode(NLPacketList& packetList, QDataStream& stream, const QUuid& nodeID) {
+    packetList.startSegment();
+    stream << (quint8)RemovedNodeEntry;
+    stream << nodeID;
+    packetList.endSegment();
+}
+
+void NodeRoster::logChange(const QUuid& nodeID, NodeType_t nodeType, bool removed) {
+    ++_version;
+    if (_version == NO_VERSION) {
+        // wrapped around, nobody can be caught up with a delta from here
+        _log.clear();
+        ++_version;
+    }
+    _log.push_back({ _version, nodeID, nodeType, removed });
+    while (_log.size() > _maxLogSize) {
+        _log.pop_front();
+    }
+}
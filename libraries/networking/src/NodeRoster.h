@@ -0,0 +1,89 @@
+//
+//  NodeRoster.h
+//  libraries/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_NodeRoster_h
+#define hifi_NodeRoster_h
+
+#include <deque>
+#include <vector>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QUuid>
+
+#include "NLPacketList.h"
+#include "Node.h"
+#include "NodeType.h"
+
+// The domain server's versioned record of which nodes were added, changed or removed.  Every change bumps the
+// version, and a node acknowledges the version of the last DomainList it received in full in its check-in, so
+// the next DomainList only has to carry what changed since.  The log is bounded: a node that is too far behind
+// (or acknowledges a version this roster never handed out) gets a full list instead.
+//
+// Every entry in a DomainList is its own segment, starting with an EntryType.
+class NodeRoster {
+public:
+    using Version = quint32;
+    static const Version NO_VERSION = 0;
+
+    enum EntryType : quint8 {
+        NodeEntry = 0, // the node followed by the connection secret for the pair
+        RemovedNodeEntry // the UUID of a node that has left
+    };
+
+    struct Change {
+        Version version;
+        QUuid nodeID;
+        NodeType_t nodeType;
+        bool removed;
+    };
+
+    // what every DomainList packet carries about the list it is part of, after the fields all DomainLists have
+    struct ListHeader {
+        Version version { NO_VERSION };
+        Version baseVersion { NO_VERSION }; // NO_VERSION for a full list
+        quint32 listID { 0 };
+        quint32 numEntries { 0 }; // over all of the list's packets
+    };
+
+    static const size_t DEFAULT_MAX_LOG_SIZE = 4096;
+
+    NodeRoster(size_t maxLogSize = DEFAULT_MAX_LOG_SIZE) : _maxLogSize(maxLogSize) {}
+
+    Version getVersion() const { return _version; }
+
+    /// \brief records that a node was added or that something DomainList sends for it changed
+    void nodeChanged(const QUuid& nodeID, NodeType_t nodeType) { logChange(nodeID, nodeType, false); }
+    void nodeRemoved(const QUuid& nodeID, NodeType_t nodeType) { logChange(nodeID, nodeType, true); }
+
+    /// \brief fills changes with the latest change to each node since version, newest first
+    /// \return false if the log doesn't reach back to version, in which case a full list must be sent
+    bool changesSince(Version version, std::vector<Change>& changes) const;
+
+    static void writeListHeader(QDataStream& stream, const ListHeader& header);
+    static ListHeader readListHeader(QDataStream& stream);
+
+    static void writeNode(NLPacketList& packetList, QDataStream& stream, const Node& node, const QUuid& connectionSecret);
+    static void writeRemovedNode(NLPacketList& packetList, QDataStream& stream, const QUuid& nodeID);
+
+    /// \brief whether a node that has acknowledged currentVersion can acknowledge a list it has received all of.
+    /// A full list mustn't be older than what the node has (lists can arrive out of order), and a list of changes
+    /// has to follow on from it.
+    static bool canAcknowledge(Version currentVersion, const ListHeader& header);
+
+private:
+    void logChange(const QUuid& nodeID, NodeType_t nodeType, bool removed);
+
+    std::deque<Change> _log;
+    Version _version { NO_VERSION };
+    size_t _maxLogSize;
+};
+
+#endif // hifi_NodeRoster_h
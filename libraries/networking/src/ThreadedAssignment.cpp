@@ -127,6 +127,7 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     statsObject["assignmentStats"] = assignmentStats;
 
     nodeList->sendStatsToDomainServer(statsObject);
+    nodeList->sendMetricsToDomainServer(_metrics.toByteArray());
 }
 
 void ThreadedAssignment::sendStatsPacket() {
@@ -14,6 +14,8 @@
 
 #include <QtCore/QSharedPointer>
 
+#include <MetricsRegistry.h>
+
 #include "ReceivedMessage.h"
 
 #include "Assignment.h"
@@ -27,6 +29,9 @@ public:
     virtual void aboutToFinish() { };
     void addPacketStatsAndSendStatsPacket(QJsonObject statsObject);
 
+    // counters and histograms recorded on the hot paths, sent to the domain-server along with the stats
+    MetricsRegistry& getMetrics() { return _metrics; }
+
 public slots:
     /// threaded run of assignment
     virtual void run() = 0;
@@ -48,6 +53,7 @@ protected:
     QTimer _domainServerTimer;
     QTimer _statsTimer;
     int _numQueuedCheckIns { 0 };
+    MetricsRegistry _metrics;
 
 protected slots:
     void domainSettingsRequestFailed();
@@ -27,7 +27,9 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::DomainConnectRequestPending: // keeping the old version to maintain the protocol hash
             return 17;
         case PacketType::DomainList:
-            return static_cast<PacketVersion>(DomainListVersion::HasConnectReason);
+            return static_cast<PacketVersion>(DomainListVersion::HasRosterVersion);
+        case PacketType::DomainListRequest:
+            return static_cast<PacketVersion>(DomainListRequestVersion::HasRosterVersion);
         case PacketType::EntityAdd:
         case PacketType::EntityClone:
         case PacketType::EntityEdit:
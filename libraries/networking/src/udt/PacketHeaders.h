@@ -137,6 +137,7 @@ public:
         BulkAvatarTraitsAck,
         StopInjector,
         AvatarZonePresence,
+        NodeMetrics,
         NUM_PACKET_TYPE
     };
 
@@ -156,6 +157,7 @@ public:
     const static QSet<PacketTypeEnum::Value> getNonVerifiedPackets() {
         const static QSet<PacketTypeEnum::Value> NON_VERIFIED_PACKETS = QSet<PacketTypeEnum::Value>()
             << PacketTypeEnum::Value::NodeJsonStats
+            << PacketTypeEnum::Value::NodeMetrics
             << PacketTypeEnum::Value::EntityQuery
             << PacketTypeEnum::Value::OctreeDataNack
             << PacketTypeEnum::Value::EntityEditNack
@@ -386,7 +388,13 @@ enum class DomainListVersion : PacketVersion {
     GetMachineFingerprintFromUUIDSupport,
     AuthenticationOptional,
     HasTimestamp,
-    HasConnectReason
+    HasConnectReason,
+    HasRosterVersion
+};
+
+enum class DomainListRequestVersion : PacketVersion {
+    PreRosterVersion = 22,
+    HasRosterVersion
 };
 
 enum class AudioVersion : PacketVersion {
@@ -0,0 +1,111 @@
+//
+//  CollisionShapeCache.cpp
+//  libraries/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CollisionShapeCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+
+#include "PhysicsLogging.h"
+#include "ShapeFactory.h"
+#include "ShapeManager.h"
+
+// Whenever a change is made to the serialized format that isn't backward compatible, this value should be incremented.
+static const uint32_t FORMAT_VERSION = 2;
+static const uint32_t MAGIC = 0x50485343;  // "CSHP"
+
+const uint32_t CollisionShapeCache::CURRENT_VERSION = (FORMAT_VERSION << 16) | ShapeFactory::SHAPE_ALGORITHM_VERSION;
+const std::string CollisionShapeCache::DEFAULT_DIRNAME { "collision_shape_cache" };
+const std::string CollisionShapeCache::EXT { "shape" };
+
+CollisionShapeCache::CollisionShapeCache(const std::string& dirname, QObject* parent) :
+    FileCache(dirname, EXT, parent) { }
+
+bool CollisionShapeCache::isCacheable(ShapeType type) {
+    // the shapes worth building off thread are the ones worth keeping
+    return ShapeManager::canBuildOffThread(type);
+}
+
+QByteArray CollisionShapeCache::getContentHash(const ShapeInfo& info) {
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    auto addValue = [&](const auto& value) {
+        hash.addData(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    addValue((quint32)info.getType());
+    addValue(info.getHalfExtents());
+    addValue(info.getOffset());
+
+    // sizes go in too, so that moving points between lists changes the hash
+    const ShapeInfo::PointCollection& pointCollection = info.getPointCollection();
+    addValue((quint32)pointCollection.size());
+    for (const auto& points : pointCollection) {
+        addValue((quint32)points.size());
+        hash.addData(reinterpret_cast<const char*>(points.constData()), points.size() * sizeof(glm::vec3));
+    }
+    const ShapeInfo::TriangleIndices& indices = info.getTriangleIndices();
+    addValue((quint32)indices.size());
+    hash.addData(reinterpret_cast<const char*>(indices.constData()), indices.size() * sizeof(int32_t));
+    return hash.result();
+}
+
+CollisionShapeCache::Key CollisionShapeCache::getKey(const ShapeInfo& info) {
+    return getKey(getContentHash(info));
+}
+
+CollisionShapeCache::Key CollisionShapeCache::getKey(const QByteArray& contentHash) {
+    return QString("%1-%2").arg(QString(contentHash.toHex())).arg(CURRENT_VERSION, 0, 16).toStdString();
+}
+
+const btCollisionShape* CollisionShapeCache::getShape(const ShapeInfo& info) {
+    QByteArray contentHash = getContentHash(info);
+    auto file = getFile(getKey(contentHash));
+    if (!file) {
+        return nullptr;
+    }
+
+    QFile input(QString::fromStdString(file->getFilepath()));
+    if (!input.open(QIODevice::ReadOnly)) {
+        qCWarning(physics) << "Unable to open cached collision shape" << input.fileName();
+        return nullptr;
+    }
+    QDataStream stream(&input);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint32 magic, version;
+    QByteArray hash;
+    stream >> magic >> version >> hash;
+    if (stream.status() != QDataStream::Ok || magic != MAGIC || version != CURRENT_VERSION || hash != contentHash) {
+        qCWarning(physics) << "Ignoring mismatched cached collision shape" << input.fileName();
+        return nullptr;
+    }
+    const btCollisionShape* shape = ShapeFactory::deserializeShape(stream);
+    if (!shape) {
+        qCWarning(physics) << "Ignoring corrupt cached collision shape" << input.fileName();
+    }
+    return shape;
+}
+
+bool CollisionShapeCache::putShape(const ShapeInfo& info, const btCollisionShape* shape) {
+    QByteArray contentHash = getContentHash(info);
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        stream << (quint32)MAGIC << (quint32)CURRENT_VERSION << contentHash;
+        if (!ShapeFactory::serializeShape(shape, stream)) {
+            return false;
+        }
+    }
+    return (bool)writeFile(data.data(), Metadata(getKey(contentHash), data.size()));
+}
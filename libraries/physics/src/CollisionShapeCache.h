@@ -0,0 +1,56 @@
+//
+//  CollisionShapeCache.h
+//  libraries/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CollisionShapeCache_h
+#define hifi_CollisionShapeCache_h
+
+#include <shared/FileCache.h>
+
+#include <ShapeInfo.h>
+
+class btCollisionShape;
+
+// Keeps the hulls and mesh BVHs built by the ShapeFactory on disk, so that loading a domain again doesn't have to
+// build them again.  Files are keyed by a hash of the points, triangle indices, type and extents the shape is built
+// from rather than the ShapeManager's hash, which leaves the geometry out of most shape types and so can't tell
+// apart two versions of a model at the same URL.
+//
+// The key includes ShapeFactory::SHAPE_ALGORITHM_VERSION and the file format version, so files written by
+// other versions are never read and age out of the cache like any other unused file.
+class CollisionShapeCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    static const uint32_t CURRENT_VERSION;
+    static const std::string DEFAULT_DIRNAME;
+    static const std::string EXT;
+
+    CollisionShapeCache(const std::string& dirname = DEFAULT_DIRNAME, QObject* parent = nullptr);
+
+    /// \return true for the shape types that are slow enough to build to be worth caching
+    static bool isCacheable(ShapeType type);
+
+    /// \return a new shape owned by the caller, or nullptr if it isn't cached
+    const btCollisionShape* getShape(const ShapeInfo& info);
+
+    /// \return true if the shape was written
+    bool putShape(const ShapeInfo& info, const btCollisionShape* shape);
+
+    /// \return a hash of everything the ShapeFactory builds the shape from
+    static QByteArray getContentHash(const ShapeInfo& info);
+
+    static Key getKey(const ShapeInfo& info);
+
+private:
+    static Key getKey(const QByteArray& contentHash);
+};
+
+#endif // hifi_CollisionShapeCache_h
@@ -0,0 +1,115 @@
+//
+//  ContactMap.cpp
+//  libraries/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContactMap.h"
+
+static const int MIN_CAPACITY = 64; // must be a power of two
+
+static uint32_t hashKey(const ContactKey& key) {
+    // the low bits of a pointer are mostly alignment, so mix both pointers through the high half of the product
+    uint64_t hash = (uint64_t)(uintptr_t)key._a * 0x9E3779B97F4A7C15ULL;
+    hash ^= (uint64_t)(uintptr_t)key._b * 0xC2B2AE3D27D4EB4FULL;
+    return (uint32_t)(hash >> 32);
+}
+
+ContactInfo& ContactMap::operator[](const ContactKey& key) {
+    bool found = false;
+    int slot = findSlot(key, found);
+    if (found) {
+        return _entries[slot].contact;
+    }
+
+    // keep at least a quarter of the slots empty, counting removed ones as full, so probes stay short and end
+    int capacity = _entries.size();
+    if ((_size + _numRemoved + 1) * 4 > (size_t)capacity * 3) {
+        int newCapacity = capacity == 0 ? MIN_CAPACITY : capacity;
+        while ((_size + 1) * 2 > (size_t)newCapacity) {
+            newCapacity *= 2;
+        }
+        rehash(newCapacity);
+        slot = findSlot(key, found);
+    }
+
+    Entry& entry = _entries[slot];
+    if (entry.state == REMOVED) {
+        --_numRemoved;
+    }
+    entry.key = key;
+    entry.contact = ContactInfo();
+    entry.state = FULL;
+    ++_size;
+    return entry.contact;
+}
+
+ContactInfo* ContactMap::find(const ContactKey& key) {
+    bool found = false;
+    int slot = findSlot(key, found);
+    return found ? &_entries[slot].contact : nullptr;
+}
+
+void ContactMap::clear() {
+    _entries.clear();
+    _size = 0;
+    _numRemoved = 0;
+}
+
+// returns the slot holding key, or else the first free slot along its probe sequence
+int ContactMap::findSlot(const ContactKey& key, bool& found) const {
+    found = false;
+    if (_entries.size() == 0) {
+        return -1;
+    }
+    uint32_t mask = (uint32_t)_entries.size() - 1;
+    uint32_t i = hashKey(key) & mask;
+    int firstRemoved = -1;
+    while (true) {
+        const Entry& entry = _entries[i];
+        if (entry.state == EMPTY) {
+            return firstRemoved >= 0 ? firstRemoved : (int)i;
+        }
+        if (entry.state == REMOVED) {
+            if (firstRemoved < 0) {
+                firstRemoved = (int)i;
+            }
+        } else if (entry.key == key) {
+            found = true;
+            return (int)i;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+void ContactMap::rehash(int capacity) {
+    btAlignedObjectArray<Entry> oldEntries(_entries);
+    _entries.clear();
+    _entries.resize(capacity, Entry());
+    _numRemoved = 0;
+
+    uint32_t mask = (uint32_t)capacity - 1;
+    for (int j = 0; j < oldEntries.size(); ++j) {
+        const Entry& entry = oldEntries[j];
+        if (entry.state == FULL) {
+            uint32_t i = hashKey(entry.key) & mask;
+            while (_entries[i].state != EMPTY) {
+                i = (i + 1) & mask;
+            }
+            _entries[i] = entry;
+        }
+    }
+}
+
+void ContactMap::shrinkIfSparse() {
+    // sweep() visits every slot, so don't let a burst of contacts leave it walking a mostly empty table
+    int capacity = _entries.size();
+    if (capacity > MIN_CAPACITY && _size * 8 < (size_t)capacity) {
+        rehash(capacity / 2);
+    }
+}
@@ -0,0 +1,88 @@
+//
+//  ContactMap.h
+//  libraries/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ContactMap_h
+#define hifi_ContactMap_h
+
+#include <stdint.h>
+
+#include <LinearMath/btAlignedObjectArray.h>
+
+#include "ContactInfo.h"
+
+// simple class for keeping track of contacts
+class ContactKey {
+public:
+    ContactKey() = delete;
+    ContactKey(void* a, void* b) : _a(a), _b(b) {}
+    bool operator<(const ContactKey& other) const { return _a < other._a || (_a == other._a && _b < other._b); }
+    bool operator==(const ContactKey& other) const { return _a == other._a && _b == other._b; }
+    void* _a; // ObjectMotionState pointer
+    void* _b; // ObjectMotionState pointer
+};
+
+// The contacts PhysicsEngine is tracking, one per pair of objects.  Updated every substep for every manifold
+// with a contact, so it is an open addressed table with linear probing rather than a tree: a lookup for a pair
+// that is still touching is usually one or two neighbouring slots.
+//
+// Removed entries are left behind as markers until the next time the table is rebuilt, so that sweep() can drop
+// the contacts that have ended (ContactInfo knows the last substep it was updated) in the same linear pass that
+// reports them.
+class ContactMap {
+public:
+    /// \return the contact for key, added if it wasn't already there
+    ContactInfo& operator[](const ContactKey& key);
+
+    /// \return the contact for key, or nullptr
+    ContactInfo* find(const ContactKey& key);
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    void clear();
+
+    /// \brief calls f(key, contact) once per contact and removes the ones for which it returns false
+    template <typename F>
+    void sweep(F f) {
+        for (int i = 0; i < _entries.size(); ++i) {
+            Entry& entry = _entries[i];
+            if (entry.state == FULL && !f(entry.key, entry.contact)) {
+                entry.state = REMOVED;
+                --_size;
+                ++_numRemoved;
+            }
+        }
+        shrinkIfSparse();
+    }
+
+private:
+    enum State : uint8_t {
+        EMPTY = 0,
+        FULL,
+        REMOVED
+    };
+
+    struct Entry {
+        ContactKey key { nullptr, nullptr };
+        ContactInfo contact;
+        State state { EMPTY };
+    };
+
+    int findSlot(const ContactKey& key, bool& found) const;
+    void rehash(int capacity);
+    void shrinkIfSparse();
+
+    // btAlignedObjectArray because ContactInfo holds btVector3s
+    btAlignedObjectArray<Entry> _entries;
+    size_t _size { 0 };
+    size_t _numRemoved { 0 };
+};
+
+#endif // hifi_ContactMap_h
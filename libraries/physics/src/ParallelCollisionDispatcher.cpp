@@ -0,0 +1,65 @@
+//
+//  ParallelCollisionDispatcher.cpp
+//  libraries/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ParallelCollisionDispatcher.h"
+
+#include <BulletCollision/BroadphaseCollision/btOverlappingPairCache.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+#include <LinearMath/btQuickprof.h>
+
+#include <TBBHelpers.h>
+
+// below this many pairs handing them out costs more than it saves
+static const int MIN_PARALLEL_PAIRS = 256;
+static const int PAIRS_PER_TASK = 64;
+
+ParallelCollisionDispatcher::ParallelCollisionDispatcher(btCollisionConfiguration* collisionConfiguration) :
+    btCollisionDispatcher(collisionConfiguration) {
+}
+
+btPersistentManifold* ParallelCollisionDispatcher::getNewManifold(const btCollisionObject* body0, const btCollisionObject* body1) {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    return btCollisionDispatcher::getNewManifold(body0, body1);
+}
+
+void ParallelCollisionDispatcher::releaseManifold(btPersistentManifold* manifold) {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    btCollisionDispatcher::releaseManifold(manifold);
+}
+
+void* ParallelCollisionDispatcher::allocateCollisionAlgorithm(int size) {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    return btCollisionDispatcher::allocateCollisionAlgorithm(size);
+}
+
+void ParallelCollisionDispatcher::freeCollisionAlgorithm(void* ptr) {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    btCollisionDispatcher::freeCollisionAlgorithm(ptr);
+}
+
+void ParallelCollisionDispatcher::dispatchAllCollisionPairs(btOverlappingPairCache* pairCache,
+                                                            const btDispatcherInfo& dispatchInfo, btDispatcher* dispatcher) {
+    int numPairs = pairCache->getNumOverlappingPairs();
+    if (!_multithreaded || gContactAddedCallback || numPairs < MIN_PARALLEL_PAIRS) {
+        btCollisionDispatcher::dispatchAllCollisionPairs(pairCache, dispatchInfo, dispatcher);
+        return;
+    }
+
+    BT_PROFILE("dispatchAllCollisionPairsMt");
+    // same as what btCollisionPairCallback does for each pair, which never asks for a pair to be removed
+    btBroadphasePair* pairs = pairCache->getOverlappingPairArrayPtr();
+    btNearCallback nearCallback = getNearCallback();
+    tbb::parallel_for(tbb::blocked_range<int>(0, numPairs, PAIRS_PER_TASK), [&](const tbb::blocked_range<int>& range) {
+        for (int i = range.begin(); i < range.end(); ++i) {
+            nearCallback(pairs[i], *this, dispatchInfo);
+        }
+    });
+}
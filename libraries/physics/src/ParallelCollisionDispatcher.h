@@ -0,0 +1,44 @@
+//
+//  ParallelCollisionDispatcher.h
+//  libraries/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ParallelCollisionDispatcher_h
+#define hifi_ParallelCollisionDispatcher_h
+
+#include <mutex>
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcher.h>
+
+// A btCollisionDispatcher that can run the narrowphase of every overlapping pair on the tbb pool.
+//
+// Each pair only writes to its own algorithm and manifold, so the only shared state is the pools that algorithms and
+// manifolds come from, which are guarded here since our Bullet isn't built with BT_THREADSAFE.  The narrowphase stays
+// on the calling thread while a gContactAddedCallback is set, because those callbacks aren't expected to be reentrant.
+class ParallelCollisionDispatcher : public btCollisionDispatcher {
+public:
+    ParallelCollisionDispatcher(btCollisionConfiguration* collisionConfiguration);
+
+    void setMultithreaded(bool multithreaded) { _multithreaded = multithreaded; }
+    bool isMultithreaded() const { return _multithreaded; }
+
+    btPersistentManifold* getNewManifold(const btCollisionObject* body0, const btCollisionObject* body1) override;
+    void releaseManifold(btPersistentManifold* manifold) override;
+    void* allocateCollisionAlgorithm(int size) override;
+    void freeCollisionAlgorithm(void* ptr) override;
+
+    void dispatchAllCollisionPairs(btOverlappingPairCache* pairCache, const btDispatcherInfo& dispatchInfo,
+                                   btDispatcher* dispatcher) override;
+
+private:
+    std::mutex _poolMutex;
+    bool _multithreaded { false };
+};
+
+#endif // hifi_ParallelCollisionDispatcher_h
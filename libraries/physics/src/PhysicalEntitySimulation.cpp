@@ -133,6 +133,7 @@ void PhysicalEntitySimulation::processChangedEntity(const EntityItemPointer& ent
                 // NOTE: this packet will NOT be resent if lost, but the good news is:
                 // the entity-server will eventually clear velocity and ownership for timeout
                 motionState->sendUpdate(_entityPacketSender, _physicsEngine->getNumSubsteps());
+                ++_numUpdatesSent;
             }
 
             // remove from the physical simulation
@@ -298,7 +299,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
                         // bummer, the hashes are different and we no longer want the shape we've received
                         ObjectMotionState::getShapeManager()->releaseShape(shape);
                         // try again
-                        shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                        shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                         if (shape) {
                             buildMotionState(shape, entity);
                             requestItr = _shapeRequests.erase(requestItr);
@@ -372,7 +373,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
                 ShapeInfo shapeInfo;
                 entity->computeShapeInfo(shapeInfo);
                 uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
-                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                 if (shape) {
                     buildMotionState(shape, entity);
                 } else if (requestCount != ObjectMotionState::getShapeManager()->getWorkRequestCount()) {
@@ -428,14 +429,14 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
         bool needsNewShape = object->needsNewShape() && object->_entity->isReadyToComputeShape();
         if (needsNewShape) {
             ShapeType shapeType = object->getShapeType();
-            if (shapeType == SHAPE_TYPE_STATIC_MESH) {
+            if (ShapeManager::canBuildOffThread(shapeType)) {
                 ShapeRequest shapeRequest(object->_entity);
                 ShapeRequests::iterator requestItr = _shapeRequests.find(shapeRequest);
                 if (requestItr == _shapeRequests.end()) {
                     ShapeInfo shapeInfo;
                     object->_entity->computeShapeInfo(shapeInfo);
                     uint32_t requestCount = ObjectMotionState::getShapeManager()->getWorkRequestCount();
-                    btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo));
+                    btCollisionShape* shape = const_cast<btCollisionShape*>(ObjectMotionState::getShapeManager()->getShape(shapeInfo, true));
                     if (shape) {
                         object->setShape(shape);
                         handledFlags |= Simulation::DIRTY_SHAPE;
@@ -577,6 +578,7 @@ void PhysicalEntitySimulation::addOwnershipBid(EntityMotionState* motionState) {
     }
     motionState->initForBid();
     motionState->sendBid(_entityPacketSender, _physicsEngine->getNumSubsteps());
+    ++_numBidsSent;
     _bids.push_back(motionState);
     _nextBidExpiry = glm::min(_nextBidExpiry, motionState->getNextBidExpiry());
 }
@@ -604,6 +606,7 @@ void PhysicalEntitySimulation::sendOwnershipBids(uint32_t numSubsteps) {
                 // "telling" the server rather than what we've been "hearing" from the server.
                 _bids[i]->slaveBidPriority();
                 _bids[i]->sendUpdate(_entityPacketSender, numSubsteps);
+                ++_numUpdatesSent;
 
                 addOwnership(_bids[i]);
                 removeBid = true;
@@ -616,6 +619,7 @@ void PhysicalEntitySimulation::sendOwnershipBids(uint32_t numSubsteps) {
             } else {
                 if (now > _bids[i]->getNextBidExpiry()) {
                     _bids[i]->sendBid(_entityPacketSender, numSubsteps);
+                    ++_numBidsSent;
                     _nextBidExpiry = glm::min(_nextBidExpiry, _bids[i]->getNextBidExpiry());
                 }
                 ++i;
@@ -641,6 +645,7 @@ void PhysicalEntitySimulation::sendOwnedUpdates(uint32_t numSubsteps) {
         } else {
             if (_owned[i]->shouldSendUpdate(numSubsteps)) {
                 _owned[i]->sendUpdate(_entityPacketSender, numSubsteps);
+                ++_numUpdatesSent;
             }
             ++i;
         }
@@ -99,6 +99,10 @@ public:
     void sendOwnershipBids(uint32_t numSubsteps);
     void sendOwnedUpdates(uint32_t numSubsteps);
 
+    // totals since init, for measuring ownership traffic
+    uint64_t getNumBidsSent() const { return _numBidsSent; }
+    uint64_t getNumUpdatesSent() const { return _numUpdatesSent; }
+
 private:
     void buildMotionStatesForEntitiesThatNeedThem();
 
@@ -135,6 +139,8 @@ private:
     uint64_t _nextBidExpiry;
     uint32_t _lastStepSendPackets { 0 };
     uint32_t _lastWorkDeliveryCount { 0 };
+    uint64_t _numBidsSent { 0 };
+    uint64_t _numUpdatesSent { 0 };
 };
 
 
@@ -22,6 +22,7 @@
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
+#include "ParallelCollisionDispatcher.h"
 #include "PhysicsHelpers.h"
 #include "PhysicsDebugDraw.h"
 #include "ThreadSafeDynamicsWorld.h"
@@ -45,7 +46,7 @@ PhysicsEngine::~PhysicsEngine() {
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+        _collisionDispatcher = new ParallelCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
         _constraintSolver = new btSequentialImpulseConstraintSolver;
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
@@ -67,6 +68,9 @@ void PhysicsEngine::init() {
         // in order for its broadphase collision queries to work correctly. Look at how we use
         // _activeStaticBodies to track and update the Aabb's of moved static objects.
         _dynamicsWorld->setForceUpdateAllAabbs(false);
+
+        _collisionDispatcher->setMultithreaded(_multithreaded);
+        _dynamicsWorld->setMultithreaded(_multithreaded);
     }
 }
 
@@ -290,18 +294,18 @@ void PhysicsEngine::processTransaction(PhysicsEngine::Transaction& transaction)
 }
 
 void PhysicsEngine::removeContacts(ObjectMotionState* motionState) {
-    // trigger events for new/existing/old contacts
-    ContactMap::iterator contactItr = _contactMap.begin();
-    while (contactItr != _contactMap.end()) {
-        if (contactItr->first._a == motionState || contactItr->first._b == motionState) {
-            contactItr = _contactMap.erase(contactItr);
-        } else {
-            ++contactItr;
-        }
-    }
+    _contactMap.sweep([motionState](const ContactKey& key, ContactInfo&) {
+        return key._a != motionState && key._b != motionState;
+    });
 }
 
 void PhysicsEngine::stepSimulation() {
+    float dt = 1.0e-6f * (float)(_clock.getTimeMicroseconds());
+    _clock.reset();
+    stepSimulation(dt);
+}
+
+void PhysicsEngine::stepSimulation(float dt) {
     CProfileManager::Reset();
     BT_PROFILE("stepSimulation");
     // NOTE: the grand order of operations is:
@@ -311,8 +315,6 @@ void PhysicsEngine::stepSimulation() {
     // (4) send outgoing packets
 
     const float MAX_TIMESTEP = (float)PHYSICS_ENGINE_MAX_NUM_SUBSTEPS * PHYSICS_ENGINE_FIXED_SUBSTEP;
-    float dt = 1.0e-6f * (float)(_clock.getTimeMicroseconds());
-    _clock.reset();
     float timeStep = btMin(dt, MAX_TIMESTEP);
 
     auto onSubStep = [this]() {
@@ -468,6 +470,8 @@ void PhysicsEngine::updateContactMap() {
     BT_PROFILE("updateContactMap");
     ++_numContactFrames;
 
+    bool doInfection = !Physics::getSessionUUID().isNull();
+
     // update all contacts every frame
     int numManifolds = _collisionDispatcher->getNumManifolds();
     for (int i = 0; i < numManifolds; ++i) {
@@ -491,7 +495,7 @@ void PhysicsEngine::updateContactMap() {
                 _contactMap[ContactKey(a, b)].update(_numContactFrames, contactManifold->getContactPoint(0));
             }
 
-            if (!Physics::getSessionUUID().isNull()) {
+            if (doInfection) {
                 doOwnershipInfection(objectA, objectB);
             }
         }
@@ -549,18 +553,15 @@ void PhysicsEngine::doOwnershipInfectionForConstraints() {
 const CollisionEvents& PhysicsEngine::getCollisionEvents() {
     _collisionEvents.clear();
 
-    // scan known contacts and trigger events
-    ContactMap::iterator contactItr = _contactMap.begin();
-
-    while (contactItr != _contactMap.end()) {
-        ContactInfo& contact = contactItr->second;
+    // scan known contacts, trigger events and drop the ones that ended, all in one pass
+    _contactMap.sweep([&](const ContactKey& key, ContactInfo& contact) {
         ContactEventType type = contact.computeType(_numContactFrames);
         const btScalar SIGNIFICANT_DEPTH = -0.002f; // penetrations have negative distance
         if (type != CONTACT_EVENT_TYPE_CONTINUE ||
                 (contact.distance < SIGNIFICANT_DEPTH &&
                  contact.readyForContinue(_numContactFrames))) {
-            ObjectMotionState* motionStateA = static_cast<ObjectMotionState*>(contactItr->first._a);
-            ObjectMotionState* motionStateB = static_cast<ObjectMotionState*>(contactItr->first._b);
+            ObjectMotionState* motionStateA = static_cast<ObjectMotionState*>(key._a);
+            ObjectMotionState* motionStateB = static_cast<ObjectMotionState*>(key._b);
 
             // NOTE: the MyAvatar RigidBody is the only object in the simulation that does NOT have a MotionState
             // which means should we ever want to report ALL collision events against the avatar we can
@@ -594,12 +595,8 @@ const CollisionEvents& PhysicsEngine::getCollisionEvents() {
             }
         }
 
-        if (type == CONTACT_EVENT_TYPE_END) {
-            contactItr = _contactMap.erase(contactItr);
-        } else {
-            ++contactItr;
-        }
-    }
+        return type != CONTACT_EVENT_TYPE_END;
+    });
     return _collisionEvents;
 }
 
@@ -819,6 +816,14 @@ void PhysicsEngine::setShowBulletConstraintLimits(bool value) {
     }
 }
 
+void PhysicsEngine::setMultithreaded(bool multithreaded) {
+    _multithreaded = multithreaded;
+    if (_dynamicsWorld) {
+        _collisionDispatcher->setMultithreaded(multithreaded);
+        _dynamicsWorld->setMultithreaded(multithreaded);
+    }
+}
+
 void PhysicsEngine::setContactAddedCallback(PhysicsEngine::ContactAddedCallback newCb) {
     // gContactAddedCallback is a special feature hook in Bullet
     // if non-null AND one of the colliding objects has btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK flag set
@@ -21,7 +21,7 @@
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
 #include "BulletUtil.h"
-#include "ContactInfo.h"
+#include "ContactMap.h"
 #include "ObjectMotionState.h"
 #include "ThreadSafeDynamicsWorld.h"
 #include "ObjectAction.h"
@@ -30,19 +30,9 @@
 const float HALF_SIMULATION_EXTENT = 512.0f; // meters
 
 class CharacterController;
+class ParallelCollisionDispatcher;
 class PhysicsDebugDraw;
 
-// simple class for keeping track of contacts
-class ContactKey {
-public:
-    ContactKey() = delete;
-    ContactKey(void* a, void* b) : _a(a), _b(b) {}
-    bool operator<(const ContactKey& other) const { return _a < other._a || (_a == other._a && _b < other._b); }
-    bool operator==(const ContactKey& other) const { return _a == other._a && _b == other._b; }
-    void* _a; // ObjectMotionState pointer
-    void* _b; // ObjectMotionState pointer
-};
-
 struct ContactTestResult {
     ContactTestResult() = delete;
 
@@ -69,7 +59,6 @@ struct ContactTestResult {
     glm::vec3 collisionNormal;
 };
 
-using ContactMap = std::map<ContactKey, ContactInfo>;
 using CollisionEvents = std::vector<Collision>;
 
 class PhysicsEngine {
@@ -109,6 +98,8 @@ public:
     void processTransaction(Transaction& transaction);
 
     void stepSimulation();
+    /// \brief step by dt seconds rather than by the time since the last step, for repeatable runs
+    void stepSimulation(float dt);
     void harvestPerformanceStats();
     void printPerformanceStatsToFile(const QString& filename);
     void updateContactMap();
@@ -150,6 +141,10 @@ public:
     void setShowBulletConstraints(bool value);
     void setShowBulletConstraintLimits(bool value);
 
+    /// \brief spread the narrowphase and the solving of independent islands over the tbb pool
+    void setMultithreaded(bool multithreaded);
+    bool isMultithreaded() const { return _multithreaded; }
+
     // Function for getting colliding objects in the world of specified type
     // See PhysicsCollisionGroups.h for mask flags.
     std::vector<ContactTestResult> contactTest(uint16_t mask, const ShapeInfo& regionShapeInfo, const Transform& regionTransform, uint16_t group = USER_COLLISION_GROUP_DYNAMIC, float threshold = 0.0f) const;
@@ -170,7 +165,7 @@ private:
 
     btClock _clock;
     btDefaultCollisionConfiguration* _collisionConfig = NULL;
-    btCollisionDispatcher* _collisionDispatcher = NULL;
+    ParallelCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
     btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
@@ -193,6 +188,7 @@ private:
     bool _dumpNextStats { false };
     bool _saveNextStats { false };
     bool _hasOutgoingChanges { false };
+    bool _multithreaded { false };
 
 };
 
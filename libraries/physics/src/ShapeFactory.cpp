@@ -13,10 +13,30 @@
 
 #include <glm/gtx/norm.hpp>
 
+#include <QtCore/QDataStream>
+#include <QtCore/QIODevice>
+
 #include <SharedUtil.h> // for MILLIMETERS_PER_METER
 
 #include "BulletUtil.h"
-
+#include "CollisionShapeCache.h"
+
+
+// util method: releases the buffers allocated by allocateStaticMesh() along with the dataArray
+static void deleteStaticMeshArray(btTriangleIndexVertexArray* dataArray) {
+    IndexedMeshArray& meshes = dataArray->getIndexedMeshArray();
+    for (int32_t i = 0; i < meshes.size(); ++i) {
+        btIndexedMesh mesh = meshes[i];
+        mesh.m_numTriangles = 0;
+        delete [] mesh.m_triangleIndexBase;
+        mesh.m_triangleIndexBase = nullptr;
+        mesh.m_numVertices = 0;
+        delete [] mesh.m_vertexBase;
+        mesh.m_vertexBase = nullptr;
+    }
+    meshes.clear();
+    delete dataArray;
+}
 
 class StaticMeshShape : public btBvhTriangleMeshShape {
 public:
@@ -27,26 +47,31 @@ public:
         assert(_dataArray);
     }
 
+    // bvhBuffer holds a BVH that was serialized with serializeInPlace() from a shape with the same dataArray,
+    // it must have been allocated with btAlignedAlloc() and the StaticMeshShape takes ownership of it
+    StaticMeshShape(btTriangleIndexVertexArray* dataArray, void* bvhBuffer, btOptimizedBvh* bvh)
+    :   btBvhTriangleMeshShape(dataArray, true, false), _dataArray(dataArray), _bvhBuffer(bvhBuffer) {
+        assert(_dataArray);
+        setOptimizedBvh(bvh);
+    }
+
     ~StaticMeshShape() {
         assert(_dataArray);
-        IndexedMeshArray& meshes = _dataArray->getIndexedMeshArray();
-        for (int32_t i = 0; i < meshes.size(); ++i) {
-            btIndexedMesh mesh = meshes[i];
-            mesh.m_numTriangles = 0;
-            delete [] mesh.m_triangleIndexBase;
-            mesh.m_triangleIndexBase = nullptr;
-            mesh.m_numVertices = 0;
-            delete [] mesh.m_vertexBase;
-            mesh.m_vertexBase = nullptr;
-        }
-        meshes.clear();
-        delete _dataArray;
+        deleteStaticMeshArray(_dataArray);
         _dataArray = nullptr;
+        if (_bvhBuffer) {
+            // the BVH lives inside the buffer and owns none of its arrays
+            btAlignedFree(_bvhBuffer);
+            _bvhBuffer = nullptr;
+        }
     }
 
+    const btTriangleIndexVertexArray* getDataArray() const { return _dataArray; }
+
 private:
     // the StaticMeshShape owns its vertex/index data
     btTriangleIndexVertexArray* _dataArray;
+    void* _bvhBuffer { nullptr };
 };
 
 // the dataArray must be created before we create the StaticMeshShape
@@ -198,6 +223,27 @@ btConvexHullShape* createConvexHull(const ShapeInfo::PointList& points) {
     return hull;
 }
 
+// util method: allocates the buffers of a mesh that will be owned by a StaticMeshShape
+btIndexedMesh allocateStaticMesh(int32_t numVertices, int32_t numIndices, PHY_ScalarType indexType) {
+    const int32_t VERTICES_PER_TRIANGLE = 3;
+    btIndexedMesh mesh;
+    mesh.m_numTriangles = numIndices / VERTICES_PER_TRIANGLE;
+    if (indexType == PHY_SHORT) {
+        mesh.m_triangleIndexBase = new unsigned char[sizeof(int16_t) * (size_t)numIndices];
+        mesh.m_indexType = PHY_SHORT;
+        mesh.m_triangleIndexStride = VERTICES_PER_TRIANGLE * sizeof(int16_t);
+    } else {
+        mesh.m_triangleIndexBase = new unsigned char[sizeof(int32_t) * (size_t)numIndices];
+        mesh.m_indexType = PHY_INTEGER;
+        mesh.m_triangleIndexStride = VERTICES_PER_TRIANGLE * sizeof(int32_t);
+    }
+    mesh.m_numVertices = numVertices;
+    mesh.m_vertexBase = new unsigned char[VERTICES_PER_TRIANGLE * sizeof(btScalar) * (size_t)mesh.m_numVertices];
+    mesh.m_vertexStride = VERTICES_PER_TRIANGLE * sizeof(btScalar);
+    mesh.m_vertexType = PHY_FLOAT;
+    return mesh;
+}
+
 // util method
 btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     assert(info.getType() == SHAPE_TYPE_STATIC_MESH); // should only get here for mesh shapes
@@ -224,23 +270,10 @@ btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     }
 
     // allocate mesh buffers
-    btIndexedMesh mesh;
     const int32_t VERTICES_PER_TRIANGLE = 3;
-    mesh.m_numTriangles = numIndices / VERTICES_PER_TRIANGLE;
-    if (numIndices < std::numeric_limits<int16_t>::max()) {
-        // small number of points so we can use 16-bit indices
-        mesh.m_triangleIndexBase = new unsigned char[sizeof(int16_t) * (size_t)numIndices];
-        mesh.m_indexType = PHY_SHORT;
-        mesh.m_triangleIndexStride = VERTICES_PER_TRIANGLE * sizeof(int16_t);
-    } else {
-        mesh.m_triangleIndexBase = new unsigned char[sizeof(int32_t) * (size_t)numIndices];
-        mesh.m_indexType = PHY_INTEGER;
-        mesh.m_triangleIndexStride = VERTICES_PER_TRIANGLE * sizeof(int32_t);
-    }
-    mesh.m_numVertices = pointList.size();
-    mesh.m_vertexBase = new unsigned char[VERTICES_PER_TRIANGLE * sizeof(btScalar) * (size_t)mesh.m_numVertices];
-    mesh.m_vertexStride = VERTICES_PER_TRIANGLE * sizeof(btScalar);
-    mesh.m_vertexType = PHY_FLOAT;
+    // small number of points so we can use 16-bit indices
+    PHY_ScalarType indexType = numIndices < std::numeric_limits<int16_t>::max() ? PHY_SHORT : PHY_INTEGER;
+    btIndexedMesh mesh = allocateStaticMesh(pointList.size(), numIndices, indexType);
 
     // copy data into buffers
     btScalar* vertexData = static_cast<btScalar*>((void*)(mesh.m_vertexBase));
@@ -483,7 +516,207 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
     delete nonConstShape;
 }
 
+const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info, CollisionShapeCache* cache) {
+    if (!cache || !CollisionShapeCache::isCacheable(info.getType())) {
+        return createShapeFromInfo(info);
+    }
+    const btCollisionShape* shape = cache->getShape(info);
+    if (!shape) {
+        shape = createShapeFromInfo(info);
+        if (shape) {
+            cache->putShape(info, shape);
+        }
+    }
+    return shape;
+}
+
+enum SerializedShapeType : quint8 {
+    SERIALIZED_CONVEX_HULL = 0,
+    SERIALIZED_COMPOUND,
+    SERIALIZED_STATIC_MESH
+};
+
+// compounds made by the ShapeFactory are at most two deep, anything deeper is bad data
+const int MAX_SERIALIZED_SHAPE_DEPTH = 4;
+const quint32 MAX_SERIALIZED_ARRAY_SIZE = 1 << 26;
+
+static void writeVector(QDataStream& stream, const btVector3& v) {
+    stream << (float)v.x() << (float)v.y() << (float)v.z();
+}
+
+static btVector3 readVector(QDataStream& stream) {
+    float x, y, z;
+    stream >> x >> y >> z;
+    return btVector3(x, y, z);
+}
+
+bool ShapeFactory::serializeShape(const btCollisionShape* shape, QDataStream& stream) {
+    switch (shape->getShapeType()) {
+        case CONVEX_HULL_SHAPE_PROXYTYPE: {
+            const btConvexHullShape* hull = static_cast<const btConvexHullShape*>(shape);
+            stream << (quint8)SERIALIZED_CONVEX_HULL << (float)hull->getMargin() << (quint32)hull->getNumPoints();
+            const btVector3* points = hull->getUnscaledPoints();
+            for (int32_t i = 0; i < hull->getNumPoints(); ++i) {
+                writeVector(stream, points[i]);
+            }
+        }
+        break;
+        case COMPOUND_SHAPE_PROXYTYPE: {
+            const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+            int32_t numChildShapes = compound->getNumChildShapes();
+            stream << (quint8)SERIALIZED_COMPOUND << (quint32)numChildShapes;
+            for (int32_t i = 0; i < numChildShapes; ++i) {
+                const btTransform& transform = compound->getChildTransform(i);
+                btQuaternion rotation = transform.getRotation();
+                writeVector(stream, transform.getOrigin());
+                stream << (float)rotation.x() << (float)rotation.y() << (float)rotation.z() << (float)rotation.w();
+                if (!serializeShape(compound->getChildShape(i), stream)) {
+                    return false;
+                }
+            }
+        }
+        break;
+        case TRIANGLE_MESH_SHAPE_PROXYTYPE: {
+            const StaticMeshShape* meshShape = dynamic_cast<const StaticMeshShape*>(shape);
+            if (!meshShape || meshShape->getDataArray()->getIndexedMeshArray().size() != 1) {
+                return false;
+            }
+            const btIndexedMesh& mesh = meshShape->getDataArray()->getIndexedMeshArray()[0];
+            const int32_t VERTICES_PER_TRIANGLE = 3;
+            int32_t numIndices = mesh.m_numTriangles * VERTICES_PER_TRIANGLE;
+            size_t indexSize = mesh.m_indexType == PHY_SHORT ? sizeof(int16_t) : sizeof(int32_t);
+            stream << (quint8)SERIALIZED_STATIC_MESH << (qint32)mesh.m_indexType
+                << (quint32)mesh.m_numVertices << (quint32)numIndices;
+            stream.writeRawData((const char*)mesh.m_vertexBase, (int)(VERTICES_PER_TRIANGLE * sizeof(btScalar) * mesh.m_numVertices));
+            stream.writeRawData((const char*)mesh.m_triangleIndexBase, (int)(indexSize * numIndices));
+
+            // the quantized BVH is what takes the time to build, so it is saved as is
+            const btOptimizedBvh* bvh = const_cast<StaticMeshShape*>(meshShape)->getOptimizedBvh();
+            unsigned bvhSize = bvh->calculateSerializeBufferSize();
+            void* bvhBuffer = btAlignedAlloc(bvhSize, 16);
+            bool serialized = bvh->serializeInPlace(bvhBuffer, bvhSize, false);
+            if (serialized) {
+                stream << (quint32)bvhSize;
+                stream.writeRawData((const char*)bvhBuffer, bvhSize);
+            }
+            btAlignedFree(bvhBuffer);
+            if (!serialized) {
+                return false;
+            }
+        }
+        break;
+        default:
+            return false;
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+static btCollisionShape* readShape(QDataStream& stream, int depth) {
+    if (depth > MAX_SERIALIZED_SHAPE_DEPTH) {
+        return nullptr;
+    }
+    quint8 type;
+    stream >> type;
+    btCollisionShape* shape = nullptr;
+    switch (type) {
+        case SERIALIZED_CONVEX_HULL: {
+            float margin;
+            quint32 numPoints;
+            stream >> margin >> numPoints;
+            if (stream.status() != QDataStream::Ok || numPoints == 0 || numPoints > MAX_SERIALIZED_ARRAY_SIZE) {
+                return nullptr;
+            }
+            btConvexHullShape* hull = new btConvexHullShape();
+            for (quint32 i = 0; i < numPoints; ++i) {
+                hull->addPoint(readVector(stream), false);
+            }
+            hull->setMargin(margin);
+            hull->recalcLocalAabb();
+            shape = hull;
+        }
+        break;
+        case SERIALIZED_COMPOUND: {
+            quint32 numChildShapes;
+            stream >> numChildShapes;
+            if (stream.status() != QDataStream::Ok || numChildShapes > MAX_SERIALIZED_ARRAY_SIZE) {
+                return nullptr;
+            }
+            btCompoundShape* compound = new btCompoundShape();
+            for (quint32 i = 0; i < numChildShapes; ++i) {
+                btVector3 origin = readVector(stream);
+                float x, y, z, w;
+                stream >> x >> y >> z >> w;
+                btCollisionShape* child = readShape(stream, depth + 1);
+                if (!child) {
+                    ShapeFactory::deleteShape(compound);
+                    return nullptr;
+                }
+                compound->addChildShape(btTransform(btQuaternion(x, y, z, w), origin), child);
+            }
+            compound->recalculateLocalAabb();
+            shape = compound;
+        }
+        break;
+        case SERIALIZED_STATIC_MESH: {
+            qint32 indexType;
+            quint32 numVertices;
+            quint32 numIndices;
+            stream >> indexType >> numVertices >> numIndices;
+            if (stream.status() != QDataStream::Ok || (indexType != PHY_SHORT && indexType != PHY_INTEGER) ||
+                numVertices > MAX_SERIALIZED_ARRAY_SIZE || numIndices > MAX_SERIALIZED_ARRAY_SIZE) {
+                return nullptr;
+            }
+            const int32_t VERTICES_PER_TRIANGLE = 3;
+            btIndexedMesh mesh = allocateStaticMesh(numVertices, numIndices, (PHY_ScalarType)indexType);
+            btTriangleIndexVertexArray* dataArray = new btTriangleIndexVertexArray;
+            dataArray->addIndexedMesh(mesh, mesh.m_indexType);
+
+            int vertexSize = (int)(VERTICES_PER_TRIANGLE * sizeof(btScalar) * numVertices);
+            int indexSize = (int)((indexType == PHY_SHORT ? sizeof(int16_t) : sizeof(int32_t)) * numIndices);
+            quint32 bvhSize = 0;
+            bool valid = stream.readRawData((char*)mesh.m_vertexBase, vertexSize) == vertexSize &&
+                stream.readRawData((char*)mesh.m_triangleIndexBase, indexSize) == indexSize;
+            for (quint32 i = 0; valid && i < numIndices; ++i) {
+                // Bullet trusts the indices, so check them before it sees them
+                uint32_t index = indexType == PHY_SHORT ? (uint16_t)((const int16_t*)mesh.m_triangleIndexBase)[i] :
+                    (uint32_t)((const int32_t*)mesh.m_triangleIndexBase)[i];
+                valid = index < numVertices;
+            }
+            if (valid) {
+                stream >> bvhSize;
+                valid = stream.status() == QDataStream::Ok && bvhSize > 0 && bvhSize <= MAX_SERIALIZED_ARRAY_SIZE;
+            }
+            void* bvhBuffer = valid ? btAlignedAlloc(bvhSize, 16) : nullptr;
+            btOptimizedBvh* bvh = nullptr;
+            if (valid && stream.readRawData((char*)bvhBuffer, bvhSize) == (int)bvhSize) {
+                // same as Bullet's own examples: btOptimizedBvh adds no data to the btQuantizedBvh this creates
+                bvh = static_cast<btOptimizedBvh*>(btOptimizedBvh::deSerializeInPlace(bvhBuffer, bvhSize, false));
+            }
+            if (bvh) {
+                shape = new StaticMeshShape(dataArray, bvhBuffer, bvh);
+            } else {
+                if (bvhBuffer) {
+                    btAlignedFree(bvhBuffer);
+                }
+                deleteStaticMeshArray(dataArray);
+            }
+        }
+        break;
+        default:
+        break;
+    }
+    if (shape && stream.status() != QDataStream::Ok) {
+        ShapeFactory::deleteShape(shape);
+        shape = nullptr;
+    }
+    return shape;
+}
+
+const btCollisionShape* ShapeFactory::deserializeShape(QDataStream& stream) {
+    return readShape(stream, 0);
+}
+
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    shape = ShapeFactory::createShapeFromInfo(shapeInfo, cache.get());
     emit submitWork(this);
 }
@@ -17,14 +17,29 @@
 #include <QObject>
 #include <QtCore/QRunnable>
 
+#include <memory>
+
 #include <ShapeInfo.h>
 
+class CollisionShapeCache;
+class QDataStream;
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
+    // Bump this whenever createShapeFromInfo() starts building something different from the same ShapeInfo,
+    // so that shapes saved in a CollisionShapeCache by older versions are not used.
+    const uint32_t SHAPE_ALGORITHM_VERSION = 1;
+
     const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
+    // same as above, but looks for the shape in cache first and adds it to cache if it had to be built
+    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info, CollisionShapeCache* cache);
     void deleteShape(const btCollisionShape* shape);
 
+    // Convex hulls, static meshes with their BVH, and compounds of them can be serialized, nothing else.
+    bool serializeShape(const btCollisionShape* shape, QDataStream& stream);
+    const btCollisionShape* deserializeShape(QDataStream& stream);
+
     class Worker : public QObject, public QRunnable {
         Q_OBJECT
     public:
@@ -32,6 +47,7 @@ namespace ShapeFactory {
         void run() override;
         ShapeInfo shapeInfo;
         const btCollisionShape* shape;
+        std::shared_ptr<CollisionShapeCache> cache;
     signals:
         void submitWork(Worker*);
     };
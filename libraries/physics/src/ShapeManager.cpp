@@ -36,7 +36,19 @@ ShapeManager::~ShapeManager() {
     }
 }
 
-const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
+bool ShapeManager::canBuildOffThread(ShapeType type) {
+    switch (type) {
+        case SHAPE_TYPE_COMPOUND:
+        case SHAPE_TYPE_SIMPLE_HULL:
+        case SHAPE_TYPE_SIMPLE_COMPOUND:
+        case SHAPE_TYPE_STATIC_MESH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info, bool buildHullsOffThread) {
     if (info.getType() == SHAPE_TYPE_NONE) {
         return nullptr;
     }
@@ -47,17 +59,17 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    bool buildOffThread = info.getType() == SHAPE_TYPE_STATIC_MESH ||
+        (buildHullsOffThread && canBuildOffThread(info.getType()));
+    if (buildOffThread) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
         // starting or waiting on a thread.
         ++_workRequestCount;
 
-        const auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), hash);
-        if (itr == _pendingMeshShapes.end()) {
+        if (_pendingShapes.insert(hash).second) {
             // start a worker
-            _pendingMeshShapes.push_back(hash);
             // try to recycle old deadWorker
             ShapeFactory::Worker* worker = _deadWorker;
             if (!worker) {
@@ -66,6 +78,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 worker->shapeInfo = info;
                 _deadWorker = nullptr;
             }
+            worker->cache = _shapeCache;
             // we will delete worker manually later
             worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
@@ -73,7 +86,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         }
         // else we're still waiting for the shape to be created on another thread
     } else {
-        shape = ShapeFactory::createShapeFromInfo(info);
+        shape = ShapeFactory::createShapeFromInfo(info, _shapeCache.get());
         if (shape) {
             ShapeReference newRef;
             newRef.refCount = 1;
@@ -208,8 +221,8 @@ bool ShapeManager::hasShape(const btCollisionShape* shape) const {
 
 // slot: called when ShapeFactory::Worker is done building shape
 void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
-    auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), worker->shapeInfo.getHash());
-    if (itr == _pendingMeshShapes.end()) {
+    auto itr = _pendingShapes.find(worker->shapeInfo.getHash());
+    if (itr == _pendingShapes.end()) {
         // we've received a shape but don't remember asking for it
         // (should not fall in here, but if we do: delete the unwanted shape)
         if (worker->shape) {
@@ -217,11 +230,13 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
         }
     } else {
         // clear pending status
-        *itr = _pendingMeshShapes.back();
-        _pendingMeshShapes.pop_back();
+        _pendingShapes.erase(itr);
 
-        // cache the new shape
-        if (worker->shape) {
+        if (worker->shape && _shapeMap.find(HashKey(worker->shapeInfo.getHash()))) {
+            // the same shape was built on this thread while the worker was busy
+            ShapeFactory::deleteShape(worker->shape);
+        } else if (worker->shape) {
+            // cache the new shape
             ShapeReference newRef;
             // refCount is zero because nothing is using the shape yet
             newRef.refCount = 0;
@@ -277,6 +292,7 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     // save this dead worker for later
     worker->shapeInfo.clear();
     worker->shape = nullptr;
+    worker->cache.reset();
     _deadWorker = worker;
     ++_workDeliveryCount;
 }
@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <unordered_set>
 #include <vector>
 
 #include <QObject>
@@ -22,6 +23,7 @@
 
 #include <ShapeInfo.h>
 
+#include "CollisionShapeCache.h"
 #include "ShapeFactory.h"
 #include "HashKey.h"
 
@@ -41,6 +43,11 @@
 // and returns the pointer.  If not it asks the ShapeFactory to create it, adds an
 // entry in the map with a ref-count of 1, and returns the pointer.
 //
+// Static meshes, and hulls when the caller asks for it, are expensive to build so they are built on the global
+// QThreadPool instead: getShape() returns nullptr and bumps the work request count, and any other request for the
+// same hash while the first is pending joins it rather than starting another worker.  Finished shapes are added
+// with a ref-count of zero and the work delivery count is bumped, after which getShapeByKey() will find them.
+//
 // When a body stops using a shape the ShapeManager must be informed so it can
 // decrement its ref-count.  When a ref-count drops to zero the ShapeManager
 // doesn't delete it right away.  Instead it puts the shape's key on a list delete
@@ -55,8 +62,9 @@ public:
     ShapeManager();
     ~ShapeManager();
 
-    /// \return pointer to shape
-    const btCollisionShape* getShape(const ShapeInfo& info);
+    /// \return pointer to shape, or nullptr if it is being built on another thread
+    /// \param buildHullsOffThread also build convex hull and compound shapes on another thread
+    const btCollisionShape* getShape(const ShapeInfo& info, bool buildHullsOffThread = false);
     const btCollisionShape* getShapeByKey(uint64_t key);
     bool hasShapeWithKey(uint64_t key) const;
 
@@ -66,11 +74,20 @@ public:
     /// delete shapes that have zero references
     void collectGarbage();
 
+    /// \return true if shapes of this type may be built on another thread
+    static bool canBuildOffThread(ShapeType type);
+
+    /// shapes that are slow to build are looked for in cache before being built, and added to it after.
+    /// Only Interface sets one: the entity server and agents run SimpleEntitySimulation and never build shapes,
+    /// and physics-replay leaves it unset so that it measures the real build costs.
+    void setShapeCache(const std::shared_ptr<CollisionShapeCache>& cache) { _shapeCache = cache; }
+
     // validation methods
     int getNumShapes() const { return _shapeMap.size(); }
     int getNumReferences(const ShapeInfo& info) const;
     int getNumReferences(const btCollisionShape* shape) const;
     bool hasShape(const btCollisionShape* shape) const;
+    int getNumPendingShapes() const { return (int)_pendingShapes.size(); }
     uint32_t getWorkRequestCount() const { return _workRequestCount; }
     uint32_t getWorkDeliveryCount() const { return _workDeliveryCount; }
 
@@ -100,8 +117,9 @@ private:
     // btHashMap is required because it supports memory alignment of the btCollisionShapes
     btHashMap<HashKey, ShapeReference> _shapeMap;
     std::vector<uint64_t> _garbageRing;
-    std::vector<uint64_t> _pendingMeshShapes;
+    std::unordered_set<uint64_t> _pendingShapes;
     std::vector<KeyExpiry> _orphans;
+    std::shared_ptr<CollisionShapeCache> _shapeCache;
     ShapeFactory::Worker* _deadWorker { nullptr };
     TimePoint _nextOrphanExpiry;
     uint32_t _ringIndex { 0 };
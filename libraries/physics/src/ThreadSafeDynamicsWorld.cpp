@@ -17,10 +17,199 @@
 
 #include "ThreadSafeDynamicsWorld.h"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.h>
 #include <LinearMath/btQuickprof.h>
 
+#include <TBBHelpers.h>
+#include <tbb/enumerable_thread_specific.h>
+
 #include "Profile.h"
 
+// islands with fewer bodies, contacts and constraints than this are solved together, so the tasks are worth handing out
+static const int MIN_WORK_PER_JOB = 64;
+
+// same as the one btDiscreteDynamicsWorld uses to sort its constraints
+static int getConstraintIslandId(const btTypedConstraint* constraint) {
+    const btCollisionObject& bodyA = constraint->getRigidBodyA();
+    const btCollisionObject& bodyB = constraint->getRigidBodyB();
+    return bodyA.getIslandTag() >= 0 ? bodyA.getIslandTag() : bodyB.getIslandTag();
+}
+
+class SortConstraintOnIslandPredicate {
+public:
+    bool operator()(const btTypedConstraint* lhs, const btTypedConstraint* rhs) const {
+        return getConstraintIslandId(lhs) < getConstraintIslandId(rhs);
+    }
+};
+
+class CompareIslandId {
+public:
+    bool operator()(const btTypedConstraint* constraint, int islandId) const {
+        return getConstraintIslandId(constraint) < islandId;
+    }
+    bool operator()(int islandId, const btTypedConstraint* constraint) const {
+        return islandId < getConstraintIslandId(constraint);
+    }
+};
+
+// Solves the awake islands concurrently, each job with its own btSequentialImpulseConstraintSolver.
+//
+// Dynamic objects only ever belong to one island, but a kinematic object can touch several of them, and the solver
+// keeps its scratch index in the object's companion id.  So islands that share a kinematic object go in the same job.
+// Static objects all map to the solver's own fixed body and can be shared freely.
+class ThreadSafeDynamicsWorld::IslandSolver : public btSimulationIslandManager::IslandCallback {
+public:
+    void processIsland(btCollisionObject** bodies, int numBodies, btPersistentManifold** manifolds,
+                       int numManifolds, int islandId) override {
+        // bodies is reused for the next island, but manifolds stays put until the islands are built again
+        Island island;
+        island.id = islandId;
+        island.firstBody = (int)_bodies.size();
+        island.numBodies = numBodies;
+        island.manifolds = manifolds;
+        island.numManifolds = numManifolds;
+        _bodies.insert(_bodies.end(), bodies, bodies + numBodies);
+        _islands.push_back(island);
+    }
+
+    void solve(btSimulationIslandManager* islandManager, btCollisionWorld* collisionWorld, btDispatcher* dispatcher,
+               btTypedConstraint** constraints, int numConstraints, const btContactSolverInfo& solverInfo,
+               btConstraintSolver* serialSolver) {
+        _islands.clear();
+        _bodies.clear();
+        {
+            BT_PROFILE("buildIslands");
+            islandManager->buildAndProcessIslands(dispatcher, collisionWorld, this);
+        }
+
+        buildJobs(constraints, numConstraints);
+
+        if (_jobs.size() == 1) {
+            solveJob(_jobs[0], serialSolver, solverInfo, dispatcher);
+        } else if (_jobs.size() > 1) {
+            BT_PROFILE("solveIslandsMt");
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, _jobs.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+                auto& solver = _solvers.local();
+                if (!solver) {
+                    solver.reset(new btSequentialImpulseConstraintSolver());
+                }
+                for (size_t i = range.begin(); i < range.end(); ++i) {
+                    solveJob(_jobs[i], solver.get(), solverInfo, dispatcher);
+                }
+            });
+        }
+    }
+
+private:
+    struct Island {
+        int id;
+        int firstBody;
+        int numBodies;
+        btPersistentManifold** manifolds;
+        int numManifolds;
+        int firstConstraint { 0 };
+        int numConstraints { 0 };
+        int group { -1 };
+    };
+
+    struct Job {
+        std::vector<btCollisionObject*> bodies;
+        std::vector<btPersistentManifold*> manifolds;
+        std::vector<btTypedConstraint*> constraints;
+    };
+
+    int findGroup(int island) {
+        while (_islands[island].group != island) {
+            _islands[island].group = _islands[_islands[island].group].group;
+            island = _islands[island].group;
+        }
+        return island;
+    }
+
+    void joinKinematic(const btCollisionObject* object, int island) {
+        if (object->isKinematicObject()) {
+            auto itr = _kinematicIslands.find(object);
+            if (itr == _kinematicIslands.end()) {
+                _kinematicIslands[object] = island;
+            } else {
+                int a = findGroup(island);
+                int b = findGroup(itr->second);
+                if (a != b) {
+                    _islands[std::max(a, b)].group = std::min(a, b);
+                }
+            }
+        }
+    }
+
+    void buildJobs(btTypedConstraint** constraints, int numConstraints) {
+        _jobs.clear();
+        _kinematicIslands.clear();
+        int numIslands = (int)_islands.size();
+
+        // the constraints are sorted by island
+        for (int i = 0; i < numIslands; ++i) {
+            Island& island = _islands[i];
+            island.group = i;
+            auto range = std::equal_range(constraints, constraints + numConstraints, island.id, CompareIslandId());
+            island.firstConstraint = (int)(range.first - constraints);
+            island.numConstraints = (int)(range.second - range.first);
+        }
+
+        for (int i = 0; i < numIslands; ++i) {
+            const Island& island = _islands[i];
+            for (int j = 0; j < island.numManifolds; ++j) {
+                joinKinematic(island.manifolds[j]->getBody0(), i);
+                joinKinematic(island.manifolds[j]->getBody1(), i);
+            }
+            for (int j = 0; j < island.numConstraints; ++j) {
+                const btTypedConstraint* constraint = constraints[island.firstConstraint + j];
+                joinKinematic(&constraint->getRigidBodyA(), i);
+                joinKinematic(&constraint->getRigidBodyB(), i);
+            }
+        }
+
+        // one job per group in island order, small groups are packed together.  Islands without contacts or
+        // constraints still need solving, the solver is what applies gravity and other forces to their bodies.
+        std::vector<int> groupJobs(numIslands, -1);
+        int openJob = -1;
+        for (int i = 0; i < numIslands; ++i) {
+            const Island& island = _islands[i];
+            int group = findGroup(i);
+            int jobIndex = groupJobs[group];
+            if (jobIndex < 0) {
+                if (openJob < 0 || jobWork(_jobs[openJob]) >= MIN_WORK_PER_JOB) {
+                    openJob = (int)_jobs.size();
+                    _jobs.emplace_back();
+                }
+                jobIndex = groupJobs[group] = openJob;
+            }
+            Job& job = _jobs[jobIndex];
+            job.bodies.insert(job.bodies.end(), _bodies.begin() + island.firstBody, _bodies.begin() + island.firstBody + island.numBodies);
+            job.manifolds.insert(job.manifolds.end(), island.manifolds, island.manifolds + island.numManifolds);
+            job.constraints.insert(job.constraints.end(), constraints + island.firstConstraint,
+                                   constraints + island.firstConstraint + island.numConstraints);
+        }
+    }
+
+    static int jobWork(const Job& job) {
+        return (int)(job.bodies.size() + job.manifolds.size() + job.constraints.size());
+    }
+
+    static void solveJob(Job& job, btConstraintSolver* solver, const btContactSolverInfo& solverInfo, btDispatcher* dispatcher) {
+        solver->solveGroup(job.bodies.data(), (int)job.bodies.size(), job.manifolds.data(), (int)job.manifolds.size(),
+                           job.constraints.data(), (int)job.constraints.size(), solverInfo, nullptr, dispatcher);
+    }
+
+    std::vector<Island> _islands;
+    std::vector<btCollisionObject*> _bodies;
+    std::vector<Job> _jobs;
+    std::unordered_map<const btCollisionObject*, int> _kinematicIslands;
+    tbb::enumerable_thread_specific<std::unique_ptr<btSequentialImpulseConstraintSolver>> _solvers;
+};
+
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btDispatcher* dispatcher,
         btBroadphaseInterface* pairCache,
@@ -29,6 +218,9 @@ ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
     :   btDiscreteDynamicsWorld(dispatcher, pairCache, constraintSolver, collisionConfiguration) {
 }
 
+ThreadSafeDynamicsWorld::~ThreadSafeDynamicsWorld() {
+}
+
 int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps,
                                                                btScalar fixedTimeStep, SubStepCallback onSubStep) {
     DETAILED_PROFILE_RANGE(simulation_physics, "stepWithCB");
@@ -92,6 +284,30 @@ int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep
     return subSteps;
 }
 
+void ThreadSafeDynamicsWorld::solveConstraints(btContactSolverInfo& solverInfo) {
+    if (!_multithreaded || !m_islandManager->getSplitIslands()) {
+        btDiscreteDynamicsWorld::solveConstraints(solverInfo);
+        return;
+    }
+
+    DETAILED_PROFILE_RANGE(simulation_physics, "solveConstraintsMt");
+    BT_PROFILE("solveConstraintsMt");
+    int numConstraints = getNumConstraints();
+    m_sortedConstraints.resize(numConstraints);
+    for (int i = 0; i < numConstraints; ++i) {
+        m_sortedConstraints[i] = m_constraints[i];
+    }
+    m_sortedConstraints.quickSort(SortConstraintOnIslandPredicate());
+    btTypedConstraint** constraints = numConstraints > 0 ? &m_sortedConstraints[0] : nullptr;
+
+    if (!_islandSolver) {
+        _islandSolver.reset(new IslandSolver());
+    }
+    m_constraintSolver->prepareSolve(getNumCollisionObjects(), getDispatcher()->getNumManifolds());
+    _islandSolver->solve(m_islandManager, this, getDispatcher(), constraints, numConstraints, solverInfo, m_constraintSolver);
+    m_constraintSolver->allSolved(solverInfo, m_debugDrawer);
+}
+
 // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
 void ThreadSafeDynamicsWorld::synchronizeMotionState(btRigidBody* body) {
     btAssert(body);
@@ -24,6 +24,7 @@
 #include "ObjectMotionState.h"
 
 #include <functional>
+#include <memory>
 
 using SubStepCallback = std::function<void()>;
 
@@ -36,6 +37,7 @@ public:
             btBroadphaseInterface* pairCache,
             btConstraintSolver* constraintSolver,
             btCollisionConfiguration* collisionConfiguration);
+    ~ThreadSafeDynamicsWorld();
 
     int getNumSubsteps() const { return _numSubsteps; }
     int stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps = 1,
@@ -55,7 +57,18 @@ public:
     void addChangedMotionState(ObjectMotionState* motionState) { _changedMotionStates.push_back(motionState); }
     virtual void debugDrawObject(const btTransform& worldTransform, const btCollisionShape* shape, const btVector3& color) override;
 
+    // When multithreaded the simulation islands that don't share any object are handed to the constraint solver on
+    // the tbb pool instead of one after another.  Substeps, the substep callback and the motion states are the same
+    // either way, only the order the islands are solved in changes.
+    void setMultithreaded(bool multithreaded) { _multithreaded = multithreaded; }
+    bool isMultithreaded() const { return _multithreaded; }
+
+protected:
+    virtual void solveConstraints(btContactSolverInfo& solverInfo) override;
+
 private:
+    class IslandSolver;
+
     // call this instead of non-virtual btDiscreteDynamicsWorld::synchronizeSingleMotionState()
     void synchronizeMotionState(btRigidBody* body);
     void drawConnectedSpheres(btIDebugDraw* drawer, btScalar radius1, btScalar radius2, const btVector3& position1, 
@@ -66,6 +79,8 @@ private:
     SetOfMotionStates _activeStates;
     SetOfMotionStates _lastActiveStates;
     int _numSubsteps { 0 };
+    std::unique_ptr<IslandSolver> _islandSolver;
+    bool _multithreaded { false };
 };
 
 #endif // hifi_ThreadSafeDynamicsWorld_h
@@ -13,6 +13,7 @@
 
 #include "impl/FileClip.h"
 #include "impl/BufferClip.h"
+#include "impl/ClipIndex.h"
 
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
@@ -33,6 +34,19 @@ void Clip::toFile(const QString& filePath, const Clip::ConstPointer& clip) {
     FileClip::write(filePath, clip->duplicate());
 }
 
+bool Clip::convertFile(const QString& sourcePath, const QString& destinationPath) {
+    Clip::Pointer clip;
+    {
+        // copy the frames out so the source is unmapped before the destination is written, they may be the same file
+        auto source = fromFile(sourcePath);
+        if (!source) {
+            return false;
+        }
+        clip = source->duplicate();
+    }
+    return FileClip::write(destinationPath, clip);
+}
+
 QByteArray Clip::toBuffer(const Clip::ConstPointer& clip) {
     QBuffer buffer;
     if (buffer.open(QFile::Truncate | QFile::WriteOnly)) {
@@ -55,7 +69,10 @@ float Clip::position() const {
 }
 
 // FIXME move to frame?
-bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
+// offset is where output is relative to the start of the clip, and is moved past the frame.  If index is given
+// the frame is added to it.
+bool writeFrame(QIODevice& output, const Frame& frame, quint64& offset, std::vector<ClipIndex::Entry>* index = nullptr,
+                bool compressed = true) {
     if (frame.type == Frame::TYPE_INVALID) {
         qWarning() << "Attempting to write invalid frame";
         return true;
@@ -87,6 +104,12 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
             return false;
         }
     }
+
+    offset += sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
+    if (index) {
+        index->push_back({ frame.type, dataSize, frame.timeOffset, offset });
+    }
+    offset += dataSize;
     return true;
 }
 
@@ -105,17 +128,22 @@ bool Clip::write(QIODevice& output) {
     // Always mark new files as compressed
     rootObject.insert(FRAME_COMREPSSION_FLAG, true);
     QByteArray headerFrameData = QJsonDocument(rootObject).toBinaryData();
+    quint64 offset = 0;
     // Never compress the header frame
-    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
+    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), offset, nullptr, false)) {
         return false;
     }
 
     seek(0);
 
+    std::vector<ClipIndex::Entry> index;
+    index.reserve(frameCount());
     for (auto frame = nextFrame(); frame; frame = nextFrame()) {
-        if (!writeFrame(output, *frame)) {
+        if (!writeFrame(output, *frame, offset, &index)) {
             return false;
         }
     }
-    return true;
+
+    // Readers without index support skip it, its frame types are never in the header's type map
+    return ClipIndex::write(output, offset, index, true);
 }
@@ -51,6 +51,8 @@ public:
 
     static Pointer fromFile(const QString& filePath);
     static void toFile(const QString& filePath, const ConstPointer& clip);
+    // rewrites a clip file in the current, indexed, format.  The paths may be the same.
+    static bool convertFile(const QString& sourcePath, const QString& destinationPath);
     static QByteArray toBuffer(const ConstPointer& clip);
     static Pointer newClip();
     
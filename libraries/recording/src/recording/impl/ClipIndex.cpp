@@ -0,0 +1,278 @@
+//
+//  ClipIndex.cpp
+//  libraries/recording/src/recording/impl
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ClipIndex.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QIODevice>
+
+#include "../Logging.h"
+
+using namespace recording;
+
+static const size_t FRAME_HEADER_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
+static const size_t TRAILER_SIZE = 4 * sizeof(uint32_t) + sizeof(quint64) + sizeof(quint64) + sizeof(uint32_t) +
+                                   sizeof(quint64) + sizeof(uint32_t);
+static const size_t DIRECTORY_ENTRY_SIZE = 3 * sizeof(uint32_t) + sizeof(quint64) + sizeof(FrameSize);
+static const size_t REGIONS_PER_DIRECTORY_FRAME = 2048;
+static const size_t MAX_FRAME_DATA_SIZE = std::numeric_limits<FrameSize>::max();
+
+static void setupStream(QDataStream& stream) {
+    stream.setByteOrder(QDataStream::LittleEndian);
+}
+
+// the same layout Clip::write uses for every other frame
+static bool writeIndexFrame(QIODevice& output, FrameType type, const QByteArray& data, quint64& offset) {
+    if ((size_t)data.size() > MAX_FRAME_DATA_SIZE) {
+        return false;
+    }
+    Frame::Time timeOffset = 0;
+    FrameSize size = (FrameSize)data.size();
+    if (output.write((const char*)&type, sizeof(FrameType)) != sizeof(FrameType) ||
+        output.write((const char*)&timeOffset, sizeof(Frame::Time)) != sizeof(Frame::Time) ||
+        output.write((const char*)&size, sizeof(FrameSize)) != sizeof(FrameSize) ||
+        output.write(data) != data.size()) {
+        return false;
+    }
+    offset += FRAME_HEADER_SIZE + size;
+    return true;
+}
+
+// finds the frame whose header starts at offset, and checks it's an index frame that fits inside data
+static bool readIndexFrame(const uchar* data, size_t size, quint64 offset, FrameType expectedType, QByteArray& frameData) {
+    if (offset > size || size - offset < FRAME_HEADER_SIZE) {
+        return false;
+    }
+    FrameType type;
+    FrameSize frameSize;
+    memcpy(&type, data + offset, sizeof(FrameType));
+    memcpy(&frameSize, data + offset + sizeof(FrameType) + sizeof(Frame::Time), sizeof(FrameSize));
+    if (type != expectedType || size - offset - FRAME_HEADER_SIZE < frameSize) {
+        return false;
+    }
+    frameData = QByteArray::fromRawData((const char*)data + offset + FRAME_HEADER_SIZE, frameSize);
+    return true;
+}
+
+bool ClipIndex::write(QIODevice& output, quint64 offset, const std::vector<Entry>& entries, bool compressRegions) {
+    std::vector<Region> regions;
+    std::map<FrameType, TypeIndex> types;
+    Frame::Time lastTime = 0;
+
+    for (size_t first = 0; first < entries.size(); first += FRAMES_PER_REGION) {
+        size_t last = std::min(first + FRAMES_PER_REGION, entries.size());
+        uint32_t regionIndex = (uint32_t)regions.size();
+
+        QByteArray regionData;
+        {
+            QDataStream stream(&regionData, QIODevice::WriteOnly);
+            setupStream(stream);
+            for (size_t i = first; i < last; i++) {
+                const Entry& entry = entries[i];
+                stream << entry.type << entry.size << entry.timeOffset << entry.fileOffset;
+
+                auto& typeIndex = types[entry.type];
+                typeIndex.type = entry.type;
+                typeIndex.numFrames++;
+                auto& runs = typeIndex.regionRuns;
+                if (runs.empty() || runs.back().first + runs.back().second < regionIndex) {
+                    runs.push_back({ regionIndex, 1 });
+                } else if (runs.back().first + runs.back().second == regionIndex) {
+                    runs.back().second++;
+                }
+                lastTime = std::max(lastTime, entry.timeOffset);
+            }
+        }
+        if (compressRegions) {
+            regionData = qCompress(regionData);
+        }
+
+        Region region;
+        region.firstTime = entries[first].timeOffset;
+        region.lastTime = entries[last - 1].timeOffset;
+        region.numFrames = (uint32_t)(last - first);
+        region.fileOffset = offset + FRAME_HEADER_SIZE;
+        region.size = (FrameSize)regionData.size();
+        if (!writeIndexFrame(output, TYPE_INDEX, regionData, offset)) {
+            return false;
+        }
+        regions.push_back(region);
+    }
+
+    Trailer trailer;
+    trailer.magic = MAGIC;
+    trailer.version = VERSION;
+    trailer.flags = compressRegions ? FLAG_COMPRESSED_REGIONS : 0;
+    trailer.lastTime = lastTime;
+    trailer.numFrames = entries.size();
+
+    trailer.directoryOffset = offset;
+    for (size_t first = 0; first < regions.size(); first += REGIONS_PER_DIRECTORY_FRAME) {
+        size_t last = std::min(first + REGIONS_PER_DIRECTORY_FRAME, regions.size());
+        QByteArray directoryData;
+        QDataStream stream(&directoryData, QIODevice::WriteOnly);
+        setupStream(stream);
+        stream << (uint32_t)(last - first);
+        for (size_t i = first; i < last; i++) {
+            const Region& region = regions[i];
+            stream << region.firstTime << region.lastTime << region.numFrames << region.fileOffset << region.size;
+        }
+        if (!writeIndexFrame(output, TYPE_INDEX, directoryData, offset)) {
+            return false;
+        }
+        trailer.numDirectoryFrames++;
+    }
+
+    trailer.typesOffset = offset;
+    for (auto& entry : types) {
+        TypeIndex& typeIndex = entry.second;
+        // a type scattered over too many runs to fit in a frame is listed as being in every region, which is still true
+        const size_t MAX_RUNS = (MAX_FRAME_DATA_SIZE - 64) / (2 * sizeof(uint32_t));
+        if (typeIndex.regionRuns.size() > MAX_RUNS) {
+            typeIndex.regionRuns = { { 0, (uint32_t)regions.size() } };
+        }
+
+        QByteArray typeData;
+        QDataStream stream(&typeData, QIODevice::WriteOnly);
+        setupStream(stream);
+        stream << typeIndex.type << typeIndex.numFrames << (uint32_t)typeIndex.regionRuns.size();
+        for (const auto& run : typeIndex.regionRuns) {
+            stream << run.first << run.second;
+        }
+        if (!writeIndexFrame(output, TYPE_INDEX, typeData, offset)) {
+            return false;
+        }
+        trailer.numTypeFrames++;
+    }
+
+    QByteArray trailerData;
+    {
+        QDataStream stream(&trailerData, QIODevice::WriteOnly);
+        setupStream(stream);
+        stream << trailer.magic << trailer.version << trailer.flags << trailer.lastTime << trailer.numFrames
+               << trailer.directoryOffset << trailer.numDirectoryFrames << trailer.typesOffset << trailer.numTypeFrames;
+    }
+    Q_ASSERT((size_t)trailerData.size() == TRAILER_SIZE);
+    return writeIndexFrame(output, TYPE_TRAILER, trailerData, offset);
+}
+
+bool ClipIndex::readTrailer(const uchar* data, size_t size, Trailer& trailer) {
+    if (!data || size < FRAME_HEADER_SIZE + TRAILER_SIZE) {
+        return false;
+    }
+    QByteArray trailerData;
+    quint64 offset = size - FRAME_HEADER_SIZE - TRAILER_SIZE;
+    if (!readIndexFrame(data, size, offset, TYPE_TRAILER, trailerData) || (size_t)trailerData.size() != TRAILER_SIZE) {
+        return false;
+    }
+
+    QDataStream stream(trailerData);
+    setupStream(stream);
+    stream >> trailer.magic >> trailer.version >> trailer.flags >> trailer.lastTime >> trailer.numFrames
+           >> trailer.directoryOffset >> trailer.numDirectoryFrames >> trailer.typesOffset >> trailer.numTypeFrames;
+    return stream.status() == QDataStream::Ok && trailer.magic == MAGIC && trailer.version == VERSION;
+}
+
+bool ClipIndex::readDirectory(const uchar* data, size_t size, const Trailer& trailer, std::vector<Region>& regions) {
+    regions.clear();
+    quint64 offset = trailer.directoryOffset;
+    for (uint32_t i = 0; i < trailer.numDirectoryFrames; i++) {
+        QByteArray directoryData;
+        if (!readIndexFrame(data, size, offset, TYPE_INDEX, directoryData)) {
+            return false;
+        }
+        offset += FRAME_HEADER_SIZE + directoryData.size();
+
+        QDataStream stream(directoryData);
+        setupStream(stream);
+        uint32_t numRegions = 0;
+        stream >> numRegions;
+        if ((size_t)directoryData.size() < sizeof(uint32_t) + numRegions * DIRECTORY_ENTRY_SIZE) {
+            return false;
+        }
+        for (uint32_t j = 0; j < numRegions; j++) {
+            Region region;
+            stream >> region.firstTime >> region.lastTime >> region.numFrames >> region.fileOffset >> region.size;
+            regions.push_back(region);
+        }
+        if (stream.status() != QDataStream::Ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ClipIndex::readTypes(const uchar* data, size_t size, const Trailer& trailer, std::vector<TypeIndex>& types) {
+    types.clear();
+    quint64 offset = trailer.typesOffset;
+    for (uint32_t i = 0; i < trailer.numTypeFrames; i++) {
+        QByteArray typeData;
+        if (!readIndexFrame(data, size, offset, TYPE_INDEX, typeData)) {
+            return false;
+        }
+        offset += FRAME_HEADER_SIZE + typeData.size();
+
+        QDataStream stream(typeData);
+        setupStream(stream);
+        TypeIndex typeIndex;
+        uint32_t numRuns = 0;
+        stream >> typeIndex.type >> typeIndex.numFrames >> numRuns;
+        if ((size_t)typeData.size() < numRuns * 2 * sizeof(uint32_t)) {
+            return false;
+        }
+        typeIndex.regionRuns.resize(numRuns);
+        for (auto& run : typeIndex.regionRuns) {
+            stream >> run.first >> run.second;
+        }
+        if (stream.status() != QDataStream::Ok) {
+            return false;
+        }
+        types.push_back(typeIndex);
+    }
+    return true;
+}
+
+bool ClipIndex::readRegion(const uchar* data, size_t size, const Trailer& trailer, const Region& region, std::vector<Entry>& entries) {
+    entries.clear();
+    if (region.fileOffset < FRAME_HEADER_SIZE) {
+        return false;
+    }
+    QByteArray regionData;
+    if (!readIndexFrame(data, size, region.fileOffset - FRAME_HEADER_SIZE, TYPE_INDEX, regionData) || regionData.size() != region.size) {
+        return false;
+    }
+    if (trailer.flags & FLAG_COMPRESSED_REGIONS) {
+        regionData = qUncompress(regionData);
+    }
+
+    const size_t ENTRY_SIZE = sizeof(FrameType) + sizeof(FrameSize) + sizeof(Frame::Time) + sizeof(quint64);
+    if ((size_t)regionData.size() != region.numFrames * ENTRY_SIZE) {
+        qCWarning(recordingLog) << "Corrupt clip index region at" << region.fileOffset;
+        return false;
+    }
+
+    QDataStream stream(regionData);
+    setupStream(stream);
+    entries.resize(region.numFrames);
+    for (auto& entry : entries) {
+        stream >> entry.type >> entry.size >> entry.timeOffset >> entry.fileOffset;
+        if (entry.fileOffset > size || size - entry.fileOffset < entry.size) {
+            entries.clear();
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,92 @@
+//
+//  ClipIndex.h
+//  libraries/recording/src/recording/impl
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+#ifndef hifi_Recording_Impl_ClipIndex_h
+#define hifi_Recording_Impl_ClipIndex_h
+
+#include <vector>
+
+#include <QtCore/QtGlobal>
+
+#include "../Frame.h"
+
+class QIODevice;
+
+namespace recording {
+
+// Version 2 clips are a version 1 frame stream followed by an index of it, so opening one doesn't have to walk
+// every frame.  The index is stored as frames of types that are never registered, which older readers drop like
+// any other frame type missing from the header's type map.
+//
+//   [header frame] [frames...] [region index frames...] [directory frames...] [type frames...] [trailer frame]
+//
+// Each region index frame lists the headers of up to FRAMES_PER_REGION consecutive frames, optionally compressed.
+// The directory lists the time span and location of every region and is read on open, the regions themselves are
+// read when playback first reaches them.  The type frames hold one sub-index per frame type: how many frames of that
+// type there are and which runs of regions contain them.  The trailer is a fixed size frame at the very end that
+// locates the rest.
+class ClipIndex {
+public:
+    static const FrameType TYPE_INDEX = 0xFFFD;
+    static const FrameType TYPE_TRAILER = 0xFFFE;
+    static const uint32_t MAGIC = 0x58444E49;  // "INDX"
+    static const uint32_t VERSION = 2;
+    static const size_t FRAMES_PER_REGION = 2048;
+    static const uint32_t FLAG_COMPRESSED_REGIONS = 0x1;
+
+    // a frame's header, as stored in the file before its type is translated
+    struct Entry {
+        FrameType type;
+        FrameSize size;
+        Frame::Time timeOffset;
+        quint64 fileOffset;  // of the frame data, from the start of the clip
+    };
+
+    struct Region {
+        Frame::Time firstTime;
+        Frame::Time lastTime;
+        uint32_t numFrames;
+        quint64 fileOffset;  // of the region's index frame data
+        FrameSize size;
+    };
+
+    struct TypeIndex {
+        FrameType type;
+        quint64 numFrames { 0 };
+        std::vector<std::pair<uint32_t, uint32_t>> regionRuns;  // first region, number of regions
+    };
+
+    struct Trailer {
+        uint32_t magic { 0 };
+        uint32_t version { 0 };
+        uint32_t flags { 0 };
+        Frame::Time lastTime { 0 };
+        quint64 numFrames { 0 };
+        quint64 directoryOffset { 0 };  // of the first directory frame's header
+        uint32_t numDirectoryFrames { 0 };
+        quint64 typesOffset { 0 };  // of the first type frame's header
+        uint32_t numTypeFrames { 0 };
+    };
+
+    // appends the index of entries, offset is where output is relative to the start of the clip.
+    static bool write(QIODevice& output, quint64 offset, const std::vector<Entry>& entries, bool compressRegions);
+
+    // all of these only look at the few bytes they need, and fail on anything that doesn't fit inside data.
+    static bool readTrailer(const uchar* data, size_t size, Trailer& trailer);
+    static bool readDirectory(const uchar* data, size_t size, const Trailer& trailer, std::vector<Region>& regions);
+    static bool readTypes(const uchar* data, size_t size, const Trailer& trailer, std::vector<TypeIndex>& types);
+    static bool readRegion(const uchar* data, size_t size, const Trailer& trailer, const Region& region, std::vector<Entry>& entries);
+};
+
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include "PointerClip.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include <QtCore/QDebug>
 #include <QtCore/QJsonDocument>
@@ -75,7 +76,15 @@ PointerFrameHeaderList parseFrameHeaders(uchar* const start, const size_t& size)
 }
 
 void PointerClip::reset() {
-    _frames.clear();
+    _regions.clear();
+    _types.clear();
+    _trailer = ClipIndex::Trailer();
+    _isIndexed = false;
+    _frameCount = 0;
+    _lastTime = 0;
+    _regionIndex = 0;
+    _frameIndex = 0;
+    _translationMap.clear();
     _data = nullptr;
     _size = 0;
     _header = QJsonDocument();
@@ -87,19 +96,19 @@ void PointerClip::init(uchar* data, size_t size) {
     _data = data;
     _size = size;
 
-    auto parsedFrameHeaders = parseFrameHeaders(data, size);
-    // Verify that at least one frame exists and that the first frame is a header
-    if (0 == parsedFrameHeaders.size()) {
-        qWarning() << "No frames found, invalid file";
-        reset();
-        return;
-    }
-
-    // Grab the file header
+    // Grab the file header, which is the first frame in every version
+    PointerFrameHeader fileHeaderFrameHeader;
     {
-        auto fileHeaderFrameHeader = *parsedFrameHeaders.begin();
-        parsedFrameHeaders.pop_front();
-        if (fileHeaderFrameHeader.type != Frame::TYPE_HEADER) {
+        if (!data || size < (size_t)MINIMUM_FRAME_SIZE) {
+            qWarning() << "No frames found, invalid file";
+            reset();
+            return;
+        }
+        memcpy(&(fileHeaderFrameHeader.type), data, sizeof(FrameType));
+        memcpy(&(fileHeaderFrameHeader.timeOffset), data + sizeof(FrameType), sizeof(Frame::Time));
+        memcpy(&(fileHeaderFrameHeader.size), data + sizeof(FrameType) + sizeof(Frame::Time), sizeof(FrameSize));
+        fileHeaderFrameHeader.fileOffset = MINIMUM_FRAME_SIZE;
+        if (fileHeaderFrameHeader.type != Frame::TYPE_HEADER || size - (size_t)MINIMUM_FRAME_SIZE < fileHeaderFrameHeader.size) {
             qWarning() << "Missing header frame, invalid file";
             reset();
             return;
@@ -114,46 +123,217 @@ void PointerClip::init(uchar* data, size_t size) {
         _compressed = _header.object()[FRAME_COMREPSSION_FLAG].toBool();
     }
 
-    // Find the type enum translation map and fix up the frame headers
+    // Find the type enum translation map
     {
-        FrameTranslationMap translationMap = parseTranslationMap(_header);
-        if (translationMap.empty()) {
+        _translationMap = parseTranslationMap(_header);
+        if (_translationMap.empty()) {
             qWarning() << "Header missing frame type map, invalid file";
             reset();
             return;
         }
+    }
+
+    // An indexed clip only needs its directory and type sub-indexes, the regions are read as playback reaches them
+    std::vector<ClipIndex::Region> locations;
+    if (ClipIndex::readTrailer(data, size, _trailer) &&
+        ClipIndex::readDirectory(data, size, _trailer, locations) &&
+        ClipIndex::readTypes(data, size, _trailer, _types)) {
+        _regions.resize(locations.size());
+        for (size_t i = 0; i < locations.size(); ++i) {
+            _regions[i].firstTime = locations[i].firstTime;
+            _regions[i].lastTime = locations[i].lastTime;
+            _regions[i].location = locations[i];
+        }
+        for (const auto& typeIndex : _types) {
+            if (_translationMap.contains(typeIndex.type)) {
+                _frameCount += typeIndex.numFrames;
+            }
+        }
+        _lastTime = _trailer.lastTime;
+        _isIndexed = true;
+        qDebug(recordingLog) << "Opened indexed clip with" << _frameCount << "frames in" << _regions.size() << "regions";
+        return;
+    }
+    _trailer = ClipIndex::Trailer();
+    _types.clear();
+
+    // Otherwise parse every frame header, and fix up the types
+    auto parsedFrameHeaders = parseFrameHeaders(data + fileHeaderFrameHeader.fileOffset + fileHeaderFrameHeader.size,
+        size - fileHeaderFrameHeader.fileOffset - fileHeaderFrameHeader.size);
+    Region region;
+    region.isLoaded = true;
+    region.frames.reserve(parsedFrameHeaders.size());
+    quint64 dataOffset = fileHeaderFrameHeader.fileOffset + fileHeaderFrameHeader.size;
+    for (auto& frameHeader : parsedFrameHeaders) {
+        if (!_translationMap.contains(frameHeader.type)) {
+            continue;
+        }
+        frameHeader.type = _translationMap[frameHeader.type];
+        frameHeader.fileOffset += dataOffset;
+        region.frames.push_back(frameHeader);
+    }
+    if (!region.frames.empty()) {
+        region.firstTime = region.frames.front().timeOffset;
+        region.lastTime = region.frames.back().timeOffset;
+    }
+    _frameCount = region.frames.size();
+    _lastTime = region.lastTime;
+    _regions.push_back(std::move(region));
+}
 
-        // Update the loaded headers with the frame data
-        _frames.reserve(parsedFrameHeaders.size());
-        for (auto& frameHeader : parsedFrameHeaders) {
-            if (!translationMap.contains(frameHeader.type)) {
+// Internal only function, needs no locking
+const PointerClip::Region* PointerClip::getRegion(size_t regionIndex) const {
+    if (regionIndex >= _regions.size()) {
+        return nullptr;
+    }
+    Region& region = _regions[regionIndex];
+    if (!region.isLoaded) {
+        std::vector<ClipIndex::Entry> entries;
+        if (!ClipIndex::readRegion(_data, _size, _trailer, region.location, entries)) {
+            qCWarning(recordingLog) << "Unable to read clip index region" << regionIndex;
+        }
+        region.frames.reserve(entries.size());
+        for (const auto& entry : entries) {
+            if (!_translationMap.contains(entry.type)) {
                 continue;
             }
-            frameHeader.type = translationMap[frameHeader.type];
-            _frames.push_back(frameHeader);
+            PointerFrameHeader header;
+            header.type = _translationMap[entry.type];
+            header.timeOffset = entry.timeOffset;
+            header.size = entry.size;
+            header.fileOffset = entry.fileOffset;
+            region.frames.push_back(header);
         }
+        // a region that failed to load stays empty rather than being retried every frame
+        region.isLoaded = true;
     }
+    return &region;
+}
 
+// Internal only function, needs no locking
+const PointerFrameHeader* PointerClip::currentFrame() const {
+    while (_regionIndex < _regions.size()) {
+        const Region* region = getRegion(_regionIndex);
+        if (_frameIndex < region->frames.size()) {
+            return &region->frames[_frameIndex];
+        }
+        ++_regionIndex;
+        _frameIndex = 0;
+    }
+    return nullptr;
 }
 
 // Internal only function, needs no locking
-FrameConstPointer PointerClip::readFrame(size_t frameIndex) const {
-    FramePointer result;
-    if (frameIndex < _frames.size()) {
-        result = std::make_shared<Frame>();
-        const auto& header = _frames[frameIndex];
-        result->type = header.type;
-        result->timeOffset = header.timeOffset;
-        if (header.size) {
-            result->data.insert(0, reinterpret_cast<char*>(_data)+header.fileOffset, header.size);
-            if (_compressed) {
-                result->data = qUncompress(result->data);
+FrameConstPointer PointerClip::readFrame(const PointerFrameHeader& header) const {
+    FramePointer result = std::make_shared<Frame>();
+    result->type = header.type;
+    result->timeOffset = header.timeOffset;
+    if (header.size) {
+        result->data.insert(0, reinterpret_cast<char*>(_data)+header.fileOffset, header.size);
+        if (_compressed) {
+            result->data = qUncompress(result->data);
+        }
+    }
+    return result;
+}
+
+Clip::Pointer PointerClip::duplicate() const {
+    auto result = newClip();
+    Locker lock(_mutex);
+    for (size_t i = 0; i < _regions.size(); ++i) {
+        for (const auto& header : getRegion(i)->frames) {
+            result->addFrame(readFrame(header));
+        }
+    }
+    return result;
+}
+
+float PointerClip::duration() const {
+    Locker lock(_mutex);
+    if (0 == _frameCount) {
+        return 0;
+    }
+    return Frame::frameTimeToSeconds(_lastTime);
+}
+
+size_t PointerClip::frameCount() const {
+    Locker lock(_mutex);
+    return _frameCount;
+}
+
+size_t PointerClip::frameCount(FrameType type) const {
+    Locker lock(_mutex);
+    size_t result = 0;
+    if (_isIndexed) {
+        for (const auto& typeIndex : _types) {
+            if (_translationMap.contains(typeIndex.type) && _translationMap[typeIndex.type] == type) {
+                result += typeIndex.numFrames;
             }
         }
+    } else if (!_regions.empty()) {
+        const auto& frames = _regions.front().frames;
+        result = std::count_if(frames.begin(), frames.end(), [&](const PointerFrameHeader& header) {
+            return header.type == type;
+        });
+    }
+    return result;
+}
+
+void PointerClip::seekFrameTime(Frame::Time offset) {
+    Locker lock(_mutex);
+    // the first region that ends at or after offset holds the first frame at or after it
+    auto itr = std::lower_bound(_regions.begin(), _regions.end(), offset,
+        [](const Region& a, Frame::Time b)->bool {
+            return a.lastTime < b;
+        }
+    );
+    _regionIndex = itr - _regions.begin();
+    _frameIndex = 0;
+    if (const Region* region = getRegion(_regionIndex)) {
+        auto frameItr = std::lower_bound(region->frames.begin(), region->frames.end(), offset,
+            [](const PointerFrameHeader& a, Frame::Time b)->bool {
+                return a.timeOffset < b;
+            }
+        );
+        _frameIndex = frameItr - region->frames.begin();
+    }
+}
+
+Frame::Time PointerClip::positionFrameTime() const {
+    Locker lock(_mutex);
+    Frame::Time result = Frame::INVALID_TIME;
+    if (auto header = currentFrame()) {
+        result = header->timeOffset;
+    }
+    return result;
+}
+
+FrameConstPointer PointerClip::peekFrame() const {
+    Locker lock(_mutex);
+    FrameConstPointer result;
+    if (auto header = currentFrame()) {
+        result = readFrame(*header);
     }
     return result;
 }
 
+FrameConstPointer PointerClip::nextFrame() {
+    Locker lock(_mutex);
+    FrameConstPointer result;
+    if (auto header = currentFrame()) {
+        result = readFrame(*header);
+        ++_frameIndex;
+    }
+    return result;
+}
+
+void PointerClip::skipFrame() {
+    Locker lock(_mutex);
+    if (currentFrame()) {
+        ++_frameIndex;
+    }
+}
+
 void PointerClip::addFrame(FrameConstPointer) {
     throw std::runtime_error("Pointer clips are read only, use duplicate to create a read/write clip");
 }
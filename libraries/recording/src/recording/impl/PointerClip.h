@@ -10,13 +10,16 @@
 #ifndef hifi_Recording_Impl_PointerClip_h
 #define hifi_Recording_Impl_PointerClip_h
 
-#include "ArrayClip.h"
+#include "../Clip.h"
 
 #include <mutex>
+#include <vector>
 
 #include <QtCore/QJsonDocument>
+#include <QtCore/QMap>
 
 #include "../Frame.h"
+#include "ClipIndex.h"
 
 namespace recording {
 
@@ -29,7 +32,12 @@ struct PointerFrameHeader : public FrameHeader {
 
 using PointerFrameHeaderList = std::list<PointerFrameHeader>;
 
-class PointerClip : public ArrayClip<PointerFrameHeader> {
+// A read only clip over a block of memory, usually a mapped file.
+//
+// The frame headers are kept in regions.  A clip with a ClipIndex at the end only reads its directory on open and
+// reads each region the first time it is needed, so opening and seeking don't depend on the length of the clip.
+// Older clips are parsed in full on open into one region.
+class PointerClip : public Clip {
 public:
     using Pointer = std::shared_ptr<PointerClip>;
 
@@ -37,20 +45,63 @@ public:
     PointerClip(uchar* data, size_t size) { init(data, size); }
 
     void init(uchar* data, size_t size);
+
+    virtual Clip::Pointer duplicate() const override;
+    virtual float duration() const override;
+    virtual size_t frameCount() const override;
+
+    virtual void seekFrameTime(Frame::Time offset) override;
+    virtual Frame::Time positionFrameTime() const override;
+
+    virtual FrameConstPointer peekFrame() const override;
+    virtual FrameConstPointer nextFrame() override;
+    virtual void skipFrame() override;
     virtual void addFrame(FrameConstPointer) override;
+
     const QJsonDocument& getHeader() const {
         return _header;
     }
 
+    bool isIndexed() const { return _isIndexed; }
+
+    // number of frames of the given type, answered from the index's per type sub-indexes without loading any regions
+    size_t frameCount(FrameType type) const;
+
     // FIXME move to frame?
     static const qint64 MINIMUM_FRAME_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
 protected:
+    struct Region {
+        Frame::Time firstTime { 0 };
+        Frame::Time lastTime { 0 };
+        ClipIndex::Region location;
+        bool isLoaded { false };
+        std::vector<PointerFrameHeader> frames;
+    };
+
     void reset() override;
-    virtual FrameConstPointer readFrame(size_t index) const override;
+    FrameConstPointer readFrame(const PointerFrameHeader& header) const;
+
+    // the region a frame is in, loading it if needed.  Returns nullptr if the region can't be read.
+    const Region* getRegion(size_t regionIndex) const;
+
+    // moves the play position past the end of empty regions, returns the header of the frame it's at, if any.
+    const PointerFrameHeader* currentFrame() const;
+
     QJsonDocument _header;
+    QMap<FrameType, FrameType> _translationMap;
     uchar* _data { nullptr };
     size_t _size { 0 };
     bool _compressed { true };
+
+    bool _isIndexed { false };
+    ClipIndex::Trailer _trailer;
+    std::vector<ClipIndex::TypeIndex> _types;
+    mutable std::vector<Region> _regions;
+    size_t _frameCount { 0 };
+    Frame::Time _lastTime { 0 };
+
+    mutable size_t _regionIndex { 0 };
+    mutable size_t _frameIndex { 0 };
 };
 
 }
@@ -45,6 +45,14 @@ bool CullTest::frustumTest(const AABox& bound) {
     return true;
 }
 
+bool CullTest::frustumTest(const uint64_t* frustumMasks, size_t index) {
+    if (!(frustumMasks[index / 64] & ((uint64_t)1 << (index % 64)))) {
+        _renderDetails._outOfView++;
+        return false;
+    }
+    return true;
+}
+
 bool CullTest::antiFrustumTest(const AABox& bound) {
     assert(_antiFrustum);
     if (_antiFrustum->boxInsideFrustum(bound)) {
@@ -344,6 +352,7 @@ void CullShapeBounds::run(const RenderContextPointer& renderContext, const Input
         auto& details = args->_details.edit(_detailType);
         CullTest test(_cullFunctor, args, details, antiFrustum);
         auto scene = args->_scene;
+        std::vector<uint64_t> frustumMasks;
 
         for (auto& inItems : inShapes) {
             auto key = inItems.first;
@@ -355,9 +364,17 @@ void CullShapeBounds::run(const RenderContextPointer& renderContext, const Input
 
             details._considered += (int)inItems.second.size();
 
+            // frustum test the whole bucket at once
+            const auto& items = inItems.second;
+            frustumMasks.resize((items.size() + 63) / 64);
+            if (!items.empty()) {
+                args->getViewFrustum().boxesIntersectFrustum(&items[0].bound, (int)items.size(), frustumMasks.data(), sizeof(ItemBound));
+            }
+
             if (antiFrustum == nullptr) {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound)) {
+                for (size_t i = 0; i < items.size(); i++) {
+                    const auto& item = items[i];
+                    if (test.solidAngleTest(item.bound) && test.frustumTest(frustumMasks.data(), i)) {
                         const auto shapeKey = scene->getItem(item.id).getKey();
                         if (cullFilter.test(shapeKey)) {
                             outItems->second.emplace_back(item);
@@ -368,8 +385,9 @@ void CullShapeBounds::run(const RenderContextPointer& renderContext, const Input
                     }
                 }
             } else {
-                for (auto& item : inItems.second) {
-                    if (test.solidAngleTest(item.bound) && test.frustumTest(item.bound) && test.antiFrustumTest(item.bound)) {
+                for (size_t i = 0; i < items.size(); i++) {
+                    const auto& item = items[i];
+                    if (test.solidAngleTest(item.bound) && test.frustumTest(frustumMasks.data(), i) && test.antiFrustumTest(item.bound)) {
                         const auto shapeKey = scene->getItem(item.id).getKey();
                         if (cullFilter.test(shapeKey)) {
                             outItems->second.emplace_back(item);
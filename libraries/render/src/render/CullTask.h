@@ -31,6 +31,8 @@ namespace render {
         CullTest(CullFunctor& functor, RenderArgs* pargs, RenderDetails::Item& renderDetails, ViewFrustumPointer antiFrustum = nullptr);
 
         bool frustumTest(const AABox& bound);
+        // for a bound already tested with ViewFrustum::boxesIntersectFrustum()
+        bool frustumTest(const uint64_t* frustumMasks, size_t index);
         bool antiFrustumTest(const AABox& bound);
         bool solidAngleTest(const AABox& bound);
         bool zoneOcclusionTest(const render::Item& item);
@@ -12,6 +12,7 @@
 
 #include <numeric>
 #include <gpu/Batch.h>
+#include <TBBHelpers.h>
 #include "Logging.h"
 #include "TransitionStage.h"
 #include "HighlightStage.h"
@@ -189,6 +190,12 @@ Scene::Scene(glm::vec3 origin, float size) :
 
 Scene::~Scene() {
     qCDebug(renderlogging) << "Scene::~Scene()";
+    auto queued = _transactionQueue.exchange(nullptr);
+    while (queued) {
+        auto next = queued->next;
+        delete queued;
+        queued = next;
+    }
 }
 
 ItemID Scene::allocateID() {
@@ -202,28 +209,40 @@ bool Scene::isAllocatedID(const ItemID& id) const {
 
 /// Enqueue change batch to the scene
 void Scene::enqueueTransaction(const Transaction& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(transaction);
+    pushTransaction(new QueuedTransaction { transaction, nullptr });
 }
 
 void Scene::enqueueTransaction(Transaction&& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(std::move(transaction));
+    pushTransaction(new QueuedTransaction { std::move(transaction), nullptr });
+}
+
+void Scene::pushTransaction(QueuedTransaction* queued) {
+    // the producers never wait on each other nor on enqueueFrame(), which only ever swaps the whole list out
+    queued->next = _transactionQueue.load(std::memory_order_relaxed);
+    while (!_transactionQueue.compare_exchange_weak(queued->next, queued, std::memory_order_release, std::memory_order_relaxed)) {
+    }
 }
 
 uint32_t Scene::enqueueFrame() {
     PROFILE_RANGE(render, __FUNCTION__);
-    TransactionQueue localTransactionQueue;
-    {
-        std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-        localTransactionQueue.swap(_transactionQueue);
+    QueuedTransaction* queued = _transactionQueue.exchange(nullptr, std::memory_order_acquire);
+
+    // the list is newest first, the frame needs the transactions in the order they were queued
+    size_t numTransactions = 0;
+    for (auto node = queued; node; node = node->next) {
+        ++numTransactions;
+    }
+    TransactionQueue frame(numTransactions);
+    while (queued) {
+        frame[--numTransactions] = std::move(queued->transaction);
+        auto next = queued->next;
+        delete queued;
+        queued = next;
     }
 
-    Transaction consolidatedTransaction;
-    consolidatedTransaction.merge(std::move(localTransactionQueue));
     {
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        _transactionFrames.push_back(consolidatedTransaction);
+        _transactionFrames.push_back(std::move(frame));
     }
 
     return ++_transactionFrameNumber;
@@ -248,7 +267,9 @@ void Scene::processTransactionQueue() {
     queuedFrames.clear();
 }
 
-void Scene::processTransactionFrame(const Transaction& transaction) {
+// Each kind of change is applied for all the transactions of the frame before the next kind, in the order they were
+// queued, as if they had been merged into one transaction.
+void Scene::processTransactionFrame(const TransactionQueue& transactions) {
     PROFILE_RANGE(render, __FUNCTION__);
     {
         std::unique_lock<std::mutex> lock(_itemsMutex);
@@ -262,32 +283,58 @@ void Scene::processTransactionFrame(const Transaction& transaction) {
         // capture anything coming from the transaction
 
         // resets and potential NEW items
-        resetItems(transaction._resetItems);
+        for (const auto& transaction : transactions) {
+            resetItems(transaction._resetItems);
+        }
 
         // Update the numItemsAtomic counter AFTER the reset changes went through
         _numAllocatedItems.exchange(maxID);
 
         // updates
-        updateItems(transaction._updatedItems);
+        if (_parallelItemUpdates) {
+            updateItemsInParallel(transactions);
+        } else {
+            for (const auto& transaction : transactions) {
+                updateItems(transaction._updatedItems);
+            }
+        }
 
         // removes
-        removeItems(transaction._removedItems);
+        for (const auto& transaction : transactions) {
+            removeItems(transaction._removedItems);
+        }
 
         // add transitions
-        resetTransitionItems(transaction._resetTransitions);
-        removeTransitionItems(transaction._removeTransitions);
-        queryTransitionItems(transaction._queriedTransitions);
-        resetTransitionFinishedOperator(transaction._transitionFinishedOperators);
+        for (const auto& transaction : transactions) {
+            resetTransitionItems(transaction._resetTransitions);
+        }
+        for (const auto& transaction : transactions) {
+            removeTransitionItems(transaction._removeTransitions);
+        }
+        for (const auto& transaction : transactions) {
+            queryTransitionItems(transaction._queriedTransitions);
+        }
+        for (const auto& transaction : transactions) {
+            resetTransitionFinishedOperator(transaction._transitionFinishedOperators);
+        }
 
         // Update the numItemsAtomic counter AFTER the pending changes went through
         _numAllocatedItems.exchange(maxID);
     }
 
-    resetSelections(transaction._resetSelections);
+    for (const auto& transaction : transactions) {
+        resetSelections(transaction._resetSelections);
+    }
 
-    resetHighlights(transaction._highlightResets);
-    removeHighlights(transaction._highlightRemoves);
-    queryHighlights(transaction._highlightQueries);
+    for (const auto& transaction : transactions) {
+        resetHighlights(transaction._highlightResets);
+    }
+    for (const auto& transaction : transactions) {
+        removeHighlights(transaction._highlightRemoves);
+    }
+    for (const auto& transaction : transactions) {
+        queryHighlights(transaction._highlightQueries);
+    }
 }
 
 void Scene::resetItems(const Transaction::Resets& transactions) {
@@ -356,27 +403,85 @@ void Scene::updateItems(const Transaction::Updates& transactions) {
 
         // Update the item
         item.update(std::get<1>(update));
-        auto newKey = item.getKey();
 
-        // Update the item's container
-        if (oldKey.isSpatial() == newKey.isSpatial()) {
-            if (newKey.isSpatial()) {
-                auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(nullptr), updateID, newKey);
-                item.resetCell(newCell, newKey.isSmall());
+        updateItemContainer(updateID, item, oldKey, oldCell);
+    }
+}
+
+void Scene::updateItemsInParallel(const TransactionQueue& transactions) {
+    // gather the updates of the frame and sort them by item, keeping the order of the ones for the same item
+    std::vector<const Transaction::Update*> updates;
+    for (const auto& transaction : transactions) {
+        for (const auto& update : transaction._updatedItems) {
+            auto updateID = std::get<0>(update);
+            if (updateID != Item::INVALID_ITEM_ID && _items[updateID].exist()) {
+                updates.push_back(&update);
             }
+        }
+    }
+    if (updates.empty()) {
+        return;
+    }
+    std::stable_sort(updates.begin(), updates.end(), [](const Transaction::Update* a, const Transaction::Update* b) {
+        return std::get<0>(*a) < std::get<0>(*b);
+    });
+
+    struct ItemUpdates {
+        size_t begin;
+        size_t end;
+        ItemKey oldKey;
+        ItemCell oldCell;
+    };
+    std::vector<ItemUpdates> itemUpdates;
+    for (size_t i = 0; i < updates.size(); i++) {
+        if (i == 0 || std::get<0>(*updates[i]) != std::get<0>(*updates[i - 1])) {
+            itemUpdates.push_back({ i, i + 1, ItemKey(), Item::INVALID_CELL });
         } else {
-            if (newKey.isSpatial()) {
-                _masterNonspatialSet.erase(updateID);
-
-                auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(nullptr), updateID, newKey);
-                item.resetCell(newCell, newKey.isSmall());
-            } else {
-                _masterSpatialTree.removeItem(oldCell, oldKey, updateID);
-                item.resetCell();
+            itemUpdates.back().end = i + 1;
+        }
+    }
 
-                _masterNonspatialSet.insert(updateID);
+    // every item is touched by one task only, so the functors run without locking
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, itemUpdates.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); i++) {
+            auto& group = itemUpdates[i];
+            auto& item = _items[std::get<0>(*updates[group.begin])];
+            group.oldKey = item.getKey();
+            group.oldCell = item.getCell();
+            for (size_t j = group.begin; j < group.end; j++) {
+                item.update(std::get<1>(*updates[j]));
             }
         }
+    });
+
+    // the spatial tree and the nonspatial set are shared, they are brought up to date afterwards, once per item
+    for (const auto& group : itemUpdates) {
+        auto updateID = std::get<0>(*updates[group.begin]);
+        updateItemContainer(updateID, _items[updateID], group.oldKey, group.oldCell);
+    }
+}
+
+void Scene::updateItemContainer(ItemID id, Item& item, const ItemKey& oldKey, ItemCell oldCell) {
+    auto newKey = item.getKey();
+
+    // Update the item's container
+    if (oldKey.isSpatial() == newKey.isSpatial()) {
+        if (newKey.isSpatial()) {
+            auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(nullptr), id, newKey);
+            item.resetCell(newCell, newKey.isSmall());
+        }
+    } else {
+        if (newKey.isSpatial()) {
+            _masterNonspatialSet.erase(id);
+
+            auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(nullptr), id, newKey);
+            item.resetCell(newCell, newKey.isSmall());
+        } else {
+            _masterSpatialTree.removeItem(oldCell, oldKey, id);
+            item.resetCell();
+
+            _masterNonspatialSet.insert(id);
+        }
     }
 }
 
@@ -44,6 +44,10 @@ public:
     typedef std::function<void(HighlightStyle const*)> SelectionHighlightQueryFunc;
 
     Transaction() {}
+    Transaction(const Transaction& other) = default;
+    Transaction(Transaction&& other) = default;
+    Transaction& operator=(const Transaction& other) = default;
+    Transaction& operator=(Transaction&& other) = default;
     ~Transaction() {}
 
     // Item transactions
@@ -158,6 +162,11 @@ public:
     // Process the pending transactions queued
     void processTransactionQueue();
 
+    // Apply the update functors of different items on the TBB pool, the functors of one item still run in order.
+    // Only for scenes whose functors don't touch anything shared with other items, off by default.
+    void setParallelItemUpdates(bool parallel) { _parallelItemUpdates = parallel; }
+    bool getParallelItemUpdates() const { return _parallelItemUpdates; }
+
     // Access a particular selection (empty if doesn't exist)
     // Thread safe
     Selection getSelection(const Selection::Name& name) const;
@@ -199,17 +208,24 @@ protected:
     // Thread safe elements that can be accessed from anywhere
     std::atomic<unsigned int> _IDAllocator{ 1 }; // first valid itemID will be One
     std::atomic<unsigned int> _numAllocatedItems{ 1 }; // num of allocated items, matching the _items.size()
-    std::mutex _transactionQueueMutex;
-    TransactionQueue _transactionQueue;
 
-    
+    // Transactions are pushed on a lock free list from any thread, newest first, and enqueueFrame() takes the whole
+    // list at once
+    struct QueuedTransaction {
+        Transaction transaction;
+        QueuedTransaction* next { nullptr };
+    };
+    std::atomic<QueuedTransaction*> _transactionQueue { nullptr };
+    void pushTransaction(QueuedTransaction* queued);
+
+    // A frame keeps its transactions as they were queued rather than merging them into one
     std::mutex _transactionFramesMutex;
-    using TransactionFrames = std::vector<Transaction>;
+    using TransactionFrames = std::vector<TransactionQueue>;
     TransactionFrames _transactionFrames;
     uint32_t _transactionFrameNumber{ 0 };
 
     // Process one transaction frame 
-    void processTransactionFrame(const Transaction& transaction);
+    void processTransactionFrame(const TransactionQueue& transactions);
 
     // The actual database
     // database of items is protected for editing by a mutex
@@ -222,6 +238,9 @@ protected:
     void resetTransitionFinishedOperator(const Transaction::TransitionFinishedOperators& transactions);
     void removeItems(const Transaction::Removes& transactions);
     void updateItems(const Transaction::Updates& transactions);
+    void updateItemsInParallel(const TransactionQueue& transactions);
+    void updateItemContainer(ItemID id, Item& item, const ItemKey& oldKey, ItemCell oldCell);
+    bool _parallelItemUpdates { false };
 
     void resetTransitionItems(const Transaction::TransitionResets& transactions);
     void removeTransitionItems(const Transaction::TransitionRemoves& transactions);
@@ -10,6 +10,7 @@
 //
 #include "SpatialTree.h"
 
+#include <TBBHelpers.h>
 #include <ViewFrustum.h>
 
 using namespace render;
@@ -596,41 +597,275 @@ int Octree::selectCellBrick(Index cellID, CellSelection& selection, bool inside)
     return (int) selection.size() - numSelectedsIn;
 }
 
-int ItemSpatialTree::selectCells(CellSelection& selection, const ViewFrustum& frustum, float threshold) const {
+// below this many cells the threads cost more than they save
+static const int MIN_CELLS_FOR_PARALLEL_SELECT = 4096;
+
+Octree::FrustumPlanes::FrustumPlanes(const Coord4f frustum[6]) {
+    for (int p = 0; p < 8; p++) {
+        // the padding planes face every direction at once, nothing is behind them
+        Coord4f plane = p < ViewFrustum::NUM_PLANES ? frustum[p] : Coord4f(0.0f, 0.0f, 0.0f, 1.0f);
+        nx[p] = plane.x;
+        ny[p] = plane.y;
+        nz[p] = plane.z;
+        d[p] = plane.w;
+        // the same corners Location::intersectCell() picks with normalToIndex()
+        farX[p] = plane.x >= 0.0f ? 1.0f : 0.0f;
+        farY[p] = plane.y >= 0.0f ? 1.0f : 0.0f;
+        farZ[p] = plane.z >= 0.0f ? 1.0f : 0.0f;
+        nearX[p] = -plane.x >= 0.0f ? 1.0f : 0.0f;
+        nearY[p] = -plane.y >= 0.0f ? 1.0f : 0.0f;
+        nearZ[p] = -plane.z >= 0.0f ? 1.0f : 0.0f;
+    }
+}
+
+// The corners and the dot products are evaluated in the same order as Location::intersectCell() and glm::dot()
+// do, so both agree on cells that touch a plane.
+Octree::Location::Intersection Octree::intersectCell(const Location& cell, const FrustumPlanes& planes) {
+    Coord3f cellSize = Coord3f(Octree::getInvDepthDimension(cell.depth));
+    Coord3f cellPos = Coord3f(cell.pos) * cellSize;
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    const __m128 zero = _mm_setzero_ps();
+    __m128 size = _mm_set1_ps(cellSize.x);
+    __m128 x = _mm_set1_ps(cellPos.x);
+    __m128 y = _mm_set1_ps(cellPos.y);
+    __m128 z = _mm_set1_ps(cellPos.z);
+    __m128 outside = zero;
+    __m128 partial = zero;
+    for (int p = 0; p < 8; p += 4) {
+        __m128 nx = _mm_loadu_ps(planes.nx + p);
+        __m128 ny = _mm_loadu_ps(planes.ny + p);
+        __m128 nz = _mm_loadu_ps(planes.nz + p);
+        __m128 d = _mm_loadu_ps(planes.d + p);
+
+        __m128 farX = _mm_add_ps(x, _mm_mul_ps(size, _mm_loadu_ps(planes.farX + p)));
+        __m128 farY = _mm_add_ps(y, _mm_mul_ps(size, _mm_loadu_ps(planes.farY + p)));
+        __m128 farZ = _mm_add_ps(z, _mm_mul_ps(size, _mm_loadu_ps(planes.farZ + p)));
+        __m128 farDot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, farX), _mm_mul_ps(ny, farY)),
+                                   _mm_add_ps(_mm_mul_ps(nz, farZ), d));
+        outside = _mm_or_ps(outside, _mm_cmpnge_ps(farDot, zero));
+
+        __m128 nearX = _mm_add_ps(x, _mm_mul_ps(size, _mm_loadu_ps(planes.nearX + p)));
+        __m128 nearY = _mm_add_ps(y, _mm_mul_ps(size, _mm_loadu_ps(planes.nearY + p)));
+        __m128 nearZ = _mm_add_ps(z, _mm_mul_ps(size, _mm_loadu_ps(planes.nearZ + p)));
+        __m128 nearDot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nearX), _mm_mul_ps(ny, nearY)),
+                                    _mm_add_ps(_mm_mul_ps(nz, nearZ), d));
+        partial = _mm_or_ps(partial, _mm_cmpnge_ps(nearDot, zero));
+    }
+    if (_mm_movemask_ps(outside)) {
+        return Location::Outside;
+    }
+    return _mm_movemask_ps(partial) ? Location::Intersect : Location::Inside;
+#else
+    bool partialFlag = false;
+    for (int p = 0; p < ViewFrustum::NUM_PLANES; p++) {
+        Coord3f farPoint = cellPos + cellSize * Coord3f(planes.farX[p], planes.farY[p], planes.farZ[p]);
+        float farDot = (planes.nx[p] * farPoint.x + planes.ny[p] * farPoint.y) + (planes.nz[p] * farPoint.z + planes.d[p]);
+        if (!(farDot >= 0.0f)) {
+            return Location::Outside;
+        }
+        Coord3f nearPoint = cellPos + cellSize * Coord3f(planes.nearX[p], planes.nearY[p], planes.nearZ[p]);
+        float nearDot = (planes.nx[p] * nearPoint.x + planes.ny[p] * nearPoint.y) + (planes.nz[p] * nearPoint.z + planes.d[p]);
+        if (!(nearDot >= 0.0f)) {
+            partialFlag = true;
+        }
+    }
+    return partialFlag ? Location::Intersect : Location::Inside;
+#endif
+}
+
+int Octree::select(std::vector<CellSelection>& selections, const std::vector<const FrustumSelector*>& selectors) const {
+    const int numSelectors = (int)selectors.size();
+    assert(numSelectors <= MAX_NUM_SELECTORS);
+    assert((int)selections.size() == numSelectors);
+    if (numSelectors == 0) {
+        return 0;
+    }
+
+    int numSelectedsIn = 0;
+    for (const auto& selection : selections) {
+        numSelectedsIn += (int)selection.size();
+    }
+
+    std::vector<FrustumPlanes> planes;
+    planes.reserve(numSelectors);
+    for (auto selector : selectors) {
+        planes.emplace_back(selector->frustum);
+    }
+
+    // Always include the root cell partially containing potentially outer objects
+    Index cellID = ROOT_CELL;
+    auto cell = getConcreteCell(cellID);
+    for (auto& selection : selections) {
+        selectCellBrick(cellID, selection, false);
+    }
+
+    // then traverse deeper, starting out intersecting every frustum
+    uint32_t allMask = (numSelectors == MAX_NUM_SELECTORS) ? 0xFFFFFFFF : ((1U << numSelectors) - 1);
+    if (getNumAllocatedCells() < MIN_CELLS_FOR_PARALLEL_SELECT) {
+        for (int i = 0; i < NUM_OCTANTS; i++) {
+            Index subCellID = cell.child((Link)i);
+            if (subCellID != INVALID_CELL) {
+                selectTraverse(subCellID, allMask, 0, selectors, planes, selections);
+            }
+        }
+    } else {
+        // each octant selects into its own lists, which are appended in octant order so nothing moves
+        std::vector<CellSelection> octantSelections[NUM_OCTANTS];
+        tbb::parallel_for(0, (int)NUM_OCTANTS, [&](int i) {
+            Index subCellID = cell.child((Link)i);
+            if (subCellID != INVALID_CELL) {
+                octantSelections[i].resize(numSelectors);
+                selectTraverse(subCellID, allMask, 0, selectors, planes, octantSelections[i]);
+            }
+        });
+        for (int i = 0; i < NUM_OCTANTS; i++) {
+            for (int s = 0; s < (int)octantSelections[i].size(); s++) {
+                const CellSelection& from = octantSelections[i][s];
+                CellSelection& to = selections[s];
+                to.insideCells.insert(to.insideCells.end(), from.insideCells.begin(), from.insideCells.end());
+                to.insideBricks.insert(to.insideBricks.end(), from.insideBricks.begin(), from.insideBricks.end());
+                to.partialCells.insert(to.partialCells.end(), from.partialCells.begin(), from.partialCells.end());
+                to.partialBricks.insert(to.partialBricks.end(), from.partialBricks.begin(), from.partialBricks.end());
+            }
+        }
+    }
+
+    int numSelecteds = 0;
+    for (const auto& selection : selections) {
+        numSelecteds += (int)selection.size();
+    }
+    return numSelecteds - numSelectedsIn;
+}
+
+// The selectors whose frustum partially contains the cell's parent are in intersectMask, the ones that fully
+// contain it in insideMask.  For each selector this is selectTraverse() while it intersects and selectBranch() once
+// the cell is inside.
+void Octree::selectTraverse(Index cellID, uint32_t intersectMask, uint32_t insideMask,
+                            const std::vector<const FrustumSelector*>& selectors, const std::vector<FrustumPlanes>& planes,
+                            std::vector<CellSelection>& selections) const {
+    auto cell = getConcreteCell(cellID);
+    auto cellLocation = cell.getlocation();
+    auto cellCenter = cellLocation.getCenter();
+    float subcellWidth = Octree::getCoordSubcellWidth(cellLocation.depth);
+
+    uint32_t childIntersectMask = 0;
+    uint32_t childInsideMask = 0;
+    for (int s = 0; s < (int)selectors.size(); s++) {
+        uint32_t bit = 1U << s;
+        bool inside = (insideMask & bit) != 0;
+        if (!inside) {
+            if (!(intersectMask & bit)) {
+                continue;
+            }
+            auto intersection = intersectCell(cellLocation, planes[s]);
+            if (intersection == Location::Outside) {
+                continue;
+            }
+            inside = (intersection == Location::Inside);
+        }
+
+        // Test for lod
+        if (selectors[s]->testThreshold(cellCenter, subcellWidth) < 0.0f) {
+            continue;
+        }
+
+        selectCellBrick(cellID, selections[s], inside);
+        if (inside) {
+            childInsideMask |= bit;
+        } else {
+            childIntersectMask |= bit;
+        }
+    }
+
+    if (childIntersectMask | childInsideMask) {
+        for (int i = 0; i < NUM_OCTANTS; i++) {
+            Index subCellID = cell.child((Link)i);
+            if (subCellID != INVALID_CELL) {
+                selectTraverse(subCellID, childIntersectMask, childInsideMask, selectors, planes, selections);
+            }
+        }
+    }
+}
+
+std::unique_ptr<Octree::FrustumSelector> ItemSpatialTree::evalSelector(const ViewFrustum& frustum, float threshold) const {
     auto worldPlanes = frustum.getPlanes();
     if (frustum.isPerspective()) {
-        PerspectiveSelector selector;
+        auto selector = std::make_unique<PerspectiveSelector>();
         for (int i = 0; i < ViewFrustum::NUM_PLANES; i++) {
             ::Plane octPlane;
             octPlane.setNormalAndPoint(worldPlanes[i].getNormal(), evalCoordf(worldPlanes[i].getPoint(), ROOT_DEPTH));
-            selector.frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
+            selector->frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
         }
 
-        selector.eyePos = evalCoordf(frustum.getPosition(), ROOT_DEPTH);
-        selector.setAngle(threshold);
-
-        return Octree::select(selection, selector);
+        selector->eyePos = evalCoordf(frustum.getPosition(), ROOT_DEPTH);
+        selector->setAngle(threshold);
+        return selector;
     } else {
-        OrthographicSelector selector;
+        auto selector = std::make_unique<OrthographicSelector>();
         for (int i = 0; i < ViewFrustum::NUM_PLANES; i++) {
             ::Plane octPlane;
             octPlane.setNormalAndPoint(worldPlanes[i].getNormal(), evalCoordf(worldPlanes[i].getPoint(), ROOT_DEPTH));
-            selector.frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
+            selector->frustum[i] = Coord4f(octPlane.getNormal(), octPlane.getDCoefficient());
         }
 
         // Divide the threshold (which is in world distance units) by the dimension of the octree
         // as all further computations will be done in normalized octree units
         threshold *= getInvCellWidth(ROOT_DEPTH);
-        selector.setSize(threshold);
+        selector->setSize(threshold);
+        return selector;
+    }
+}
+
+int ItemSpatialTree::selectCells(CellSelection& selection, const ViewFrustum& frustum, float threshold) const {
+    auto selector = evalSelector(frustum, threshold);
+    std::vector<CellSelection> selections(1);
+    selections[0] = std::move(selection);
+    int numSelected = Octree::select(selections, { selector.get() });
+    selection = std::move(selections[0]);
+    return numSelected;
+}
 
-        return Octree::select(selection, selector);
+int ItemSpatialTree::selectCells(std::vector<CellSelection>& selections, const std::vector<ViewFrustum>& frustums,
+                                 const std::vector<float>& thresholds) const {
+    assert(frustums.size() == thresholds.size());
+    selections.resize(frustums.size());
+
+    std::vector<std::unique_ptr<FrustumSelector>> selectors;
+    std::vector<const FrustumSelector*> selectorPointers;
+    for (size_t i = 0; i < frustums.size(); i++) {
+        selectors.push_back(evalSelector(frustums[i], thresholds[i]));
+        selectorPointers.push_back(selectors.back().get());
     }
+    return Octree::select(selections, selectorPointers);
 }
 
 int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
                                      float threshold) const {
     selectCells(selection.cellSelection, frustum, threshold);
+    fetchCellItems(selection);
+    return (int) selection.numItems();
+}
+
+int ItemSpatialTree::selectCellItems(std::vector<ItemSelection>& selections, const ItemFilter& filter,
+                                     const std::vector<ViewFrustum>& frustums, const std::vector<float>& thresholds) const {
+    selections.resize(frustums.size());
+    std::vector<CellSelection> cellSelections(frustums.size());
+    for (size_t i = 0; i < frustums.size(); i++) {
+        cellSelections[i] = std::move(selections[i].cellSelection);
+    }
+    selectCells(cellSelections, frustums, thresholds);
 
+    int numItems = 0;
+    for (size_t i = 0; i < frustums.size(); i++) {
+        selections[i].cellSelection = std::move(cellSelections[i]);
+        fetchCellItems(selections[i]);
+        numItems += (int)selections[i].numItems();
+    }
+    return numItems;
+}
+
+void ItemSpatialTree::fetchCellItems(ItemSelection& selection) const {
     // Just grab the items in every selected bricks
     for (auto brickId : selection.cellSelection.insideBricks) {
         auto& brickItems = getConcreteBrick(brickId).items;
@@ -647,9 +882,4 @@ int ItemSpatialTree::selectCellItems(ItemSelection& selection, const ItemFilter&
         auto& brickSubcellItems = getConcreteBrick(brickId).subcellItems;
         selection.partialSubcellItems.insert(selection.partialSubcellItems.end(), brickSubcellItems.begin(), brickSubcellItems.end());
     }
-
-    return (int) selection.numItems();
 }
-
-
-
@@ -340,11 +340,32 @@ namespace render {
         int selectBranch(Index cellID, CellSelection& selection, const FrustumSelector& selector) const;
         int selectCellBrick(Index cellID, CellSelection& selection, bool inside) const;
 
+        // Select for several frustums in one traversal: each cell is tested against all of them at once, and the
+        // top level octants are traversed on separate threads when the tree is big enough.
+        // selections[i] gets the same cells, in the same order, as select(selections[i], *selectors[i]).
+        static const int MAX_NUM_SELECTORS { 32 };
+        int select(std::vector<CellSelection>& selections, const std::vector<const FrustumSelector*>& selectors) const;
+
 
         int getNumAllocatedCells() const { return (int)_cells.size(); }
         int getNumFreeCells() const { return (int)_freeCells.size(); }
             
     protected:
+        // The planes of a FrustumSelector laid out to be tested four at a time, padded to 8 with planes that pass
+        struct FrustumPlanes {
+            float nx[8], ny[8], nz[8], d[8];
+            float farX[8], farY[8], farZ[8]; // corner of a unit cell furthest along the normal
+            float nearX[8], nearY[8], nearZ[8]; // and nearest to it
+
+            FrustumPlanes(const Coord4f frustum[6]);
+        };
+        // same result as Location::intersectCell()
+        static Location::Intersection intersectCell(const Location& cell, const FrustumPlanes& planes);
+
+        void selectTraverse(Index cellID, uint32_t intersectMask, uint32_t insideMask,
+                            const std::vector<const FrustumSelector*>& selectors, const std::vector<FrustumPlanes>& planes,
+                            std::vector<CellSelection>& selections) const;
+
         Index allocateCell(Index parent, const Location& location);
         void freeCell(Index index);
 
@@ -449,6 +470,13 @@ namespace render {
         // Selection and traverse
         int selectCells(CellSelection& selection, const ViewFrustum& frustum, float threshold) const;
 
+        // Several views in one traversal, selections[i] is the same as selectCells() with frustums[i] and thresholds[i]
+        int selectCells(std::vector<CellSelection>& selections, const std::vector<ViewFrustum>& frustums,
+                        const std::vector<float>& thresholds) const;
+
+        // Eval the selector testing cells against a frustum, in the normalized coordinates of the tree
+        std::unique_ptr<FrustumSelector> evalSelector(const ViewFrustum& frustum, float threshold) const;
+
         class ItemSelection {
         public:
             CellSelection cellSelection;
@@ -475,6 +503,11 @@ namespace render {
 
         int selectCellItems(ItemSelection& selection, const ItemFilter& filter, const ViewFrustum& frustum, 
                             float threshold) const;
+        int selectCellItems(std::vector<ItemSelection>& selections, const ItemFilter& filter,
+                            const std::vector<ViewFrustum>& frustums, const std::vector<float>& thresholds) const;
+
+    private:
+        void fetchCellItems(ItemSelection& selection) const;
     };
 }
 
@@ -223,7 +223,6 @@ ScriptEngine::ScriptEngine(Context context, const QString& scriptContents, const
     BaseScriptEngine(),
     _context(context),
     _scriptContents(scriptContents),
-    _timerFunctionMap(),
     _fileNameString(fileNameString),
     _arrayBufferClass(new ArrayBufferClass(this)),
     _assetScriptingInterface(new AssetScriptingInterface(this))
@@ -254,6 +253,11 @@ ScriptEngine::ScriptEngine(Context context, const QString& scriptContents, const
         }
     }, Qt::DirectConnection);
 
+    _timerClock.start();
+    _timerWheelTimer.setSingleShot(true);
+    _timerWheelTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_timerWheelTimer, &QTimer::timeout, this, &ScriptEngine::timerFired);
+
     setProcessEventsInterval(MSECS_PER_SECOND);
     if (isEntityServerScript()) {
         qCDebug(scriptengine) << "isEntityServerScript() -- limiting maxRetries to 1";
@@ -1349,32 +1353,25 @@ void ScriptEngine::run() {
 // NOTE: This is private because it must be called on the same thread that created the timers, which is why
 // we want to only call it in our own run "shutdown" processing.
 void ScriptEngine::stopAllTimers() {
-    QMutableHashIterator<QTimer*, CallbackData> i(_timerFunctionMap);
-    int j {0};
-    while (i.hasNext()) {
-        i.next();
-        QTimer* timer = i.key();
-        qCDebug(scriptengine) << getFilename() << "stopAllTimers[" << j++ << "]";
-        stopTimer(timer);
+    if (!_timerFunctionMap.isEmpty()) {
+        qCDebug(scriptengine) << getFilename() << "stopAllTimers[" << _timerFunctionMap.size() << "]";
     }
+    _timerWheel.clear();
+    _timerFunctionMap.clear();
+    _timerWheelTimer.stop();
 }
 
 void ScriptEngine::stopAllTimersForEntityScript(const EntityItemID& entityID) {
-     // We could maintain a separate map of entityID => QTimer, but someone will have to prove to me that it's worth the complexity. -HRS
-    QVector<QTimer*> toDelete;
-    QMutableHashIterator<QTimer*, CallbackData> i(_timerFunctionMap);
-    while (i.hasNext()) {
-        i.next();
-        if (i.value().definingEntityIdentifier != entityID) {
-            continue;
+     // We could maintain a separate map of entityID => timer, but someone will have to prove to me that it's worth the complexity. -HRS
+    QVector<TimerWheel::TimerID> toDelete;
+    for (auto it = _timerFunctionMap.cbegin(); it != _timerFunctionMap.cend(); ++it) {
+        if (it.value().definingEntityIdentifier == entityID) {
+            toDelete << it.key(); // don't delete while we're iterating. save it.
         }
-        QTimer* timer = i.key();
-        toDelete << timer; // don't delete while we're iterating. save it.
     }
-    for (auto timer:toDelete) { // now reap 'em
-        stopTimer(timer);
+    for (auto timerID : toDelete) { // now reap 'em
+        stopTimer(timerID);
     }
-
 }
 
 void ScriptEngine::stop(bool marshal) {
@@ -1436,79 +1433,78 @@ void ScriptEngine::timerFired() {
         }
     }
 
-    QTimer* callingTimer = reinterpret_cast<QTimer*>(sender());
-    CallbackData timerData = _timerFunctionMap.value(callingTimer);
+    // fire everything that is due, in deadline order; callbacks may set or clear timers, including their own
+    _timerWheel.advance(_timerClock.elapsed(), [this](TimerWheel::TimerID timerID, bool isRepeating) {
+        // a single shot timer is done, we can forget it
+        CallbackData timerData = isRepeating ? _timerFunctionMap.value(timerID) : _timerFunctionMap.take(timerID);
 
-    if (!callingTimer->isActive()) {
-        // this timer is done, we can kill it
-        _timerFunctionMap.remove(callingTimer);
-        delete callingTimer;
-    }
+        // call the associated JS function, if it exists
+        if (timerData.function.isValid()) {
+            PROFILE_RANGE(script, "timerFired");
+            auto preTimer = p_high_resolution_clock::now();
+            callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
+            auto postTimer = p_high_resolution_clock::now();
+            auto elapsed = (postTimer - preTimer);
+            _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+        } else {
+            qCWarning(scriptengine) << "timerFired -- invalid function" << timerData.function.toVariant().toString();
+        }
+    });
 
-    // call the associated JS function, if it exists
-    if (timerData.function.isValid()) {
-        PROFILE_RANGE(script, __FUNCTION__);
-        auto preTimer = p_high_resolution_clock::now();
-        callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
-        auto postTimer = p_high_resolution_clock::now();
-        auto elapsed = (postTimer - preTimer);
-        _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-    } else {
-        qCWarning(scriptengine) << "timerFired -- invalid function" << timerData.function.toVariant().toString();
-    }
+    scheduleTimerWheelWakeup();
 }
 
-QObject* ScriptEngine::setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot) {
-    // create the timer, add it to the map, and start it
-    QTimer* newTimer = new QTimer(this);
-    newTimer->setSingleShot(isSingleShot);
-
-    // The default timer type is not very accurate below about 200ms http://doc.qt.io/qt-5/qt.html#TimerType-enum
-    static const int MIN_TIMEOUT_FOR_COARSE_TIMER = 200;
-    if (intervalMS < MIN_TIMEOUT_FOR_COARSE_TIMER) {
-        newTimer->setTimerType(Qt::PreciseTimer);
+void ScriptEngine::scheduleTimerWheelWakeup() {
+    auto wakeup = _timerWheel.getNextWakeup();
+    if (wakeup < 0) {
+        _timerWheelTimer.stop();
+        return;
     }
 
-    connect(newTimer, &QTimer::timeout, this, &ScriptEngine::timerFired);
-
-    // make sure the timer stops when the script does
-    connect(this, &ScriptEngine::scriptEnding, newTimer, &QTimer::stop);
+    // only re-arm for an earlier wakeup, so setting thousands of timers doesn't restart the QTimer for each one
+    if (_timerWheelTimer.isActive() && wakeup >= _timerWheelWakeup) {
+        return;
+    }
+    _timerWheelWakeup = wakeup;
+    _timerWheelTimer.start((int)std::max<qint64>(0, wakeup - _timerClock.elapsed()));
+}
 
+QScriptValue ScriptEngine::setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot) {
+    // add the timer to the wheel and the map, and make sure we wake up in time for it
+    auto timerID = _timerWheel.add(_timerClock.elapsed(), (quint32)std::max(intervalMS, 0), !isSingleShot);
 
     CallbackData timerData = { function, currentEntityIdentifier, currentSandboxURL };
-    _timerFunctionMap.insert(newTimer, timerData);
+    _timerFunctionMap.insert(timerID, timerData);
 
-    newTimer->start(intervalMS);
-    return newTimer;
+    scheduleTimerWheelWakeup();
+    return QScriptValue(timerID);
 }
 
-QObject* ScriptEngine::setInterval(const QScriptValue& function, int intervalMS) {
+QScriptValue ScriptEngine::setInterval(const QScriptValue& function, int intervalMS) {
     QSharedPointer<ScriptEngines> scriptEngines(_scriptEngines);
     if (!scriptEngines || scriptEngines->isStopped()) {
         scriptWarningMessage("Script.setInterval() while shutting down is ignored... parent script:" + getFilename());
-        return NULL; // bail early
+        return QScriptValue(QScriptValue::NullValue); // bail early
     }
 
     return setupTimerWithInterval(function, intervalMS, false);
 }
 
-QObject* ScriptEngine::setTimeout(const QScriptValue& function, int timeoutMS) {
+QScriptValue ScriptEngine::setTimeout(const QScriptValue& function, int timeoutMS) {
     QSharedPointer<ScriptEngines> scriptEngines(_scriptEngines);
     if (!scriptEngines || scriptEngines->isStopped()) {
         scriptWarningMessage("Script.setTimeout() while shutting down is ignored... parent script:" + getFilename());
-        return NULL; // bail early
+        return QScriptValue(QScriptValue::NullValue); // bail early
     }
 
     return setupTimerWithInterval(function, timeoutMS, true);
 }
 
-void ScriptEngine::stopTimer(QTimer *timer) {
-    if (_timerFunctionMap.contains(timer)) {
-        timer->stop();
-        _timerFunctionMap.remove(timer);
-        delete timer;
-    } else {
-        qCDebug(scriptengine) << "stopTimer -- not in _timerFunctionMap" << timer;
+void ScriptEngine::stopTimer(TimerWheel::TimerID timerID) {
+    if (_timerFunctionMap.remove(timerID) > 0) {
+        _timerWheel.remove(timerID);
+    } else if (timerID != TimerWheel::INVALID_TIMER_ID) {
+        qCDebug(scriptengine) << "stopTimer -- not in _timerFunctionMap" << timerID;
     }
 }
 
@@ -2676,6 +2672,10 @@ void ScriptEngine::doWithEnvironment(const EntityItemID& entityID, const QUrl& s
     currentEntityIdentifier = entityID;
     currentSandboxURL = sandboxURL;
 
+    // only time the outermost call, so a script calling into another entity's script is charged for both
+    bool isTimed = _isEntityScriptTimingEnabled && !entityID.isNull() && oldIdentifier.isNull();
+    quint64 startUsecs = isTimed ? usecTimestampNow() : 0;
+
 #if DEBUG_CURRENT_ENTITY
     QScriptValue oldData = this->globalObject().property("debugEntityID");
     this->globalObject().setProperty("debugEntityID", entityID.toScriptValue(this)); // Make the entityID available to javascript as a global.
@@ -2687,6 +2687,21 @@ void ScriptEngine::doWithEnvironment(const EntityItemID& entityID, const QUrl& s
     maybeEmitUncaughtException(!entityID.isNull() ? entityID.toString() : __FUNCTION__);
     currentEntityIdentifier = oldIdentifier;
     currentSandboxURL = oldSandboxURL;
+
+    if (isTimed) {
+        auto elapsedUsecs = usecTimestampNow() - startUsecs;
+        QMutexLocker locker { &_entityScriptTimingsMutex };
+        auto& timing = _entityScriptTimings[entityID];
+        timing.usecs += elapsedUsecs;
+        ++timing.calls;
+    }
+}
+
+EntityScriptTimings ScriptEngine::takeEntityScriptTimings() {
+    EntityScriptTimings timings;
+    QMutexLocker locker { &_entityScriptTimingsMutex };
+    std::swap(timings, _entityScriptTimings);
+    return timings;
 }
 
 void ScriptEngine::callWithEnvironment(const EntityItemID& entityID, const QUrl& sandboxURL, QScriptValue function, QScriptValue thisObject, QScriptValueList args) {
@@ -19,9 +19,12 @@
 #include <unordered_map>
 #include <vector>
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QUrl>
 #include <QtCore/QSet>
+#include <QtCore/QTimer>
 #include <QtCore/QWaitCondition>
 #include <QtCore/QStringList>
 #include <QMap>
@@ -37,6 +40,7 @@
 #include <EntityItemID.h>
 #include <EntitiesScriptEngineProvider.h>
 #include <EntityScriptUtils.h>
+#include <TimerWheel.h>
 
 #include "PointerEvent.h"
 #include "ArrayBufferClass.h"
@@ -91,6 +95,13 @@ typedef std::unordered_map<EntityItemID, EntityScriptContentAvailable> EntityScr
 typedef QList<CallbackData> CallbackList;
 typedef QHash<QString, CallbackList> RegisteredEventHandlers;
 
+// Time spent running one entity script's code (its methods, timers and event handlers) on its engine's thread.
+struct EntityScriptTiming {
+    quint64 usecs { 0 };
+    quint32 calls { 0 };
+};
+using EntityScriptTimings = QHash<EntityItemID, EntityScriptTiming>;
+
 class EntityScriptDetails {
 public:
     EntityScriptStatus status { EntityScriptStatus::PENDING };
@@ -470,31 +481,31 @@ public:
      * @function Script.setInterval
      * @param {function} function - The function to call. This can be either the name of a function or an in-line definition.
      * @param {number} interval - The interval at which to call the function, in ms.
-     * @returns {object} A handle to the interval timer. This can be used in {@link Script.clearInterval}.
+     * @returns {number} A handle to the interval timer. This can be used in {@link Script.clearInterval}.
      * @example <caption>Print a message every second.</caption>
      * Script.setInterval(function () {
      *     print("Interval timer fired");
      * }, 1000);
     */
-    Q_INVOKABLE QObject* setInterval(const QScriptValue& function, int intervalMS);
+    Q_INVOKABLE QScriptValue setInterval(const QScriptValue& function, int intervalMS);
 
     /*@jsdoc
      * Calls a function once, after a delay.
      * @function Script.setTimeout
      * @param {function} function - The function to call. This can be either the name of a function or an in-line definition.
      * @param {number} timeout - The delay after which to call the function, in ms.
-     * @returns {object} A handle to the timeout timer. This can be used in {@link Script.clearTimeout}.
+     * @returns {number} A handle to the timeout timer. This can be used in {@link Script.clearTimeout}.
      * @example <caption>Print a message once, after a second.</caption>
      * Script.setTimeout(function () {
      *     print("Timeout timer fired");
      * }, 1000);
      */
-    Q_INVOKABLE QObject* setTimeout(const QScriptValue& function, int timeoutMS);
+    Q_INVOKABLE QScriptValue setTimeout(const QScriptValue& function, int timeoutMS);
 
     /*@jsdoc
      * Stops an interval timer set by {@link Script.setInterval|setInterval}.
      * @function Script.clearInterval
-     * @param {object} timer - The interval timer to stop.
+     * @param {number} timer - The interval timer to stop.
      * @example <caption>Stop an interval timer.</caption>
      * // Print a message every second.
      * var timer = Script.setInterval(function () {
@@ -507,12 +518,12 @@ public:
      *     Script.clearInterval(timer);
      * }, 10000);
      */
-    Q_INVOKABLE void clearInterval(QObject* timer) { stopTimer(reinterpret_cast<QTimer*>(timer)); }
+    Q_INVOKABLE void clearInterval(const QScriptValue& timer) { stopTimer(timer.toUInt32()); }
 
     /*@jsdoc
      * Stops a timeout timer set by {@link Script.setTimeout|setTimeout}.
      * @function Script.clearTimeout
-     * @param {object} timer - The timeout timer to stop.
+     * @param {number} timer - The timeout timer to stop.
      * @example <caption>Stop a timeout timer.</caption>
      * // Print a message after two seconds.
      * var timer = Script.setTimeout(function () {
@@ -522,7 +533,7 @@ public:
      * // Uncomment the following line to stop the timer from firing.
      * //Script.clearTimeout(timer);
      */
-    Q_INVOKABLE void clearTimeout(QObject* timer) { stopTimer(reinterpret_cast<QTimer*>(timer)); }
+    Q_INVOKABLE void clearTimeout(const QScriptValue& timer) { stopTimer(timer.toUInt32()); }
 
     /*@jsdoc
      * Prints a message to the program log and emits {@link Script.printedMessage}.
@@ -692,6 +703,12 @@ public:
     bool getEntityScriptDetails(const EntityItemID& entityID, EntityScriptDetails &details) const;
     bool hasEntityScriptDetails(const EntityItemID& entityID) const;
 
+    /// When enabled, every outermost call into an entity script is timed and charged to that entity.
+    void setEntityScriptTimingEnabled(bool enabled) { _isEntityScriptTimingEnabled = enabled; }
+
+    /// Returns the time accumulated per entity script since the previous call, and starts a new period.
+    EntityScriptTimings takeEntityScriptTimings();
+
     void setScriptEngines(QSharedPointer<ScriptEngines>& scriptEngines) { _scriptEngines = scriptEngines; }
 
     /*@jsdoc
@@ -942,8 +959,9 @@ protected:
     void setEntityScriptDetails(const EntityItemID& entityID, const EntityScriptDetails& details);
     void setParentURL(const QString& parentURL) { _parentURL = parentURL; }
 
-    QObject* setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot);
-    void stopTimer(QTimer* timer);
+    QScriptValue setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot);
+    void stopTimer(TimerWheel::TimerID timerID);
+    void scheduleTimerWheelWakeup();
 
     QHash<EntityItemID, RegisteredEventHandlers> _registeredHandlers;
     void forwardHandlerCall(const EntityItemID& entityID, const QString& eventName, QScriptValueList eventHanderArgs);
@@ -973,10 +991,22 @@ protected:
     std::atomic<bool> _isRunning { false };
     std::atomic<bool> _isStopping { false };
     bool _isInitialized { false };
-    QHash<QTimer*, CallbackData> _timerFunctionMap;
+
+    // Script timers are entries in a timer wheel rather than a QTimer each, one precise QTimer wakes the engine
+    // when the earliest of them is due.
+    TimerWheel _timerWheel;
+    QHash<TimerWheel::TimerID, CallbackData> _timerFunctionMap;
+    QElapsedTimer _timerClock;
+    QTimer _timerWheelTimer { this };
+    qint64 _timerWheelWakeup { -1 };
+
     QSet<QUrl> _includedURLs;
     mutable QReadWriteLock _entityScriptsLock { QReadWriteLock::Recursive };
     QHash<EntityItemID, EntityScriptDetails> _entityScripts;
+
+    std::atomic<bool> _isEntityScriptTimingEnabled { false };
+    QMutex _entityScriptTimingsMutex;
+    EntityScriptTimings _entityScriptTimings;
     EntityScriptContentAvailableMap _contentAvailableQueue;
 
     bool _isThreaded { false };
@@ -0,0 +1,147 @@
+//
+//  MetricsRegistry.cpp
+//  libraries/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MetricsRegistry.h"
+
+#include <QtCore/QDataStream>
+
+const int MetricHistogram::SUB_BUCKET_BITS;
+const uint32_t MetricHistogram::NUM_SUB_BUCKETS;
+const int MetricHistogram::NUM_BUCKETS;
+
+uint64_t MetricHistogram::bucketLowerBound(int index) {
+    if (index < (int)NUM_SUB_BUCKETS) {
+        return (uint64_t)index;
+    }
+    int shift = index / NUM_SUB_BUCKETS - 1;
+    return (uint64_t)(NUM_SUB_BUCKETS + index % NUM_SUB_BUCKETS) << shift;
+}
+
+uint64_t MetricHistogram::bucketUpperBound(int index) {
+    if (index < (int)NUM_SUB_BUCKETS) {
+        return (uint64_t)index + 1;
+    }
+    int shift = index / NUM_SUB_BUCKETS - 1;
+    return bucketLowerBound(index) + ((uint64_t)1 << shift);
+}
+
+template <typename T>
+T& MetricsRegistry::findOrAdd(std::vector<Entry<T>>& entries, const QString& name, const QString& help) {
+    for (auto& entry : entries) {
+        if (entry.name == name) {
+            return *entry.metric;
+        }
+    }
+    entries.push_back({ name, help, std::unique_ptr<T>(new T()) });
+    return *entries.back().metric;
+}
+
+MetricCounter& MetricsRegistry::counter(const QString& name, const QString& help) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return findOrAdd(_counters, name, help);
+}
+
+MetricHistogram& MetricsRegistry::histogram(const QString& name, const QString& help) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return findOrAdd(_histograms, name, help);
+}
+
+std::vector<MetricSnapshot> MetricsRegistry::snapshot() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::vector<MetricSnapshot> snapshots;
+    snapshots.reserve(_counters.size() + _histograms.size());
+
+    for (const auto& entry : _counters) {
+        MetricSnapshot snapshot;
+        snapshot.name = entry.name;
+        snapshot.help = entry.help;
+        snapshot.type = MetricSnapshot::Counter;
+        snapshot.value = entry.metric->get();
+        snapshots.push_back(std::move(snapshot));
+    }
+
+    for (const auto& entry : _histograms) {
+        MetricSnapshot snapshot;
+        snapshot.name = entry.name;
+        snapshot.help = entry.help;
+        snapshot.type = MetricSnapshot::Histogram;
+        // not taken atomically, a record() racing with us can show in the buckets and not the sum
+        snapshot.value = entry.metric->getSum();
+        for (int i = 0; i < MetricHistogram::NUM_BUCKETS; ++i) {
+            uint64_t count = entry.metric->getBucket(i);
+            if (count > 0) {
+                snapshot.buckets.emplace_back((quint16)i, (quint64)count);
+                snapshot.count += count;
+            }
+        }
+        snapshots.push_back(std::move(snapshot));
+    }
+
+    return snapshots;
+}
+
+QByteArray MetricsRegistry::toByteArray() const {
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+
+    auto snapshots = snapshot();
+    stream << (quint32)snapshots.size();
+    for (const auto& snapshot : snapshots) {
+        stream << snapshot.name << snapshot.help << (quint8)snapshot.type << (quint64)snapshot.value;
+        if (snapshot.type == MetricSnapshot::Histogram) {
+            stream << (quint16)snapshot.buckets.size();
+            for (const auto& bucket : snapshot.buckets) {
+                stream << bucket.first << bucket.second;
+            }
+        }
+    }
+    return data;
+}
+
+std::vector<MetricSnapshot> MetricsRegistry::fromByteArray(const QByteArray& data) {
+    QDataStream stream(data);
+    std::vector<MetricSnapshot> snapshots;
+
+    quint32 numMetrics = 0;
+    stream >> numMetrics;
+    for (quint32 i = 0; i < numMetrics && stream.status() == QDataStream::Ok; ++i) {
+        MetricSnapshot snapshot;
+        quint8 type;
+        quint64 value;
+        stream >> snapshot.name >> snapshot.help >> type >> value;
+        snapshot.type = (MetricSnapshot::Type)type;
+        snapshot.value = value;
+
+        if (snapshot.type == MetricSnapshot::Histogram) {
+            quint16 numBuckets = 0;
+            stream >> numBuckets;
+            for (quint16 j = 0; j < numBuckets && stream.status() == QDataStream::Ok; ++j) {
+                quint16 index;
+                quint64 count;
+                stream >> index >> count;
+                if (index < MetricHistogram::NUM_BUCKETS) {
+                    snapshot.buckets.emplace_back(index, count);
+                    snapshot.count += count;
+                }
+            }
+        } else if (snapshot.type != MetricSnapshot::Counter) {
+            // from a newer sender, we can't tell how long the rest of it is
+            break;
+        }
+
+        if (stream.status() == QDataStream::Ok) {
+            snapshots.push_back(std::move(snapshot));
+        }
+    }
+
+    return snapshots;
+}
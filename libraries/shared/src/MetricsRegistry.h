@@ -0,0 +1,132 @@
+//
+//  MetricsRegistry.h
+//  libraries/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MetricsRegistry_h
+#define hifi_MetricsRegistry_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// A count that only goes up.  Safe to add to from any thread.
+class MetricCounter {
+public:
+    void add(uint64_t amount = 1) { _value.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t get() const { return _value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> _value { 0 };
+};
+
+// A log-linear histogram of unsigned values (usually microseconds or bytes), safe to record into from any thread.
+// Every power of two is split into NUM_SUB_BUCKETS linear buckets, so a bucket is never wider than 1/8 of its
+// lower bound and the whole 32 bit range fits in NUM_BUCKETS fixed counters.  Recording is two relaxed atomic adds.
+// Values above UINT32_MAX land in the last bucket, but still count fully towards the sum.
+class MetricHistogram {
+public:
+    static const int SUB_BUCKET_BITS = 3;
+    static const uint32_t NUM_SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int NUM_BUCKETS = (32 - SUB_BUCKET_BITS + 1) * NUM_SUB_BUCKETS;
+
+    void record(uint64_t value) {
+        uint32_t clamped = value > UINT32_MAX ? UINT32_MAX : (uint32_t)value;
+        _buckets[bucketIndex(clamped)].fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    static int bucketIndex(uint32_t value) {
+        if (value < NUM_SUB_BUCKETS) {
+            return (int)value;
+        }
+        int shift = highestBit(value) - SUB_BUCKET_BITS;
+        return (shift + 1) * NUM_SUB_BUCKETS + (int)((value >> shift) & (NUM_SUB_BUCKETS - 1));
+    }
+
+    // the values in bucket i are [lowerBound(i), upperBound(i))
+    static uint64_t bucketLowerBound(int index);
+    static uint64_t bucketUpperBound(int index);
+
+    uint64_t getBucket(int index) const { return _buckets[index].load(std::memory_order_relaxed); }
+    uint64_t getSum() const { return _sum.load(std::memory_order_relaxed); }
+
+private:
+    static int highestBit(uint32_t value) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse(&index, value);
+        return (int)index;
+#else
+        return 31 - __builtin_clz(value);
+#endif
+    }
+
+    std::atomic<uint64_t> _buckets[NUM_BUCKETS] {};
+    std::atomic<uint64_t> _sum { 0 };
+};
+
+// A point in time copy of one metric, as sent to the domain-server.
+struct MetricSnapshot {
+    enum Type : quint8 {
+        Counter = 0,
+        Histogram
+    };
+
+    QString name;
+    QString help;
+    Type type { Counter };
+    quint64 value { 0 }; // the count of a counter, the sum of a histogram
+
+    // histograms only: the non-empty buckets in index order, and the total of their counts
+    std::vector<std::pair<quint16, quint64>> buckets;
+    quint64 count { 0 };
+};
+
+// The named counters and histograms an assignment records into on its hot paths.  Registering takes a lock and
+// should be done once up front; the returned references stay valid for the lifetime of the registry.
+// Values are cumulative, rates are left to whoever scrapes them.
+class MetricsRegistry {
+public:
+    MetricCounter& counter(const QString& name, const QString& help);
+    MetricHistogram& histogram(const QString& name, const QString& help);
+
+    std::vector<MetricSnapshot> snapshot() const;
+
+    // compact binary form of snapshot() for the NodeMetrics packet
+    QByteArray toByteArray() const;
+    static std::vector<MetricSnapshot> fromByteArray(const QByteArray& data);
+
+private:
+    template <typename T>
+    struct Entry {
+        QString name;
+        QString help;
+        std::unique_ptr<T> metric;
+    };
+
+    template <typename T>
+    static T& findOrAdd(std::vector<Entry<T>>& entries, const QString& name, const QString& help);
+
+    mutable std::mutex _mutex;
+    std::vector<Entry<MetricCounter>> _counters;
+    std::vector<Entry<MetricHistogram>> _histograms;
+};
+
+#endif // hifi_MetricsRegistry_h
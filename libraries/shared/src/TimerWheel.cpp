@@ -0,0 +1,260 @@
+//
+//  TimerWheel.cpp
+//  libraries/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TimerWheel.h"
+
+#include <algorithm>
+
+TimerWheel::TimerWheel(quint64 nowMsecs) : _currentTick(nowMsecs) {
+    _slots[0].resize(LEVEL_0_SLOTS);
+    for (int level = 1; level < NUM_LEVELS; ++level) {
+        _slots[level].resize(LEVEL_SLOTS);
+    }
+    _level0Occupancy.fill(0);
+}
+
+TimerWheel::TimerID TimerWheel::add(quint64 nowMsecs, quint32 intervalMsecs, bool isRepeating) {
+    if (isEmpty()) {
+        // nothing has been advancing the wheel while it was idle, catch up so the timer is filed close by
+        _currentTick = std::max(_currentTick, nowMsecs);
+    }
+
+    int index;
+    if (_freeTimers.empty()) {
+        index = (int)_timers.size();
+        _timers.emplace_back();
+    } else {
+        index = _freeTimers.back();
+        _freeTimers.pop_back();
+        _timers[index] = Timer();
+    }
+
+    // skip ids that are invalid or still in use after wrapping around
+    while (_nextTimerID == INVALID_TIMER_ID || _timerIndices.contains(_nextTimerID)) {
+        ++_nextTimerID;
+    }
+
+    auto& timer = _timers[index];
+    timer.id = _nextTimerID++;
+    timer.interval = intervalMsecs;
+    timer.isRepeating = isRepeating;
+    _timerIndices.insert(timer.id, index);
+
+    schedule(index, nowMsecs + intervalMsecs);
+    return timer.id;
+}
+
+bool TimerWheel::remove(TimerID timerID) {
+    auto it = _timerIndices.find(timerID);
+    if (it == _timerIndices.end()) {
+        return false;
+    }
+
+    int index = it.value();
+    _timerIndices.erase(it);
+    if (_timers[index].level != NONE) {
+        unlink(index);
+    }
+    release(index);
+    return true;
+}
+
+void TimerWheel::clear() {
+    _timers.clear();
+    _freeTimers.clear();
+    _timerIndices.clear();
+    for (auto& slots : _slots) {
+        std::fill(slots.begin(), slots.end(), Slot());
+    }
+    _level0Occupancy.fill(0);
+}
+
+qint64 TimerWheel::getNextWakeup() const {
+    if (isEmpty()) {
+        return -1;
+    }
+
+    // past the end of this lap of the first level, something may have to come down from a coarser level
+    quint64 lapStart = _currentTick & ~(quint64)(LEVEL_0_SLOTS - 1);
+    int slot = findNextOccupiedLevel0Slot((int)(_currentTick - lapStart));
+    if (slot != NONE) {
+        return (qint64)(lapStart + slot);
+    }
+    return (qint64)(lapStart + LEVEL_0_SLOTS);
+}
+
+void TimerWheel::collectDue(quint64 nowMsecs, std::vector<DueTimer>& dueTimers) {
+    while (_currentTick <= nowMsecs) {
+        if (isEmpty()) {
+            _currentTick = nowMsecs + 1;
+            break;
+        }
+
+        int level0Slot = (int)(_currentTick & (LEVEL_0_SLOTS - 1));
+        auto& slot = _slots[0][level0Slot];
+        if (slot.head != NONE) {
+            size_t firstDue = dueTimers.size();
+            for (int index = slot.head; index != NONE;) {
+                auto& timer = _timers[index];
+                int next = timer.next;
+                timer.level = NONE;
+                timer.slot = NONE;
+                timer.previous = NONE;
+                timer.next = NONE;
+                dueTimers.push_back({ timer.id, timer.sequence, timer.isRepeating });
+                index = next;
+            }
+            slot = Slot();
+            _level0Occupancy[level0Slot / 64] &= ~(1ULL << (level0Slot % 64));
+
+            std::sort(dueTimers.begin() + firstDue, dueTimers.end(), [](const DueTimer& a, const DueTimer& b) {
+                return a.sequence < b.sequence;
+            });
+        }
+
+        // skip straight to the next occupied slot of this lap, or the start of the next lap
+        int nextSlot = level0Slot + 1 < LEVEL_0_SLOTS ? findNextOccupiedLevel0Slot(level0Slot + 1) : NONE;
+        quint64 nextTick = (_currentTick - level0Slot) + (nextSlot != NONE ? nextSlot : (int)LEVEL_0_SLOTS);
+        _currentTick = std::min(nextTick, nowMsecs + 1);
+
+        // cascade as soon as a lap starts, not on the next advance, so getNextWakeup() sees what comes down
+        if ((_currentTick & (LEVEL_0_SLOTS - 1)) == 0) {
+            cascadeLap();
+        }
+    }
+
+    // reschedule repeating timers once the wheel has caught up, so none of them lands behind the current tick
+    for (const auto& dueTimer : dueTimers) {
+        if (dueTimer.isRepeating) {
+            int index = _timerIndices.value(dueTimer.id);
+            auto& timer = _timers[index];
+            quint64 expiry = timer.expiry + timer.interval;
+            if (expiry <= nowMsecs) {
+                // don't try to catch up on missed intervals
+                expiry = nowMsecs + timer.interval;
+            }
+            schedule(index, expiry);
+        }
+    }
+}
+
+void TimerWheel::schedule(int index, quint64 expiry) {
+    auto& timer = _timers[index];
+    timer.expiry = std::max(expiry, _currentTick);
+    timer.sequence = _nextSequence++;
+    link(index);
+}
+
+void TimerWheel::link(int index) {
+    auto& timer = _timers[index];
+
+    quint64 delta = timer.expiry - _currentTick;
+    // timers beyond the top level wait in its furthest slot and are re-filed when it comes around
+    quint64 placement = delta < MAX_DELTA ? timer.expiry : _currentTick + MAX_DELTA - 1;
+
+    if (delta < (quint64)LEVEL_0_SLOTS) {
+        timer.level = 0;
+        timer.slot = (int)(placement & (LEVEL_0_SLOTS - 1));
+        _level0Occupancy[timer.slot / 64] |= 1ULL << (timer.slot % 64);
+    } else {
+        timer.level = 1;
+        while (timer.level < NUM_LEVELS - 1 && delta >= (1ULL << (LEVEL_0_BITS + timer.level * LEVEL_BITS))) {
+            ++timer.level;
+        }
+        timer.slot = (int)((placement >> (LEVEL_0_BITS + (timer.level - 1) * LEVEL_BITS)) & (LEVEL_SLOTS - 1));
+    }
+
+    auto& slot = _slots[timer.level][timer.slot];
+    timer.previous = slot.tail;
+    timer.next = NONE;
+    if (slot.tail != NONE) {
+        _timers[slot.tail].next = index;
+    } else {
+        slot.head = index;
+    }
+    slot.tail = index;
+}
+
+void TimerWheel::unlink(int index) {
+    auto& timer = _timers[index];
+    auto& slot = _slots[timer.level][timer.slot];
+
+    if (timer.previous != NONE) {
+        _timers[timer.previous].next = timer.next;
+    } else {
+        slot.head = timer.next;
+    }
+    if (timer.next != NONE) {
+        _timers[timer.next].previous = timer.previous;
+    } else {
+        slot.tail = timer.previous;
+    }
+
+    if (timer.level == 0 && slot.head == NONE) {
+        _level0Occupancy[timer.slot / 64] &= ~(1ULL << (timer.slot % 64));
+    }
+
+    timer.level = NONE;
+    timer.slot = NONE;
+    timer.previous = NONE;
+    timer.next = NONE;
+}
+
+void TimerWheel::cascadeLap() {
+    // move the coarser slots that start now down a level, from the top so they can cascade all the way
+    int slots[NUM_LEVELS];
+    int lastLevel = 0;
+    for (int level = 1; level < NUM_LEVELS; ++level) {
+        slots[level] = (int)((_currentTick >> (LEVEL_0_BITS + (level - 1) * LEVEL_BITS)) & (LEVEL_SLOTS - 1));
+        lastLevel = level;
+        if (slots[level] != 0) {
+            break;
+        }
+    }
+    for (int level = lastLevel; level >= 1; --level) {
+        cascade(level, slots[level]);
+    }
+}
+
+void TimerWheel::cascade(int level, int slotIndex) {
+    // detach the whole slot first, timers may be re-filed into it
+    auto slot = _slots[level][slotIndex];
+    _slots[level][slotIndex] = Slot();
+
+    for (int index = slot.head; index != NONE;) {
+        int next = _timers[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+void TimerWheel::release(int index) {
+    _timers[index].id = INVALID_TIMER_ID;
+    _freeTimers.push_back(index);
+}
+
+int TimerWheel::findNextOccupiedLevel0Slot(int fromSlot) const {
+    for (int word = fromSlot / 64; word < (int)_level0Occupancy.size(); ++word) {
+        quint64 bits = _level0Occupancy[word];
+        if (word == fromSlot / 64) {
+            bits &= ~0ULL << (fromSlot % 64);
+        }
+        if (bits != 0) {
+            int bit = 0;
+            while ((bits & 1) == 0) {
+                bits >>= 1;
+                ++bit;
+            }
+            return word * 64 + bit;
+        }
+    }
+    return NONE;
+}
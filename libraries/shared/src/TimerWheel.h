@@ -0,0 +1,127 @@
+//
+//  TimerWheel.h
+//  libraries/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TimerWheel_h
+#define hifi_TimerWheel_h
+
+#include <array>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QtGlobal>
+
+/// Hierarchical timing wheel with millisecond resolution, for owners that need many timers without a QObject each.
+///
+/// The first level has one slot per millisecond for the next 256 ms; each of the three levels above it has 64
+/// slots, each 64 times coarser than the level below, covering about 18 hours. Timers further out than that
+/// are parked in the top level and re-filed when it comes around. Adding, removing and firing a timer are
+/// constant time, and the owner only needs a single system timer, armed to getNextWakeup().
+///
+/// Timers due at the same millisecond fire in the order they were scheduled. It is safe to add or remove timers,
+/// including the one firing, from inside the fire callback.
+class TimerWheel {
+public:
+    using TimerID = quint32;
+    static const TimerID INVALID_TIMER_ID = 0;
+
+    TimerWheel(quint64 nowMsecs = 0);
+
+    /// Schedules a timer due `intervalMsecs` after `nowMsecs`. Repeating timers are rescheduled every interval
+    /// until removed.
+    TimerID add(quint64 nowMsecs, quint32 intervalMsecs, bool isRepeating);
+
+    /// Returns false if the timer is unknown, already fired (single shot), or removed.
+    bool remove(TimerID timerID);
+
+    bool contains(TimerID timerID) const { return _timerIndices.contains(timerID); }
+    int size() const { return _timerIndices.size(); }
+    bool isEmpty() const { return _timerIndices.isEmpty(); }
+    void clear();
+
+    /// The time the owner should next call advance(), or -1 if there are no timers. This may be earlier than
+    /// the next deadline, when timers need to move down from a coarser level.
+    qint64 getNextWakeup() const;
+
+    /// Fires every timer due at or before `nowMsecs`, in deadline order, calling `fire(timerID, isRepeating)`.
+    /// A single shot timer is already gone from the wheel when its callback runs.
+    template <typename F>
+    void advance(quint64 nowMsecs, F&& fire);
+
+private:
+    static const int NUM_LEVELS = 4;
+    static const int LEVEL_0_BITS = 8;
+    static const int LEVEL_BITS = 6;
+    static const int LEVEL_0_SLOTS = 1 << LEVEL_0_BITS;
+    static const int LEVEL_SLOTS = 1 << LEVEL_BITS;
+    static const quint64 MAX_DELTA = 1ULL << (LEVEL_0_BITS + (NUM_LEVELS - 1) * LEVEL_BITS);
+    static const int NONE = -1;
+
+    struct Timer {
+        TimerID id { INVALID_TIMER_ID };
+        quint64 expiry { 0 };
+        quint64 sequence { 0 };
+        quint32 interval { 0 };
+        bool isRepeating { false };
+        int level { NONE };
+        int slot { NONE };
+        int previous { NONE };
+        int next { NONE };
+    };
+
+    struct Slot {
+        int head { NONE };
+        int tail { NONE };
+    };
+
+    struct DueTimer {
+        TimerID id;
+        quint64 sequence;
+        bool isRepeating;
+    };
+
+    void collectDue(quint64 nowMsecs, std::vector<DueTimer>& dueTimers);
+    void schedule(int index, quint64 expiry);
+    void link(int index);
+    void unlink(int index);
+    void cascadeLap();
+    void cascade(int level, int slot);
+    void release(int index);
+    int findNextOccupiedLevel0Slot(int fromSlot) const;
+
+    std::vector<Timer> _timers;
+    std::vector<int> _freeTimers;
+    QHash<TimerID, int> _timerIndices;
+    std::vector<Slot> _slots[NUM_LEVELS];
+    std::array<quint64, LEVEL_0_SLOTS / 64> _level0Occupancy;
+
+    quint64 _currentTick;
+    quint64 _nextSequence { 0 };
+    TimerID _nextTimerID { INVALID_TIMER_ID + 1 };
+};
+
+template <typename F>
+void TimerWheel::advance(quint64 nowMsecs, F&& fire) {
+    std::vector<DueTimer> dueTimers;
+    collectDue(nowMsecs, dueTimers);
+
+    for (const auto& dueTimer : dueTimers) {
+        // an earlier callback may have removed it
+        if (!contains(dueTimer.id)) {
+            continue;
+        }
+        if (!dueTimer.isRepeating) {
+            remove(dueTimer.id);
+        }
+        fire(dueTimer.id, dueTimer.isRepeating);
+    }
+}
+
+#endif // hifi_TimerWheel_h
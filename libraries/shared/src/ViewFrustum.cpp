@@ -275,6 +275,285 @@ bool ViewFrustum::boxIntersectsKeyhole(const AABox& box) const {
     return true;
 }
 
+//
+// Batched intersection tests
+//
+// The elements are transposed into blocks of 64 (all the x, then all the y, ...) so the kernels can test four (SSE2)
+// or eight (AVX2) of them against the same plane at once, each block giving one word of the mask.  The kernels do the
+// arithmetic in the same order as Plane::distance(), AABox::getFarthestVertex() and touchesSphere() so they agree
+// with the single element tests.
+//
+static const int BATCH_SIZE = 64;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+// planes[i] = (normal, d), keyhole = (position, radius) or nullptr, spheres = rows of x, y, z, radius
+static uint64_t spheresIntersectPlanes_SSE(const float (*planes)[4], const float* keyhole, const float (*spheres)[BATCH_SIZE], int count) {
+    uint64_t mask = 0;
+    const __m128 zero = _mm_setzero_ps();
+    for (int i = 0; i < count; i += 4) {
+        __m128 x = _mm_load_ps(&spheres[0][i]);
+        __m128 y = _mm_load_ps(&spheres[1][i]);
+        __m128 z = _mm_load_ps(&spheres[2][i]);
+        __m128 radius = _mm_load_ps(&spheres[3][i]);
+        __m128 negRadius = _mm_sub_ps(zero, radius);
+
+        __m128 outside = zero;
+        for (int p = 0; p < NUM_FRUSTUM_PLANES; p++) {
+            __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p][0]), x), _mm_mul_ps(_mm_set1_ps(planes[p][1]), y)),
+                                    _mm_mul_ps(_mm_set1_ps(planes[p][2]), z));
+            __m128 distance = _mm_add_ps(_mm_set1_ps(planes[p][3]), dot);
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negRadius));
+        }
+        int lanes = ~_mm_movemask_ps(outside) & 0xf;
+
+        if (keyhole) {
+            __m128 dx = _mm_sub_ps(x, _mm_set1_ps(keyhole[0]));
+            __m128 dy = _mm_sub_ps(y, _mm_set1_ps(keyhole[1]));
+            __m128 dz = _mm_sub_ps(z, _mm_set1_ps(keyhole[2]));
+            __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+            lanes |= _mm_movemask_ps(_mm_cmple_ps(length, _mm_add_ps(radius, _mm_set1_ps(keyhole[3]))));
+        }
+        mask |= (uint64_t)lanes << i;
+    }
+    return mask;
+}
+
+// boxes = rows of corner x, y, z, then scale x, y, z
+static uint64_t boxesIntersectPlanes_SSE(const float (*planes)[4], const float* keyhole, const float (*boxes)[BATCH_SIZE], int count) {
+    // which of the scale components reach the farthest vertex, per plane
+    __m128 farMasks[NUM_FRUSTUM_PLANES][3];
+    for (int p = 0; p < NUM_FRUSTUM_PLANES; p++) {
+        for (int j = 0; j < 3; j++) {
+            farMasks[p][j] = _mm_castsi128_ps(_mm_set1_epi32(planes[p][j] > 0.0f ? -1 : 0));
+        }
+    }
+
+    uint64_t mask = 0;
+    const __m128 zero = _mm_setzero_ps();
+    for (int i = 0; i < count; i += 4) {
+        __m128 x = _mm_load_ps(&boxes[0][i]);
+        __m128 y = _mm_load_ps(&boxes[1][i]);
+        __m128 z = _mm_load_ps(&boxes[2][i]);
+        __m128 scaleX = _mm_load_ps(&boxes[3][i]);
+        __m128 scaleY = _mm_load_ps(&boxes[4][i]);
+        __m128 scaleZ = _mm_load_ps(&boxes[5][i]);
+
+        __m128 outside = zero;
+        for (int p = 0; p < NUM_FRUSTUM_PLANES; p++) {
+            __m128 farX = _mm_add_ps(x, _mm_and_ps(scaleX, farMasks[p][0]));
+            __m128 farY = _mm_add_ps(y, _mm_and_ps(scaleY, farMasks[p][1]));
+            __m128 farZ = _mm_add_ps(z, _mm_and_ps(scaleZ, farMasks[p][2]));
+            __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p][0]), farX), _mm_mul_ps(_mm_set1_ps(planes[p][1]), farY)),
+                                    _mm_mul_ps(_mm_set1_ps(planes[p][2]), farZ));
+            __m128 distance = _mm_add_ps(_mm_set1_ps(planes[p][3]), dot);
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+        }
+        int lanes = ~_mm_movemask_ps(outside) & 0xf;
+
+        if (keyhole) {
+            __m128 kx = _mm_set1_ps(keyhole[0]);
+            __m128 ky = _mm_set1_ps(keyhole[1]);
+            __m128 kz = _mm_set1_ps(keyhole[2]);
+            __m128 ex = _mm_add_ps(_mm_max_ps(_mm_sub_ps(x, kx), zero), _mm_max_ps(_mm_sub_ps(_mm_sub_ps(kx, x), scaleX), zero));
+            __m128 ey = _mm_add_ps(_mm_max_ps(_mm_sub_ps(y, ky), zero), _mm_max_ps(_mm_sub_ps(_mm_sub_ps(ky, y), scaleY), zero));
+            __m128 ez = _mm_add_ps(_mm_max_ps(_mm_sub_ps(z, kz), zero), _mm_max_ps(_mm_sub_ps(_mm_sub_ps(kz, z), scaleZ), zero));
+            __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), _mm_mul_ps(ez, ez));
+            lanes |= _mm_movemask_ps(_mm_cmple_ps(lengthSquared, _mm_set1_ps(keyhole[3] * keyhole[3])));
+        }
+        mask |= (uint64_t)lanes << i;
+    }
+    return mask;
+}
+
+//
+// Runtime CPU dispatch
+//
+#include "CPUDetect.h"
+
+uint64_t spheresIntersectPlanes_AVX2(const float (*planes)[4], const float* keyhole, const float (*spheres)[64], int count);
+uint64_t boxesIntersectPlanes_AVX2(const float (*planes)[4], const float* keyhole, const float (*boxes)[64], int count);
+
+static uint64_t spheresIntersectPlanes(const float (*planes)[4], const float* keyhole, const float (*spheres)[BATCH_SIZE], int count) {
+    static auto f = cpuSupportsAVX2() ? spheresIntersectPlanes_AVX2 : spheresIntersectPlanes_SSE;
+    return (*f)(planes, keyhole, spheres, count);
+}
+
+static uint64_t boxesIntersectPlanes(const float (*planes)[4], const float* keyhole, const float (*boxes)[BATCH_SIZE], int count) {
+    static auto f = cpuSupportsAVX2() ? boxesIntersectPlanes_AVX2 : boxesIntersectPlanes_SSE;
+    return (*f)(planes, keyhole, boxes, count);
+}
+
+#else   // portable reference code
+
+static uint64_t spheresIntersectPlanes_ref(const float (*planes)[4], const float* keyhole, const float (*spheres)[BATCH_SIZE], int count) {
+    uint64_t mask = 0;
+    for (int i = 0; i < count; i++) {
+        float x = spheres[0][i];
+        float y = spheres[1][i];
+        float z = spheres[2][i];
+        float radius = spheres[3][i];
+        bool inside = true;
+        for (int p = 0; p < NUM_FRUSTUM_PLANES; p++) {
+            float distance = planes[p][3] + ((planes[p][0] * x + planes[p][1] * y) + planes[p][2] * z);
+            if (distance < -radius) {
+                inside = false;
+            }
+        }
+        if (keyhole) {
+            float dx = x - keyhole[0];
+            float dy = y - keyhole[1];
+            float dz = z - keyhole[2];
+            if (sqrtf((dx * dx + dy * dy) + dz * dz) <= radius + keyhole[3]) {
+                inside = true;
+            }
+        }
+        mask |= (uint64_t)inside << i;
+    }
+    return mask;
+}
+
+static uint64_t boxesIntersectPlanes_ref(const float (*planes)[4], const float* keyhole, const float (*boxes)[BATCH_SIZE], int count) {
+    uint64_t mask = 0;
+    for (int i = 0; i < count; i++) {
+        float x = boxes[0][i];
+        float y = boxes[1][i];
+        float z = boxes[2][i];
+        bool inside = true;
+        for (int p = 0; p < NUM_FRUSTUM_PLANES; p++) {
+            float farX = planes[p][0] > 0.0f ? x + boxes[3][i] : x;
+            float farY = planes[p][1] > 0.0f ? y + boxes[4][i] : y;
+            float farZ = planes[p][2] > 0.0f ? z + boxes[5][i] : z;
+            float distance = planes[p][3] + ((planes[p][0] * farX + planes[p][1] * farY) + planes[p][2] * farZ);
+            if (distance < 0.0f) {
+                inside = false;
+            }
+        }
+        if (keyhole) {
+            float ex = std::max(x - keyhole[0], 0.0f) + std::max((keyhole[0] - x) - boxes[3][i], 0.0f);
+            float ey = std::max(y - keyhole[1], 0.0f) + std::max((keyhole[1] - y) - boxes[4][i], 0.0f);
+            float ez = std::max(z - keyhole[2], 0.0f) + std::max((keyhole[2] - z) - boxes[5][i], 0.0f);
+            if ((ex * ex + ey * ey) + ez * ez <= keyhole[3] * keyhole[3]) {
+                inside = true;
+            }
+        }
+        mask |= (uint64_t)inside << i;
+    }
+    return mask;
+}
+
+static auto& spheresIntersectPlanes = spheresIntersectPlanes_ref;
+static auto& boxesIntersectPlanes = boxesIntersectPlanes_ref;
+#endif
+
+// Transposes count elements, stride bytes apart, into blocks of numRows x BATCH_SIZE floats and hands each block to
+// testBlock(block, blockSize), which returns its word of the mask.  The kernels read whole groups of eight, so the
+// tail of the last block is zeroed and its extra bits cleared.
+template <int NUM_ROWS, typename T, typename Pack, typename TestBlock>
+static void testInBatches(const T* elements, int count, size_t stride, uint64_t* masks, Pack pack, TestBlock testBlock) {
+    alignas(32) float block[NUM_ROWS][BATCH_SIZE];
+    const char* bytes = reinterpret_cast<const char*>(elements);
+    for (int start = 0; start < count; start += BATCH_SIZE) {
+        int blockSize = std::min(count - start, BATCH_SIZE);
+        for (int i = 0; i < blockSize; i++) {
+            pack(*reinterpret_cast<const T*>(bytes + (start + i) * stride), block, i);
+        }
+        int paddedSize = std::min((blockSize + 7) & ~7, BATCH_SIZE);
+        for (int row = 0; row < NUM_ROWS; row++) {
+            std::fill(&block[row][blockSize], &block[row][paddedSize], 0.0f);
+        }
+
+        uint64_t mask = testBlock(block, blockSize);
+        if (blockSize < BATCH_SIZE) {
+            mask &= ((uint64_t)1 << blockSize) - 1;
+        }
+        masks[start / BATCH_SIZE] = mask;
+    }
+}
+
+static void packSphere(const glm::vec4& sphere, float (*block)[BATCH_SIZE], int i) {
+    block[0][i] = sphere.x;
+    block[1][i] = sphere.y;
+    block[2][i] = sphere.z;
+    block[3][i] = sphere.w;
+}
+
+static void packBox(const AABox& box, float (*block)[BATCH_SIZE], int i) {
+    const glm::vec3& corner = box.getCorner();
+    const glm::vec3& scale = box.getScale();
+    block[0][i] = corner.x;
+    block[1][i] = corner.y;
+    block[2][i] = corner.z;
+    block[3][i] = scale.x;
+    block[4][i] = scale.y;
+    block[5][i] = scale.z;
+}
+
+static void packCube(const AACube& cube, float (*block)[BATCH_SIZE], int i) {
+    const glm::vec3& corner = cube.getCorner();
+    block[0][i] = corner.x;
+    block[1][i] = corner.y;
+    block[2][i] = corner.z;
+    block[3][i] = cube.getScale();
+    block[4][i] = cube.getScale();
+    block[5][i] = cube.getScale();
+}
+
+void ViewFrustum::getBatchPlanes(float planes[NUM_FRUSTUM_PLANES][4]) const {
+    for (int i = 0; i < NUM_FRUSTUM_PLANES; i++) {
+        const glm::vec3& normal = _planes[i].getNormal();
+        planes[i][0] = normal.x;
+        planes[i][1] = normal.y;
+        planes[i][2] = normal.z;
+        planes[i][3] = _planes[i].getDCoefficient();
+    }
+}
+
+void ViewFrustum::spheresIntersectFrustum(const glm::vec4* spheres, int count, uint64_t* masks, size_t stride) const {
+    float planes[NUM_FRUSTUM_PLANES][4];
+    getBatchPlanes(planes);
+    testInBatches<4>(spheres, count, stride, masks, packSphere, [&](const float (*block)[BATCH_SIZE], int blockSize) {
+        return spheresIntersectPlanes(planes, nullptr, block, blockSize);
+    });
+}
+
+void ViewFrustum::boxesIntersectFrustum(const AABox* boxes, int count, uint64_t* masks, size_t stride) const {
+    float planes[NUM_FRUSTUM_PLANES][4];
+    getBatchPlanes(planes);
+    testInBatches<6>(boxes, count, stride, masks, packBox, [&](const float (*block)[BATCH_SIZE], int blockSize) {
+        return boxesIntersectPlanes(planes, nullptr, block, blockSize);
+    });
+}
+
+void ViewFrustum::spheresIntersectKeyhole(const glm::vec4* spheres, int count, uint64_t* masks, size_t stride) const {
+    float planes[NUM_FRUSTUM_PLANES][4];
+    getBatchPlanes(planes);
+    float keyhole[4] = { _position.x, _position.y, _position.z, _centerSphereRadius };
+    testInBatches<4>(spheres, count, stride, masks, packSphere, [&](const float (*block)[BATCH_SIZE], int blockSize) {
+        return spheresIntersectPlanes(planes, keyhole, block, blockSize);
+    });
+}
+
+void ViewFrustum::cubesIntersectKeyhole(const AACube* cubes, int count, uint64_t* masks, size_t stride) const {
+    float planes[NUM_FRUSTUM_PLANES][4];
+    getBatchPlanes(planes);
+    float keyhole[4] = { _position.x, _position.y, _position.z, _centerSphereRadius };
+    testInBatches<6>(cubes, count, stride, masks, packCube, [&](const float (*block)[BATCH_SIZE], int blockSize) {
+        return boxesIntersectPlanes(planes, keyhole, block, blockSize);
+    });
+}
+
+void ViewFrustum::boxesIntersectKeyhole(const AABox* boxes, int count, uint64_t* masks, size_t stride) const {
+    float planes[NUM_FRUSTUM_PLANES][4];
+    getBatchPlanes(planes);
+    float keyhole[4] = { _position.x, _position.y, _position.z, _centerSphereRadius };
+    testInBatches<6>(boxes, count, stride, masks, packBox, [&](const float (*block)[BATCH_SIZE], int blockSize) {
+        return boxesIntersectPlanes(planes, keyhole, block, blockSize);
+    });
+}
+
 // TODO: the slop and relative error should be passed in by argument rather than hard-coded.
 bool ViewFrustum::isVerySimilar(const ViewFrustum& other) const {
     const float MIN_POSITION_SLOP_SQUARED = 25.0f; // 5 meters squared
@@ -111,6 +111,15 @@ public:
     bool cubeIntersectsKeyhole(const AACube& cube) const;
     bool boxIntersectsKeyhole(const AABox& box) const;
 
+    // Batched versions of the tests above, several elements at a time with SSE2 or AVX2: bit i % 64 of masks[i / 64]
+    // is set when element i intersects, masks must hold (count + 63) / 64 words.  Spheres are packed as (center, radius).
+    // The elements can be members of larger structs, stride is the distance in bytes from one to the next.
+    void spheresIntersectFrustum(const glm::vec4* spheres, int count, uint64_t* masks, size_t stride = sizeof(glm::vec4)) const;
+    void boxesIntersectFrustum(const AABox* boxes, int count, uint64_t* masks, size_t stride = sizeof(AABox)) const;
+    void spheresIntersectKeyhole(const glm::vec4* spheres, int count, uint64_t* masks, size_t stride = sizeof(glm::vec4)) const;
+    void cubesIntersectKeyhole(const AACube* cubes, int count, uint64_t* masks, size_t stride = sizeof(AACube)) const;
+    void boxesIntersectKeyhole(const AABox* boxes, int count, uint64_t* masks, size_t stride = sizeof(AABox)) const;
+
     bool isVerySimilar(const ViewFrustum& compareTo) const;
 
     PickRay computePickRay(float x, float y);
@@ -185,6 +194,8 @@ private:
 
     static void tesselateSides(const glm::vec3 points[8], Triangle triangles[8]);
 
+    void getBatchPlanes(float planes[NUM_FRUSTUM_PLANES][4]) const;
+
 };
 using ViewFrustumPointer = std::shared_ptr<ViewFrustum>;
 using ViewFrustums = std::vector<ViewFrustum>;
@@ -0,0 +1,53 @@
+//
+//  ConicalViewFrustum_avx2.cpp
+//  libraries/shared/src/avx2
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// keep the multiplies and adds apart, as in the scalar tests, so both agree on elements right at the boundary
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+//
+// AVX2 version of the batched ConicalViewFrustum test, eight spheres at a time.
+// See spheresIntersectCone_SSE() in ConicalViewFrustum.cpp for the layout.
+//
+uint64_t spheresIntersectCone_AVX2(const float* cone, const float (*spheres)[64], int count) {
+    uint64_t mask = 0;
+    for (int i = 0; i < count; i += 8) {
+        __m256 x = _mm256_sub_ps(_mm256_load_ps(&spheres[0][i]), _mm256_set1_ps(cone[0]));
+        __m256 y = _mm256_sub_ps(_mm256_load_ps(&spheres[1][i]), _mm256_set1_ps(cone[1]));
+        __m256 z = _mm256_sub_ps(_mm256_load_ps(&spheres[2][i]), _mm256_set1_ps(cone[2]));
+        __m256 radius = _mm256_load_ps(&spheres[3][i]);
+        __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+                                                       _mm256_mul_ps(z, z)));
+
+        __m256 inKeyhole = _mm256_cmp_ps(distance, _mm256_add_ps(_mm256_set1_ps(cone[6]), radius), _CMP_LT_OQ);
+        __m256 pastFarClip = _mm256_cmp_ps(distance, _mm256_add_ps(_mm256_set1_ps(cone[7]), radius), _CMP_GT_OQ);
+
+        __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(cone[3])), _mm256_mul_ps(y, _mm256_set1_ps(cone[4]))),
+                                   _mm256_mul_ps(z, _mm256_set1_ps(cone[5])));
+        __m256 tangent = _mm256_sqrt_ps(_mm256_sub_ps(_mm256_mul_ps(distance, distance), _mm256_mul_ps(radius, radius)));
+        __m256 threshold = _mm256_sub_ps(_mm256_mul_ps(tangent, _mm256_set1_ps(cone[8])),
+                                         _mm256_mul_ps(radius, _mm256_set1_ps(cone[9])));
+        __m256 inCone = _mm256_andnot_ps(pastFarClip, _mm256_cmp_ps(dot, threshold, _CMP_GT_OQ));
+
+        mask |= (uint64_t)_mm256_movemask_ps(_mm256_or_ps(inKeyhole, inCone)) << i;
+    }
+    return mask;
+}
+
+#endif
@@ -0,0 +1,115 @@
+//
+//  ViewFrustum_avx2.cpp
+//  libraries/shared/src/avx2
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// keep the multiplies and adds apart, as in the scalar tests, so both agree on elements right at the boundary
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+static const int NUM_PLANES = 6;
+
+//
+// AVX2 versions of the batched ViewFrustum tests, eight elements at a time.
+// See spheresIntersectPlanes_SSE() and boxesIntersectPlanes_SSE() in ViewFrustum.cpp for the layout.
+//
+uint64_t spheresIntersectPlanes_AVX2(const float (*planes)[4], const float* keyhole, const float (*spheres)[64], int count) {
+    uint64_t mask = 0;
+    const __m256 zero = _mm256_setzero_ps();
+    for (int i = 0; i < count; i += 8) {
+        __m256 x = _mm256_load_ps(&spheres[0][i]);
+        __m256 y = _mm256_load_ps(&spheres[1][i]);
+        __m256 z = _mm256_load_ps(&spheres[2][i]);
+        __m256 radius = _mm256_load_ps(&spheres[3][i]);
+        __m256 negRadius = _mm256_sub_ps(zero, radius);
+
+        __m256 outside = zero;
+        for (int p = 0; p < NUM_PLANES; p++) {
+            __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes[p][0]), x),
+                                                     _mm256_mul_ps(_mm256_set1_ps(planes[p][1]), y)),
+                                       _mm256_mul_ps(_mm256_set1_ps(planes[p][2]), z));
+            __m256 distance = _mm256_add_ps(_mm256_set1_ps(planes[p][3]), dot);
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negRadius, _CMP_LT_OQ));
+        }
+        int lanes = ~_mm256_movemask_ps(outside) & 0xff;
+
+        if (keyhole) {
+            __m256 dx = _mm256_sub_ps(x, _mm256_set1_ps(keyhole[0]));
+            __m256 dy = _mm256_sub_ps(y, _mm256_set1_ps(keyhole[1]));
+            __m256 dz = _mm256_sub_ps(z, _mm256_set1_ps(keyhole[2]));
+            __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                                         _mm256_mul_ps(dz, dz)));
+            __m256 reach = _mm256_add_ps(radius, _mm256_set1_ps(keyhole[3]));
+            lanes |= _mm256_movemask_ps(_mm256_cmp_ps(length, reach, _CMP_LE_OQ));
+        }
+        mask |= (uint64_t)lanes << i;
+    }
+    return mask;
+}
+
+uint64_t boxesIntersectPlanes_AVX2(const float (*planes)[4], const float* keyhole, const float (*boxes)[64], int count) {
+    // which of the scale components reach the farthest vertex, per plane
+    __m256 farMasks[NUM_PLANES][3];
+    for (int p = 0; p < NUM_PLANES; p++) {
+        for (int j = 0; j < 3; j++) {
+            farMasks[p][j] = _mm256_castsi256_ps(_mm256_set1_epi32(planes[p][j] > 0.0f ? -1 : 0));
+        }
+    }
+
+    uint64_t mask = 0;
+    const __m256 zero = _mm256_setzero_ps();
+    for (int i = 0; i < count; i += 8) {
+        __m256 x = _mm256_load_ps(&boxes[0][i]);
+        __m256 y = _mm256_load_ps(&boxes[1][i]);
+        __m256 z = _mm256_load_ps(&boxes[2][i]);
+        __m256 scaleX = _mm256_load_ps(&boxes[3][i]);
+        __m256 scaleY = _mm256_load_ps(&boxes[4][i]);
+        __m256 scaleZ = _mm256_load_ps(&boxes[5][i]);
+
+        __m256 outside = zero;
+        for (int p = 0; p < NUM_PLANES; p++) {
+            __m256 farX = _mm256_add_ps(x, _mm256_and_ps(scaleX, farMasks[p][0]));
+            __m256 farY = _mm256_add_ps(y, _mm256_and_ps(scaleY, farMasks[p][1]));
+            __m256 farZ = _mm256_add_ps(z, _mm256_and_ps(scaleZ, farMasks[p][2]));
+            __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes[p][0]), farX),
+                                                     _mm256_mul_ps(_mm256_set1_ps(planes[p][1]), farY)),
+                                       _mm256_mul_ps(_mm256_set1_ps(planes[p][2]), farZ));
+            __m256 distance = _mm256_add_ps(_mm256_set1_ps(planes[p][3]), dot);
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, zero, _CMP_LT_OQ));
+        }
+        int lanes = ~_mm256_movemask_ps(outside) & 0xff;
+
+        if (keyhole) {
+            __m256 kx = _mm256_set1_ps(keyhole[0]);
+            __m256 ky = _mm256_set1_ps(keyhole[1]);
+            __m256 kz = _mm256_set1_ps(keyhole[2]);
+            __m256 ex = _mm256_add_ps(_mm256_max_ps(_mm256_sub_ps(x, kx), zero),
+                                      _mm256_max_ps(_mm256_sub_ps(_mm256_sub_ps(kx, x), scaleX), zero));
+            __m256 ey = _mm256_add_ps(_mm256_max_ps(_mm256_sub_ps(y, ky), zero),
+                                      _mm256_max_ps(_mm256_sub_ps(_mm256_sub_ps(ky, y), scaleY), zero));
+            __m256 ez = _mm256_add_ps(_mm256_max_ps(_mm256_sub_ps(z, kz), zero),
+                                      _mm256_max_ps(_mm256_sub_ps(_mm256_sub_ps(kz, z), scaleZ), zero));
+            __m256 lengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ex, ex), _mm256_mul_ps(ey, ey)),
+                                                 _mm256_mul_ps(ez, ez));
+            lanes |= _mm256_movemask_ps(_mm256_cmp_ps(lengthSquared, _mm256_set1_ps(keyhole[3] * keyhole[3]), _CMP_LE_OQ));
+        }
+        mask |= (uint64_t)lanes << i;
+    }
+    return mask;
+}
+
+#endif
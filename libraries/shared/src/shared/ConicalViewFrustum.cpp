@@ -11,6 +11,7 @@
 
 #include "ConicalViewFrustum.h"
 
+#include <algorithm>
 
 #include "../NumericalConstants.h"
 #include "../ViewFrustum.h"
@@ -108,6 +109,123 @@ bool ConicalViewFrustum::intersects(const glm::vec3& relativePosition, float dis
            sqrtf(distance * distance - radius * radius) * _cosAngle - radius * _sinAngle;
 }
 
+//
+// Batched intersection tests, see the ones in ViewFrustum.cpp
+//
+static const int BATCH_SIZE = 64;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+// cone = position, direction, radius, far clip, cos and sin of the angle; spheres = rows of x, y, z, radius
+static uint64_t spheresIntersectCone_SSE(const float* cone, const float (*spheres)[BATCH_SIZE], int count) {
+    uint64_t mask = 0;
+    for (int i = 0; i < count; i += 4) {
+        __m128 x = _mm_sub_ps(_mm_load_ps(&spheres[0][i]), _mm_set1_ps(cone[0]));
+        __m128 y = _mm_sub_ps(_mm_load_ps(&spheres[1][i]), _mm_set1_ps(cone[1]));
+        __m128 z = _mm_sub_ps(_mm_load_ps(&spheres[2][i]), _mm_set1_ps(cone[2]));
+        __m128 radius = _mm_load_ps(&spheres[3][i]);
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+
+        __m128 inKeyhole = _mm_cmplt_ps(distance, _mm_add_ps(_mm_set1_ps(cone[6]), radius));
+        __m128 pastFarClip = _mm_cmpgt_ps(distance, _mm_add_ps(_mm_set1_ps(cone[7]), radius));
+
+        __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(cone[3])), _mm_mul_ps(y, _mm_set1_ps(cone[4]))),
+                                _mm_mul_ps(z, _mm_set1_ps(cone[5])));
+        __m128 tangent = _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(distance, distance), _mm_mul_ps(radius, radius)));
+        __m128 threshold = _mm_sub_ps(_mm_mul_ps(tangent, _mm_set1_ps(cone[8])), _mm_mul_ps(radius, _mm_set1_ps(cone[9])));
+        __m128 inCone = _mm_andnot_ps(pastFarClip, _mm_cmpgt_ps(dot, threshold));
+
+        mask |= (uint64_t)_mm_movemask_ps(_mm_or_ps(inKeyhole, inCone)) << i;
+    }
+    return mask;
+}
+
+//
+// Runtime CPU dispatch
+//
+#include "../CPUDetect.h"
+
+uint64_t spheresIntersectCone_AVX2(const float* cone, const float (*spheres)[64], int count);
+
+static uint64_t spheresIntersectCone(const float* cone, const float (*spheres)[BATCH_SIZE], int count) {
+    static auto f = cpuSupportsAVX2() ? spheresIntersectCone_AVX2 : spheresIntersectCone_SSE;
+    return (*f)(cone, spheres, count);
+}
+
+#else   // portable reference code
+
+static uint64_t spheresIntersectCone(const float* cone, const float (*spheres)[BATCH_SIZE], int count) {
+    uint64_t mask = 0;
+    for (int i = 0; i < count; i++) {
+        float x = spheres[0][i] - cone[0];
+        float y = spheres[1][i] - cone[1];
+        float z = spheres[2][i] - cone[2];
+        float radius = spheres[3][i];
+        float distance = sqrtf((x * x + y * y) + z * z);
+        bool inKeyhole = distance < cone[6] + radius;
+        bool pastFarClip = distance > cone[7] + radius;
+        float dot = (x * cone[3] + y * cone[4]) + z * cone[5];
+        bool inCone = dot > sqrtf(distance * distance - radius * radius) * cone[8] - radius * cone[9];
+        mask |= (uint64_t)(inKeyhole || (!pastFarClip && inCone)) << i;
+    }
+    return mask;
+}
+
+#endif
+
+// Packs the bounding spheres pack() gives for count elements, stride bytes apart, into blocks of BATCH_SIZE and tests them
+template <typename T, typename Pack>
+static void testInBatches(const float* cone, const T* elements, int count, size_t stride, uint64_t* masks, Pack pack) {
+    alignas(32) float block[4][BATCH_SIZE];
+    const char* bytes = reinterpret_cast<const char*>(elements);
+    for (int start = 0; start < count; start += BATCH_SIZE) {
+        int blockSize = std::min(count - start, BATCH_SIZE);
+        for (int i = 0; i < blockSize; i++) {
+            glm::vec4 sphere = pack(*reinterpret_cast<const T*>(bytes + (start + i) * stride));
+            block[0][i] = sphere.x;
+            block[1][i] = sphere.y;
+            block[2][i] = sphere.z;
+            block[3][i] = sphere.w;
+        }
+        int paddedSize = std::min((blockSize + 7) & ~7, BATCH_SIZE);
+        for (int row = 0; row < 4; row++) {
+            std::fill(&block[row][blockSize], &block[row][paddedSize], 0.0f);
+        }
+
+        uint64_t mask = spheresIntersectCone(cone, block, blockSize);
+        if (blockSize < BATCH_SIZE) {
+            mask &= ((uint64_t)1 << blockSize) - 1;
+        }
+        masks[start / BATCH_SIZE] = mask;
+    }
+}
+
+void ConicalViewFrustum::spheresIntersect(const glm::vec4* spheres, int count, uint64_t* masks, size_t stride) const {
+    const float cone[10] = { _position.x, _position.y, _position.z, _direction.x, _direction.y, _direction.z,
+                             _radius, _farClip, _cosAngle, _sinAngle };
+    testInBatches(cone, spheres, count, stride, masks, [](const glm::vec4& sphere) {
+        return sphere;
+    });
+}
+
+void ConicalViewFrustum::cubesIntersect(const AACube* cubes, int count, uint64_t* masks, size_t stride) const {
+    const float cone[10] = { _position.x, _position.y, _position.z, _direction.x, _direction.y, _direction.z,
+                             _radius, _farClip, _cosAngle, _sinAngle };
+    testInBatches(cone, cubes, count, stride, masks, [](const AACube& cube) {
+        return glm::vec4(cube.calcCenter(), 0.5f * SQRT_THREE * cube.getScale());
+    });
+}
+
+void ConicalViewFrustum::boxesIntersect(const AABox* boxes, int count, uint64_t* masks, size_t stride) const {
+    const float cone[10] = { _position.x, _position.y, _position.z, _direction.x, _direction.y, _direction.z,
+                             _radius, _farClip, _cosAngle, _sinAngle };
+    testInBatches(cone, boxes, count, stride, masks, [](const AABox& box) {
+        return glm::vec4(box.calcCenter(), 0.5f * glm::length(box.getScale()));
+    });
+}
+
 float ConicalViewFrustum::getAngularSize(float distance, float radius) const {
     const float AVOID_DIVIDE_BY_ZERO = 0.001f;
     float angularSize = radius / (distance + AVOID_DIVIDE_BY_ZERO);
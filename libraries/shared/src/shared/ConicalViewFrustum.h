@@ -12,12 +12,14 @@
 #ifndef hifi_ConicalViewFrustum_h
 #define hifi_ConicalViewFrustum_h
 
+#include <stdint.h>
 #include <vector>
 
 #include <glm/glm.hpp>
 
-class AACube;
-class AABox;
+#include "../AABox.h"
+#include "../AACube.h"
+
 class ViewFrustum;
 using ViewFrustums = std::vector<ViewFrustum>;
 
@@ -49,6 +51,12 @@ public:
     float getAngularSize(const AABox& box) const;
 
     bool intersects(const glm::vec3& relativePosition, float distance, float radius) const;
+
+    // Batched versions of intersects(), see ViewFrustum::boxesIntersectFrustum() for the layout of the masks.
+    // Spheres are packed as (center, radius) in world frame.
+    void spheresIntersect(const glm::vec4* spheres, int count, uint64_t* masks, size_t stride = sizeof(glm::vec4)) const;
+    void cubesIntersect(const AACube* cubes, int count, uint64_t* masks, size_t stride = sizeof(AACube)) const;
+    void boxesIntersect(const AABox* boxes, int count, uint64_t* masks, size_t stride = sizeof(AABox)) const;
     float getAngularSize(float distance, float radius) const;
 
     int serialize(unsigned char* destinationBuffer) const;
@@ -115,6 +115,7 @@ protected:
     friend class TaskConfig;
 
     bool _isEnabled{ true };
+    bool _isParallel{ false };
 
     uint8_t _branch { 0 };
 public:
@@ -130,6 +131,11 @@ public:
     bool isEnabled() const { return _isEnabled; }
     void setEnabled(bool enable);
 
+    // Tasks only: run the child jobs concurrently, each one as soon as the jobs producing its input are done,
+    // instead of one after the other in the order they were added
+    bool isParallel() const { return _isParallel; }
+    void setParallel(bool parallel) { _isParallel = parallel; }
+
     virtual void setPresetList(const QJsonObject& object);
 
     /*@jsdoc
@@ -0,0 +1,125 @@
+//
+//  JobGraph.cpp
+//  task/src/task
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JobGraph.h"
+
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+#include <tbb/task_group.h>
+
+using namespace task;
+
+namespace {
+
+using Producers = std::unordered_map<const void*, int>;
+
+// A varying and all the varyings it is made of are produced by the job owning it
+void addProducer(Producers& producers, const Varying& varying, int jobIndex) {
+    if (varying.isNull()) {
+        return;
+    }
+    producers.emplace(varying.getDataID(), jobIndex);
+    for (uint8_t i = 0; i < varying.length(); ++i) {
+        addProducer(producers, varying[i], jobIndex);
+    }
+}
+
+void findProducers(const Producers& producers, const Varying& varying, int jobIndex, std::vector<int>& dependencies) {
+    if (varying.isNull()) {
+        return;
+    }
+    auto producer = producers.find(varying.getDataID());
+    if (producer != producers.end()) {
+        // the whole varying comes from one job, no need to look at its elements
+        if (producer->second < jobIndex) {
+            dependencies.push_back(producer->second);
+        }
+        return;
+    }
+    // an input assembled by the task from the outputs of several jobs
+    for (uint8_t i = 0; i < varying.length(); ++i) {
+        findProducers(producers, varying[i], jobIndex, dependencies);
+    }
+}
+
+}
+
+void JobGraph::build(const std::vector<Varying>& inputs, const std::vector<Varying>& outputs) {
+    assert(inputs.size() == outputs.size());
+    clear();
+
+    int numJobs = (int)outputs.size();
+    Producers producers;
+    for (int i = 0; i < numJobs; ++i) {
+        addProducer(producers, outputs[i], i);
+    }
+
+    _dependencies.resize(numJobs);
+    _dependents.resize(numJobs);
+    for (int i = 0; i < numJobs; ++i) {
+        auto& dependencies = _dependencies[i];
+        findProducers(producers, inputs[i], i, dependencies);
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+        if (dependencies.empty()) {
+            _roots.push_back(i);
+        }
+        for (auto dependency : dependencies) {
+            _dependents[dependency].push_back(i);
+        }
+    }
+}
+
+void JobGraph::clear() {
+    _dependencies.clear();
+    _dependents.clear();
+    _roots.clear();
+}
+
+bool JobGraph::run(const RunJob& runJob) const {
+    int numJobs = getNumJobs();
+    std::unique_ptr<std::atomic<int>[]> numPendingDependencies(new std::atomic<int>[numJobs]);
+    for (int i = 0; i < numJobs; ++i) {
+        numPendingDependencies[i] = (int)_dependencies[i].size();
+    }
+    std::atomic<bool> isAborted { false };
+
+    tbb::task_group group;
+    std::function<void(int)> spawn = [&](int jobIndex) {
+        group.run([&, jobIndex] {
+            if (isAborted) {
+                return;
+            }
+            if (!runJob(jobIndex)) {
+                isAborted = true;
+                return;
+            }
+            // the last dependency to finish is the one releasing a dependent
+            for (auto dependent : _dependents[jobIndex]) {
+                if (--numPendingDependencies[dependent] == 0) {
+                    spawn(dependent);
+                }
+            }
+        });
+    };
+
+    for (auto root : _roots) {
+        spawn(root);
+    }
+    group.wait();
+
+    return !isAborted;
+}
@@ -0,0 +1,52 @@
+//
+//  JobGraph.h
+//  task/src/task
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_task_JobGraph_h
+#define hifi_task_JobGraph_h
+
+#include <functional>
+#include <vector>
+
+#include "Varying.h"
+
+namespace task {
+
+// The data dependencies between the jobs of a task, derived from the varyings they are bound to:
+// a job depends on every job added before it whose output, or an element of that output, is part of its input.
+// Since a job can only be fed the output of jobs that already exist, the graph is always acyclic.
+class JobGraph {
+public:
+    // Runs the job at the given index, returns false to abort the task
+    using RunJob = std::function<bool(int jobIndex)>;
+
+    JobGraph() = default;
+
+    // inputs[i] and outputs[i] are the input and output varyings of job i, in the order the jobs were added
+    void build(const std::vector<Varying>& inputs, const std::vector<Varying>& outputs);
+    void clear();
+
+    int getNumJobs() const { return (int)_dependencies.size(); }
+    const std::vector<int>& getDependencies(int jobIndex) const { return _dependencies[jobIndex]; }
+
+    // Runs every job once, each one after all the jobs it depends on, with the jobs that are ready running concurrently
+    // on the TBB work stealing pool. Once a job aborts no other job is started, the ones already running finish.
+    // Returns false if the run was aborted.
+    bool run(const RunJob& runJob) const;
+
+private:
+    std::vector<std::vector<int>> _dependencies;
+    std::vector<std::vector<int>> _dependents;
+    std::vector<int> _roots;
+};
+
+}
+
+#endif // hifi_task_JobGraph_h
@@ -13,6 +13,7 @@
 #define hifi_task_Task_h
 
 #include "Config.h"
+#include "JobGraph.h"
 #include "Varying.h"
 
 #include <unordered_map>
@@ -60,6 +61,10 @@ public:
     // Task flow control
     TaskFlow taskFlow{};
 
+    // The context of one job running concurrently with others in a parallel task, which gets its own jobConfig and
+    // taskFlow. Contexts that can't be shared across threads return nullptr, and their tasks run their jobs in sequence.
+    virtual std::shared_ptr<JobContext> cloneForJob() const { return nullptr; }
+
 protected:
 };
 using JobContextPointer = std::shared_ptr<JobContext>;
@@ -259,6 +264,7 @@ public:
         // Create a new job in the container's queue; returns the job's output
         template <class NT, class... NA> const Varying addJob(std::string name, const Varying& input, NA&&... args) {
             _jobs.emplace_back((NT::JobModel::create(name, input, std::forward<NA>(args)...)));
+            _isGraphDirty = true;
 
             // Conect the child config to this task's config
             std::static_pointer_cast<JobConfig>(Concept::getConfiguration())->connectChildConfig(_jobs.back().getConfiguration(), name);
@@ -269,6 +275,41 @@ public:
             const auto input = Varying(typename NT::JobModel::Input());
             return addJob<NT>(name, input, std::forward<NA>(args)...);
         }
+
+    protected:
+        // Runs the jobs concurrently following their data dependencies, returns false if the context doesn't allow it
+        bool runJobsInParallel(const ContextPointer& jobContext) {
+            std::vector<ContextPointer> jobContexts;
+            for (size_t i = 0; i < _jobs.size(); ++i) {
+                auto context = jobContext->cloneForJob();
+                if (!context) {
+                    return false;
+                }
+                jobContexts.push_back(std::static_pointer_cast<Context>(context));
+            }
+
+            if (_isGraphDirty) {
+                std::vector<Varying> inputs;
+                std::vector<Varying> outputs;
+                for (const auto& job : _jobs) {
+                    inputs.push_back(job.getInput());
+                    outputs.push_back(job.getOutput());
+                }
+                _graph.build(inputs, outputs);
+                _isGraphDirty = false;
+            }
+
+            _graph.run([&](int jobIndex) {
+                auto job = _jobs[jobIndex];
+                const auto& context = jobContexts[jobIndex];
+                job.run(context);
+                return !context->taskFlow.doAbortTask();
+            });
+            return true;
+        }
+
+        JobGraph _graph;
+        bool _isGraphDirty { true };
     };
 
     template <class T, class C = Config, class I = None, class O = None> class TaskModel : public TaskConcept {
@@ -330,6 +371,9 @@ public:
         void run(const ContextPointer& jobContext) override {
             auto config = std::static_pointer_cast<C>(Concept::_config);
             if (config->isEnabled()) {
+                if (config->isParallel() && TaskConcept::runJobsInParallel(jobContext)) {
+                    return;
+                }
                 for (auto job : TaskConcept::_jobs) {
                     job.run(jobContext);
                     if (jobContext->taskFlow.doAbortTask()) {
@@ -15,9 +15,12 @@
 #include <type_traits>
 #include <tuple>
 #include <array>
+#include <memory>
+#include <utility>
 
 namespace task {
 class Varying;
+template <class T, class = void> struct VaryingElements;
 
 
 // A varying piece of data, to be used as Job/Task I/O
@@ -46,6 +49,9 @@ public:
 
     bool isNull() const { return _concept == nullptr; }
 
+    // Identifies the data behind this varying, shared by all the copies of it
+    const void* getDataID() const { return _concept.get(); }
+
 protected:
     class Concept {
     public:
@@ -68,10 +74,10 @@ protected:
         virtual ~Model() = default;
 
         virtual Varying operator[] (uint8_t index) const override {
-            return Varying();
+            return VaryingElements<T>::get(_data, index);
         }
         virtual uint8_t length() const override {
-            return 0;
+            return VaryingElements<T>::length(_data);
         }
 
         Data _data;
@@ -80,6 +86,19 @@ protected:
     std::shared_ptr<Concept> _concept;
 };
 
+// The sets of varyings (VaryingSetN, VaryingArray) expose their elements through the type erased Varying holding
+// them, so that whoever only sees that varying can still tell which other varyings it is made of.
+template <class T, class> struct VaryingElements {
+    static Varying get(const T& data, uint8_t index) { return Varying(); }
+    static uint8_t length(const T& data) { return 0; }
+};
+template <class T> struct VaryingElements<T, typename std::enable_if<
+        std::is_same<typename std::decay<decltype(std::declval<const T&>()[(uint8_t)0])>::type, Varying>::value &&
+        std::is_same<decltype(std::declval<const T&>().length()), uint8_t>::value>::type> {
+    static Varying get(const T& data, uint8_t index) { return data[index]; }
+    static uint8_t length(const T& data) { return data.length(); }
+};
+
 template < typename T0, typename T1 >
 class VaryingSet2 : public std::pair<Varying, Varying> {
 public:
@@ -522,6 +541,8 @@ public:
         assert(list.size() == NUM);
         std::copy(list.begin(), list.end(), std::array<Varying, NUM>::begin());
     }
+
+    uint8_t length() const { return (uint8_t)NUM; }
 };
 
 }
@@ -18,8 +18,13 @@
 
 #include <glm/gtx/quaternion.hpp>
 
+#include <TBBHelpers.h>
+
 using namespace workload;
 
+// big enough that a chunk is worth handing to another thread, and a multiple of four
+static const uint32_t PROXIES_PER_CHUNK = 4096;
+
 Space::Space() : Collection() {
 }
 
@@ -28,9 +33,8 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     // Here we should be able to check the value of last ProxyID allocated
     // and allocate new proxies accordingly
     ProxyID maxID = _IDAllocator.getNumAllocatedIndices();
-    if (maxID > (Index) _proxies.size()) {
-        _proxies.resize(maxID + 100); // allocate the maxId and more
-        _owners.resize(maxID + 100);
+    if (maxID > (Index) _proxyRegion.size()) {
+        resizeProxies(maxID + 100); // allocate the maxId and more
     }
     // Now we know for sure that we have enough items in the array to
     // capture anything coming from the transaction
@@ -40,6 +44,31 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     processRemoves(transaction._removedItems);
 }
 
+void Space::resizeProxies(uint32_t numProxies) {
+    numProxies = (numProxies + 3) & ~3;
+    _proxyX.resize(numProxies, 0.0f);
+    _proxyY.resize(numProxies, 0.0f);
+    _proxyZ.resize(numProxies, 0.0f);
+    _proxyRadius.resize(numProxies, 0.0f);
+    _proxyRegion.resize(numProxies, Region::INVALID);
+    _proxyPrevRegion.resize(numProxies, Region::INVALID);
+    _owners.resize(numProxies);
+}
+
+void Space::setProxySphere(int32_t proxyID, const Sphere& sphere) {
+    _proxyX[proxyID] = sphere.x;
+    _proxyY[proxyID] = sphere.y;
+    _proxyZ[proxyID] = sphere.z;
+    _proxyRadius[proxyID] = sphere.w;
+}
+
+Proxy Space::getProxy(int32_t proxyID) const {
+    Proxy proxy(Sphere(_proxyX[proxyID], _proxyY[proxyID], _proxyZ[proxyID], _proxyRadius[proxyID]));
+    proxy.region = _proxyRegion[proxyID];
+    proxy.prevRegion = _proxyPrevRegion[proxyID];
+    return proxy;
+}
+
 void Space::processResets(const Transaction::Resets& transactions) {
     for (auto& reset : transactions) {
         // Access the true item
@@ -49,11 +78,10 @@ void Space::processResets(const Transaction::Resets& transactions) {
         if (!_IDAllocator.checkIndex(proxyID)) {
             continue;
         }
-        auto& item = _proxies[proxyID];
 
         // Reset the item with a new payload
-        item.sphere = (std::get<1>(reset));
-        item.prevRegion = item.region = Region::UNKNOWN;
+        setProxySphere(proxyID, std::get<1>(reset));
+        _proxyPrevRegion[proxyID] = _proxyRegion[proxyID] = Region::UNKNOWN;
 
         _owners[proxyID] = (std::get<2>(reset));
     }
@@ -66,11 +94,8 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         }
         _IDAllocator.freeIndex(removedID);
 
-        // Access the true item
-        auto& item = _proxies[removedID];
-
         // Kill it
-        item.prevRegion = item.region = Region::INVALID;
+        _proxyPrevRegion[removedID] = _proxyRegion[removedID] = Region::INVALID;
         _owners[removedID] = Owner();
     }
 }
@@ -82,48 +107,117 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
             continue;
         }
 
-        // Access the true item
-        auto& item = _proxies[updateID];
-
         // Update the item
-        item.sphere = (std::get<1>(update));
+        setProxySphere(updateID, std::get<1>(update));
     }
 }
 
-void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
-    std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
-    uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
-        if (proxy.region < Region::INVALID) {
-            glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
-            float proxyRadius = proxy.sphere.w;
+// A proxy's region is the lowest k of any view whose region sphere k it touches, or R4 if it touches none.  That is
+// the same as walking each view's spheres in order and stopping at the first hit, which is what this used to do, but
+// every (view, k) pair can be tested without branching.
+void Space::categorizeRange(uint32_t begin, uint32_t end, const std::vector<Sphere>& regionSpheres, Changes& changes) {
+    const uint32_t numSpheres = (uint32_t)regionSpheres.size();
+    for (uint32_t i = begin; i < end; i += 4) {
+        uint8_t regions[4];
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+        const __m128 R4 = _mm_set1_ps((float)Region::R4);
+        __m128 x = _mm_loadu_ps(_proxyX.data() + i);
+        __m128 y = _mm_loadu_ps(_proxyY.data() + i);
+        __m128 z = _mm_loadu_ps(_proxyZ.data() + i);
+        __m128 radius = _mm_loadu_ps(_proxyRadius.data() + i);
+        __m128 region = R4;
+        for (uint32_t j = 0; j < numSpheres; ++j) {
+            const Sphere& sphere = regionSpheres[j];
+            __m128 dx = _mm_sub_ps(x, _mm_set1_ps(sphere.x));
+            __m128 dy = _mm_sub_ps(y, _mm_set1_ps(sphere.y));
+            __m128 dz = _mm_sub_ps(z, _mm_set1_ps(sphere.z));
+            __m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            __m128 touchDistance = _mm_add_ps(radius, _mm_set1_ps(sphere.w));
+            __m128 touches = _mm_cmplt_ps(distance2, _mm_mul_ps(touchDistance, touchDistance));
+            __m128 k = _mm_set1_ps((float)(j % Region::NUM_TRACKED_REGIONS));
+            region = _mm_min_ps(region, _mm_or_ps(_mm_and_ps(touches, k), _mm_andnot_ps(touches, R4)));
+        }
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128((__m128i*)lanes, _mm_cvttps_epi32(region));
+        for (int lane = 0; lane < 4; ++lane) {
+            regions[lane] = (uint8_t)lanes[lane];
+        }
+#else
+        for (int lane = 0; lane < 4; ++lane) {
+            glm::vec3 proxyCenter(_proxyX[i + lane], _proxyY[i + lane], _proxyZ[i + lane]);
+            float proxyRadius = _proxyRadius[i + lane];
             uint8_t region = Region::R4;
-            for (uint32_t j = 0; j < numViews; ++j) {
-                auto& view = _views[j];
-                // for each 'view' we need only increment 'k' below the current value of 'region'
-                for (uint8_t k = 0; k < region; ++k) {
-                    float touchDistance = proxyRadius + view.regions[k].w;
-                    if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+            for (uint32_t j = 0; j < numSpheres; ++j) {
+                uint8_t k = (uint8_t)(j % Region::NUM_TRACKED_REGIONS);
+                if (k < region) {
+                    float touchDistance = proxyRadius + regionSpheres[j].w;
+                    if (distance2(proxyCenter, glm::vec3(regionSpheres[j])) < touchDistance * touchDistance) {
                         region = k;
-                        break;
                     }
                 }
             }
-            proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
+            regions[lane] = region;
+        }
+#endif
+        for (uint32_t lane = 0; lane < 4; ++lane) {
+            uint32_t index = i + lane;
+            if (_proxyRegion[index] < Region::INVALID) {
+                _proxyPrevRegion[index] = _proxyRegion[index];
+                _proxyRegion[index] = regions[lane];
+                if (regions[lane] != _proxyPrevRegion[index]) {
+                    changes.emplace_back(Space::Change((int32_t)index, regions[lane], _proxyPrevRegion[index]));
+                }
             }
         }
     }
 }
 
+void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
+    std::unique_lock<std::mutex> lock(_proxiesMutex);
+    uint32_t numProxies = (uint32_t)_proxyRegion.size();
+
+    std::vector<Sphere> regionSpheres;
+    regionSpheres.reserve(_views.size() * Region::NUM_TRACKED_REGIONS);
+    for (const auto& view : _views) {
+        for (uint32_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+            regionSpheres.push_back(view.regions[k]);
+        }
+    }
+
+    uint32_t numChunks = (numProxies + PROXIES_PER_CHUNK - 1) / PROXIES_PER_CHUNK;
+    if (numChunks < 2) {
+        categorizeRange(0, numProxies, regionSpheres, changes);
+        return;
+    }
+
+    // each chunk collects its own changes, and they are appended in chunk order so the result doesn't depend on
+    // how the chunks were scheduled
+    _chunkChanges.resize(numChunks);
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numChunks, 1), [&](const tbb::blocked_range<uint32_t>& range) {
+        for (uint32_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+            uint32_t begin = chunk * PROXIES_PER_CHUNK;
+            uint32_t end = std::min(begin + PROXIES_PER_CHUNK, numProxies);
+            _chunkChanges[chunk].clear();
+            categorizeRange(begin, end, regionSpheres, _chunkChanges[chunk]);
+        }
+    });
+
+    size_t numChanges = changes.size();
+    for (const auto& chunkChanges : _chunkChanges) {
+        numChanges += chunkChanges.size();
+    }
+    changes.reserve(numChanges);
+    for (const auto& chunkChanges : _chunkChanges) {
+        changes.insert(changes.end(), chunkChanges.begin(), chunkChanges.end());
+    }
+}
+
 uint32_t Space::copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    auto numCopied = std::min(numDestProxies, (uint32_t)_proxies.size());
-    memcpy(proxies, _proxies.data(), numCopied * sizeof(Proxy));
+    auto numCopied = std::min(numDestProxies, (uint32_t)_proxyRegion.size());
+    for (uint32_t i = 0; i < numCopied; ++i) {
+        proxies[i] = getProxy(i);
+    }
     return numCopied;
 }
 
@@ -131,8 +225,8 @@ uint32_t Space::copySelectedProxyValues(Proxy::Vector& proxies, const workload::
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     uint32_t numCopied = 0;
     for (auto index : indices) {
-        if (isAllocatedID(index) && (index < (Index)_proxies.size())) {
-            proxies.push_back(_proxies[index]);
+        if (isAllocatedID(index) && (index < (Index)_proxyRegion.size())) {
+            proxies.push_back(getProxy(index));
             ++numCopied;
         }
     }
@@ -141,7 +235,7 @@ uint32_t Space::copySelectedProxyValues(Proxy::Vector& proxies, const workload::
 
 const Owner Space::getOwner(int32_t proxyID) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxies.size())) {
+    if (isAllocatedID(proxyID) && (proxyID < (Index)_owners.size())) {
         return _owners[proxyID];
     }
     return Owner();
@@ -149,8 +243,8 @@ const Owner Space::getOwner(int32_t proxyID) const {
 
 uint8_t Space::getRegion(int32_t proxyID) const {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxies.size())) {
-        return _proxies[proxyID].region;
+    if (isAllocatedID(proxyID) && (proxyID < (Index)_proxyRegion.size())) {
+        return _proxyRegion[proxyID];
     }
     return (uint8_t)Region::INVALID;
 }
@@ -159,8 +253,14 @@ void Space::clear() {
     Collection::clear();
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     _IDAllocator.clear();
-    _proxies.clear();
+    _proxyX.clear();
+    _proxyY.clear();
+    _proxyZ.clear();
+    _proxyRadius.clear();
+    _proxyRegion.clear();
+    _proxyPrevRegion.clear();
     _owners.clear();
+    _chunkChanges.clear();
     _views.clear();
 }
 
@@ -35,6 +35,8 @@ public:
         uint8_t prevRegion { 0 };
     };
 
+    using Changes = std::vector<Change>;
+
     Space();
 
     void setViews(const Views& views);
@@ -45,6 +47,7 @@ public:
     uint32_t getNumObjects() const { return _IDAllocator.getNumLiveIndices(); }
     uint32_t getNumAllocatedProxies() const { return (uint32_t)(_IDAllocator.getNumAllocatedIndices()); }
 
+    // Changes are appended in order of proxyId, however the work ends up split between threads.
     void categorizeAndGetChanges(std::vector<Change>& changes);
     uint32_t copyProxyValues(Proxy* proxies, uint32_t numDestProxies) const;
     uint32_t copySelectedProxyValues(Proxy::Vector& proxies, const workload::indexed_container::Indices& indices) const;
@@ -60,11 +63,26 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
-    // The database of proxies is protected for editing by a mutex
+    void resizeProxies(uint32_t numProxies);
+    void setProxySphere(int32_t proxyID, const Sphere& sphere);
+    Proxy getProxy(int32_t proxyID) const;
+    void categorizeRange(uint32_t begin, uint32_t end, const std::vector<Sphere>& regionSpheres, Changes& changes);
+
+    // The database of proxies is protected for editing by a mutex.  Proxies are stored as one array per component
+    // so categorizeAndGetChanges() can test four of them at a time, and the arrays are padded to a multiple of four
+    // with INVALID proxies.
     mutable std::mutex _proxiesMutex;
-    Proxy::Vector _proxies;
+    std::vector<float> _proxyX;
+    std::vector<float> _proxyY;
+    std::vector<float> _proxyZ;
+    std::vector<float> _proxyRadius;
+    std::vector<uint8_t> _proxyRegion;
+    std::vector<uint8_t> _proxyPrevRegion;
     std::vector<Owner> _owners;
 
+    // per chunk of proxies, kept between frames to avoid reallocating them
+    std::vector<Changes> _chunkChanges;
+
     Views _views;
 };
 
@@ -0,0 +1,73 @@
+"use strict";
+
+//
+//  entityScriptServerShardingTest.js
+//  scripts/developer/tests
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Spawns 1,000 entities with server scripts, a few of which deliberately hog their script engine, to exercise
+//  the entity script server's shards. Compare the "script_engine_stats" section of the entity script server's
+//  stats on the domain server with different "script_shards" settings: with one shard the cheap scripts' timers
+//  fall behind the slow ones, with several they only fall behind on the shards the slow scripts hash to.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+(function() {
+    var NUM_ENTITIES = 1000;
+    var NUM_SLOW_ENTITIES = 10;
+    var GRID_SIZE = Math.ceil(Math.sqrt(NUM_ENTITIES));
+    var SPACING = 0.5;
+    var LIFETIME = 600;
+
+    // each script counts its interval callbacks and reports how late they run, the slow ones also burn CPU
+    var SERVER_SCRIPT_SOURCE = "(function() {" +
+        "  var INTERVAL_MS = 100;" +
+        "  var BUSY_MS = %BUSY_MS%;" +
+        "  var interval, lastTime, maxLateness = 0, calls = 0;" +
+        "  this.preload = function(entityID) {" +
+        "    lastTime = Date.now();" +
+        "    interval = Script.setInterval(function() {" +
+        "      var now = Date.now();" +
+        "      maxLateness = Math.max(maxLateness, now - lastTime - INTERVAL_MS);" +
+        "      lastTime = now;" +
+        "      while (Date.now() - now < BUSY_MS) {}" +
+        "      if (++calls % 100 === 0) {" +
+        "        print('entityScriptServerShardingTest', entityID, 'max lateness', maxLateness, 'ms');" +
+        "        maxLateness = 0;" +
+        "      }" +
+        "    }, INTERVAL_MS);" +
+        "  };" +
+        "  this.unload = function() {" +
+        "    Script.clearInterval(interval);" +
+        "  };" +
+        "})";
+
+    var origin = Vec3.sum(MyAvatar.position, Vec3.multiplyQbyV(MyAvatar.orientation, { x: 0, y: 0, z: -2 }));
+    var entityIDs = [];
+
+    for (var i = 0; i < NUM_ENTITIES; i++) {
+        var busyMs = i < NUM_SLOW_ENTITIES ? 20 : 0;
+        var source = SERVER_SCRIPT_SOURCE.replace("%BUSY_MS%", busyMs);
+        entityIDs.push(Entities.addEntity({
+            type: "Box",
+            name: "entityScriptServerShardingTest " + i,
+            position: Vec3.sum(origin, { x: (i % GRID_SIZE) * SPACING, y: 0, z: Math.floor(i / GRID_SIZE) * SPACING }),
+            dimensions: { x: 0.2, y: 0.2, z: 0.2 },
+            color: busyMs > 0 ? { red: 255, green: 0, blue: 0 } : { red: 0, green: 255, blue: 0 },
+            serverScripts: "data:application/javascript," + encodeURIComponent(source),
+            lifetime: LIFETIME
+        }));
+    }
+
+    print("entityScriptServerShardingTest: added", entityIDs.length, "scripted entities");
+
+    Script.scriptEnding.connect(function() {
+        entityIDs.forEach(function(entityID) {
+            Entities.deleteEntity(entityID);
+        });
+    });
+}());
@@ -0,0 +1,264 @@
+//
+//  AnimClipDataTests.cpp
+//  tests/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimClipDataTests.h"
+
+#include <random>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <AnimClipData.h>
+#include <AnimSkeleton.h>
+#include <AnimationCache.h>
+#include <NodeList.h>
+#include <NumericalConstants.h>
+#include <ResourceManager.h>
+#include <ResourceRequestObserver.h>
+#include <StatTracker.h>
+
+QTEST_MAIN(AnimClipDataTests)
+
+// 15 bits over [-1 / sqrt(2), 1 / sqrt(2)] is good to about a hundredth of a degree
+const float MAX_ROTATION_ERROR = 0.0005f;
+
+static float angleBetween(const glm::quat& a, const glm::quat& b) {
+    return 2.0f * acosf(glm::min(1.0f, glm::abs(glm::dot(a, b))));
+}
+
+// a clip shaped like a real one: every joint rotates, the hips also move, everything else keeps its scale and offset
+static std::vector<AnimPoseVec> makeFrames(size_t numFrames, size_t numJoints, std::mt19937& generator) {
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    AnimPoseVec defaultPoses(numJoints);
+    for (auto& pose : defaultPoses) {
+        pose.trans() = glm::vec3(unit(generator), unit(generator), unit(generator));
+    }
+
+    std::vector<AnimPoseVec> frames(numFrames, defaultPoses);
+    for (size_t frame = 0; frame < numFrames; frame++) {
+        for (size_t joint = 0; joint < numJoints; joint++) {
+            frames[frame][joint].rot() = glm::normalize(glm::quat(unit(generator), unit(generator), unit(generator), unit(generator)));
+        }
+        frames[frame][0].trans() = glm::vec3(0.0f, 1.0f, 0.1f * (float)frame);
+    }
+    return frames;
+}
+
+static HFMJoint makeJoint(const QString& name, int parentIndex, const glm::vec3& translation) {
+    HFMJoint joint;
+    joint.parentIndex = parentIndex;
+    joint.distanceToParent = glm::length(translation);
+    joint.translation = translation;
+    joint.preTransform = glm::mat4();
+    joint.preRotation = glm::quat();
+    joint.rotation = glm::quat();
+    joint.postRotation = glm::quat();
+    joint.postTransform = glm::mat4();
+    joint.transform = glm::mat4();
+    joint.rotationMin = glm::vec3(-PI);
+    joint.rotationMax = glm::vec3(PI);
+    joint.inverseDefaultRotation = glm::quat();
+    joint.inverseBindRotation = glm::quat();
+    joint.bindTransform = glm::mat4();
+    joint.name = name;
+    joint.isSkeletonJoint = true;
+    return joint;
+}
+
+void AnimClipDataTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>();
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+    DependencyManager::set<ResourceManager>();
+    DependencyManager::set<AnimationCache>();
+    DependencyManager::set<ResourceRequestObserver>();
+    DependencyManager::set<ResourceCacheSharedItems>();
+    DependencyManager::set<StatTracker>();
+}
+
+void AnimClipDataTests::cleanupTestCase() {
+    DependencyManager::get<ResourceManager>()->cleanup();
+}
+
+void AnimClipDataTests::testRotationQuantization() {
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<glm::quat> rotations {
+        glm::quat(), -glm::quat(), glm::quat(0.0f, 1.0f, 0.0f, 0.0f), glm::quat(0.0f, 0.0f, 0.0f, -1.0f),
+        glm::normalize(glm::quat(0.5f, 0.5f, -0.5f, 0.5f))
+    };
+    for (int i = 0; i < 10000; i++) {
+        rotations.push_back(glm::normalize(glm::quat(unit(generator), unit(generator), unit(generator), unit(generator))));
+    }
+
+    float maxError = 0.0f;
+    for (auto& rot : rotations) {
+        uint16_t data[3];
+        AnimClipData::encodeRotation(rot, data);
+        glm::quat decoded = AnimClipData::decodeRotation(data);
+        QVERIFY(glm::abs(glm::length(decoded) - 1.0f) < 0.0001f);
+        maxError = glm::max(maxError, angleBetween(rot, decoded));
+    }
+    qDebug() << "max rotation error" << maxError << "radians";
+    QVERIFY(maxError < MAX_ROTATION_ERROR);
+}
+
+void AnimClipDataTests::testDecodeFrames() {
+    std::mt19937 generator(2);
+    const size_t NUM_FRAMES = 30;
+    const size_t NUM_JOINTS = 57;
+    auto frames = makeFrames(NUM_FRAMES, NUM_JOINTS, generator);
+
+    AnimClipData clipData(frames);
+    QCOMPARE(clipData.getNumFrames(), NUM_FRAMES);
+    QCOMPARE(clipData.getNumJoints(), NUM_JOINTS);
+
+    AnimPoseBuffer buffer;
+    AnimPoseVec poses;
+    for (size_t frame = 0; frame < NUM_FRAMES; frame++) {
+        clipData.decodeFrame(frame, buffer);
+        clipData.decodeFrame(frame, poses);
+        QCOMPARE(buffer.size(), NUM_JOINTS);
+        QCOMPARE(poses.size(), NUM_JOINTS);
+        for (size_t joint = 0; joint < NUM_JOINTS; joint++) {
+            const AnimPose& expected = frames[frame][joint];
+
+            // scale and translation are stored as is
+            QCOMPARE(poses[joint].scale(), expected.scale());
+            QCOMPARE(poses[joint].trans(), expected.trans());
+            QVERIFY(angleBetween(poses[joint].rot(), expected.rot()) < MAX_ROTATION_ERROR);
+            QCOMPARE(buffer.getPose(joint).rot(), poses[joint].rot());
+        }
+    }
+
+    // only the hips' translation is stored per frame
+    size_t rotationBytes = NUM_FRAMES * NUM_JOINTS * 3 * sizeof(uint16_t);
+    size_t perFrameBytes = NUM_FRAMES * sizeof(glm::vec3);
+    QVERIFY(clipData.getMemoryUsage() < 2 * (rotationBytes + perFrameBytes));
+}
+
+void AnimClipDataTests::testMirrored() {
+    std::vector<HFMJoint> joints {
+        makeJoint("Hips", -1, glm::vec3(0.0f, 1.0f, 0.0f)),
+        makeJoint("LeftUpLeg", 0, glm::vec3(0.1f, -0.1f, 0.0f)),
+        makeJoint("RightUpLeg", 0, glm::vec3(-0.1f, -0.1f, 0.0f)),
+        makeJoint("Spine", 0, glm::vec3(0.0f, 0.2f, 0.0f)),
+        makeJoint("LeftArm", 3, glm::vec3(0.2f, 0.3f, 0.0f)),
+        makeJoint("RightArm", 3, glm::vec3(-0.2f, 0.3f, 0.0f))
+    };
+    AnimSkeleton skeleton(joints, QMap<int, glm::quat>());
+
+    std::mt19937 generator(3);
+    auto frames = makeFrames(10, joints.size(), generator);
+    auto clipData = std::make_shared<AnimClipData>(frames);
+
+    auto mirrored = clipData->getMirrored(skeleton);
+    QVERIFY(mirrored);
+    QCOMPARE(clipData->getMirrored(skeleton), mirrored);
+    QCOMPARE(mirrored->getNumFrames(), clipData->getNumFrames());
+
+    AnimPoseVec expected;
+    AnimPoseVec poses;
+    for (size_t frame = 0; frame < frames.size(); frame++) {
+        clipData->decodeFrame(frame, expected);
+        skeleton.mirrorRelativePoses(expected);
+        mirrored->decodeFrame(frame, poses);
+        for (size_t joint = 0; joint < joints.size(); joint++) {
+            QVERIFY(glm::length(poses[joint].trans() - expected[joint].trans()) < 0.001f);
+            QVERIFY(angleBetween(poses[joint].rot(), expected[joint].rot()) < MAX_ROTATION_ERROR);
+        }
+    }
+}
+
+void AnimClipDataTests::testSharedBetweenClips() {
+    const int NUM_CLIPS = 200;
+    const size_t NUM_FRAMES = 300;
+    const size_t NUM_JOINTS = 100;
+    std::mt19937 generator(4);
+    auto frames = makeFrames(NUM_FRAMES, NUM_JOINTS, generator);
+
+    auto animationCache = DependencyManager::get<AnimationCache>();
+    int numBuilds = 0;
+    auto build = [&] {
+        ++numBuilds;
+        return std::make_shared<AnimClipData>(frames);
+    };
+
+    std::vector<AnimClipDataPointer> clips;
+    for (int i = 0; i < NUM_CLIPS; i++) {
+        clips.push_back(animationCache->getClipData("idle.fbx|0|skeleton", build));
+    }
+    QCOMPARE(numBuilds, 1);
+    for (auto& clip : clips) {
+        QCOMPARE(clip, clips[0]);
+    }
+
+    // another skeleton gets its own copy
+    auto otherClip = animationCache->getClipData("idle.fbx|0|other skeleton", build);
+    QCOMPARE(numBuilds, 2);
+    QVERIFY(otherClip != clips[0]);
+
+    // every AnimClip used to keep its own AnimPoseVec per frame
+    size_t perClipBytes = NUM_FRAMES * (sizeof(AnimPoseVec) + NUM_JOINTS * sizeof(AnimPose));
+    size_t sharedBytes = clips[0]->getMemoryUsage();
+    qDebug() << NUM_CLIPS << "clips of" << NUM_FRAMES << "frames and" << NUM_JOINTS << "joints:"
+        << (NUM_CLIPS * perClipBytes) / BYTES_PER_KILOBYTE << "KB as copies,"
+        << sharedBytes / BYTES_PER_KILOBYTE << "KB shared";
+    QVERIFY(sharedBytes * 5 < perClipBytes);
+
+    // once every clip lets go, the next one builds it again
+    clips.clear();
+    animationCache->getClipData("idle.fbx|0|skeleton", build);
+    QCOMPARE(numBuilds, 3);
+}
+
+void AnimClipDataTests::benchmarkSampling_data() {
+    QTest::addColumn<bool>("compressed");
+    QTest::newRow("AnimPoseBuffer frames") << false;
+    QTest::newRow("AnimClipData frames") << true;
+}
+
+void AnimClipDataTests::benchmarkSampling() {
+    QFETCH(bool, compressed);
+    const size_t NUM_FRAMES = 300;
+    const size_t NUM_JOINTS = 100;
+    const int NUM_SAMPLES = 1000;
+
+    std::mt19937 generator(5);
+    auto frames = makeFrames(NUM_FRAMES, NUM_JOINTS, generator);
+    AnimClipData clipData(frames);
+    std::vector<AnimPoseBuffer> buffers;
+    for (auto& frame : frames) {
+        buffers.emplace_back(frame);
+    }
+
+    // what AnimClip::evaluate does per update, with and without decoding the two frames first
+    AnimPoseBuffer prevFrame;
+    AnimPoseBuffer nextFrame;
+    AnimPoseVec poses;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_SAMPLES; i++) {
+            float frame = (float)(NUM_FRAMES - 1) * (float)i / (float)NUM_SAMPLES;
+            size_t prevIndex = (size_t)frame;
+            size_t nextIndex = prevIndex + 1;
+            float alpha = frame - (float)prevIndex;
+            if (compressed) {
+                clipData.decodeFrame(prevIndex, prevFrame);
+                clipData.decodeFrame(nextIndex, nextFrame);
+                AnimPoseBuffer::blend(prevFrame, nextFrame, alpha, poses);
+            } else {
+                AnimPoseBuffer::blend(buffers[prevIndex], buffers[nextIndex], alpha, poses);
+            }
+        }
+    }
+}
@@ -0,0 +1,30 @@
+//
+//  AnimClipDataTests.h
+//  tests/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimClipDataTests_h
+#define hifi_AnimClipDataTests_h
+
+#include <QtTest/QtTest>
+
+class AnimClipDataTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void testRotationQuantization();
+    void testDecodeFrames();
+    void testMirrored();
+    void testSharedBetweenClips();
+    void benchmarkSampling_data();
+    void benchmarkSampling();
+};
+
+#endif // hifi_AnimClipDataTests_h
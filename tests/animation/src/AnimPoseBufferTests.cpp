@@ -0,0 +1,225 @@
+//
+//  AnimPoseBufferTests.cpp
+//  tests/animation/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimPoseBufferTests.h"
+
+#include <random>
+
+#include <AnimPoseBuffer.h>
+#include <AnimUtil.h>
+#include <GLMHelpers.h>
+
+QTEST_GUILESS_MAIN(AnimPoseBufferTests)
+
+const float TEST_EPSILON = 0.0001f;
+
+static AnimPoseVec randomPoses(size_t numPoses, std::mt19937& generator, bool uniformScale) {
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scales(0.5f, 2.0f);
+
+    AnimPoseVec poses(numPoses);
+    for (auto& pose : poses) {
+        float scale = scales(generator);
+        pose.scale() = uniformScale ? glm::vec3(scale) : glm::vec3(scale, scales(generator), scales(generator));
+        pose.rot() = glm::normalize(glm::quat(unit(generator), unit(generator), unit(generator), unit(generator)));
+        pose.trans() = 10.0f * glm::vec3(unit(generator), unit(generator), unit(generator));
+    }
+    return poses;
+}
+
+// every joint's parent comes before it, like an AnimSkeleton's
+static std::vector<int> randomHierarchy(size_t numJoints, std::mt19937& generator) {
+    std::vector<int> parentIndices(numJoints, -1);
+    for (size_t i = 1; i < numJoints; i++) {
+        std::uniform_int_distribution<int> parents(std::max(0, (int)i - 4), (int)i - 1);
+        parentIndices[i] = parents(generator);
+    }
+    return parentIndices;
+}
+
+static bool posesAreClose(const AnimPose& a, const AnimPose& b, float epsilon) {
+    return glm::length(a.scale() - b.scale()) <= epsilon * glm::max(1.0f, glm::length(b.scale())) &&
+        glm::length(a.trans() - b.trans()) <= epsilon * glm::max(1.0f, glm::length(b.trans())) &&
+        glm::abs(glm::dot(a.rot(), b.rot())) >= 1.0f - epsilon;
+}
+
+void AnimPoseBufferTests::testRoundTrip() {
+    std::mt19937 generator(1);
+    for (size_t numPoses : { 0, 1, 3, 4, 5, 50 }) {
+        AnimPoseVec poses = randomPoses(numPoses, generator, false);
+        AnimPoseBuffer buffer(poses);
+        QCOMPARE(buffer.size(), numPoses);
+
+        AnimPoseVec result;
+        buffer.getPoses(result);
+        QCOMPARE(result.size(), numPoses);
+        for (size_t i = 0; i < numPoses; i++) {
+            QCOMPARE(result[i].scale(), poses[i].scale());
+            QCOMPARE(result[i].rot(), poses[i].rot());
+            QCOMPARE(result[i].trans(), poses[i].trans());
+        }
+
+        // growing keeps the existing poses and adds identity ones
+        buffer.resize(numPoses + 2);
+        QCOMPARE(buffer.getPose(numPoses).rot(), glm::quat());
+        QCOMPARE(buffer.getPose(numPoses + 1).scale(), glm::vec3(1.0f));
+        if (numPoses > 0) {
+            QCOMPARE(buffer.getPose(0).trans(), poses[0].trans());
+        }
+    }
+}
+
+void AnimPoseBufferTests::testBlendMatchesAnimPoseVec() {
+    std::mt19937 generator(2);
+    for (size_t numPoses : { 1, 7, 8, 53 }) {
+        AnimPoseVec a = randomPoses(numPoses, generator, false);
+        AnimPoseVec b = randomPoses(numPoses, generator, false);
+
+        // make some of the rotations land in the opposite hemisphere, which the blend has to flip
+        for (size_t i = 0; i < numPoses; i += 3) {
+            b[i].rot() = -a[i].rot();
+        }
+
+        AnimPoseBuffer bufferA(a);
+        AnimPoseBuffer bufferB(b);
+        for (float alpha : { 0.0f, 0.25f, 0.5f, 0.9f, 1.0f }) {
+            AnimPoseVec expected(numPoses);
+            ::blend(numPoses, a.data(), b.data(), alpha, expected.data());
+
+            AnimPoseVec poses;
+            AnimPoseBuffer::blend(bufferA, bufferB, alpha, poses);
+            QCOMPARE(poses.size(), numPoses);
+
+            AnimPoseBuffer buffer;
+            AnimPoseBuffer::blend(bufferA, bufferB, alpha, buffer);
+            QCOMPARE(buffer.size(), numPoses);
+
+            for (size_t i = 0; i < numPoses; i++) {
+                QVERIFY(posesAreClose(poses[i], expected[i], TEST_EPSILON));
+                QVERIFY(posesAreClose(buffer.getPose(i), expected[i], TEST_EPSILON));
+                // the same hemisphere as the scalar path, not just the same rotation
+                QVERIFY(glm::dot(poses[i].rot(), expected[i].rot()) > 0.0f);
+            }
+        }
+    }
+}
+
+void AnimPoseBufferTests::testRelativeToAbsoluteMatchesMatrices() {
+    std::mt19937 generator(3);
+    const size_t NUM_JOINTS = 100;
+    std::vector<int> parentIndices = randomHierarchy(NUM_JOINTS, generator);
+
+    // uniform scales take the direct path in AnimPose::operator*, non-uniform ones go through the matrices
+    for (bool uniformScale : { true, false }) {
+        AnimPoseVec relativePoses = randomPoses(NUM_JOINTS, generator, uniformScale);
+
+        // the original matrix multiply and decomposition
+        AnimPoseVec expected = relativePoses;
+        for (size_t i = 0; i < NUM_JOINTS; i++) {
+            if (parentIndices[i] >= 0) {
+                glm::mat4 result;
+                glm_mat4u_mul(expected[parentIndices[i]], expected[i], result);
+                expected[i] = AnimPose(result);
+            }
+        }
+
+        // and the AnimPose multiply AnimSkeleton::convertRelativePosesToAbsolute() uses
+        AnimPoseVec poses = relativePoses;
+        for (size_t i = 0; i < NUM_JOINTS; i++) {
+            if (parentIndices[i] >= 0) {
+                poses[i] = poses[parentIndices[i]] * poses[i];
+            }
+            QVERIFY(posesAreClose(poses[i], expected[i], 0.001f));
+        }
+    }
+
+    // the direct path picks the same quat sign as the decomposition
+    AnimPose parent(glm::vec3(2.0f), glm::angleAxis(2.5f, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(1.0f, 2.0f, 3.0f));
+    AnimPose child(glm::vec3(1.0f, 0.5f, 3.0f), glm::angleAxis(2.0f, glm::vec3(1.0f, 0.0f, 0.0f)), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 result;
+    glm_mat4u_mul(parent, child, result);
+    AnimPose expected(result);
+    AnimPose pose = parent * child;
+    QVERIFY(posesAreClose(pose, expected, TEST_EPSILON));
+    QVERIFY(glm::dot(pose.rot(), expected.rot()) > 0.0f);
+}
+
+void AnimPoseBufferTests::benchmarkBlend_data() {
+    QTest::addColumn<int>("numJoints");
+    QTest::addColumn<bool>("useBuffer");
+    for (int numJoints : { 50, 100, 200 }) {
+        QTest::newRow(qPrintable(QString("AnimPoseVec %1").arg(numJoints))) << numJoints << false;
+        QTest::newRow(qPrintable(QString("AnimPoseBuffer %1").arg(numJoints))) << numJoints << true;
+    }
+}
+
+void AnimPoseBufferTests::benchmarkBlend() {
+    QFETCH(int, numJoints);
+    QFETCH(bool, useBuffer);
+    const int NUM_BLENDS = 1000;
+
+    std::mt19937 generator(5);
+    AnimPoseVec a = randomPoses(numJoints, generator, false);
+    AnimPoseVec b = randomPoses(numJoints, generator, false);
+    AnimPoseBuffer bufferA(a);
+    AnimPoseBuffer bufferB(b);
+    AnimPoseVec result(numJoints);
+
+    QBENCHMARK {
+        for (int i = 0; i < NUM_BLENDS; i++) {
+            float alpha = (float)i / (float)NUM_BLENDS;
+            if (useBuffer) {
+                AnimPoseBuffer::blend(bufferA, bufferB, alpha, result);
+            } else {
+                ::blend(numJoints, a.data(), b.data(), alpha, result.data());
+            }
+        }
+    }
+}
+
+void AnimPoseBufferTests::benchmarkRelativeToAbsolute_data() {
+    QTest::addColumn<int>("numJoints");
+    QTest::addColumn<bool>("useMatrices");
+    for (int numJoints : { 50, 100, 200 }) {
+        QTest::newRow(qPrintable(QString("matrices %1").arg(numJoints))) << numJoints << true;
+        QTest::newRow(qPrintable(QString("AnimPose %1").arg(numJoints))) << numJoints << false;
+    }
+}
+
+void AnimPoseBufferTests::benchmarkRelativeToAbsolute() {
+    QFETCH(int, numJoints);
+    QFETCH(bool, useMatrices);
+    const int NUM_CONVERSIONS = 100;
+
+    std::mt19937 generator(6);
+    std::vector<int> parentIndices = randomHierarchy(numJoints, generator);
+    AnimPoseVec relativePoses = randomPoses(numJoints, generator, true);
+    AnimPoseVec poses;
+
+    QBENCHMARK {
+        for (int n = 0; n < NUM_CONVERSIONS; n++) {
+            poses = relativePoses;
+            for (int i = 0; i < numJoints; i++) {
+                int parentIndex = parentIndices[i];
+                if (parentIndex < 0) {
+                    continue;
+                }
+                if (useMatrices) {
+                    glm::mat4 result;
+                    glm_mat4u_mul(poses[parentIndex], poses[i], result);
+                    poses[i] = AnimPose(result);
+                } else {
+                    poses[i] = poses[parentIndex] * poses[i];
+                }
+            }
+        }
+    }
+}
@@ -260,6 +260,128 @@ void AnimTests::testVariant() {
     QVERIFY(q.z == 4.0f);
 }
 
+void AnimTests::testVariantMapKeys() {
+    AnimVariantKey alpha("testAlpha");
+    QVERIFY(!alpha.isEmpty());
+    QVERIFY(alpha.getName() == "testAlpha");
+    QVERIFY(AnimVariantKey("testAlpha") == alpha);
+    QVERIFY(AnimVariantKey::find("testAlpha") == alpha);
+    QVERIFY(AnimVariantKey("testBeta") != alpha);
+    QVERIFY(AnimVariantKey::getName(alpha.getIndex()) == "testAlpha");
+    QVERIFY(AnimVariantKey("").isEmpty());
+
+    // looking up a name that was never interned doesn't intern it
+    int numKeys = AnimVariantKey::getNumKeys();
+    AnimVariantMap vars;
+    QVERIFY(!vars.hasKey("testNeverSet"));
+    QVERIFY(vars.lookup("testNeverSet", 7) == 7);
+    QVERIFY(AnimVariantKey::find("testNeverSet").isEmpty());
+    QCOMPARE(AnimVariantKey::getNumKeys(), numKeys);
+
+    // keys and names address the same variables
+    vars.set(alpha, 0.25f);
+    QVERIFY(vars.hasKey("testAlpha"));
+    QVERIFY(vars.lookup("testAlpha", 1.0f) == 0.25f);
+    vars.set("testPosition", glm::vec3(1.0f, 2.0f, 3.0f));
+    QVERIFY(vars.lookupRaw(AnimVariantKey("testPosition"), glm::vec3()) == glm::vec3(1.0f, 2.0f, 3.0f));
+    vars.setTrigger("testTrigger");
+    QVERIFY(vars.lookup(AnimVariantKey("testTrigger"), false));
+
+    // empty keys are never set
+    vars.set(AnimVariantKey(), 1.0f);
+    QVERIFY(!vars.hasKey(AnimVariantKey()));
+    QVERIFY(vars.lookup(AnimVariantKey(), 2.0f) == 2.0f);
+
+    vars.unset(alpha);
+    QVERIFY(!vars.hasKey(alpha));
+    QVERIFY(vars.lookup(alpha, 1.0f) == 1.0f);
+
+    AnimVariantMap other;
+    other.set(alpha, 3);
+    other.set("testPosition", glm::vec3(4.0f, 5.0f, 6.0f));
+    vars.copyVariantsFrom(other);
+    QVERIFY(vars.lookup(alpha, 0) == 3);
+    QVERIFY(vars.lookupRaw("testPosition", glm::vec3()) == glm::vec3(4.0f, 5.0f, 6.0f));
+    QVERIFY(vars.lookup("testTrigger", false));
+
+    auto debugMap = vars.toDebugMap();
+    QCOMPARE((int)debugMap.size(), 3);
+    QVERIFY(debugMap["testAlpha"] == "3");
+
+    vars.clearMap();
+    QVERIFY(!vars.hasKey("testTrigger"));
+    QVERIFY(vars.toDebugMap().empty());
+}
+
+namespace {
+
+const int NUM_AVATARS = 100;
+const int NUM_SET_VARIABLES = 100;
+const int NUM_READ_VARIABLES = 50;
+
+// What a frame of Rig::updateAnimations does to the variables of each avatar: start from the triggers of the previous
+// frame, set the controller and locomotion variables, and have the nodes of the graph read theirs.
+template <typename Key>
+float updateAvatarVariables(std::vector<AnimVariantMap>& avatarVars, const std::vector<Key>& setKeys,
+                            const std::vector<Key>& readKeys, float time) {
+    float sum = 0.0f;
+    for (auto& vars : avatarVars) {
+        AnimVariantMap triggersOut;
+        for (int i = 0; i < NUM_SET_VARIABLES; i++) {
+            switch (i % 3) {
+                case 0:
+                    vars.set(setKeys[i], time);
+                    break;
+                case 1:
+                    vars.set(setKeys[i], (i % 2) == 0);
+                    break;
+                default:
+                    vars.set(setKeys[i], glm::vec3(time, 0.0f, 1.0f));
+                    break;
+            }
+        }
+        for (int i = 0; i < NUM_READ_VARIABLES; i++) {
+            sum += vars.lookup(readKeys[i], 0.0f);
+            sum += vars.lookupRigToGeometry(readKeys[i], Vectors::ZERO).x;
+        }
+        triggersOut.setTrigger(readKeys[0]);
+        vars = std::move(triggersOut);
+    }
+    return sum;
+}
+
+}
+
+void AnimTests::benchmarkAvatarVariables() {
+    std::vector<AnimVariantKey> setKeys;
+    for (int i = 0; i < NUM_SET_VARIABLES; i++) {
+        setKeys.emplace_back(QString("benchmarkVariable%1").arg(i));
+    }
+    std::vector<AnimVariantKey> readKeys(setKeys.begin() + NUM_SET_VARIABLES - NUM_READ_VARIABLES, setKeys.end());
+    std::vector<AnimVariantMap> avatarVars(NUM_AVATARS);
+
+    float time = 0.0f;
+    QBENCHMARK {
+        time += 1.0f / 60.0f;
+        updateAvatarVariables(avatarVars, setKeys, readKeys, time);
+    }
+}
+
+void AnimTests::benchmarkAvatarVariablesByName() {
+    std::vector<QString> setNames;
+    for (int i = 0; i < NUM_SET_VARIABLES; i++) {
+        setNames.push_back(QString("benchmarkVariable%1").arg(i));
+    }
+    std::vector<QString> readNames(setNames.begin() + NUM_SET_VARIABLES - NUM_READ_VARIABLES, setNames.end());
+    std::vector<AnimVariantMap> avatarVars(NUM_AVATARS);
+
+    float time = 0.0f;
+    QBENCHMARK {
+        time += 1.0f / 60.0f;
+        updateAvatarVariables(avatarVars, setNames, readNames, time);
+    }
+}
+
 void AnimTests::testAccumulateTime() {
 
     float startFrame = 0.0f;
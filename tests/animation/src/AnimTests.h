@@ -25,6 +25,9 @@ private slots:
     void testClipEvaulateWithVars();
     void testLoader();
     void testVariant();
+    void testVariantMapKeys();
+    void benchmarkAvatarVariables();
+    void benchmarkAvatarVariablesByName();
     void testAccumulateTime();
     void testAnimPose();
     void testExpressionTokenizer();
@@ -0,0 +1,176 @@
+//
+//  BakerTests.cpp
+//  tests/model-baker/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakerTests.h"
+
+#include <model-baker/Baker.h>
+#include <model-baker/CalculateBlendshapeNormalsTask.h>
+#include <model-baker/CalculateBlendshapeTangentsTask.h>
+
+QTEST_GUILESS_MAIN(BakerTests)
+
+namespace {
+
+const int NUM_MESHES = 8;
+const int GRID_SIZE = 32;
+const int NUM_BLENDSHAPES = 3;
+
+// A wavy grid with texture coordinates and blendshapes, but no normals or tangents, so the baker computes them
+hfm::Mesh createMesh(int meshIndex, int numBlendshapes) {
+    hfm::Mesh mesh;
+    mesh.meshIndex = meshIndex;
+    for (int y = 0; y < GRID_SIZE; ++y) {
+        for (int x = 0; x < GRID_SIZE; ++x) {
+            float height = sinf(0.3f * (float)(x + meshIndex)) * cosf(0.2f * (float)y);
+            mesh.vertices.push_back(glm::vec3((float)x, height, (float)y));
+            mesh.texCoords.push_back(glm::vec2((float)x, (float)y) / (float)GRID_SIZE);
+        }
+    }
+
+    hfm::MeshPart part;
+    for (int y = 0; y < GRID_SIZE - 1; ++y) {
+        for (int x = 0; x < GRID_SIZE - 1; ++x) {
+            int corner = y * GRID_SIZE + x;
+            part.triangleIndices << corner << corner + GRID_SIZE << corner + 1;
+            part.triangleIndices << corner + 1 << corner + GRID_SIZE << corner + GRID_SIZE + 1;
+        }
+    }
+    mesh.parts.push_back(part);
+
+    for (int b = 0; b < numBlendshapes; ++b) {
+        hfm::Blendshape blendshape;
+        for (int i = b % 3; i < mesh.vertices.size(); i += 3) {
+            blendshape.indices.push_back(i);
+            blendshape.vertices.push_back(mesh.vertices[i] + glm::vec3(0.0f, 0.1f * (float)(b + 1), 0.0f));
+        }
+        mesh.blendshapes.push_back(blendshape);
+    }
+    return mesh;
+}
+
+hfm::Model::Pointer createModel() {
+    auto model = std::make_shared<hfm::Model>();
+    for (int m = 0; m < NUM_MESHES; ++m) {
+        model->meshes.push_back(createMesh(m, NUM_BLENDSHAPES));
+        model->meshIndicesToModelNames.insert(m, QString("mesh%1").arg(m));
+    }
+    return model;
+}
+
+std::shared_ptr<baker::Baker> bake(bool isParallel) {
+    auto baker = std::make_shared<baker::Baker>(createModel(), hifi::VariantHash(), hifi::URL());
+    auto config = baker->getConfiguration();
+    config->setParallel(isParallel);
+    config->getJobConfig("BuildDracoMesh")->setEnabled(true);
+    baker->run();
+    return baker;
+}
+
+using BlendshapeNormalsInput = CalculateBlendshapeNormalsTask::Input;
+using BlendshapeTangentsInput = CalculateBlendshapeTangentsTask::Input;
+
+void calculateBlendshapes(const std::vector<hfm::Mesh>& meshes, CalculateBlendshapeNormalsTask::Output& normals,
+                          CalculateBlendshapeTangentsTask::Output& tangents) {
+    BlendshapeNormalsInput normalsInput;
+    for (const auto& mesh : meshes) {
+        normalsInput.edit0().push_back(mesh.blendshapes.toStdVector());
+    }
+    normalsInput.edit1() = meshes;
+    CalculateBlendshapeNormalsTask().run(nullptr, normalsInput, normals);
+
+    BlendshapeTangentsInput tangentsInput;
+    tangentsInput.edit0() = normals;
+    tangentsInput.edit1() = normalsInput.get0();
+    tangentsInput.edit2() = meshes;
+    CalculateBlendshapeTangentsTask().run(nullptr, tangentsInput, tangents);
+}
+
+}
+
+void BakerTests::testParallelBakeIsDeterministic() {
+    auto expected = bake(false);
+    const auto& expectedMeshes = expected->getHFMModel()->meshes;
+    QCOMPARE(expectedMeshes.size(), NUM_MESHES);
+
+    for (int run = 0; run < 10; ++run) {
+        auto actual = bake(true);
+        const auto& meshes = actual->getHFMModel()->meshes;
+        QCOMPARE(meshes.size(), expectedMeshes.size());
+
+        for (int m = 0; m < meshes.size(); ++m) {
+            const auto& mesh = meshes[m];
+            const auto& expectedMesh = expectedMeshes[m];
+            QVERIFY(!mesh.normals.isEmpty());
+            QVERIFY(!mesh.tangents.isEmpty());
+            QVERIFY(mesh.normals == expectedMesh.normals);
+            QVERIFY(mesh.tangents == expectedMesh.tangents);
+
+            QCOMPARE(mesh.blendshapes.size(), expectedMesh.blendshapes.size());
+            for (int b = 0; b < mesh.blendshapes.size(); ++b) {
+                QVERIFY(!mesh.blendshapes[b].normals.isEmpty());
+                QVERIFY(mesh.blendshapes[b].normals == expectedMesh.blendshapes[b].normals);
+                QVERIFY(mesh.blendshapes[b].tangents == expectedMesh.blendshapes[b].tangents);
+            }
+
+            QVERIFY(mesh._mesh);
+            QCOMPARE(mesh._mesh->getNumVertices(), expectedMesh._mesh->getNumVertices());
+            QCOMPARE(mesh._mesh->getNumIndices(), expectedMesh._mesh->getNumIndices());
+        }
+
+        QVERIFY(actual->getDracoErrors() == expected->getDracoErrors());
+        QVERIFY(actual->getDracoMeshes() == expected->getDracoMeshes());
+        QVERIFY(actual->getDracoMaterialLists() == expected->getDracoMaterialLists());
+    }
+}
+
+void BakerTests::testBlendshapePassesMatchSerial() {
+    const int NUM_MANY_BLENDSHAPES = 60;
+    std::vector<hfm::Mesh> meshes { createMesh(0, NUM_MANY_BLENDSHAPES), createMesh(1, 0), createMesh(2, 7) };
+
+    CalculateBlendshapeNormalsTask::Output normals;
+    CalculateBlendshapeTangentsTask::Output tangents;
+    calculateBlendshapes(meshes, normals, tangents);
+    QCOMPARE(normals.size(), meshes.size());
+    QCOMPARE(tangents.size(), meshes.size());
+
+    // Every blendshape is baked on its own, and must land in the same slot with the same bits as the parallel pass
+    for (size_t m = 0; m < meshes.size(); ++m) {
+        const auto& mesh = meshes[m];
+        QCOMPARE(normals[m].size(), (size_t)mesh.blendshapes.size());
+        QCOMPARE(tangents[m].size(), (size_t)mesh.blendshapes.size());
+        for (int b = 0; b < mesh.blendshapes.size(); ++b) {
+            hfm::Mesh singleMesh = mesh;
+            singleMesh.blendshapes = { mesh.blendshapes[b] };
+
+            CalculateBlendshapeNormalsTask::Output expectedNormals;
+            CalculateBlendshapeTangentsTask::Output expectedTangents;
+            calculateBlendshapes({ singleMesh }, expectedNormals, expectedTangents);
+
+            QVERIFY(!normals[m][b].empty());
+            QVERIFY(!tangents[m][b].empty());
+            QVERIFY(normals[m][b] == expectedNormals[0][0]);
+            QVERIFY(tangents[m][b] == expectedTangents[0][0]);
+        }
+    }
+}
+
+void BakerTests::benchmarkBlendshapePasses() {
+    std::vector<hfm::Mesh> meshes;
+    for (int m = 0; m < 4; ++m) {
+        meshes.push_back(createMesh(m, 50));
+    }
+
+    QBENCHMARK {
+        CalculateBlendshapeNormalsTask::Output normals;
+        CalculateBlendshapeTangentsTask::Output tangents;
+        calculateBlendshapes(meshes, normals, tangents);
+    }
+}
@@ -0,0 +1,25 @@
+//
+//  BakerTests.h
+//  tests/model-baker/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakerTests_h
+#define hifi_BakerTests_h
+
+#include <QtTest/QtTest>
+
+class BakerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testParallelBakeIsDeterministic();
+    void testBlendshapePassesMatchSerial();
+    void benchmarkBlendshapePasses();
+};
+
+#endif // hifi_BakerTests_h
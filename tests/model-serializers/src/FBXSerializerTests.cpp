@@ -0,0 +1,274 @@
+//
+//  FBXSerializerTests.cpp
+//  tests/model-serializers/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FBXSerializerTests.h"
+
+#include <cmath>
+
+#include <QtCore/QTemporaryFile>
+
+#include <FBXSerializer.h>
+#include <FBXWriter.h>
+
+QTEST_GUILESS_MAIN(FBXSerializerTests)
+
+// Set to the path of a large binary FBX, like a full avatar, to benchmark parsing it
+static const char* BENCHMARK_FILE_VARIABLE = "HIFI_FBX_BENCHMARK_FILE";
+
+// Set to benchmark a generated mesh the size of a detailed avatar, rather than a small one
+static const char* LARGE_BENCHMARKS_VARIABLE = "HIFI_LARGE_BENCHMARKS";
+
+namespace {
+
+template <class T>
+bool isSameVector(const QVariant& a, const QVariant& b) {
+    return a.value<QVector<T>>() == b.value<QVector<T>>();
+}
+
+bool isSameProperty(const QVariant& a, const QVariant& b) {
+    if (a.userType() != b.userType()) {
+        return false;
+    }
+    int type = a.userType();
+    if (type == qMetaTypeId<QVector<float>>()) {
+        return isSameVector<float>(a, b);
+    } else if (type == qMetaTypeId<QVector<double>>()) {
+        return isSameVector<double>(a, b);
+    } else if (type == qMetaTypeId<QVector<qint64>>()) {
+        return isSameVector<qint64>(a, b);
+    } else if (type == qMetaTypeId<QVector<qint32>>()) {
+        return isSameVector<qint32>(a, b);
+    } else if (type == qMetaTypeId<QVector<bool>>()) {
+        return isSameVector<bool>(a, b);
+    }
+    return a == b;
+}
+
+bool isSameNode(const FBXNode& a, const FBXNode& b) {
+    if (a.name != b.name || a.properties.size() != b.properties.size() || a.children.size() != b.children.size()) {
+        return false;
+    }
+    for (int i = 0; i < a.properties.size(); i++) {
+        if (!isSameProperty(a.properties[i], b.properties[i])) {
+            return false;
+        }
+    }
+    for (int i = 0; i < a.children.size(); i++) {
+        if (!isSameNode(a.children[i], b.children[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+FBXNode createNode(const char* name, const QVariantList& properties, const FBXNodeList& children = FBXNodeList()) {
+    FBXNode node;
+    node.name = name;
+    node.properties = properties;
+    node.children = children;
+    return node;
+}
+
+// A grid mesh, big enough for FBXWriter to compress its arrays
+FBXNode createMeshTree(int gridSize) {
+    QVector<double> vertices;
+    QVector<double> normals;
+    QVector<double> uvs;
+    for (int y = 0; y < gridSize; y++) {
+        for (int x = 0; x < gridSize; x++) {
+            vertices << (double)x << sin(0.1 * x) * cos(0.1 * y) << (double)y;
+            uvs << (double)x / gridSize << (double)y / gridSize;
+        }
+    }
+    QVector<qint32> polygonIndices;
+    for (int y = 0; y < gridSize - 1; y++) {
+        for (int x = 0; x < gridSize - 1; x++) {
+            int corner = y * gridSize + x;
+            // the last index of each polygon is stored as -index - 1
+            polygonIndices << corner << corner + gridSize << corner + gridSize + 1 << -(corner + 1) - 1;
+            for (int i = 0; i < 4; i++) {
+                normals << 0.0 << 1.0 << 0.0;
+            }
+        }
+    }
+
+    const qint64 GEOMETRY_ID = 1001;
+    const qint64 MODEL_ID = 1002;
+
+    FBXNode geometry = createNode("Geometry", { GEOMETRY_ID, QByteArray("Grid\0\1Geometry", 14), QByteArray("Mesh") }, {
+        createNode("Vertices", { QVariant::fromValue(vertices) }),
+        createNode("PolygonVertexIndex", { QVariant::fromValue(polygonIndices) }),
+        createNode("LayerElementNormal", { 0 }, {
+            createNode("MappingInformationType", { QByteArray("ByPolygonVertex") }),
+            createNode("ReferenceInformationType", { QByteArray("Direct") }),
+            createNode("Normals", { QVariant::fromValue(normals) })
+        }),
+        createNode("LayerElementUV", { 0 }, {
+            createNode("MappingInformationType", { QByteArray("ByVertice") }),
+            createNode("ReferenceInformationType", { QByteArray("Direct") }),
+            createNode("UV", { QVariant::fromValue(uvs) })
+        })
+    });
+    FBXNode model = createNode("Model", { MODEL_ID, QByteArray("Grid\0\1Model", 11), QByteArray("Mesh") });
+
+    FBXNode root;
+    root.children = {
+        createNode("GlobalSettings", {}, {
+            createNode("Properties70", {}, {
+                createNode("P", { QByteArray("UnitScaleFactor"), QByteArray("double"), QByteArray("Number"), QByteArray(""), 1.0 })
+            })
+        }),
+        createNode("Objects", {}, { geometry, model }),
+        createNode("Connections", {}, {
+            createNode("C", { QByteArray("OO"), GEOMETRY_ID, MODEL_ID }),
+            createNode("C", { QByteArray("OO"), MODEL_ID, (qint64)0 })
+        })
+    };
+    return root;
+}
+
+}
+
+void FBXSerializerTests::testBinaryRoundTrip() {
+    QVector<float> floats;
+    QVector<double> doubles;
+    QVector<qint64> longs;
+    QVector<qint32> ints;
+    QVector<bool> bools;
+    for (int i = 0; i < 5000; i++) {
+        floats << 0.5f * i;
+        doubles << 0.25 * i;
+        longs << (qint64)i << -(qint64)i;
+        ints << i % 7;
+        bools << (i % 3 == 0);
+    }
+
+    FBXNode root;
+    root.children = {
+        createNode("Scalars", { QVariant::fromValue((qint16)-12), true, false, (qint32)123456, 1.5f, 2.25, (qint64)1 << 40, QByteArray("text") }),
+        createNode("Small", { QVariant::fromValue(QVector<float> { 1.0f, 2.0f }), QVariant::fromValue(QVector<qint32>()) }),
+        // these are big enough for FBXWriter to compress them
+        createNode("Arrays", {
+            QVariant::fromValue(floats), QVariant::fromValue(doubles), QVariant::fromValue(longs),
+            QVariant::fromValue(ints), QVariant::fromValue(bools)
+        }, {
+            createNode("Child", { QByteArray("with\0null", 9) }, { createNode("Leaf", { (qint32)1 }) }),
+            createNode("Empty", {})
+        })
+    };
+
+    auto data = FBXWriter::encodeFBX(root);
+    QVERIFY(data.startsWith("Kaydara FBX Binary  "));
+
+    FBXNode parsed = FBXSerializer::parseFBX(data);
+    QVERIFY(isSameNode(parsed, root));
+
+    // through a device, as model loading does
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+    QVERIFY(isSameNode(FBXSerializer::parseFBX(&buffer), root));
+
+    // from a device that has to be read into memory first
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write(data), (qint64)data.size());
+    QVERIFY(file.seek(0));
+    QVERIFY(isSameNode(FBXSerializer::parseFBX(&file), root));
+
+    // and from a buffer that doesn't own its bytes
+    auto rawData = QByteArray::fromRawData(data.constData(), data.size());
+    QVERIFY(isSameNode(FBXSerializer::parseFBX(rawData), root));
+}
+
+void FBXSerializerTests::testCorruptFiles() {
+    auto data = FBXWriter::encodeFBX(createMeshTree(64));
+
+    // cut short in the middle of a compressed array
+    QVERIFY_EXCEPTION_THROWN(FBXSerializer::parseFBX(data.left(data.size() / 2)), QString);
+
+    // damaged compressed data
+    auto damaged = data;
+    int vertices = damaged.indexOf("Vertices");
+    QVERIFY(vertices > 0);
+    for (int i = vertices + 40; i < vertices + 80; i++) {
+        damaged[i] = (char)0xff;
+    }
+    QVERIFY_EXCEPTION_THROWN(FBXSerializer::parseFBX(damaged), QString);
+
+    // a header with nothing after it is an empty document
+    FBXNode empty = FBXSerializer::parseFBX(data.left(27));
+    QVERIFY(empty.children.isEmpty());
+}
+
+void FBXSerializerTests::testHFMModelFromBinary() {
+    FBXNode tree = createMeshTree(64);
+
+    // what the serializer extracts from the tree itself is the reference
+    FBXSerializer reference;
+    reference._rootNode = tree;
+    HFMModel::Pointer expected(reference.extractHFMModel(hifi::VariantHash(), "grid.fbx"));
+
+    FBXSerializer serializer;
+    auto actual = serializer.read(FBXWriter::encodeFBX(tree), hifi::VariantHash(), hifi::URL("grid.fbx"));
+    QVERIFY(actual);
+
+    QCOMPARE(actual->meshes.size(), 1);
+    QCOMPARE(actual->meshes.size(), expected->meshes.size());
+    for (int i = 0; i < actual->meshes.size(); i++) {
+        const auto& mesh = actual->meshes[i];
+        const auto& expectedMesh = expected->meshes[i];
+        QVERIFY(!mesh.vertices.isEmpty());
+        QVERIFY(mesh.vertices == expectedMesh.vertices);
+        QVERIFY(mesh.normals == expectedMesh.normals);
+        QVERIFY(mesh.texCoords == expectedMesh.texCoords);
+        QVERIFY(mesh.originalIndices == expectedMesh.originalIndices);
+        QCOMPARE(mesh.parts.size(), expectedMesh.parts.size());
+        for (int j = 0; j < mesh.parts.size(); j++) {
+            QVERIFY(mesh.parts[j].quadIndices == expectedMesh.parts[j].quadIndices);
+            QVERIFY(mesh.parts[j].quadTrianglesIndices == expectedMesh.parts[j].quadTrianglesIndices);
+            QVERIFY(mesh.parts[j].triangleIndices == expectedMesh.parts[j].triangleIndices);
+        }
+        QVERIFY(mesh.modelTransform == expectedMesh.modelTransform);
+    }
+    QCOMPARE(actual->joints.size(), expected->joints.size());
+    QVERIFY(actual->meshExtents.minimum == expected->meshExtents.minimum);
+    QVERIFY(actual->meshExtents.maximum == expected->meshExtents.maximum);
+}
+
+void FBXSerializerTests::benchmarkParseBinary() {
+    // about a million vertices when asked for, in the range of a detailed avatar
+    bool isLarge = !QProcessEnvironment::systemEnvironment().value(LARGE_BENCHMARKS_VARIABLE).isEmpty();
+    auto data = FBXWriter::encodeFBX(createMeshTree(isLarge ? 1024 : 128));
+
+    QBENCHMARK {
+        FBXNode root = FBXSerializer::parseFBX(data);
+        QCOMPARE(root.children.size(), 3);
+    }
+}
+
+void FBXSerializerTests::benchmarkParseFile() {
+    QString path = QProcessEnvironment::systemEnvironment().value(BENCHMARK_FILE_VARIABLE);
+    if (path.isEmpty()) {
+        QSKIP("Set HIFI_FBX_BENCHMARK_FILE to the path of a binary FBX file to benchmark it");
+    }
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    auto mappedData = file.map(0, file.size());
+    QVERIFY(mappedData);
+    auto data = QByteArray::fromRawData((const char*)mappedData, file.size());
+
+    QBENCHMARK {
+        FBXSerializer serializer;
+        auto model = serializer.read(data, hifi::VariantHash(), hifi::URL::fromLocalFile(path));
+        QVERIFY(model);
+    }
+}
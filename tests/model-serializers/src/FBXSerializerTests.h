@@ -0,0 +1,27 @@
+//
+//  FBXSerializerTests.h
+//  tests/model-serializers/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_FBXSerializerTests_h
+#define hifi_FBXSerializerTests_h
+
+#include <QtTest/QtTest>
+
+class FBXSerializerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testBinaryRoundTrip();
+    void testCorruptFiles();
+    void testHFMModelFromBinary();
+    void benchmarkParseBinary();
+    void benchmarkParseFile();
+};
+
+#endif // hifi_FBXSerializerTests_h
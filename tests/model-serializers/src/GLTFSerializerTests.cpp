@@ -0,0 +1,154 @@
+//
+//  GLTFSerializerTests.cpp
+//  tests/model-serializers/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "GLTFSerializerTests.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QtEndian>
+
+#include <DependencyManager.h>
+#include <GLTFSerializer.h>
+#include <ResourceManager.h>
+
+QTEST_GUILESS_MAIN(GLTFSerializerTests)
+
+namespace {
+
+const QVector<glm::vec3> POSITIONS { { 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+const glm::vec3 NORMAL { 0.0f, 0.0f, 1.0f };
+const QVector<quint16> TEXCOORDS { 0, 0, 65535, 0, 65535, 65535, 0, 65535 };
+const QVector<quint16> INDICES { 0, 1, 2, 0, 2, 3 };
+
+template <class T>
+void append(QByteArray& bytes, T value) {
+    value = qToLittleEndian(value);
+    bytes.append((const char*)&value, sizeof(T));
+}
+
+void appendFloat(QByteArray& bytes, float value) {
+    quint32 bits;
+    memcpy(&bits, &value, sizeof(float));
+    append(bytes, bits);
+}
+
+void pad(QByteArray& bytes, char padding) {
+    while (bytes.size() % 4 != 0) {
+        bytes.append(padding);
+    }
+}
+
+// A quad with positions and normals interleaved in one buffer view, normalized texture coordinates and short indices
+QByteArray createGLB() {
+    QByteArray binary;
+    for (const auto& position : POSITIONS) {
+        appendFloat(binary, position.x);
+        appendFloat(binary, position.y);
+        appendFloat(binary, position.z);
+        appendFloat(binary, NORMAL.x);
+        appendFloat(binary, NORMAL.y);
+        appendFloat(binary, NORMAL.z);
+    }
+    const int TEXCOORDS_OFFSET = binary.size();
+    for (auto texCoord : TEXCOORDS) {
+        append(binary, texCoord);
+    }
+    const int INDICES_OFFSET = binary.size();
+    for (auto index : INDICES) {
+        append(binary, index);
+    }
+    pad(binary, 0);
+
+    const int FLOAT = 5126;
+    const int UNSIGNED_SHORT = 5123;
+    QJsonObject json {
+        { "asset", QJsonObject { { "version", "2.0" } } },
+        { "scene", 0 },
+        { "scenes", QJsonArray { QJsonObject { { "nodes", QJsonArray { 0 } } } } },
+        { "nodes", QJsonArray { QJsonObject { { "mesh", 0 } } } },
+        { "meshes", QJsonArray { QJsonObject { { "primitives", QJsonArray { QJsonObject {
+            { "attributes", QJsonObject { { "POSITION", 0 }, { "NORMAL", 1 }, { "TEXCOORD_0", 2 } } },
+            { "indices", 3 }
+        } } } } } },
+        { "buffers", QJsonArray { QJsonObject { { "byteLength", binary.size() } } } },
+        { "bufferViews", QJsonArray {
+            QJsonObject { { "buffer", 0 }, { "byteOffset", 0 }, { "byteLength", TEXCOORDS_OFFSET }, { "byteStride", 24 } },
+            QJsonObject { { "buffer", 0 }, { "byteOffset", TEXCOORDS_OFFSET }, { "byteLength", INDICES_OFFSET - TEXCOORDS_OFFSET } },
+            QJsonObject { { "buffer", 0 }, { "byteOffset", INDICES_OFFSET }, { "byteLength", INDICES.size() * 2 } }
+        } },
+        { "accessors", QJsonArray {
+            QJsonObject { { "bufferView", 0 }, { "byteOffset", 0 }, { "componentType", FLOAT }, { "count", POSITIONS.size() },
+                          { "type", "VEC3" } },
+            QJsonObject { { "bufferView", 0 }, { "byteOffset", 12 }, { "componentType", FLOAT }, { "count", POSITIONS.size() },
+                          { "type", "VEC3" } },
+            QJsonObject { { "bufferView", 1 }, { "componentType", UNSIGNED_SHORT }, { "normalized", true },
+                          { "count", TEXCOORDS.size() / 2 }, { "type", "VEC2" } },
+            QJsonObject { { "bufferView", 2 }, { "componentType", UNSIGNED_SHORT }, { "count", INDICES.size() },
+                          { "type", "SCALAR" } }
+        } }
+    };
+    QByteArray jsonChunk = QJsonDocument(json).toJson(QJsonDocument::Compact);
+    pad(jsonChunk, ' ');
+
+    QByteArray glb("glTF");
+    append(glb, (quint32)2);
+    append(glb, (quint32)(12 + 8 + jsonChunk.size() + 8 + binary.size()));
+    append(glb, (quint32)jsonChunk.size());
+    glb.append("JSON");
+    glb.append(jsonChunk);
+    append(glb, (quint32)binary.size());
+    glb.append("BIN", 4);
+    glb.append(binary);
+    return glb;
+}
+
+}
+
+void GLTFSerializerTests::initTestCase() {
+    DependencyManager::set<ResourceManager>();
+}
+
+void GLTFSerializerTests::cleanupTestCase() {
+    DependencyManager::get<ResourceManager>()->cleanup();
+    DependencyManager::destroy<ResourceManager>();
+}
+
+void GLTFSerializerTests::testInterleavedGLB() {
+    GLTFSerializer serializer;
+    auto model = serializer.read(createGLB(), hifi::VariantHash(), hifi::URL("file:///quad.glb"));
+    QVERIFY(model);
+    QCOMPARE(model->meshes.size(), 1);
+
+    const auto& mesh = model->meshes[0];
+    QVERIFY(mesh.vertices == POSITIONS);
+    QCOMPARE(mesh.normals.size(), POSITIONS.size());
+    for (const auto& normal : mesh.normals) {
+        QCOMPARE(normal, NORMAL);
+    }
+    QCOMPARE(mesh.texCoords.size(), POSITIONS.size());
+    for (int i = 0; i < mesh.texCoords.size(); i++) {
+        QCOMPARE(mesh.texCoords[i], glm::vec2(TEXCOORDS[2 * i] / 65535.0f, TEXCOORDS[2 * i + 1] / 65535.0f));
+    }
+
+    QCOMPARE(mesh.parts.size(), 1);
+    QVector<int> expectedIndices;
+    for (auto index : INDICES) {
+        expectedIndices.push_back(index);
+    }
+    QVERIFY(mesh.parts[0].triangleIndices == expectedIndices);
+}
+
+void GLTFSerializerTests::testTruncatedGLB() {
+    // a binary chunk that claims more than the file holds is dropped rather than read past the end
+    auto glb = createGLB();
+    GLTFSerializer serializer;
+    auto model = serializer.read(glb.left(glb.size() - 16), hifi::VariantHash(), hifi::URL("file:///quad.glb"));
+    QVERIFY(!model || model->meshes.isEmpty() || model->meshes[0].vertices.isEmpty());
+}
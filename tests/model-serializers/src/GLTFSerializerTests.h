@@ -0,0 +1,26 @@
+//
+//  GLTFSerializerTests.h
+//  tests/model-serializers/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_GLTFSerializerTests_h
+#define hifi_GLTFSerializerTests_h
+
+#include <QtTest/QtTest>
+
+class GLTFSerializerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void testInterleavedGLB();
+    void testTruncatedGLB();
+};
+
+#endif // hifi_GLTFSerializerTests_h
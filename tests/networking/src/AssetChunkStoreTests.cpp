@@ -0,0 +1,205 @@
+//
+//  AssetChunkStoreTests.cpp
+//  tests/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetChunkStoreTests.h"
+
+#include <random>
+
+#include <QtCore/QCryptographicHash>
+
+#include <AssetChunkStore.h>
+
+QTEST_GUILESS_MAIN(AssetChunkStoreTests)
+
+static QByteArray makeData(int size, unsigned int seed) {
+    std::mt19937 generator(seed);
+    QByteArray data(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i) {
+        data[i] = (char)(generator() & 0xff);
+    }
+    return data;
+}
+
+// uploads in uneven pieces, the way packets arrive
+static AssetUtils::AssetHash store(AssetChunkStore& chunkStore, const QByteArray& data) {
+    const int PIECE_SIZE = 10007;
+    AssetChunkStore::Writer writer { chunkStore };
+    for (int position = 0; position < data.size(); position += PIECE_SIZE) {
+        if (!writer.addData(data.constData() + position, std::min(PIECE_SIZE, data.size() - position))) {
+            return AssetUtils::AssetHash();
+        }
+    }
+    return writer.finish().toHex();
+}
+
+void AssetChunkStoreTests::testChunkBoundaries() {
+    QByteArray data = makeData(4 * 1024 * 1024, 1);
+
+    // cut the data the way the writer does and check every chunk but the last is within the limits
+    std::vector<int> chunkSizes;
+    int position = 0;
+    while (position < data.size()) {
+        uint64_t rollingHash = 0;
+        int start = position + AssetChunkStore::MIN_CHUNK_SIZE;
+        int searchSize = std::min(data.size(), position + AssetChunkStore::MAX_CHUNK_SIZE) - start;
+        int boundary = searchSize > 0 ? AssetChunkStore::findChunkBoundary(data.constData() + start, searchSize, rollingHash) : -1;
+        int end = boundary >= 0 ? start + boundary : std::min(data.size(), position + AssetChunkStore::MAX_CHUNK_SIZE);
+        chunkSizes.push_back(end - position);
+        position = end;
+    }
+
+    for (size_t i = 0; i + 1 < chunkSizes.size(); ++i) {
+        QVERIFY(chunkSizes[i] >= AssetChunkStore::MIN_CHUNK_SIZE);
+        QVERIFY(chunkSizes[i] <= AssetChunkStore::MAX_CHUNK_SIZE);
+    }
+
+    // random data should average out close to the target size
+    int averageSize = data.size() / (int)chunkSizes.size();
+    QVERIFY(averageSize > AssetChunkStore::AVERAGE_CHUNK_SIZE / 2);
+    QVERIFY(averageSize < AssetChunkStore::AVERAGE_CHUNK_SIZE * 2);
+
+    // and the store cuts the same chunks no matter how the data is split up
+    QTemporaryDir directory;
+    AssetChunkStore chunkStore { QDir(directory.path()) };
+    QVERIFY(chunkStore.initialize());
+    QVERIFY(!store(chunkStore, data).isEmpty());
+    QCOMPARE(chunkStore.getStats().numChunks, (uint64_t)chunkSizes.size());
+}
+
+void AssetChunkStoreTests::testRoundTrip() {
+    QTemporaryDir directory;
+    AssetChunkStore chunkStore { QDir(directory.path()) };
+    QVERIFY(chunkStore.initialize());
+
+    QByteArray data = makeData(1500000, 2);
+    auto hash = store(chunkStore, data);
+    QCOMPARE(hash, AssetUtils::AssetHash(QCryptographicHash::hash(data, QCryptographicHash::Sha256).toHex()));
+
+    QVERIFY(chunkStore.hasAsset(hash));
+    QCOMPARE(chunkStore.getAssetSize(hash), (int64_t)data.size());
+    QCOMPARE(chunkStore.getAssetHashes(), QStringList { hash });
+
+    QCOMPARE(chunkStore.readRange(hash, 0, data.size()), data);
+
+    // ranges inside one chunk, across chunk boundaries and at the very end
+    std::mt19937 generator(3);
+    for (int i = 0; i < 50; ++i) {
+        int64_t offset = generator() % data.size();
+        int64_t size = generator() % std::min<int64_t>(data.size() - offset, 3 * AssetChunkStore::MAX_CHUNK_SIZE);
+        QCOMPARE(chunkStore.readRange(hash, offset, size), data.mid((int)offset, (int)size));
+    }
+    QCOMPARE(chunkStore.readRange(hash, data.size() - 1, 1), data.right(1));
+    QVERIFY(chunkStore.readRange(hash, data.size(), 0).isEmpty());
+
+    // past the end, or an asset that isn't there
+    QVERIFY(chunkStore.readRange(hash, data.size() - 10, 11).isNull());
+    QVERIFY(chunkStore.readRange(hash, -1, 10).isNull());
+    auto missingHash = AssetUtils::AssetHash(QCryptographicHash::hash("missing", QCryptographicHash::Sha256).toHex());
+    QVERIFY(!chunkStore.hasAsset(missingHash));
+    QVERIFY(chunkStore.readRange(missingHash, 0, 1).isNull());
+
+    QString filePath = directory.filePath("copy");
+    QVERIFY(chunkStore.copyAssetToFile(hash, filePath));
+    QFile copy { filePath };
+    QVERIFY(copy.open(QIODevice::ReadOnly));
+    QCOMPARE(copy.readAll(), data);
+
+    // an empty asset has no chunks at all
+    auto emptyHash = store(chunkStore, QByteArray());
+    QVERIFY(chunkStore.hasAsset(emptyHash));
+    QCOMPARE(chunkStore.getAssetSize(emptyHash), (int64_t)0);
+}
+
+void AssetChunkStoreTests::testDeduplication() {
+    QTemporaryDir directory;
+    AssetChunkStore chunkStore { QDir(directory.path()) };
+    QVERIFY(chunkStore.initialize());
+
+    QByteArray original = makeData(2 * 1024 * 1024, 4);
+    auto originalHash = store(chunkStore, original);
+    auto stats = chunkStore.getStats();
+    QCOMPARE(stats.writtenChunkBytes, (uint64_t)original.size());
+
+    // uploading the same asset again writes nothing
+    QCOMPARE(store(chunkStore, original), originalHash);
+    auto again = chunkStore.getStats();
+    QCOMPARE(again.writtenChunkBytes, stats.writtenChunkBytes);
+    QCOMPARE(again.numChunks, stats.numChunks);
+    QCOMPARE(again.numManifests, stats.numManifests);
+
+    // an edit in the middle only writes the chunks around it, however it shifts everything after
+    QByteArray edited = original;
+    edited.insert(original.size() / 2, makeData(100, 5));
+    auto editedHash = store(chunkStore, edited);
+    QVERIFY(editedHash != originalHash);
+
+    auto afterEdit = chunkStore.getStats();
+    uint64_t newBytes = afterEdit.writtenChunkBytes - stats.writtenChunkBytes;
+    QVERIFY(newBytes > 0);
+    QVERIFY(newBytes <= 2 * AssetChunkStore::MAX_CHUNK_SIZE);
+
+    QCOMPARE(chunkStore.readRange(originalHash, 0, original.size()), original);
+    QCOMPARE(chunkStore.readRange(editedHash, 0, edited.size()), edited);
+}
+
+void AssetChunkStoreTests::testStatsAndGarbageCollection() {
+    QTemporaryDir directory;
+    QByteArray first = makeData(1024 * 1024, 6);
+    QByteArray second = makeData(512 * 1024, 7);
+    AssetUtils::AssetHash firstHash;
+    AssetUtils::AssetHash secondHash;
+
+    {
+        AssetChunkStore chunkStore { QDir(directory.path()) };
+        QVERIFY(chunkStore.initialize());
+
+        // the totals follow uploads without waiting for a collection
+        firstHash = store(chunkStore, first);
+        secondHash = store(chunkStore, second);
+        auto stats = chunkStore.getStats();
+        QCOMPARE(stats.numManifests, (uint64_t)2);
+        QCOMPARE(stats.logicalBytes, (uint64_t)(first.size() + second.size()));
+        QCOMPARE(stats.storedBytes, stats.writtenChunkBytes);
+        QCOMPARE(stats.storedBytes, (uint64_t)(first.size() + second.size()));
+        uint64_t numChunks = stats.numChunks;
+
+        // and removals, though the chunks stay until they are collected
+        QVERIFY(chunkStore.removeAsset(secondHash));
+        QVERIFY(!chunkStore.hasAsset(secondHash));
+        stats = chunkStore.getStats();
+        QCOMPARE(stats.numManifests, (uint64_t)1);
+        QCOMPARE(stats.logicalBytes, (uint64_t)first.size());
+        QCOMPARE(stats.numChunks, numChunks);
+
+        chunkStore.collectGarbage();
+        stats = chunkStore.getStats();
+        QCOMPARE(stats.numManifests, (uint64_t)1);
+        QCOMPARE(stats.storedBytes, (uint64_t)first.size());
+        QVERIFY(stats.numChunks < numChunks);
+        QCOMPARE(chunkStore.readRange(firstHash, 0, first.size()), first);
+    }
+
+    // a new store counts what is on disk when it starts
+    AssetChunkStore reopened { QDir(directory.path()) };
+    QVERIFY(reopened.initialize());
+    auto stats = reopened.getStats();
+    QCOMPARE(stats.numManifests, (uint64_t)1);
+    QCOMPARE(stats.logicalBytes, (uint64_t)first.size());
+    QCOMPARE(stats.storedBytes, (uint64_t)first.size());
+    QCOMPARE(reopened.readRange(firstHash, 0, first.size()), first);
+
+    QVERIFY(reopened.removeAsset(firstHash));
+    reopened.collectGarbage();
+    stats = reopened.getStats();
+    QCOMPARE(stats.numManifests, (uint64_t)0);
+    QCOMPARE(stats.numChunks, (uint64_t)0);
+    QCOMPARE(stats.storedBytes, (uint64_t)0);
+}
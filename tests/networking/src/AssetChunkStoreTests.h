@@ -0,0 +1,27 @@
+//
+//  AssetChunkStoreTests.h
+//  tests/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetChunkStoreTests_h
+#define hifi_AssetChunkStoreTests_h
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+
+class AssetChunkStoreTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testChunkBoundaries();
+    void testRoundTrip();
+    void testDeduplication();
+    void testStatsAndGarbageCollection();
+};
+
+#endif // hifi_AssetChunkStoreTests_h
@@ -0,0 +1,261 @@
+//
+//  AssetMappingStoreTests.cpp
+//  tests/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetMappingStoreTests.h"
+
+#include <limits>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QProcessEnvironment>
+
+#include <AssetMappingStore.h>
+
+QTEST_GUILESS_MAIN(AssetMappingStoreTests)
+
+// the million mapping run takes a while, so it only runs when asked for
+static const char* LARGE_BENCHMARKS_VARIABLE = "HIFI_LARGE_BENCHMARKS";
+
+static AssetUtils::AssetHash makeHash(int i) {
+    return QCryptographicHash::hash(QByteArray::number(i), QCryptographicHash::Sha256).toHex();
+}
+
+static AssetUtils::AssetPath makePath(int i) {
+    // spread the mappings over folders so the prefix queries have something to find
+    return QString("/folder%1/sub%2/asset%3.fbx").arg(i % 100).arg((i / 100) % 10).arg(i);
+}
+
+QString AssetMappingStoreTests::snapshotPath() const {
+    return _testDir.filePath("map.json");
+}
+
+QString AssetMappingStoreTests::logPath() const {
+    return _testDir.filePath("map.log");
+}
+
+void AssetMappingStoreTests::testCommitAndReload() {
+    QFile::remove(snapshotPath());
+    QFile::remove(logPath());
+
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(snapshotPath(), logPath()));
+
+        AssetMappingStore::Transaction transaction;
+        transaction.setMapping("/a.fbx", makeHash(1));
+        transaction.setMapping("/b.fbx", makeHash(2));
+        QVERIFY(store.commit(transaction));
+
+        AssetMappingStore::Transaction deletion;
+        deletion.deleteMapping("/a.fbx");
+        QVERIFY(store.commit(deletion));
+
+        QCOMPARE(store.size(), (size_t)1);
+    }
+
+    // nothing was compacted, so the reload has to come from replaying the log
+    QVERIFY(!QFile::exists(snapshotPath()));
+
+    AssetMappingStore reloaded;
+    QVERIFY(reloaded.load(snapshotPath(), logPath()));
+    QCOMPARE(reloaded.size(), (size_t)1);
+    QVERIFY(reloaded.find("/a.fbx") == reloaded.end());
+    QCOMPARE(reloaded.find("/b.fbx")->second, makeHash(2));
+}
+
+void AssetMappingStoreTests::testTornLogRecordIsDiscarded() {
+    QFile::remove(snapshotPath());
+    QFile::remove(logPath());
+
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(snapshotPath(), logPath()));
+
+        AssetMappingStore::Transaction first;
+        first.setMapping("/first.fbx", makeHash(1));
+        QVERIFY(store.commit(first));
+
+        AssetMappingStore::Transaction second;
+        second.setMapping("/second.fbx", makeHash(2));
+        QVERIFY(store.commit(second));
+    }
+
+    // simulate a crash in the middle of writing the second record
+    QFile log { logPath() };
+    auto fullSize = log.size();
+    QVERIFY(log.resize(fullSize - 3));
+
+    AssetMappingStore reloaded;
+    QVERIFY(reloaded.load(snapshotPath(), logPath()));
+    QCOMPARE(reloaded.size(), (size_t)1);
+    QVERIFY(reloaded.find("/first.fbx") != reloaded.end());
+    QVERIFY(reloaded.find("/second.fbx") == reloaded.end());
+}
+
+void AssetMappingStoreTests::testCompaction() {
+    QFile::remove(snapshotPath());
+    QFile::remove(logPath());
+
+    const int NUM_MAPPINGS = 50;
+    {
+        AssetMappingStore store;
+        QVERIFY(store.load(snapshotPath(), logPath()));
+        store.setMinCompactionLogSize(256);
+
+        for (int i = 0; i < NUM_MAPPINGS; ++i) {
+            AssetMappingStore::Transaction transaction;
+            transaction.setMapping(makePath(i), makeHash(i));
+            QVERIFY(store.commit(transaction));
+        }
+    }
+
+    // the snapshot keeps the historical map.json format
+    QFile snapshot { snapshotPath() };
+    QVERIFY(snapshot.open(QIODevice::ReadOnly));
+    auto document = QJsonDocument::fromJson(snapshot.readAll());
+    QVERIFY(document.isObject());
+    QVERIFY(document.object().size() > 0);
+
+    // compaction kicked in once the log caught up with the snapshot, so it never gets much bigger
+    QVERIFY(QFileInfo(logPath()).size() < snapshot.size());
+
+    AssetMappingStore reloaded;
+    QVERIFY(reloaded.load(snapshotPath(), logPath()));
+    QCOMPARE(reloaded.size(), (size_t)NUM_MAPPINGS);
+    for (int i = 0; i < NUM_MAPPINGS; ++i) {
+        QCOMPARE(reloaded.find(makePath(i))->second, makeHash(i));
+    }
+
+    // loading folds the replayed log into the snapshot
+    QCOMPARE(QFileInfo(logPath()).size(), (qint64)0);
+}
+
+void AssetMappingStoreTests::testPrefixRange() {
+    QFile::remove(snapshotPath());
+    QFile::remove(logPath());
+
+    AssetMappingStore store;
+    QVERIFY(store.load(snapshotPath(), logPath()));
+
+    AssetMappingStore::Transaction transaction;
+    transaction.setMapping("/models/a.fbx", makeHash(1));
+    transaction.setMapping("/models/b.fbx", makeHash(2));
+    transaction.setMapping("/models/nested/c.fbx", makeHash(3));
+    transaction.setMapping("/models-old/d.fbx", makeHash(4));
+    transaction.setMapping("/textures/e.png", makeHash(5));
+    QVERIFY(store.commit(transaction));
+
+    auto range = store.getMappingsWithPrefix("/models/");
+    QStringList paths;
+    for (auto it = range.first; it != range.second; ++it) {
+        paths << it->first;
+    }
+    QCOMPARE(paths, QStringList({ "/models/a.fbx", "/models/b.fbx", "/models/nested/c.fbx" }));
+
+    range = store.getMappingsWithPrefix("/missing/");
+    QVERIFY(range.first == range.second);
+}
+
+void AssetMappingStoreTests::testHashReferenceCounts() {
+    QFile::remove(snapshotPath());
+    QFile::remove(logPath());
+
+    AssetMappingStore store;
+    QVERIFY(store.load(snapshotPath(), logPath()));
+
+    AssetMappingStore::Transaction transaction;
+    transaction.setMapping("/one.fbx", makeHash(1));
+    transaction.setMapping("/copy.fbx", makeHash(1));
+    QVERIFY(store.commit(transaction));
+    QVERIFY(store.isHashMapped(makeHash(1)));
+
+    AssetMappingStore::Transaction deletion;
+    deletion.deleteMapping("/one.fbx");
+    QVERIFY(store.commit(deletion));
+    QVERIFY(store.isHashMapped(makeHash(1)));
+
+    AssetMappingStore::Transaction overwrite;
+    overwrite.setMapping("/copy.fbx", makeHash(2));
+    QVERIFY(store.commit(overwrite));
+    QVERIFY(!store.isHashMapped(makeHash(1)));
+    QVERIFY(store.isHashMapped(makeHash(2)));
+}
+
+void AssetMappingStoreTests::benchmarkOperations_data() {
+    QTest::addColumn<int>("numMappings");
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+    if (!QProcessEnvironment::systemEnvironment().value(LARGE_BENCHMARKS_VARIABLE).isEmpty()) {
+        QTest::newRow("1M") << 1000000;
+    }
+}
+
+void AssetMappingStoreTests::benchmarkOperations() {
+    QFETCH(int, numMappings);
+
+    QFile::remove(snapshotPath());
+    QFile::remove(logPath());
+
+    AssetMappingStore store;
+    QVERIFY(store.load(snapshotPath(), logPath()));
+
+    // populate with batched commits, the way a bulk import or a folder rename lands
+    const int BATCH_SIZE = 10000;
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < numMappings; i += BATCH_SIZE) {
+        AssetMappingStore::Transaction transaction;
+        for (int j = i; j < std::min(i + BATCH_SIZE, numMappings); ++j) {
+            transaction.setMapping(makePath(j), makeHash(j));
+        }
+        QVERIFY(store.commit(transaction));
+    }
+    auto batchedMsecs = std::max<qint64>(timer.elapsed(), 1);
+    QCOMPARE(store.size(), (size_t)numMappings);
+
+    // individual set/delete operations, each a durable commit of its own
+    const int NUM_SINGLE_OPERATIONS = 1000;
+    store.setMinCompactionLogSize(std::numeric_limits<qint64>::max());
+    timer.restart();
+    for (int i = 0; i < NUM_SINGLE_OPERATIONS; ++i) {
+        AssetMappingStore::Transaction transaction;
+        if (i % 2 == 0) {
+            transaction.setMapping(QString("/bench/%1.fbx").arg(i), makeHash(i));
+        } else {
+            transaction.deleteMapping(QString("/bench/%1.fbx").arg(i - 1));
+        }
+        QVERIFY(store.commit(transaction));
+    }
+    auto singleMsecs = std::max<qint64>(timer.elapsed(), 1);
+
+    // directory-style queries
+    const int NUM_PREFIX_QUERIES = 1000;
+    size_t numFound = 0;
+    timer.restart();
+    for (int i = 0; i < NUM_PREFIX_QUERIES; ++i) {
+        auto range = store.getMappingsWithPrefix(QString("/folder%1/sub%2/").arg(i % 100).arg(i % 10));
+        numFound += std::distance(range.first, range.second);
+    }
+    auto prefixUsecs = std::max<qint64>(timer.nsecsElapsed() / 1000, 1);
+    QVERIFY(numFound > 0);
+
+    timer.restart();
+    QVERIFY(store.compact());
+    auto compactMsecs = timer.elapsed();
+
+    qDebug() << numMappings << "mappings:"
+        << (numMappings * 1000LL / batchedMsecs) << "batched sets/sec,"
+        << (NUM_SINGLE_OPERATIONS * 1000LL / singleMsecs) << "single-op commits/sec,"
+        << (NUM_PREFIX_QUERIES * 1000000LL / prefixUsecs) << "prefix queries/sec,"
+        << compactMsecs << "ms to compact";
+}
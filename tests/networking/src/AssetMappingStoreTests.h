@@ -0,0 +1,36 @@
+//
+//  AssetMappingStoreTests.h
+//  tests/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetMappingStoreTests_h
+#define hifi_AssetMappingStoreTests_h
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+
+class AssetMappingStoreTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testCommitAndReload();
+    void testTornLogRecordIsDiscarded();
+    void testCompaction();
+    void testPrefixRange();
+    void testHashReferenceCounts();
+    void benchmarkOperations_data();
+    void benchmarkOperations();
+
+private:
+    QString snapshotPath() const;
+    QString logPath() const;
+
+    QTemporaryDir _testDir;
+};
+
+#endif // hifi_AssetMappingStoreTests_h
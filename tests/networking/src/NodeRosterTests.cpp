@@ -0,0 +1,274 @@
+//
+//  NodeRosterTests.cpp
+//  tests/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "NodeRosterTests.h"
+
+#include <NodeRoster.h>
+#include <NumericalConstants.h>
+
+QTEST_GUILESS_MAIN(NodeRosterTests)
+
+static SharedNodePointer makeNode(NodeType_t type, int index) {
+    quint32 address = 0x0A000000 + index;
+    SharedNodePointer node(new Node(QUuid::createUuid(), type, SockAddr(QHostAddress(address + 0x00100000), 40000 + index % 1000),
+                                    SockAddr(QHostAddress(address), 40000 + index % 1000)));
+    node->setLocalID((Node::LocalID)(index + 1));
+    if (type == NodeType::Agent) {
+        NodePermissions permissions;
+        permissions.setVerifiedUserName(QString("user%1").arg(index));
+        node->setPermissions(permissions);
+    }
+    return node;
+}
+
+void NodeRosterTests::testChangesSince() {
+    NodeRoster roster;
+    QCOMPARE(roster.getVersion(), NodeRoster::NO_VERSION);
+
+    QUuid a = QUuid::createUuid();
+    QUuid b = QUuid::createUuid();
+    QUuid c = QUuid::createUuid();
+    roster.nodeChanged(a, NodeType::Agent);
+    roster.nodeChanged(b, NodeType::AvatarMixer);
+    NodeRoster::Version acked = roster.getVersion();
+    roster.nodeChanged(c, NodeType::Agent);
+    roster.nodeChanged(a, NodeType::Agent);
+    roster.nodeRemoved(b, NodeType::AvatarMixer);
+    roster.nodeChanged(a, NodeType::Agent);
+
+    std::vector<NodeRoster::Change> changes;
+    QVERIFY(roster.changesSince(acked, changes));
+
+    // one change per node, the latest, newest first
+    QCOMPARE(changes.size(), (size_t)3);
+    QCOMPARE(changes[0].nodeID, a);
+    QVERIFY(!changes[0].removed);
+    QCOMPARE(changes[1].nodeID, b);
+    QVERIFY(changes[1].removed);
+    QCOMPARE(changes[1].nodeType, (NodeType_t)NodeType::AvatarMixer);
+    QCOMPARE(changes[2].nodeID, c);
+
+    // nothing to send to a node that is caught up
+    QVERIFY(roster.changesSince(roster.getVersion(), changes));
+    QVERIFY(changes.empty());
+
+    // a node that never received a list, or has a version from some other roster, needs a full one
+    QVERIFY(!roster.changesSince(NodeRoster::NO_VERSION, changes));
+    QVERIFY(!roster.changesSince(roster.getVersion() + 1, changes));
+}
+
+void NodeRosterTests::testGap() {
+    const size_t MAX_LOG_SIZE = 16;
+    NodeRoster roster(MAX_LOG_SIZE);
+    for (size_t i = 0; i < MAX_LOG_SIZE; ++i) {
+        roster.nodeChanged(QUuid::createUuid(), NodeType::Agent);
+    }
+
+    std::vector<NodeRoster::Change> changes;
+    QVERIFY(roster.changesSince(1, changes));
+    QCOMPARE(changes.size(), MAX_LOG_SIZE - 1);
+
+    // the change right after version 1 falls off the log, so it can't be caught up any more
+    roster.nodeChanged(QUuid::createUuid(), NodeType::Agent);
+    roster.nodeChanged(QUuid::createUuid(), NodeType::Agent);
+    QVERIFY(!roster.changesSince(1, changes));
+    QVERIFY(roster.changesSince(2, changes));
+    QCOMPARE(changes.size(), MAX_LOG_SIZE);
+}
+
+void NodeRosterTests::testAcknowledge() {
+    auto full = [](NodeRoster::Version version) {
+        return NodeRoster::ListHeader { version, NodeRoster::NO_VERSION, 1, 0 };
+    };
+    auto changes = [](NodeRoster::Version version, NodeRoster::Version baseVersion) {
+        return NodeRoster::ListHeader { version, baseVersion, 1, 0 };
+    };
+
+    // a full list is good from nothing, or from anything no newer than it
+    QVERIFY(NodeRoster::canAcknowledge(NodeRoster::NO_VERSION, full(5)));
+    QVERIFY(NodeRoster::canAcknowledge(5, full(5)));
+    QVERIFY(NodeRoster::canAcknowledge(3, full(5)));
+
+    // but one that was overtaken by the changes after it would go backwards
+    QVERIFY(!NodeRoster::canAcknowledge(7, full(5)));
+
+    // changes have to start at or before what we have, and take us further
+    QVERIFY(NodeRoster::canAcknowledge(5, changes(8, 5)));
+    QVERIFY(NodeRoster::canAcknowledge(6, changes(8, 5)));
+    QVERIFY(!NodeRoster::canAcknowledge(4, changes(8, 5)));
+    QVERIFY(!NodeRoster::canAcknowledge(8, changes(8, 5)));
+    QVERIFY(!NodeRoster::canAcknowledge(NodeRoster::NO_VERSION, changes(8, 5)));
+}
+
+void NodeRosterTests::testWriteEntries() {
+    SharedNodePointer node = makeNode(NodeType::Agent, 7);
+    node->setIsReplicated(true);
+    QUuid secret = QUuid::createUuid();
+    QUuid removedID = QUuid::createUuid();
+
+    QByteArray extendedHeader;
+    QDataStream headerStream(&extendedHeader, QIODevice::WriteOnly);
+    NodeRoster::writeListHeader(headerStream, { 9, 4, 42, 2 });
+
+    auto packetList = NLPacketList::create(PacketType::DomainList, extendedHeader);
+    QDataStream packetStream(packetList.get());
+    NodeRoster::writeNode(*packetList, packetStream, *node, secret);
+    NodeRoster::writeRemovedNode(*packetList, packetStream, removedID);
+    packetList->closeCurrentPacket();
+
+    // read back the way NodeList and the load generator do
+    QByteArray message = packetList->getMessage();
+    QDataStream readStream(message);
+
+    auto header = NodeRoster::readListHeader(readStream);
+    QCOMPARE(header.version, (NodeRoster::Version)9);
+    QCOMPARE(header.baseVersion, (NodeRoster::Version)4);
+    QCOMPARE(header.listID, (quint32)42);
+    QCOMPARE(header.numEntries, (quint32)2);
+
+    quint8 entryType;
+    readStream >> entryType;
+    QCOMPARE(entryType, (quint8)NodeRoster::NodeEntry);
+    NodeType_t type;
+    QUuid uuid;
+    SockAddr publicSocket;
+    SockAddr localSocket;
+    NodePermissions permissions;
+    bool isReplicated;
+    Node::LocalID localID;
+    QUuid connectionSecret;
+    readStream >> type >> uuid >> publicSocket >> localSocket >> permissions >> isReplicated >> localID >> connectionSecret;
+    QCOMPARE(type, node->getType());
+    QCOMPARE(uuid, node->getUUID());
+    QCOMPARE(publicSocket, node->getPublicSocket());
+    QCOMPARE(localSocket, node->getLocalSocket());
+    QCOMPARE(permissions.getVerifiedUserName(), node->getPermissions().getVerifiedUserName());
+    QVERIFY(isReplicated);
+    QCOMPARE(localID, node->getLocalID());
+    QCOMPARE(connectionSecret, secret);
+
+    readStream >> entryType;
+    QCOMPARE(entryType, (quint8)NodeRoster::RemovedNodeEntry);
+    readStream >> uuid;
+    QCOMPARE(uuid, removedID);
+    QVERIFY(readStream.atEnd());
+}
+
+void NodeRosterTests::benchmarkDomainLists() {
+    // a domain with its assignment clients, every node checks in once a second and 1% of the users come and go
+    const std::vector<int> NUM_USERS = { 100, 500, 1000 };
+    const int NUM_SECONDS = 10;
+    const NodeSet ASSIGNMENT_TYPES = { NodeType::AudioMixer, NodeType::AvatarMixer, NodeType::EntityServer,
+                                       NodeType::AssetServer, NodeType::MessagesMixer, NodeType::EntityScriptServer };
+    const NodeSet ASSIGNMENT_INTERESTS = { NodeType::Agent };
+
+    for (int numUsers : NUM_USERS) {
+        for (bool sendChanges : { false, true }) {
+            NodeRoster roster;
+            QHash<QUuid, SharedNodePointer> nodes;
+            QHash<QUuid, NodeSet> interests;
+            QHash<QUuid, NodeRoster::Version> ackedVersions;
+            QHash<QUuid, QHash<QUuid, QUuid>> secrets;
+            int nextIndex = 0;
+
+            auto addNode = [&](NodeType_t type, const NodeSet& interestSet) {
+                auto node = makeNode(type, nextIndex++);
+                nodes.insert(node->getUUID(), node);
+                interests.insert(node->getUUID(), interestSet);
+                roster.nodeChanged(node->getUUID(), type);
+            };
+            for (NodeType_t type : ASSIGNMENT_TYPES) {
+                addNode(type, ASSIGNMENT_INTERESTS);
+            }
+            for (int i = 0; i < numUsers; ++i) {
+                addNode(NodeType::Agent, ASSIGNMENT_TYPES);
+            }
+
+            // as DomainServer::connectionSecretForNodes does
+            auto secretFor = [&](const QUuid& a, const QUuid& b) {
+                QUuid& secret = secrets[a][b];
+                if (secret.isNull()) {
+                    secret = QUuid::createUuid();
+                    secrets[b].insert(a, secret);
+                }
+                return secret;
+            };
+
+            qint64 elapsed = 0;
+            size_t numBytes = 0;
+            QElapsedTimer timer;
+            std::vector<NodeRoster::Change> changes;
+            std::vector<SharedNodePointer> addedNodes;
+            std::vector<QUuid> removedNodes;
+            for (int second = 0; second < NUM_SECONDS; ++second) {
+                int numLeaving = std::max(1, numUsers / 100);
+                for (auto itr = nodes.begin(); numLeaving > 0 && itr != nodes.end();) {
+                    if (itr.value()->getType() == NodeType::Agent) {
+                        roster.nodeRemoved(itr.key(), NodeType::Agent);
+                        interests.remove(itr.key());
+                        ackedVersions.remove(itr.key());
+                        itr = nodes.erase(itr);
+                        --numLeaving;
+                    } else {
+                        ++itr;
+                    }
+                }
+                for (int i = 0; i < std::max(1, numUsers / 100); ++i) {
+                    addNode(NodeType::Agent, ASSIGNMENT_TYPES);
+                }
+
+                for (const auto& node : nodes) {
+                    timer.start();
+                    const NodeSet& interestSet = interests[node->getUUID()];
+                    addedNodes.clear();
+                    removedNodes.clear();
+                    NodeRoster::Version& ackedVersion = ackedVersions[node->getUUID()];
+                    if (sendChanges && roster.changesSince(ackedVersion, changes)) {
+                        for (const auto& change : changes) {
+                            if (change.nodeID == node->getUUID() || !interestSet.contains(change.nodeType)) {
+                                continue;
+                            }
+                            if (change.removed) {
+                                removedNodes.push_back(change.nodeID);
+                            } else {
+                                addedNodes.push_back(nodes.value(change.nodeID));
+                            }
+                        }
+                    } else {
+                        for (const auto& otherNode : nodes) {
+                            if (otherNode != node && interestSet.contains(otherNode->getType())) {
+                                addedNodes.push_back(otherNode);
+                            }
+                        }
+                    }
+
+                    auto packetList = NLPacketList::create(PacketType::DomainList);
+                    QDataStream packetStream(packetList.get());
+                    for (const auto& otherNode : addedNodes) {
+                        NodeRoster::writeNode(*packetList, packetStream, *otherNode, secretFor(node->getUUID(), otherNode->getUUID()));
+                    }
+                    for (const auto& removedNodeID : removedNodes) {
+                        NodeRoster::writeRemovedNode(*packetList, packetStream, removedNodeID);
+                    }
+                    packetList->closeCurrentPacket(true);
+                    elapsed += timer.nsecsElapsed();
+
+                    numBytes += packetList->getDataSize();
+                    ackedVersion = roster.getVersion();
+                }
+            }
+
+            qDebug() << numUsers << "users," << (sendChanges ? "changes:" : "full lists:")
+                << (float)elapsed / NSECS_PER_MSEC / NUM_SECONDS << "ms per second,"
+                << numBytes / NUM_SECONDS / BYTES_PER_KILOBYTE << "kB per second";
+        }
+    }
+}
@@ -0,0 +1,29 @@
+//
+//  NodeRosterTests.h
+//  tests/networking/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_NodeRosterTests_h
+#define hifi_NodeRosterTests_h
+
+#include <QtTest/QtTest>
+
+class NodeRosterTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testChangesSince();
+    void testGap();
+    void testAcknowledge();
+    void testWriteEntries();
+
+    // DomainList CPU time and bytes for every node checking in once a second, full lists against changes
+    void benchmarkDomainLists();
+};
+
+#endif // hifi_NodeRosterTests_h
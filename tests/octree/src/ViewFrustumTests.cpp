@@ -11,11 +11,15 @@
 
 #include "ViewFrustumTests.h"
 
+#include <random>
+#include <vector>
+
 #include <glm/glm.hpp>
 
 #include <GLMHelpers.h>
 #include <NumericalConstants.h>
 #include <ViewFrustum.h>
+#include <shared/ConicalViewFrustum.h>
 
 //#include <StreamUtils.h>
 #include <test-utils/GLMTestUtils.h>
@@ -1345,3 +1349,137 @@ void ViewFrustumTests::testBoxIntersectsKeyhole() {
     box.setBox(boxCenter - halfScaleOffset, boxScale);
     QCOMPARE(view.boxIntersectsKeyhole(box), false); // outside back
 }
+
+// the way callers keep their bounds, next to other things, so the batch tests have to step over them
+struct TestBound {
+    uint32_t id;
+    AABox box;
+    AACube cube;
+    glm::vec4 sphere;
+};
+
+static std::vector<TestBound> makeTestBounds(const glm::vec3& center, float spread, int numBounds) {
+    std::mt19937 generator(5678);
+    std::uniform_real_distribution<float> offset(-spread, spread);
+    std::uniform_real_distribution<float> size(0.01f, 0.1f * spread);
+    std::vector<TestBound> bounds(numBounds);
+    for (int i = 0; i < numBounds; i++) {
+        glm::vec3 corner = center + glm::vec3(offset(generator), offset(generator), offset(generator));
+        bounds[i].id = (uint32_t)i;
+        bounds[i].box = AABox(corner, glm::vec3(size(generator), size(generator), size(generator)));
+        bounds[i].cube = AACube(corner, size(generator));
+        bounds[i].sphere = glm::vec4(corner, size(generator));
+    }
+    return bounds;
+}
+
+static bool testMask(const std::vector<uint64_t>& masks, int i) {
+    return (masks[i / 64] & ((uint64_t)1 << (i % 64))) != 0;
+}
+
+void ViewFrustumTests::testBatchIntersections() {
+    glm::vec3 center = glm::vec3(12.3f, 4.56f, 89.7f);
+    ViewFrustum view;
+    view.setProjection(glm::perspective(PI / 2.0f, 1.5f, 1.0f, 100.0f));
+    view.setPosition(center);
+    view.setOrientation(glm::angleAxis(PI / 7.0f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))));
+    view.setCenterRadius(10.0f);
+    view.calculate();
+    ConicalViewFrustum cone(view);
+    cone.calculate();
+
+    // every count around a multiple of the batch size, so the partial blocks get covered
+    std::vector<TestBound> allBounds = makeTestBounds(center, 120.0f, 1000);
+    for (int count : { 0, 1, 3, 8, 63, 64, 65, 130, 1000 }) {
+        std::vector<uint64_t> masks((count + 63) / 64 + 1, 0);
+        const TestBound* bounds = allBounds.data();
+        const size_t STRIDE = sizeof(TestBound);
+
+        view.spheresIntersectFrustum(&bounds[0].sphere, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), view.sphereIntersectsFrustum(glm::vec3(bounds[i].sphere), bounds[i].sphere.w));
+        }
+        view.spheresIntersectKeyhole(&bounds[0].sphere, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), view.sphereIntersectsKeyhole(glm::vec3(bounds[i].sphere), bounds[i].sphere.w));
+        }
+        view.boxesIntersectFrustum(&bounds[0].box, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), view.boxIntersectsFrustum(bounds[i].box));
+        }
+        view.boxesIntersectKeyhole(&bounds[0].box, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), view.boxIntersectsKeyhole(bounds[i].box));
+        }
+        view.cubesIntersectKeyhole(&bounds[0].cube, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), view.cubeIntersectsKeyhole(bounds[i].cube));
+        }
+
+        cone.boxesIntersect(&bounds[0].box, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), cone.intersects(bounds[i].box));
+        }
+        cone.cubesIntersect(&bounds[0].cube, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            QCOMPARE(testMask(masks, i), cone.intersects(bounds[i].cube));
+        }
+        cone.spheresIntersect(&bounds[0].sphere, count, masks.data(), STRIDE);
+        for (int i = 0; i < count; i++) {
+            glm::vec3 offset = glm::vec3(bounds[i].sphere) - cone.getPosition();
+            QCOMPARE(testMask(masks, i), cone.intersects(offset, glm::length(offset), bounds[i].sphere.w));
+        }
+
+        // nothing is written past the last word
+        QCOMPARE(masks.back(), (uint64_t)0);
+    }
+
+    // packed arrays, with the default stride
+    std::vector<AABox> boxes;
+    for (const auto& bound : allBounds) {
+        boxes.push_back(bound.box);
+    }
+    std::vector<uint64_t> masks((boxes.size() + 63) / 64);
+    view.boxesIntersectFrustum(boxes.data(), (int)boxes.size(), masks.data());
+    for (int i = 0; i < (int)boxes.size(); i++) {
+        QCOMPARE(testMask(masks, i), view.boxIntersectsFrustum(boxes[i]));
+    }
+}
+
+void ViewFrustumTests::benchmarkBatchIntersections() {
+    glm::vec3 center = glm::vec3(0.0f, 2.0f, 0.0f);
+    ViewFrustum view;
+    view.setProjection(glm::perspective(PI / 3.0f, 16.0f / 9.0f, 0.1f, 500.0f));
+    view.setPosition(center);
+    view.calculate();
+
+    const int NUM_BOUNDS = 100000;
+    const int NUM_ROUNDS = 100;
+    std::vector<TestBound> bounds = makeTestBounds(center, 500.0f, NUM_BOUNDS);
+    std::vector<uint64_t> masks((NUM_BOUNDS + 63) / 64);
+
+    QElapsedTimer timer;
+    timer.start();
+    int numSingle = 0;
+    for (int round = 0; round < NUM_ROUNDS; round++) {
+        for (const auto& bound : bounds) {
+            numSingle += view.boxIntersectsFrustum(bound.box) ? 1 : 0;
+        }
+    }
+    qint64 singleElapsed = timer.nsecsElapsed();
+
+    timer.restart();
+    int numBatched = 0;
+    for (int round = 0; round < NUM_ROUNDS; round++) {
+        view.boxesIntersectFrustum(&bounds[0].box, NUM_BOUNDS, masks.data(), sizeof(TestBound));
+        for (int i = 0; i < NUM_BOUNDS; i++) {
+            numBatched += testMask(masks, i) ? 1 : 0;
+        }
+    }
+    qint64 batchedElapsed = timer.nsecsElapsed();
+
+    QCOMPARE(numBatched, numSingle);
+    qDebug() << NUM_BOUNDS << "boxes:"
+        << "one at a time" << (float)singleElapsed / NSECS_PER_MSEC / NUM_ROUNDS << "ms,"
+        << "batched" << (float)batchedElapsed / NSECS_PER_MSEC / NUM_ROUNDS << "ms";
+}
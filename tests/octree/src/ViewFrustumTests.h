@@ -27,6 +27,8 @@ private slots:
     void testSphereIntersectsKeyhole();
     void testCubeIntersectsKeyhole();
     void testBoxIntersectsKeyhole();
+    void testBatchIntersections();
+    void benchmarkBatchIntersections();
 };
 
 #endif // hifi_ViewFruxtumTests_h
@@ -0,0 +1,299 @@
+//
+//  CollisionShapeCacheTests.cpp
+//  tests/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CollisionShapeCacheTests.h"
+
+#include <random>
+
+#include <CollisionShapeCache.h>
+#include <ShapeFactory.h>
+#include <Extents.h>
+#include <NumericalConstants.h>
+
+QTEST_GUILESS_MAIN(CollisionShapeCacheTests)
+
+static ShapeInfo makeHullShapeInfo(ShapeType type, int numHulls, int numPointsPerHull, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    ShapeInfo::PointCollection pointCollection;
+    Extents extents;
+    for (int i = 0; i < numHulls; ++i) {
+        glm::vec3 center((float)i, 0.0f, 0.0f);
+        ShapeInfo::PointList points;
+        for (int j = 0; j < numPointsPerHull; ++j) {
+            points.push_back(center + glm::vec3(distribution(generator), distribution(generator), distribution(generator)));
+            extents.addPoint(points.back());
+        }
+        pointCollection.push_back(points);
+    }
+    ShapeInfo info;
+    info.setParams(type, 0.5f * (extents.maximum - extents.minimum));
+    info.setPointCollection(pointCollection);
+    return info;
+}
+
+static ShapeInfo makeMeshShapeInfo(int gridSize) {
+    ShapeInfo::PointList points;
+    for (int i = 0; i <= gridSize; ++i) {
+        for (int j = 0; j <= gridSize; ++j) {
+            points.push_back(glm::vec3((float)i, 0.1f * (float)((i * j) % 7), (float)j));
+        }
+    }
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_STATIC_MESH, glm::vec3(0.5f * (float)gridSize));
+    info.setPointCollection({ points });
+    auto& indices = info.getTriangleIndices();
+    for (int i = 0; i < gridSize; ++i) {
+        for (int j = 0; j < gridSize; ++j) {
+            int32_t corner = i * (gridSize + 1) + j;
+            indices << corner << corner + 1 << corner + gridSize + 1;
+            indices << corner + 1 << corner + gridSize + 2 << corner + gridSize + 1;
+        }
+    }
+    return info;
+}
+
+static const btCollisionShape* roundTrip(const btCollisionShape* shape) {
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        if (!ShapeFactory::serializeShape(shape, stream)) {
+            return nullptr;
+        }
+    }
+    QDataStream stream(data);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    return ShapeFactory::deserializeShape(stream);
+}
+
+static void compareAabbs(const btCollisionShape* a, const btCollisionShape* b) {
+    btTransform identity;
+    identity.setIdentity();
+    btVector3 minA, maxA, minB, maxB;
+    a->getAabb(identity, minA, maxA);
+    b->getAabb(identity, minB, maxB);
+    QCOMPARE(minA, minB);
+    QCOMPARE(maxA, maxB);
+}
+
+void CollisionShapeCacheTests::serializeConvexHull() {
+    ShapeInfo info = makeHullShapeInfo(SHAPE_TYPE_SIMPLE_HULL, 1, 500, 1);
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QVERIFY(shape);
+    const btCollisionShape* copy = roundTrip(shape);
+    QVERIFY(copy);
+    QCOMPARE(copy->getShapeType(), (int)CONVEX_HULL_SHAPE_PROXYTYPE);
+
+    const btConvexHullShape* hull = static_cast<const btConvexHullShape*>(shape);
+    const btConvexHullShape* hullCopy = static_cast<const btConvexHullShape*>(copy);
+    QCOMPARE(hullCopy->getNumPoints(), hull->getNumPoints());
+    QCOMPARE(hullCopy->getMargin(), hull->getMargin());
+    for (int i = 0; i < hull->getNumPoints(); ++i) {
+        QCOMPARE(hullCopy->getUnscaledPoints()[i], hull->getUnscaledPoints()[i]);
+    }
+    compareAabbs(shape, copy);
+
+    ShapeFactory::deleteShape(shape);
+    ShapeFactory::deleteShape(copy);
+}
+
+void CollisionShapeCacheTests::serializeCompound() {
+    ShapeInfo info = makeHullShapeInfo(SHAPE_TYPE_COMPOUND, 8, 100, 2);
+    info.setOffset(glm::vec3(1.0f, 2.0f, 3.0f));
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QVERIFY(shape);
+    const btCollisionShape* copy = roundTrip(shape);
+    QVERIFY(copy);
+    QCOMPARE(copy->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+
+    const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+    const btCompoundShape* compoundCopy = static_cast<const btCompoundShape*>(copy);
+    QCOMPARE(compoundCopy->getNumChildShapes(), compound->getNumChildShapes());
+    for (int i = 0; i < compound->getNumChildShapes(); ++i) {
+        QCOMPARE(compoundCopy->getChildTransform(i).getOrigin(), compound->getChildTransform(i).getOrigin());
+        compareAabbs(compound->getChildShape(i), compoundCopy->getChildShape(i));
+    }
+    compareAabbs(shape, copy);
+
+    ShapeFactory::deleteShape(shape);
+    ShapeFactory::deleteShape(copy);
+}
+
+class TriangleCounter : public btTriangleCallback {
+public:
+    void processTriangle(btVector3* triangle, int partId, int triangleIndex) override { ++count; }
+    int count { 0 };
+};
+
+void CollisionShapeCacheTests::serializeStaticMesh() {
+    const int GRID_SIZE = 40;
+    ShapeInfo info = makeMeshShapeInfo(GRID_SIZE);
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QVERIFY(shape);
+    const btCollisionShape* copy = roundTrip(shape);
+    QVERIFY(copy);
+    QCOMPARE(copy->getShapeType(), (int)TRIANGLE_MESH_SHAPE_PROXYTYPE);
+    compareAabbs(shape, copy);
+
+    // the restored BVH finds the same triangles
+    const btBvhTriangleMeshShape* mesh = static_cast<const btBvhTriangleMeshShape*>(shape);
+    const btBvhTriangleMeshShape* meshCopy = static_cast<const btBvhTriangleMeshShape*>(copy);
+    btVector3 aabbMin(10.5f, -1.0f, 3.5f);
+    btVector3 aabbMax(20.5f, 1.0f, 13.5f);
+    TriangleCounter counter, copyCounter;
+    mesh->processAllTriangles(&counter, aabbMin, aabbMax);
+    meshCopy->processAllTriangles(&copyCounter, aabbMin, aabbMax);
+    QVERIFY(counter.count > 0);
+    QCOMPARE(copyCounter.count, counter.count);
+
+    ShapeFactory::deleteShape(shape);
+    ShapeFactory::deleteShape(copy);
+}
+
+void CollisionShapeCacheTests::readAfterRestart() {
+    QString path = _testDir.path() + "/restart";
+    ShapeInfo info = makeHullShapeInfo(SHAPE_TYPE_COMPOUND, 4, 100, 3);
+    ShapeInfo meshInfo = makeMeshShapeInfo(10);
+    {
+        CollisionShapeCache cache(path.toStdString());
+        cache.initialize();
+        QVERIFY(cache.getShape(info) == nullptr);
+
+        const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info, &cache);
+        QVERIFY(shape);
+        ShapeFactory::deleteShape(shape);
+        shape = ShapeFactory::createShapeFromInfo(meshInfo, &cache);
+        QVERIFY(shape);
+        ShapeFactory::deleteShape(shape);
+        QCOMPARE(cache.getNumTotalFiles(), (size_t)2);
+    }
+
+    CollisionShapeCache cache(path.toStdString());
+    cache.initialize();
+    QCOMPARE(cache.getNumTotalFiles(), (size_t)2);
+    const btCollisionShape* shape = cache.getShape(info);
+    QVERIFY(shape);
+    QCOMPARE(shape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+    ShapeFactory::deleteShape(shape);
+    shape = cache.getShape(meshInfo);
+    QVERIFY(shape);
+    QCOMPARE(shape->getShapeType(), (int)TRIANGLE_MESH_SHAPE_PROXYTYPE);
+    ShapeFactory::deleteShape(shape);
+}
+
+void CollisionShapeCacheTests::ignoreOtherShapes() {
+    QString path = _testDir.path() + "/ignore";
+    CollisionShapeCache cache(path.toStdString());
+    cache.initialize();
+
+    // cheap shapes are not cached
+    ShapeInfo box;
+    box.setBox(glm::vec3(1.0f));
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(box, &cache);
+    QVERIFY(shape);
+    ShapeFactory::deleteShape(shape);
+    QCOMPARE(cache.getNumTotalFiles(), (size_t)0);
+
+    // the key depends on the shape algorithm, so shapes cached by another version are never found
+    ShapeInfo info = makeHullShapeInfo(SHAPE_TYPE_SIMPLE_HULL, 1, 50, 4);
+    std::string key = CollisionShapeCache::getKey(info);
+    QVERIFY(key.find(QString::number(CollisionShapeCache::CURRENT_VERSION, 16).toStdString()) != std::string::npos);
+    QVERIFY(key != CollisionShapeCache::getKey(makeHullShapeInfo(SHAPE_TYPE_SIMPLE_HULL, 1, 50, 5)));
+
+    // a file that isn't a shape is ignored rather than trusted
+    QByteArray garbage(64, 'x');
+    QVERIFY(cache.writeFile(garbage.data(), CollisionShapeCache::Metadata(key, garbage.size())));
+    QVERIFY(cache.getShape(info) == nullptr);
+}
+
+void CollisionShapeCacheTests::missOnChangedGeometry() {
+    CollisionShapeCache cache((_testDir.path() + "/changed").toStdString());
+    cache.initialize();
+
+    // a model edited in place keeps its url and dimensions, so only its points say it changed
+    const QString url = "http://localhost/model.obj";
+    const glm::vec3 halfExtents(2.0f, 1.0f, 1.0f);
+    ShapeInfo before = makeHullShapeInfo(SHAPE_TYPE_COMPOUND, 2, 50, 6);
+    before.setParams(SHAPE_TYPE_COMPOUND, halfExtents, url);
+    ShapeInfo after = makeHullShapeInfo(SHAPE_TYPE_COMPOUND, 2, 50, 7);
+    after.setParams(SHAPE_TYPE_COMPOUND, halfExtents, url);
+    QCOMPARE(before.getHash(), after.getHash());
+    QVERIFY(CollisionShapeCache::getKey(before) != CollisionShapeCache::getKey(after));
+
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(before, &cache);
+    QVERIFY(shape);
+    ShapeFactory::deleteShape(shape);
+    QVERIFY(cache.getShape(after) == nullptr);
+    shape = cache.getShape(before);
+    QVERIFY(shape);
+    ShapeFactory::deleteShape(shape);
+
+    // a file under the right key that was written for other geometry is ignored too
+    QByteArray data;
+    {
+        QFile input(QString::fromStdString(cache.getFile(CollisionShapeCache::getKey(before))->getFilepath()));
+        QVERIFY(input.open(QIODevice::ReadOnly));
+        data = input.readAll();
+    }
+    std::string key = CollisionShapeCache::getKey(after);
+    QVERIFY(cache.writeFile(data.data(), CollisionShapeCache::Metadata(key, data.size())));
+    QVERIFY(cache.getShape(after) == nullptr);
+}
+
+void CollisionShapeCacheTests::benchmarkColdVsWarm() {
+    // roughly what a domain of compound-hull models asks for as it loads
+    const int NUM_SHAPES = 200;
+    const int NUM_HULLS = 16;
+    const int NUM_POINTS_PER_HULL = 400;
+    std::vector<ShapeInfo> infos;
+    for (int i = 0; i < NUM_SHAPES; ++i) {
+        infos.push_back(makeHullShapeInfo(SHAPE_TYPE_COMPOUND, NUM_HULLS, NUM_POINTS_PER_HULL, 100 + i));
+    }
+    QString path = _testDir.path() + "/benchmark";
+
+    int numFailures = 0;
+    auto loadAll = [&](CollisionShapeCache* cache) {
+        QElapsedTimer timer;
+        timer.start();
+        for (const auto& info : infos) {
+            const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info, cache);
+            if (shape) {
+                ShapeFactory::deleteShape(shape);
+            } else {
+                ++numFailures;
+            }
+        }
+        return timer.nsecsElapsed();
+    };
+
+    qint64 uncached = loadAll(nullptr);
+    qint64 cold, warm;
+    {
+        CollisionShapeCache cache(path.toStdString());
+        cache.initialize();
+        cold = loadAll(&cache);
+    }
+    {
+        CollisionShapeCache cache(path.toStdString());
+        cache.initialize();
+        warm = loadAll(&cache);
+    }
+    qDebug() << NUM_SHAPES << "compound shapes of" << NUM_HULLS << "hulls:"
+        << "uncached" << (float)uncached / NSECS_PER_MSEC << "ms,"
+        << "cold cache" << (float)cold / NSECS_PER_MSEC << "ms,"
+        << "warm cache" << (float)warm / NSECS_PER_MSEC << "ms";
+    QCOMPARE(numFailures, 0);
+    QVERIFY(warm < cold);
+}
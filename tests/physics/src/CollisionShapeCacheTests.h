@@ -0,0 +1,34 @@
+//
+//  CollisionShapeCacheTests.h
+//  tests/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CollisionShapeCacheTests_h
+#define hifi_CollisionShapeCacheTests_h
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+
+class CollisionShapeCacheTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void serializeConvexHull();
+    void serializeCompound();
+    void serializeStaticMesh();
+    void readAfterRestart();
+    void ignoreOtherShapes();
+    void missOnChangedGeometry();
+    void benchmarkColdVsWarm();
+
+private:
+    QTemporaryDir _testDir;
+};
+
+#endif // hifi_CollisionShapeCacheTests_h
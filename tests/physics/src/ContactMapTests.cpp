@@ -0,0 +1,219 @@
+//
+//  ContactMapTests.cpp
+//  tests/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ContactMapTests.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include <ContactMap.h>
+#include <NumericalConstants.h>
+
+QTEST_GUILESS_MAIN(ContactMapTests)
+
+static btManifoldPoint makePoint(float distance) {
+    return btManifoldPoint(btVector3(0.0f, 0.0f, 0.0f), btVector3(0.0f, distance, 0.0f), btVector3(0.0f, 1.0f, 0.0f), distance);
+}
+
+// stand-ins for the ObjectMotionStates, the map only cares about their addresses
+static std::vector<ContactKey> makeKeys(std::vector<int>& objects, size_t numKeys) {
+    std::vector<ContactKey> keys;
+    keys.reserve(numKeys);
+    for (size_t i = 0; keys.size() < numKeys; ++i) {
+        // each object touches its neighbour and the ground, which has no MotionState
+        keys.push_back(ContactKey(&objects[i], nullptr));
+        if (keys.size() < numKeys) {
+            keys.push_back(ContactKey(&objects[i], &objects[i + 1]));
+        }
+    }
+    return keys;
+}
+
+void ContactMapTests::testInsertAndFind() {
+    const size_t NUM_KEYS = 1000;
+    std::vector<int> objects(NUM_KEYS);
+    std::vector<ContactKey> keys = makeKeys(objects, NUM_KEYS);
+
+    ContactMap map;
+    QVERIFY(map.empty());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map[keys[i]].update(1, makePoint((float)i));
+    }
+    QCOMPARE(map.size(), NUM_KEYS);
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ContactInfo* contact = map.find(keys[i]);
+        QVERIFY(contact);
+        QCOMPARE(contact->distance, (btScalar)i);
+        // the same key finds the same contact instead of adding another
+        QCOMPARE(&map[keys[i]], contact);
+    }
+    QCOMPARE(map.size(), NUM_KEYS);
+
+    // order matters, as it does for the pairs Bullet hands out
+    QVERIFY(!map.find(ContactKey(&objects[1], &objects[0])));
+    QVERIFY(!map.find(ContactKey(&objects[NUM_KEYS - 1], nullptr)));
+
+    map.clear();
+    QVERIFY(map.empty());
+    QVERIFY(!map.find(keys[0]));
+}
+
+void ContactMapTests::testSweep() {
+    const size_t NUM_KEYS = 500;
+    std::vector<int> objects(NUM_KEYS);
+    std::vector<ContactKey> keys = makeKeys(objects, NUM_KEYS);
+
+    ContactMap map;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map[keys[i]].update(1, makePoint(0.0f));
+    }
+
+    // the first sweep starts every contact, then only the ones updated on the next step continue
+    uint32_t step = 1;
+    size_t numStarted = 0;
+    map.sweep([&](const ContactKey&, ContactInfo& contact) {
+        numStarted += contact.computeType(step) == CONTACT_EVENT_TYPE_START;
+        return true;
+    });
+    QCOMPARE(numStarted, NUM_KEYS);
+
+    step = 2;
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        map[keys[i]].update(step, makePoint(0.0f));
+    }
+    size_t numVisited = 0;
+    size_t numEnded = 0;
+    map.sweep([&](const ContactKey&, ContactInfo& contact) {
+        ++numVisited;
+        ContactEventType type = contact.computeType(step);
+        numEnded += type == CONTACT_EVENT_TYPE_END;
+        return type != CONTACT_EVENT_TYPE_END;
+    });
+    QCOMPARE(numVisited, NUM_KEYS);
+    QCOMPARE(numEnded, NUM_KEYS / 2);
+    QCOMPARE(map.size(), NUM_KEYS - NUM_KEYS / 2);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        QCOMPARE(map.find(keys[i]) != nullptr, i % 2 == 0);
+    }
+
+    // an ended contact that comes back starts over
+    map[keys[1]].update(3, makePoint(0.0f));
+    QCOMPARE(map.find(keys[1])->computeType(3), CONTACT_EVENT_TYPE_START);
+
+    // removing everything that touches one object, as PhysicsEngine::removeContacts() does
+    void* removed = &objects[0];
+    map.sweep([&](const ContactKey& key, ContactInfo&) {
+        return key._a != removed && key._b != removed;
+    });
+    QVERIFY(!map.find(keys[0]));
+    QVERIFY(map.find(keys[2]));
+}
+
+void ContactMapTests::testChurn() {
+    // grows, fills up with removed entries and shrinks again, checked against a std::map
+    const size_t NUM_OBJECTS = 2000;
+    const int NUM_ROUNDS = 200;
+    std::vector<int> objects(NUM_OBJECTS + 1);
+    std::vector<ContactKey> keys = makeKeys(objects, 2 * NUM_OBJECTS);
+
+    std::mt19937 generator(1234);
+    ContactMap map;
+    std::map<ContactKey, float> reference;
+    for (int round = 0; round < NUM_ROUNDS; ++round) {
+        // busy rounds add lots of contacts, quiet ones few, so the table changes size
+        size_t numTouching = (round % 20 < 10) ? keys.size() : keys.size() / 50;
+        std::uniform_int_distribution<size_t> pick(0, keys.size() - 1);
+        for (size_t i = 0; i < numTouching; ++i) {
+            const ContactKey& key = keys[pick(generator)];
+            float distance = (float)(round * keys.size() + i);
+            map[key].update(round, makePoint(distance));
+            reference[key] = distance;
+        }
+
+        std::uniform_int_distribution<int> coin(0, 2);
+        map.sweep([&](const ContactKey& key, ContactInfo&) {
+            if (coin(generator) == 0) {
+                reference.erase(key);
+                return false;
+            }
+            return true;
+        });
+
+        QCOMPARE(map.size(), reference.size());
+        for (const auto& key : keys) {
+            auto itr = reference.find(key);
+            ContactInfo* contact = map.find(key);
+            QCOMPARE(contact != nullptr, itr != reference.end());
+            if (contact) {
+                QCOMPARE(contact->distance, (btScalar)itr->second);
+            }
+        }
+    }
+}
+
+void ContactMapTests::benchmarkUpdate() {
+    // a pile of resting objects: every contact is updated every substep and a few come and go
+    const size_t NUM_CONTACTS = 20000;
+    const uint32_t NUM_STEPS = 300;
+    const size_t NUM_CHANGING = NUM_CONTACTS / 100;
+    std::vector<int> objects(NUM_CONTACTS);
+    std::vector<ContactKey> keys = makeKeys(objects, NUM_CONTACTS);
+    btManifoldPoint point = makePoint(-0.001f);
+
+    auto isTouching = [&](size_t i, uint32_t step) {
+        return i >= NUM_CHANGING || (step / 10) % 2 == 0;
+    };
+
+    QElapsedTimer timer;
+    timer.start();
+    std::map<ContactKey, ContactInfo> treeMap;
+    size_t numTreeContacts = 0;
+    for (uint32_t step = 1; step <= NUM_STEPS; ++step) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (isTouching(i, step)) {
+                treeMap[keys[i]].update(step, point);
+            }
+        }
+        auto itr = treeMap.begin();
+        while (itr != treeMap.end()) {
+            if (itr->second.computeType(step) == CONTACT_EVENT_TYPE_END) {
+                itr = treeMap.erase(itr);
+            } else {
+                ++itr;
+            }
+        }
+        numTreeContacts += treeMap.size();
+    }
+    qint64 treeElapsed = timer.nsecsElapsed();
+
+    timer.restart();
+    ContactMap flatMap;
+    size_t numFlatContacts = 0;
+    for (uint32_t step = 1; step <= NUM_STEPS; ++step) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (isTouching(i, step)) {
+                flatMap[keys[i]].update(step, point);
+            }
+        }
+        flatMap.sweep([&](const ContactKey&, ContactInfo& contact) {
+            return contact.computeType(step) != CONTACT_EVENT_TYPE_END;
+        });
+        numFlatContacts += flatMap.size();
+    }
+    qint64 flatElapsed = timer.nsecsElapsed();
+
+    QCOMPARE(numFlatContacts, numTreeContacts);
+    qDebug() << NUM_CONTACTS << "contacts," << NUM_STEPS << "steps:"
+        << "std::map" << (float)treeElapsed / NSECS_PER_MSEC / NUM_STEPS << "ms per step,"
+        << "ContactMap" << (float)flatElapsed / NSECS_PER_MSEC / NUM_STEPS << "ms per step";
+}
@@ -0,0 +1,27 @@
+//
+//  ContactMapTests.h
+//  tests/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ContactMapTests_h
+#define hifi_ContactMapTests_h
+
+#include <QtTest/QtTest>
+
+class ContactMapTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testInsertAndFind();
+    void testSweep();
+    void testChurn();
+    void benchmarkUpdate();
+};
+
+#endif // hifi_ContactMapTests_h
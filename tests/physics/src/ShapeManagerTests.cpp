@@ -244,3 +244,97 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+static ShapeInfo makeCompoundShapeInfo(int numHulls) {
+    QVector<glm::vec3> tetrahedron;
+    tetrahedron.push_back(glm::vec3(1.0f, 1.0f, 1.0f));
+    tetrahedron.push_back(glm::vec3(1.0f, -1.0f, -1.0f));
+    tetrahedron.push_back(glm::vec3(-1.0f, 1.0f, -1.0f));
+    tetrahedron.push_back(glm::vec3(-1.0f, -1.0f, 1.0f));
+
+    ShapeInfo::PointCollection pointCollection;
+    Extents extents;
+    for (int i = 0; i < numHulls; ++i) {
+        glm::vec3 offset = (float)(i - numHulls / 2) * glm::vec3(1.0f, 0.0f, 0.0f);
+        ShapeInfo::PointList pointList;
+        for (const auto& point : tetrahedron) {
+            pointList.push_back((float)(i + 1) * point + offset);
+            extents.addPoint(pointList.back());
+        }
+        pointCollection.push_back(pointList);
+    }
+
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_COMPOUND, 0.5f * (extents.maximum - extents.minimum));
+    info.setPointCollection(pointCollection);
+    return info;
+}
+
+void ShapeManagerTests::addShapesOffThread() {
+    const int NUM_SHAPES = 20;
+    std::vector<ShapeInfo> infos;
+    for (int i = 0; i < NUM_SHAPES; ++i) {
+        infos.push_back(makeCompoundShapeInfo(i + 2));
+    }
+
+    // every shape is built on another thread, and asking twice for the same shape only starts one worker
+    ShapeManager shapeManager;
+    for (const auto& info : infos) {
+        QVERIFY(shapeManager.getShape(info, true) == nullptr);
+        QVERIFY(shapeManager.getShape(info, true) == nullptr);
+    }
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)(2 * NUM_SHAPES));
+    QCOMPARE(shapeManager.getNumPendingShapes(), NUM_SHAPES);
+
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)NUM_SHAPES);
+    QCOMPARE(shapeManager.getNumPendingShapes(), 0);
+    QCOMPARE(shapeManager.getNumShapes(), NUM_SHAPES);
+
+    // delivered shapes are unreferenced until picked up
+    for (int i = 0; i < NUM_SHAPES; ++i) {
+        QCOMPARE(shapeManager.getNumReferences(infos[i]), 0);
+        const btCollisionShape* shape = shapeManager.getShapeByKey(infos[i].getHash());
+        QVERIFY(shape != nullptr);
+        QCOMPARE(shape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+        QCOMPARE(static_cast<const btCompoundShape*>(shape)->getNumChildShapes(), i + 2);
+        QCOMPARE(shapeManager.getNumReferences(infos[i]), 1);
+
+        // and once built they are found right away
+        QCOMPARE(shapeManager.getShape(infos[i], true), shape);
+        QCOMPARE(shapeManager.getNumReferences(infos[i]), 2);
+    }
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)(2 * NUM_SHAPES));
+
+    for (const auto& info : infos) {
+        const btCollisionShape* shape = shapeManager.getShapeByKey(info.getHash());
+        for (int i = 0; i < 3; ++i) {
+            QVERIFY(shapeManager.releaseShape(shape));
+        }
+        QCOMPARE(shapeManager.getNumReferences(info), 0);
+    }
+    shapeManager.collectGarbage();
+    QCOMPARE(shapeManager.getNumShapes(), 0);
+}
+
+void ShapeManagerTests::addShapeWhileBuildingOffThread() {
+    ShapeInfo info = makeCompoundShapeInfo(5);
+    ShapeManager shapeManager;
+    QVERIFY(shapeManager.getShape(info, true) == nullptr);
+
+    // a synchronous request for the same shape doesn't wait for the worker
+    const btCollisionShape* shape = shapeManager.getShape(info);
+    QVERIFY(shape != nullptr);
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
+
+    // and the worker's copy is thrown away rather than replacing it
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)1);
+    QCOMPARE(shapeManager.getNumShapes(), 1);
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
+    QCOMPARE(shapeManager.getShapeByKey(info.getHash()), shape);
+    QCOMPARE(shapeManager.getNumReferences(info), 2);
+
+    shapeManager.releaseShape(shape);
+    shapeManager.releaseShape(shape);
+    shapeManager.collectGarbage();
+    QCOMPARE(shapeManager.getNumShapes(), 0);
+}
@@ -0,0 +1,210 @@
+//
+//  ThreadSafeDynamicsWorldTests.cpp
+//  tests/physics/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ThreadSafeDynamicsWorldTests.h"
+
+#include <algorithm>
+
+#include <btBulletDynamicsCommon.h>
+
+#include <NumericalConstants.h>
+#include <ParallelCollisionDispatcher.h>
+#include <PhysicsHelpers.h>
+#include <ThreadSafeDynamicsWorld.h>
+
+QTEST_GUILESS_MAIN(ThreadSafeDynamicsWorldTests)
+
+static const float BOX_HALF_SIZE = 0.25f;
+static const float COLUMN_SPACING = 1.0f;
+static const float LAYER_GAP = 0.01f;
+static const float REST_TOLERANCE = 0.05f;
+
+// the full sized stress run takes a while, so it only runs when asked for
+static const char* LARGE_BENCHMARKS_VARIABLE = "HIFI_LARGE_BENCHMARKS";
+
+// a world set up the way PhysicsEngine::init() does it, with gravity since there are no entities to supply it
+class TestWorld {
+public:
+    TestWorld(bool multithreaded) {
+        _dispatcher.setMultithreaded(multithreaded);
+        _world.setMultithreaded(multithreaded);
+        _world.setGravity(btVector3(0.0f, -9.8f, 0.0f));
+        _world.setForceUpdateAllAabbs(false);
+
+        addBody(new btRigidBody(0.0f, nullptr, &_groundShape));
+    }
+
+    ~TestWorld() {
+        for (auto body : _bodies) {
+            _world.removeRigidBody(body);
+            delete body;
+        }
+    }
+
+    // TestWorld deletes the body when it is done with it
+    void addBody(btRigidBody* body) {
+        _world.addRigidBody(body);
+        _bodies.push_back(body);
+    }
+
+    btRigidBody* addBox(const btVector3& position, float mass) {
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        _boxShape.calculateLocalInertia(mass, inertia);
+        btRigidBody* body = new btRigidBody(mass, nullptr, &_boxShape, inertia);
+        body->setWorldTransform(btTransform(btQuaternion::getIdentity(), position));
+        addBody(body);
+        return body;
+    }
+
+    // columns of boxes dropped a little apart from each other, each column is its own island once they land
+    std::vector<btRigidBody*> addColumns(int numColumnsX, int numColumnsZ, int height, float baseHeight = 0.0f) {
+        std::vector<btRigidBody*> boxes;
+        for (int i = 0; i < numColumnsX; ++i) {
+            for (int j = 0; j < numColumnsZ; ++j) {
+                for (int k = 0; k < height; ++k) {
+                    btVector3 position(COLUMN_SPACING * i, baseHeight + BOX_HALF_SIZE + k * (2.0f * BOX_HALF_SIZE + LAYER_GAP),
+                                       COLUMN_SPACING * j);
+                    boxes.push_back(addBox(position, 1.0f));
+                }
+            }
+        }
+        return boxes;
+    }
+
+    void simulate(float seconds) {
+        int numSteps = (int)(seconds / PHYSICS_ENGINE_FIXED_SUBSTEP);
+        for (int i = 0; i < numSteps; ++i) {
+            _world.stepSimulationWithSubstepCallback(PHYSICS_ENGINE_FIXED_SUBSTEP, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS,
+                                                     PHYSICS_ENGINE_FIXED_SUBSTEP);
+        }
+    }
+
+    ThreadSafeDynamicsWorld& world() { return _world; }
+
+private:
+    btDefaultCollisionConfiguration _collisionConfig;
+    ParallelCollisionDispatcher _dispatcher { &_collisionConfig };
+    btDbvtBroadphase _broadphase;
+    btSequentialImpulseConstraintSolver _solver;
+    ThreadSafeDynamicsWorld _world { &_dispatcher, &_broadphase, &_solver, &_collisionConfig };
+    btStaticPlaneShape _groundShape { btVector3(0.0f, 1.0f, 0.0f), 0.0f };
+    btBoxShape _boxShape { btVector3(BOX_HALF_SIZE, BOX_HALF_SIZE, BOX_HALF_SIZE) };
+    std::vector<btRigidBody*> _bodies;
+};
+
+// how far the boxes of height-tall columns are from where they should come to rest on top of baseHeight
+static float maxRestError(const std::vector<btRigidBody*>& boxes, int height, float baseHeight = 0.0f) {
+    float maxError = 0.0f;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        btVector3 position = boxes[i]->getWorldTransform().getOrigin();
+        float restHeight = baseHeight + BOX_HALF_SIZE + (float)(i % height) * 2.0f * BOX_HALF_SIZE;
+        maxError = std::max(maxError, fabsf(position.getY() - restHeight));
+    }
+    return maxError;
+}
+
+void ThreadSafeDynamicsWorldTests::testSubstepCallback() {
+    for (bool multithreaded : { false, true }) {
+        TestWorld world(multithreaded);
+        world.addColumns(4, 4, 3);
+
+        int numCalls = 0;
+        const int NUM_SUBSTEPS = 3;
+        int numSubsteps = world.world().stepSimulationWithSubstepCallback(
+            (NUM_SUBSTEPS + 0.5f) * PHYSICS_ENGINE_FIXED_SUBSTEP, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS,
+            PHYSICS_ENGINE_FIXED_SUBSTEP, [&]() { ++numCalls; });
+        QCOMPARE(numSubsteps, NUM_SUBSTEPS);
+        QCOMPARE(numCalls, NUM_SUBSTEPS);
+        QCOMPARE(world.world().getNumSubsteps(), NUM_SUBSTEPS);
+    }
+}
+
+void ThreadSafeDynamicsWorldTests::testStacksSettle() {
+    const int HEIGHT = 5;
+    for (bool multithreaded : { false, true }) {
+        TestWorld world(multithreaded);
+        auto boxes = world.addColumns(8, 8, HEIGHT);
+        world.simulate(3.0f);
+        QVERIFY2(maxRestError(boxes, HEIGHT) < REST_TOLERANCE, multithreaded ? "multithreaded" : "single threaded");
+    }
+}
+
+void ThreadSafeDynamicsWorldTests::testIslandsShareKinematicObject() {
+    // every column sits on one kinematic slab, so the solver sees the slab from every island at once
+    const int HEIGHT = 4;
+    const int NUM_COLUMNS = 6;
+    const float SLAB_HALF_HEIGHT = 0.1f;
+    btBoxShape slabShape(btVector3(NUM_COLUMNS * COLUMN_SPACING, SLAB_HALF_HEIGHT, NUM_COLUMNS * COLUMN_SPACING));
+    for (bool multithreaded : { false, true }) {
+        TestWorld world(multithreaded);
+        btRigidBody* slab = new btRigidBody(0.0f, nullptr, &slabShape);
+        slab->setCollisionFlags(slab->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
+        slab->setActivationState(DISABLE_DEACTIVATION);
+        slab->setWorldTransform(btTransform(btQuaternion::getIdentity(), btVector3(0.0f, 1.0f, 0.0f)));
+        world.addBody(slab);
+
+        float baseHeight = 1.0f + SLAB_HALF_HEIGHT;
+        auto boxes = world.addColumns(NUM_COLUMNS, NUM_COLUMNS, HEIGHT, baseHeight);
+        world.simulate(3.0f);
+        QVERIFY2(maxRestError(boxes, HEIGHT, baseHeight) < REST_TOLERANCE, multithreaded ? "multithreaded" : "single threaded");
+    }
+}
+
+void ThreadSafeDynamicsWorldTests::testFreeFall() {
+    // boxes high in the air touch nothing, each is an island of its own with no contacts to solve,
+    // next to some stacks on the ground so there are islands with contacts too
+    const int NUM_FALLING = 12;
+    const float DROP_HEIGHT = 20.0f;
+    const float SECONDS = 0.5f;
+    const float TOLERANCE = 0.0001f;
+
+    TestWorld serialWorld(false);
+    serialWorld.addColumns(4, 4, 3);
+    auto serialBoxes = serialWorld.addColumns(NUM_FALLING, NUM_FALLING, 1, DROP_HEIGHT);
+    serialWorld.simulate(SECONDS);
+
+    TestWorld world(true);
+    world.addColumns(4, 4, 3);
+    auto boxes = world.addColumns(NUM_FALLING, NUM_FALLING, 1, DROP_HEIGHT);
+    world.simulate(SECONDS);
+
+    // they fell as far as gravity takes them in that time
+    float expectedHeight = DROP_HEIGHT + BOX_HALF_SIZE - 0.5f * 9.8f * SECONDS * SECONDS;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        btVector3 position = boxes[i]->getWorldTransform().getOrigin();
+        btVector3 serialPosition = serialBoxes[i]->getWorldTransform().getOrigin();
+        QVERIFY(position.distance(serialPosition) < TOLERANCE);
+        QVERIFY(boxes[i]->getLinearVelocity().distance(serialBoxes[i]->getLinearVelocity()) < TOLERANCE);
+        QVERIFY(fabsf(position.getY() - expectedHeight) < 0.1f);
+    }
+}
+
+void ThreadSafeDynamicsWorldTests::benchmarkStress() {
+    // 5000 dynamic boxes in 625 columns of 8 when asked for, a pile of blocks the size of a busy physics domain
+    bool isLarge = !QProcessEnvironment::systemEnvironment().value(LARGE_BENCHMARKS_VARIABLE).isEmpty();
+    const int NUM_COLUMNS = isLarge ? 25 : 8;
+    const int HEIGHT = 8;
+    const float SECONDS = 2.0f;
+    qint64 elapsed[2];
+    for (bool multithreaded : { false, true }) {
+        TestWorld world(multithreaded);
+        auto boxes = world.addColumns(NUM_COLUMNS, NUM_COLUMNS, HEIGHT);
+        QElapsedTimer timer;
+        timer.start();
+        world.simulate(SECONDS);
+        elapsed[multithreaded] = timer.nsecsElapsed();
+        QVERIFY(maxRestError(boxes, HEIGHT) < REST_TOLERANCE);
+    }
+    int numSteps = (int)(SECONDS / PHYSICS_ENGINE_FIXED_SUBSTEP);
+    qDebug() << NUM_COLUMNS * NUM_COLUMNS * HEIGHT << "boxes," << numSteps << "steps:"
+        << "single threaded" << (float)elapsed[0] / NSECS_PER_MSEC / numSteps << "ms per step,"
+        << "multithreaded" << (float)elapsed[1] / NSECS_PER_MSEC / numSteps << "ms per step";
+}
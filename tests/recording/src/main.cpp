@@ -119,10 +119,63 @@ void testClipOrdering() {
     Q_UNUSED(lastFrameTimeOffset); // FIXME - Unix build not yet upgraded to Qt 5.5.1 we can remove this once it is
 }
 
+void testIndexedClip() {
+    QTemporaryFile file;
+    QString fileName;
+    if (file.open()) {
+        fileName = file.fileName();
+        file.close();
+    }
+
+    // enough frames to span several index regions
+    const size_t FRAME_COUNT = 5000;
+    auto writeClip = Clip::newClip();
+    for (size_t i = 0; i < FRAME_COUNT; ++i) {
+        writeClip->addFrame(std::make_shared<Frame>(TEST_FRAME_TYPE, (float)i / 100.0f, QByteArray::number((int)i)));
+    }
+    Clip::toFile(fileName, writeClip);
+
+    auto readClip = Clip::fromFile(fileName);
+    QVERIFY(readClip != Clip::Pointer());
+    QVERIFY(readClip->frameCount() == FRAME_COUNT);
+    QVERIFY(readClip->duration() == writeClip->duration());
+
+    // seeking lands on the same frame as it does in the clip that was written
+    for (float offset : { 0.0f, 12.345f, 20.48f, 41.0f, 49.99f }) {
+        readClip->seek(offset);
+        writeClip->seek(offset);
+        QVERIFY(readClip->position() == writeClip->position());
+        auto readFrame = readClip->nextFrame();
+        auto writeFrame = writeClip->nextFrame();
+        QVERIFY(readFrame && writeFrame);
+        QVERIFY(readFrame->timeOffset == writeFrame->timeOffset);
+        QVERIFY(readFrame->data == writeFrame->data);
+    }
+    readClip->seek(100.0f);
+    QVERIFY(!readClip->nextFrame());
+
+    // converting in place keeps every frame
+    readClip.reset();
+    QVERIFY(Clip::convertFile(fileName, fileName));
+    readClip = Clip::fromFile(fileName);
+    QVERIFY(readClip != Clip::Pointer());
+    QVERIFY(readClip->frameCount() == FRAME_COUNT);
+    readClip->seek(0);
+    writeClip->seek(0);
+    size_t count = 0;
+    for (auto readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame(); readFrame && writeFrame;
+        readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame(), ++count) {
+        QVERIFY(readFrame->timeOffset == writeFrame->timeOffset);
+        QVERIFY(readFrame->data == writeFrame->data);
+    }
+    QVERIFY(count == FRAME_COUNT);
+}
+
 int main(int, const char**) {
     setupHifiApplication("Recording Test");
 
     testFrameTypeRegistration();
     testFilePersist();
     testClipOrdering();
+    testIndexedClip();
 }
@@ -0,0 +1,195 @@
+//
+//  SceneTests.cpp
+//  tests/render/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SceneTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <NumericalConstants.h>
+#include <render/Scene.h>
+
+QTEST_GUILESS_MAIN(SceneTests)
+
+// a payload that remembers the updates it went through
+class TestItem {
+public:
+    glm::vec3 position;
+    float size { 1.0f };
+    bool layered { false };
+    std::vector<int> updates;
+};
+
+namespace render {
+template <> const ItemKey payloadGetKey(const std::shared_ptr<TestItem>& item) {
+    auto builder = ItemKey::Builder().withTypeShape();
+    if (item->layered) {
+        builder.withLayer(ItemKey::LAYER_1);
+    }
+    return builder.build();
+}
+template <> const Item::Bound payloadGetBound(const std::shared_ptr<TestItem>& item, RenderArgs* args) {
+    return Item::Bound(item->position, item->size);
+}
+}
+
+using namespace render;
+
+// Each producer thread adds its items, updates them one transaction at a time and removes every tenth, the way
+// entity renderers and avatars feed the scene from their own threads.
+static void produce(Scene& scene, int producer, int numItems, int numUpdates, std::vector<ItemID>& ids) {
+    ids.resize(numItems);
+    Transaction resets;
+    for (int i = 0; i < numItems; i++) {
+        ids[i] = scene.allocateID();
+        auto item = std::make_shared<TestItem>();
+        item->position = glm::vec3((float)producer * 10.0f, (float)i, 0.0f);
+        resets.resetItem(ids[i], std::make_shared<Payload<TestItem>>(item));
+    }
+    scene.enqueueTransaction(std::move(resets));
+
+    for (int update = 0; update < numUpdates; update++) {
+        Transaction transaction;
+        for (int i = 0; i < numItems; i++) {
+            transaction.updateItem<TestItem>(ids[i], [update, producer, numUpdates](TestItem& item) {
+                item.updates.push_back(update);
+                item.position.z = (float)update;
+                // half way through some items leave the spatial tree and come back
+                item.layered = (update == numUpdates / 2) && (producer % 2 == 0);
+            });
+        }
+        scene.enqueueTransaction(std::move(transaction));
+    }
+
+    Transaction removes;
+    for (int i = 0; i < numItems; i += 10) {
+        removes.removeItem(ids[i]);
+    }
+    scene.enqueueTransaction(removes);
+}
+
+static void runProducers(Scene& scene, int numProducers, int numItems, int numUpdates, std::vector<std::vector<ItemID>>& ids) {
+    ids.resize(numProducers);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < numProducers; producer++) {
+        producers.emplace_back(produce, std::ref(scene), producer, numItems, numUpdates, std::ref(ids[producer]));
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+static void checkScene(const Scene& scene, const std::vector<std::vector<ItemID>>& ids, int numUpdates) {
+    for (const auto& producerIDs : ids) {
+        for (size_t i = 0; i < producerIDs.size(); i++) {
+            const Item& item = scene.getItem(producerIDs[i]);
+            if (i % 10 == 0) {
+                QVERIFY(!item.exist());
+                continue;
+            }
+            QVERIFY(item.exist());
+            QVERIFY(item.getKey().isSpatial());
+            QVERIFY(item.getCell() != Item::INVALID_CELL);
+            QCOMPARE(item.getBound(nullptr).getCorner().z, (float)(numUpdates - 1));
+        }
+    }
+}
+
+void SceneTests::testConcurrentTransactions() {
+    const int NUM_PRODUCERS = 8;
+    const int NUM_ITEMS = 100;
+    const int NUM_UPDATES = 20;
+    Scene scene(glm::vec3(-16384.0f), 32768.0f);
+    std::vector<std::vector<ItemID>> ids;
+    runProducers(scene, NUM_PRODUCERS, NUM_ITEMS, NUM_UPDATES, ids);
+
+    scene.enqueueFrame();
+    scene.processTransactionQueue();
+    checkScene(scene, ids, NUM_UPDATES);
+    QCOMPARE(scene.getNumItems(), (size_t)(NUM_PRODUCERS * NUM_ITEMS + 1));
+
+    // an empty frame changes nothing
+    uint32_t frame = scene.enqueueFrame();
+    scene.processTransactionQueue();
+    QCOMPARE(scene.enqueueFrame(), frame + 1);
+    checkScene(scene, ids, NUM_UPDATES);
+}
+
+void SceneTests::testParallelItemUpdates() {
+    const int NUM_PRODUCERS = 8;
+    const int NUM_ITEMS = 100;
+    const int NUM_UPDATES = 20;
+    Scene scene(glm::vec3(-16384.0f), 32768.0f);
+    scene.setParallelItemUpdates(true);
+
+    std::vector<std::vector<ItemID>> ids;
+    runProducers(scene, NUM_PRODUCERS, NUM_ITEMS, NUM_UPDATES, ids);
+    scene.enqueueFrame();
+    scene.processTransactionQueue();
+    checkScene(scene, ids, NUM_UPDATES);
+
+    // the updates of one item still come in the order they were queued
+    const int NUM_ORDERED = 50;
+    ItemID id = ids[0][1];
+    for (int update = 0; update < NUM_ORDERED; update++) {
+        Transaction transaction;
+        transaction.updateItem<TestItem>(id, [update](TestItem& item) {
+            item.updates.push_back(NUM_UPDATES + update);
+        });
+        scene.enqueueTransaction(transaction);
+    }
+    std::vector<int> updates;
+    Transaction query;
+    query.updateItem<TestItem>(id, [&updates](TestItem& item) {
+        updates = item.updates;
+    });
+    scene.enqueueTransaction(query);
+    scene.enqueueFrame();
+    scene.processTransactionQueue();
+
+    QCOMPARE((int)updates.size(), NUM_UPDATES + NUM_ORDERED);
+    for (int i = 0; i < (int)updates.size(); i++) {
+        QCOMPARE(updates[i], i);
+    }
+}
+
+void SceneTests::benchmarkTransactions() {
+    // no GPU involved: transactions only touch the items, the spatial tree and the stages
+    const int NUM_PRODUCERS = 16;
+    const int NUM_ITEMS = 500;
+    const int NUM_UPDATES = 50;
+
+    for (bool parallel : { false, true }) {
+        Scene scene(glm::vec3(-16384.0f), 32768.0f);
+        scene.setParallelItemUpdates(parallel);
+        std::vector<std::vector<ItemID>> ids;
+
+        QElapsedTimer timer;
+        timer.start();
+        runProducers(scene, NUM_PRODUCERS, NUM_ITEMS, NUM_UPDATES, ids);
+        qint64 enqueueElapsed = timer.nsecsElapsed();
+
+        timer.restart();
+        scene.enqueueFrame();
+        qint64 frameElapsed = timer.nsecsElapsed();
+
+        timer.restart();
+        scene.processTransactionQueue();
+        qint64 processElapsed = timer.nsecsElapsed();
+
+        checkScene(scene, ids, NUM_UPDATES);
+        qDebug() << NUM_PRODUCERS << "producers," << NUM_PRODUCERS * (NUM_UPDATES + 2) << "transactions,"
+            << NUM_PRODUCERS * NUM_ITEMS * NUM_UPDATES << "updates," << (parallel ? "parallel" : "serial") << "updates:"
+            << "enqueue" << (float)enqueueElapsed / NSECS_PER_MSEC << "ms,"
+            << "enqueueFrame" << (float)frameElapsed / NSECS_PER_MSEC << "ms,"
+            << "process" << (float)processElapsed / NSECS_PER_MSEC << "ms";
+    }
+}
@@ -0,0 +1,26 @@
+//
+//  SceneTests.h
+//  tests/render/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_SceneTests_h
+#define hifi_render_SceneTests_h
+
+#include <QtTest/QtTest>
+
+class SceneTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testConcurrentTransactions();
+    void testParallelItemUpdates();
+    void benchmarkTransactions();
+};
+
+#endif // hifi_render_SceneTests_h
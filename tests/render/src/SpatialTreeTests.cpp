@@ -0,0 +1,168 @@
+//
+//  SpatialTreeTests.cpp
+//  tests/render/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpatialTreeTests.h"
+
+#include <cmath>
+#include <random>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <NumericalConstants.h>
+#include <ViewFrustum.h>
+#include <render/SpatialTree.h>
+
+QTEST_GUILESS_MAIN(SpatialTreeTests)
+
+using namespace render;
+
+// a few city blocks worth of things, from pebbles to buildings, enough cells for the selection to go parallel
+static void fillTree(ItemSpatialTree& tree, int numItems) {
+    std::mt19937 generator(4321);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> height(0.0f, 50.0f);
+    std::uniform_real_distribution<float> logSize(-2.0f, 5.0f);
+    for (int i = 0; i < numItems; i++) {
+        float size = exp2f(logSize(generator));
+        AABox bound(glm::vec3(position(generator), height(generator), position(generator)), size);
+        ItemKey newKey = ItemKey::Builder().withTypeShape().build();
+        tree.resetItem(INVALID_CELL, ItemKey(), bound, (ItemID)i, newKey);
+    }
+}
+
+static ViewFrustum makePerspective(const glm::vec3& position, float yaw, float farClip) {
+    ViewFrustum frustum;
+    frustum.setProjection(60.0f, 16.0f / 9.0f, 0.1f, farClip);
+    frustum.setPosition(position);
+    frustum.setOrientation(glm::angleAxis(yaw, Vectors::UNIT_Y) * glm::angleAxis(-0.2f, Vectors::UNIT_X));
+    frustum.calculate();
+    return frustum;
+}
+
+static ViewFrustum makeOrthographic(const glm::vec3& position, float halfWidth, float depth) {
+    ViewFrustum frustum;
+    frustum.setProjection(glm::ortho(-halfWidth, halfWidth, -halfWidth, halfWidth, -depth, depth));
+    frustum.setPosition(position);
+    frustum.setOrientation(glm::angleAxis(-0.9f, Vectors::UNIT_X) * glm::angleAxis(0.4f, Vectors::UNIT_Y));
+    frustum.calculate();
+    return frustum;
+}
+
+static void compareSelections(const ItemSpatialTree::CellSelection& a, const ItemSpatialTree::CellSelection& b) {
+    QCOMPARE(a.insideCells, b.insideCells);
+    QCOMPARE(a.insideBricks, b.insideBricks);
+    QCOMPARE(a.partialCells, b.partialCells);
+    QCOMPARE(a.partialBricks, b.partialBricks);
+}
+
+void SpatialTreeTests::testSelectMatchesSerial() {
+    ItemSpatialTree tree(glm::vec3(-16384.0f), 32768.0f);
+    fillTree(tree, 20000);
+
+    std::vector<std::pair<ViewFrustum, float>> cases {
+        { makePerspective(glm::vec3(0.0f, 2.0f, 0.0f), 0.0f, 1000.0f), 0.002f },
+        { makePerspective(glm::vec3(-300.0f, 20.0f, 250.0f), 2.5f, 200.0f), 0.0f },
+        { makePerspective(glm::vec3(10000.0f, 0.0f, 0.0f), 1.0f, 1000.0f), 0.002f },
+        { makeOrthographic(glm::vec3(0.0f, 100.0f, 0.0f), 300.0f, 500.0f), 0.1f },
+        { makeOrthographic(glm::vec3(120.0f, 60.0f, -40.0f), 40.0f, 200.0f), 0.0f }
+    };
+    for (const auto& testCase : cases) {
+        // the scalar, single frustum traversal is the reference
+        ItemSpatialTree::CellSelection expected;
+        tree.Octree::select(expected, *tree.evalSelector(testCase.first, testCase.second));
+
+        ItemSpatialTree::CellSelection selection;
+        int numSelected = tree.selectCells(selection, testCase.first, testCase.second);
+        QCOMPARE(numSelected, (int)expected.size());
+        compareSelections(selection, expected);
+    }
+}
+
+void SpatialTreeTests::testSelectSeveralFrustums() {
+    ItemSpatialTree tree(glm::vec3(-16384.0f), 32768.0f);
+    fillTree(tree, 20000);
+
+    std::vector<ViewFrustum> frustums;
+    std::vector<float> thresholds;
+    for (int i = 0; i < 6; i++) {
+        frustums.push_back(makePerspective(glm::vec3(20.0f * i, 2.0f, 0.0f), 1.1f * i, 100.0f * (i + 1)));
+        thresholds.push_back(0.001f * i);
+    }
+    frustums.push_back(makeOrthographic(glm::vec3(0.0f, 100.0f, 0.0f), 150.0f, 500.0f));
+    thresholds.push_back(0.1f);
+
+    std::vector<ItemSpatialTree::CellSelection> selections;
+    int numSelected = tree.selectCells(selections, frustums, thresholds);
+    QCOMPARE(selections.size(), frustums.size());
+
+    int numExpected = 0;
+    for (size_t i = 0; i < frustums.size(); i++) {
+        ItemSpatialTree::CellSelection expected;
+        numExpected += tree.Octree::select(expected, *tree.evalSelector(frustums[i], thresholds[i]));
+        compareSelections(selections[i], expected);
+    }
+    QCOMPARE(numSelected, numExpected);
+
+    // the items come straight from the selected bricks
+    ItemFilter filter = ItemFilter::Builder::visibleWorldItems();
+    std::vector<ItemSpatialTree::ItemSelection> itemSelections;
+    tree.selectCellItems(itemSelections, filter, frustums, thresholds);
+    for (size_t i = 0; i < frustums.size(); i++) {
+        ItemSpatialTree::ItemSelection expected;
+        tree.selectCellItems(expected, filter, frustums[i], thresholds[i]);
+        QCOMPARE(itemSelections[i].insideItems, expected.insideItems);
+        QCOMPARE(itemSelections[i].partialItems, expected.partialItems);
+        QCOMPARE(itemSelections[i].insideSubcellItems, expected.insideSubcellItems);
+        QCOMPARE(itemSelections[i].partialSubcellItems, expected.partialSubcellItems);
+    }
+}
+
+void SpatialTreeTests::benchmarkSelectCascades() {
+    // the main view plus four shadow cascades of growing size, as a frame with a keylight would query
+    ItemSpatialTree tree(glm::vec3(-16384.0f), 32768.0f);
+    fillTree(tree, 100000);
+
+    std::vector<ViewFrustum> frustums { makePerspective(glm::vec3(0.0f, 2.0f, 0.0f), 0.3f, 1000.0f) };
+    std::vector<float> thresholds { 0.002f };
+    for (int i = 0; i < 4; i++) {
+        frustums.push_back(makeOrthographic(glm::vec3(0.0f, 100.0f, 0.0f), 25.0f * (1 << (2 * i)), 500.0f));
+        thresholds.push_back(0.05f);
+    }
+
+    const int NUM_FRAMES = 200;
+    QElapsedTimer timer;
+    timer.start();
+    size_t numSerial = 0;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (size_t i = 0; i < frustums.size(); i++) {
+            ItemSpatialTree::CellSelection selection;
+            tree.Octree::select(selection, *tree.evalSelector(frustums[i], thresholds[i]));
+            numSerial += selection.size();
+        }
+    }
+    qint64 serialElapsed = timer.nsecsElapsed();
+
+    timer.restart();
+    size_t numBatched = 0;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        std::vector<ItemSpatialTree::CellSelection> selections;
+        tree.selectCells(selections, frustums, thresholds);
+        for (const auto& selection : selections) {
+            numBatched += selection.size();
+        }
+    }
+    qint64 batchedElapsed = timer.nsecsElapsed();
+
+    QCOMPARE(numBatched, numSerial);
+    qDebug() << tree.getNumAllocatedCells() << "cells," << frustums.size() << "frustums:"
+        << "one at a time" << (float)serialElapsed / NSECS_PER_MSEC / NUM_FRAMES << "ms per frame,"
+        << "together" << (float)batchedElapsed / NSECS_PER_MSEC / NUM_FRAMES << "ms per frame";
+}
@@ -0,0 +1,26 @@
+//
+//  SpatialTreeTests.h
+//  tests/render/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_SpatialTreeTests_h
+#define hifi_render_SpatialTreeTests_h
+
+#include <QtTest/QtTest>
+
+class SpatialTreeTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testSelectMatchesSerial();
+    void testSelectSeveralFrustums();
+    void benchmarkSelectCascades();
+};
+
+#endif // hifi_render_SpatialTreeTests_h
@@ -0,0 +1,266 @@
+//
+//  MetricsRegistryTests.cpp
+//  tests/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MetricsRegistryTests.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <MetricsRegistry.h>
+#include <NumericalConstants.h>
+
+QTEST_GUILESS_MAIN(MetricsRegistryTests)
+
+static void checkBucket(uint32_t value) {
+    int index = MetricHistogram::bucketIndex(value);
+    QVERIFY(index >= 0 && index < MetricHistogram::NUM_BUCKETS);
+
+    uint64_t lower = MetricHistogram::bucketLowerBound(index);
+    uint64_t upper = MetricHistogram::bucketUpperBound(index);
+    QVERIFY(lower <= value && value < upper);
+
+    // no wider than an eighth of the values it holds
+    QVERIFY(upper - lower <= std::max((uint64_t)1, lower / MetricHistogram::NUM_SUB_BUCKETS));
+}
+
+void MetricsRegistryTests::testBuckets() {
+    int lastIndex = 0;
+    for (uint32_t value = 0; value < 100000; ++value) {
+        checkBucket(value);
+        int index = MetricHistogram::bucketIndex(value);
+        QVERIFY(index == lastIndex || index == lastIndex + 1);
+        lastIndex = index;
+    }
+
+    for (int bit = 0; bit < 32; ++bit) {
+        uint32_t value = (uint32_t)1 << bit;
+        checkBucket(value - 1);
+        checkBucket(value);
+        checkBucket(value + 1);
+    }
+    checkBucket(UINT32_MAX);
+    QCOMPARE(MetricHistogram::bucketIndex(UINT32_MAX), MetricHistogram::NUM_BUCKETS - 1);
+
+    // the buckets tile the whole range
+    QCOMPARE(MetricHistogram::bucketLowerBound(0), (uint64_t)0);
+    for (int i = 1; i < MetricHistogram::NUM_BUCKETS; ++i) {
+        QCOMPARE(MetricHistogram::bucketLowerBound(i), MetricHistogram::bucketUpperBound(i - 1));
+    }
+    QCOMPARE(MetricHistogram::bucketUpperBound(MetricHistogram::NUM_BUCKETS - 1), (uint64_t)UINT32_MAX + 1);
+
+    // too big for the buckets, but the sum keeps it
+    MetricHistogram histogram;
+    uint64_t huge = (uint64_t)UINT32_MAX * 4;
+    histogram.record(huge);
+    QCOMPARE(histogram.getBucket(MetricHistogram::NUM_BUCKETS - 1), (uint64_t)1);
+    QCOMPARE(histogram.getSum(), huge);
+}
+
+void MetricsRegistryTests::testConcurrentRecord() {
+    const int NUM_THREADS = 4;
+    const uint32_t NUM_RECORDS = 200000;
+    const uint32_t MAX_VALUE = 20000;
+
+    MetricHistogram histogram;
+    MetricCounter counter;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&] {
+            for (uint32_t j = 0; j < NUM_RECORDS; ++j) {
+                histogram.record(j % MAX_VALUE);
+                counter.add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    MetricHistogram expected;
+    uint64_t expectedSum = 0;
+    for (uint32_t j = 0; j < NUM_RECORDS; ++j) {
+        expected.record(j % MAX_VALUE);
+        expectedSum += j % MAX_VALUE;
+    }
+
+    uint64_t count = 0;
+    for (int i = 0; i < MetricHistogram::NUM_BUCKETS; ++i) {
+        QCOMPARE(histogram.getBucket(i), expected.getBucket(i) * NUM_THREADS);
+        count += histogram.getBucket(i);
+    }
+    QCOMPARE(count, (uint64_t)NUM_RECORDS * NUM_THREADS);
+    QCOMPARE(histogram.getSum(), expectedSum * NUM_THREADS);
+    QCOMPARE(counter.get(), (uint64_t)NUM_RECORDS * NUM_THREADS);
+}
+
+void MetricsRegistryTests::testRegistry() {
+    MetricsRegistry registry;
+    MetricCounter& counter = registry.counter("packets", "Packets processed");
+    MetricHistogram& histogram = registry.histogram("frame_usecs", "Frame time");
+
+    // registering again hands back the same metric
+    QCOMPARE(&registry.counter("packets", "Packets processed"), &counter);
+    QCOMPARE(&registry.histogram("frame_usecs", "Frame time"), &histogram);
+    QVERIFY(&registry.histogram("mix_usecs", "Mix time") != &histogram);
+
+    counter.add(3);
+    histogram.record(5);
+    histogram.record(5);
+    histogram.record(1000);
+
+    auto snapshots = registry.snapshot();
+    QCOMPARE(snapshots.size(), (size_t)3);
+
+    QCOMPARE(snapshots[0].name, QString("packets"));
+    QCOMPARE(snapshots[0].type, MetricSnapshot::Counter);
+    QCOMPARE(snapshots[0].value, (quint64)3);
+
+    QCOMPARE(snapshots[1].name, QString("frame_usecs"));
+    QCOMPARE(snapshots[1].help, QString("Frame time"));
+    QCOMPARE(snapshots[1].type, MetricSnapshot::Histogram);
+    QCOMPARE(snapshots[1].value, (quint64)1010);
+    QCOMPARE(snapshots[1].count, (quint64)3);
+    QCOMPARE(snapshots[1].buckets.size(), (size_t)2);
+    QCOMPARE((int)snapshots[1].buckets[0].first, MetricHistogram::bucketIndex(5));
+    QCOMPARE(snapshots[1].buckets[0].second, (quint64)2);
+    QCOMPARE((int)snapshots[1].buckets[1].first, MetricHistogram::bucketIndex(1000));
+
+    // nothing recorded yet
+    QCOMPARE(snapshots[2].count, (quint64)0);
+    QVERIFY(snapshots[2].buckets.empty());
+}
+
+void MetricsRegistryTests::testSnapshotRoundTrip() {
+    MetricsRegistry registry;
+    registry.counter("edits", "Edits applied").add(12345678901ULL);
+    MetricHistogram& histogram = registry.histogram("latency_usecs", "Latency");
+    for (uint32_t value = 1; value < 1000000; value *= 3) {
+        histogram.record(value);
+    }
+    registry.histogram("empty_usecs", "Never recorded");
+
+    auto expected = registry.snapshot();
+    QByteArray data = registry.toByteArray();
+    auto snapshots = MetricsRegistry::fromByteArray(data);
+
+    QCOMPARE(snapshots.size(), expected.size());
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+        QCOMPARE(snapshots[i].name, expected[i].name);
+        QCOMPARE(snapshots[i].help, expected[i].help);
+        QCOMPARE(snapshots[i].type, expected[i].type);
+        QCOMPARE(snapshots[i].value, expected[i].value);
+        QCOMPARE(snapshots[i].count, expected[i].count);
+        QVERIFY(snapshots[i].buckets == expected[i].buckets);
+    }
+
+    // a cut off packet gives back the metrics that made it, and nothing made up
+    auto truncated = MetricsRegistry::fromByteArray(data.left(data.size() / 2));
+    QVERIFY(truncated.size() < expected.size());
+    for (size_t i = 0; i < truncated.size(); ++i) {
+        QCOMPARE(truncated[i].name, expected[i].name);
+    }
+    QVERIFY(MetricsRegistry::fromByteArray(QByteArray()).empty());
+}
+
+void MetricsRegistryTests::benchmarkOverhead() {
+    // every worker decodes a network frame per packet and mixes it for a few listeners, standing in for the audio
+    // mixer slaves, and records how long the packet waited into one histogram they all share, the worst case for
+    // the atomic adds
+    const int NUM_THREADS = 4;
+    const int NUM_PACKETS = 50000;
+    const int NUM_SAMPLES = 240;
+    const int NUM_LISTENERS = 8;
+    const int NUM_RUNS = 5;
+
+    std::vector<int16_t> input(NUM_SAMPLES);
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        input[i] = (int16_t)((i * 7919) % 65536 - 32768);
+    }
+
+    auto run = [&](MetricHistogram* histogram) {
+        std::atomic<float> sink { 0.0f };
+        std::vector<std::thread> threads;
+        QElapsedTimer timer;
+        timer.start();
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&, t] {
+                std::vector<float> frame(NUM_SAMPLES);
+                std::vector<float> mixes(NUM_SAMPLES * NUM_LISTENERS, 0.0f);
+                float z1 = 0.0f;
+                float z2 = 0.0f;
+                for (int p = 0; p < NUM_PACKETS; ++p) {
+                    // a filter with state, which like a codec can't be vectorized
+                    for (int i = 0; i < NUM_SAMPLES; ++i) {
+                        float x = input[i] * (1.0f / 32768.0f);
+                        float y = x + z1;
+                        z1 = 0.5f * x - 0.3f * y + z2;
+                        z2 = 0.2f * x - 0.1f * y;
+                        frame[i] = y;
+                    }
+                    for (int l = 0; l < NUM_LISTENERS; ++l) {
+                        float gain = 1.0f / (1 + (p + l + t) % 16);
+                        float* mix = &mixes[l * NUM_SAMPLES];
+                        for (int i = 0; i < NUM_SAMPLES; ++i) {
+                            mix[i] += frame[i] * gain;
+                        }
+                    }
+                    if (histogram) {
+                        histogram->record((uint32_t)(p * 2654435761u) % 20000);
+                    }
+                }
+                float total = 0.0f;
+                for (float sample : mixes) {
+                    total += sample;
+                }
+                sink = sink + total;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return timer.nsecsElapsed();
+    };
+
+    // best of a few runs, each way, to keep scheduling noise out of it
+    qint64 withoutElapsed = std::numeric_limits<qint64>::max();
+    qint64 withElapsed = std::numeric_limits<qint64>::max();
+    MetricHistogram histogram;
+    for (int i = 0; i < NUM_RUNS; ++i) {
+        withoutElapsed = std::min(withoutElapsed, run(nullptr));
+        withElapsed = std::min(withElapsed, run(&histogram));
+    }
+
+    uint64_t count = 0;
+    for (int i = 0; i < MetricHistogram::NUM_BUCKETS; ++i) {
+        count += histogram.getBucket(i);
+    }
+    QCOMPARE(count, (uint64_t)NUM_THREADS * NUM_PACKETS * NUM_RUNS);
+
+    // the difference above is close to the noise, so time the records on their own as well
+    const int NUM_RECORDS = 10000000;
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < NUM_RECORDS; ++i) {
+        histogram.record((uint32_t)(i * 2654435761u) % 20000);
+    }
+    float recordNsecs = (float)timer.nsecsElapsed() / NUM_RECORDS;
+    float packetNsecs = (float)withoutElapsed / (NUM_THREADS * NUM_PACKETS);
+
+    qDebug() << NUM_THREADS << "threads," << NUM_PACKETS << "packets each:"
+        << "without metrics" << (float)withoutElapsed / NSECS_PER_MSEC << "ms,"
+        << "with metrics" << (float)withElapsed / NSECS_PER_MSEC << "ms,"
+        << "overhead" << 100.0f * (withElapsed - withoutElapsed) / withoutElapsed << "%";
+    qDebug() << "record()" << recordNsecs << "ns," << packetNsecs << "ns of work per packet,"
+        << 100.0f * recordNsecs / packetNsecs << "% per packet";
+}
@@ -0,0 +1,29 @@
+//
+//  MetricsRegistryTests.h
+//  tests/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MetricsRegistryTests_h
+#define hifi_MetricsRegistryTests_h
+
+#include <QtTest/QtTest>
+
+class MetricsRegistryTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testBuckets();
+    void testConcurrentRecord();
+    void testRegistry();
+    void testSnapshotRoundTrip();
+
+    // a mixer-like packet loop run with and without recording into a shared histogram
+    void benchmarkOverhead();
+};
+
+#endif // hifi_MetricsRegistryTests_h
@@ -0,0 +1,329 @@
+//
+//  TimerWheelTests.cpp
+//  tests/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TimerWheelTests.h"
+
+#include <limits>
+#include <map>
+#include <random>
+#include <unordered_map>
+
+#include <TimerWheel.h>
+
+QTEST_GUILESS_MAIN(TimerWheelTests)
+
+using TimerID = TimerWheel::TimerID;
+
+void TimerWheelTests::testSingleShot() {
+    TimerWheel wheel;
+    auto timerID = wheel.add(0, 10, false);
+    QVERIFY(timerID != TimerWheel::INVALID_TIMER_ID);
+
+    std::vector<TimerID> fired;
+    auto record = [&](TimerID id, bool isRepeating) {
+        QVERIFY(!isRepeating);
+        QVERIFY(!wheel.contains(id));
+        fired.push_back(id);
+    };
+
+    wheel.advance(9, record);
+    QVERIFY(fired.empty());
+
+    wheel.advance(10, record);
+    QCOMPARE(fired.size(), (size_t)1);
+    QCOMPARE(fired[0], timerID);
+    QVERIFY(wheel.isEmpty());
+
+    wheel.advance(100, record);
+    QCOMPARE(fired.size(), (size_t)1);
+}
+
+void TimerWheelTests::testSameDeadlineOrdering() {
+    TimerWheel wheel;
+    auto first = wheel.add(0, 5, false);
+    auto second = wheel.add(0, 5, false);
+    auto earlier = wheel.add(0, 3, false);
+    auto later = wheel.add(0, 300, false);
+    auto last = wheel.add(0, 5, false);
+
+    std::vector<TimerID> fired;
+    wheel.advance(1000, [&](TimerID id, bool) { fired.push_back(id); });
+
+    std::vector<TimerID> expected { earlier, first, second, last, later };
+    QVERIFY(fired == expected);
+}
+
+void TimerWheelTests::testRepeating() {
+    TimerWheel wheel;
+    auto timerID = wheel.add(0, 10, true);
+
+    std::vector<quint64> fireTimes;
+    for (quint64 now = 1; now <= 100; ++now) {
+        wheel.advance(now, [&](TimerID id, bool isRepeating) {
+            QCOMPARE(id, timerID);
+            QVERIFY(isRepeating);
+            fireTimes.push_back(now);
+        });
+    }
+
+    QCOMPARE(fireTimes.size(), (size_t)10);
+    for (size_t i = 0; i < fireTimes.size(); ++i) {
+        QCOMPARE(fireTimes[i], (quint64)(10 * (i + 1)));
+    }
+
+    // a late advance doesn't fire once per missed interval, and the next one is a full interval away
+    int numFired = 0;
+    wheel.advance(155, [&](TimerID, bool) { ++numFired; });
+    QCOMPARE(numFired, 1);
+    wheel.advance(164, [&](TimerID, bool) { ++numFired; });
+    QCOMPARE(numFired, 1);
+    wheel.advance(165, [&](TimerID, bool) { ++numFired; });
+    QCOMPARE(numFired, 2);
+
+    QVERIFY(wheel.remove(timerID));
+    QVERIFY(!wheel.remove(timerID));
+    wheel.advance(1000, [&](TimerID, bool) { ++numFired; });
+    QCOMPARE(numFired, 2);
+}
+
+void TimerWheelTests::testRemoveDuringFire() {
+    TimerWheel wheel;
+    auto remover = wheel.add(0, 5, false);
+    auto removed = wheel.add(0, 5, false);
+    auto interval = wheel.add(0, 5, true);
+
+    std::vector<TimerID> fired;
+    wheel.advance(5, [&](TimerID id, bool) {
+        fired.push_back(id);
+        if (id == remover) {
+            QVERIFY(wheel.remove(removed));
+        } else if (id == interval) {
+            // clearInterval from inside its own callback
+            QVERIFY(wheel.remove(interval));
+        }
+    });
+
+    std::vector<TimerID> expected { remover, interval };
+    QVERIFY(fired == expected);
+    QVERIFY(wheel.isEmpty());
+
+    wheel.advance(100, [&](TimerID id, bool) { fired.push_back(id); });
+    QCOMPARE(fired.size(), (size_t)2);
+}
+
+void TimerWheelTests::testAddDuringFire() {
+    TimerWheel wheel;
+    wheel.add(0, 5, false);
+
+    TimerID added = TimerWheel::INVALID_TIMER_ID;
+    int numFired = 0;
+    wheel.advance(5, [&](TimerID, bool) {
+        ++numFired;
+        // a zero delay timer added from a callback waits for the next advance
+        added = wheel.add(5, 0, false);
+    });
+    QCOMPARE(numFired, 1);
+    QVERIFY(wheel.contains(added));
+
+    wheel.advance(6, [&](TimerID id, bool) {
+        ++numFired;
+        QCOMPARE(id, added);
+    });
+    QCOMPARE(numFired, 2);
+}
+
+void TimerWheelTests::testLongDelays() {
+    const quint64 START = 12345;
+    const std::vector<quint64> DELAYS { 255, 256, 257, 16383, 16384, 16385, 1 << 20, (1 << 20) + 1,
+                                        (1ULL << 26) - 1, 1ULL << 26, (1ULL << 26) + 5, 3ULL * 24 * 60 * 60 * 1000 };
+
+    TimerWheel wheel(START);
+    std::unordered_map<TimerID, quint64> deadlines;
+    for (auto delay : DELAYS) {
+        deadlines[wheel.add(START, (quint32)delay, false)] = START + delay;
+    }
+
+    // step straight to each wakeup the wheel asks for, every timer should fire exactly at its deadline
+    std::vector<quint64> deadlinesInOrder;
+    for (const auto& entry : deadlines) {
+        deadlinesInOrder.push_back(entry.second);
+    }
+    std::sort(deadlinesInOrder.begin(), deadlinesInOrder.end());
+
+    std::vector<quint64> fireTimes;
+    while (!wheel.isEmpty()) {
+        auto wakeup = wheel.getNextWakeup();
+        QVERIFY(wakeup >= 0);
+        wheel.advance((quint64)wakeup, [&](TimerID id, bool) {
+            QCOMPARE((quint64)wakeup, deadlines[id]);
+            fireTimes.push_back((quint64)wakeup);
+        });
+    }
+    QVERIFY(fireTimes == deadlinesInOrder);
+}
+
+void TimerWheelTests::testNextWakeup() {
+    TimerWheel wheel(1000);
+    QCOMPARE(wheel.getNextWakeup(), (qint64)-1);
+
+    wheel.add(1000, 5, false);
+    QCOMPARE(wheel.getNextWakeup(), (qint64)1005);
+
+    // an idle wheel catches up with the clock when a timer is added
+    wheel.clear();
+    wheel.add(50000, 5, false);
+    QCOMPARE(wheel.getNextWakeup(), (qint64)50005);
+
+    // far timers wake the owner no later than their deadline
+    wheel.clear();
+    wheel.add(50000, 100000, false);
+    QVERIFY(wheel.getNextWakeup() <= 150000);
+}
+
+void TimerWheelTests::testNextWakeupAtLapStart() {
+    // advancing right up to a lap boundary has to bring the coarser timers down before the owner asks
+    TimerWheel wheel(0);
+    wheel.add(0, 255, false);
+    auto laterID = wheel.add(0, 300, false);
+    wheel.advance(255, [](TimerID, bool) {});
+    QCOMPARE(wheel.getNextWakeup(), (qint64)300);
+
+    std::vector<TimerID> fired;
+    wheel.advance(300, [&](TimerID id, bool) { fired.push_back(id); });
+    QCOMPARE(fired, std::vector<TimerID> { laterID });
+}
+
+void TimerWheelTests::testNextWakeupMatchesDeadlines() {
+    // against a plain map of deadlines, the wheel never asks to be woken after the earliest one
+    std::mt19937 generator(164);
+    std::uniform_int_distribution<int> operations(0, 2);
+    std::uniform_int_distribution<quint32> nearDelays(1, 300);
+    std::uniform_int_distribution<quint32> farDelays(1, 70000);
+    std::uniform_int_distribution<int> steps(1, 400);
+
+    TimerWheel wheel(0);
+    std::map<TimerID, quint64> deadlines;
+    quint64 now = 0;
+    for (int i = 0; i < 20000; ++i) {
+        if (operations(generator) == 0) {
+            quint32 delay = i % 2 ? nearDelays(generator) : farDelays(generator);
+            deadlines[wheel.add(now, delay, false)] = now + delay;
+        } else {
+            now += steps(generator);
+            wheel.advance(now, [&](TimerID id, bool) {
+                QVERIFY(deadlines[id] <= now);
+                deadlines.erase(id);
+            });
+        }
+
+        quint64 earliest = std::numeric_limits<quint64>::max();
+        for (const auto& entry : deadlines) {
+            QVERIFY(entry.second > now);
+            earliest = std::min(earliest, entry.second);
+        }
+        if (!deadlines.empty()) {
+            QVERIFY((quint64)wheel.getNextWakeup() <= earliest);
+        }
+    }
+}
+
+void TimerWheelTests::testStress() {
+    const int NUM_TIMERS = 10000;
+    const quint64 DURATION = 200000;
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<quint32> singleShotDelays(1, 150000);
+    std::uniform_int_distribution<quint32> intervals(1, 5000);
+    std::uniform_int_distribution<int> steps(1, 50);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    struct Expectation {
+        quint64 deadline;
+        quint32 interval;
+        bool isRepeating;
+        int numFired;
+    };
+
+    TimerWheel wheel;
+    std::unordered_map<TimerID, Expectation> expectations;
+    for (int i = 0; i < NUM_TIMERS; ++i) {
+        bool isRepeating = i % 4 == 0;
+        quint32 interval = isRepeating ? intervals(generator) : singleShotDelays(generator);
+        auto id = wheel.add(0, interval, isRepeating);
+        expectations[id] = { interval, interval, isRepeating, 0 };
+    }
+    QCOMPARE(wheel.size(), NUM_TIMERS);
+
+    int numRemoved = 0;
+    quint64 now = 0;
+    while (now < DURATION) {
+        quint64 previous = now;
+        now += steps(generator);
+        quint64 lastDeadline = 0;
+
+        wheel.advance(now, [&](TimerID id, bool isRepeating) {
+            auto& expectation = expectations[id];
+            QCOMPARE(isRepeating, expectation.isRepeating);
+
+            // fired by the first advance that reached its deadline, and in deadline order
+            QVERIFY(expectation.deadline <= now);
+            QVERIFY(expectation.deadline > previous);
+            QVERIFY(expectation.deadline >= lastDeadline);
+            lastDeadline = expectation.deadline;
+            ++expectation.numFired;
+
+            if (isRepeating) {
+                expectation.deadline += expectation.interval;
+                if (expectation.deadline <= now) {
+                    expectation.deadline = now + expectation.interval;
+                }
+
+                // clear some intervals from their own callback, like scripts do
+                if (percent(generator) < 5) {
+                    QVERIFY(wheel.remove(id));
+                    ++numRemoved;
+                }
+            }
+        });
+    }
+
+    int numSingleShotsFired = 0;
+    for (const auto& entry : expectations) {
+        const auto& expectation = entry.second;
+        if (expectation.isRepeating) {
+            QVERIFY(expectation.numFired > 0);
+        } else {
+            QCOMPARE(expectation.numFired, expectation.deadline <= DURATION ? 1 : 0);
+            numSingleShotsFired += expectation.numFired;
+        }
+    }
+    QCOMPARE(numSingleShotsFired + wheel.size() + numRemoved, NUM_TIMERS);
+}
+
+void TimerWheelTests::benchmarkAddAndFire() {
+    const int NUM_TIMERS = 10000;
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<quint32> delays(0, 60000);
+
+    QBENCHMARK {
+        TimerWheel wheel;
+        for (int i = 0; i < NUM_TIMERS; ++i) {
+            wheel.add(0, delays(generator), false);
+        }
+
+        int numFired = 0;
+        for (quint64 now = 16; !wheel.isEmpty(); now += 16) {
+            wheel.advance(now, [&](TimerID, bool) { ++numFired; });
+        }
+        QCOMPARE(numFired, NUM_TIMERS);
+    }
+}
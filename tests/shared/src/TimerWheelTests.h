@@ -0,0 +1,33 @@
+//
+//  TimerWheelTests.h
+//  tests/shared/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TimerWheelTests_h
+#define hifi_TimerWheelTests_h
+
+#include <QtTest/QtTest>
+
+class TimerWheelTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testSingleShot();
+    void testSameDeadlineOrdering();
+    void testRepeating();
+    void testRemoveDuringFire();
+    void testAddDuringFire();
+    void testLongDelays();
+    void testNextWakeup();
+    void testNextWakeupAtLapStart();
+    void testNextWakeupMatchesDeadlines();
+    void testStress();
+    void benchmarkAddAndFire();
+};
+
+#endif // hifi_TimerWheelTests_h
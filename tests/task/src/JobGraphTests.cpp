@@ -0,0 +1,244 @@
+//
+//  JobGraphTests.cpp
+//  tests/task/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JobGraphTests.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <task/JobGraph.h>
+#include <task/Task.h>
+
+QTEST_GUILESS_MAIN(JobGraphTests)
+
+namespace {
+
+class TestContext : public task::JobContext {
+public:
+    TestContext(bool canRunInParallel) : _canRunInParallel(canRunInParallel) {}
+
+    std::shared_ptr<task::JobContext> cloneForJob() const override {
+        return _canRunInParallel ? std::make_shared<TestContext>(*this) : nullptr;
+    }
+
+    bool _canRunInParallel;
+};
+using TestContextPointer = std::shared_ptr<TestContext>;
+
+class TestTimeProfiler {
+public:
+    TestTimeProfiler(const std::string& label) {}
+};
+
+Task_DeclareTypeAliases(TestContext, TestTimeProfiler)
+
+// counts the jobs that ran before the jobs producing their input
+std::atomic<int> numEarlyRuns { 0 };
+
+class Constant {
+public:
+    using Output = int;
+    using JobModel = Job::ModelO<Constant, Output>;
+
+    Constant(int value) : _value(value) {}
+
+    void run(const TestContextPointer& context, Output& output) { output = _value; }
+
+    int _value;
+};
+
+class Sum {
+public:
+    using Input = VaryingSet2<int, int>;
+    using Output = int;
+    using JobModel = Job::ModelIO<Sum, Input, Output>;
+
+    void run(const TestContextPointer& context, const Input& input, Output& output) {
+        if (input.get0() == 0 || input.get1() == 0) {
+            ++numEarlyRuns;
+        }
+        output = input.get0() + input.get1();
+    }
+};
+
+class Split {
+public:
+    using Input = int;
+    using Output = VaryingSet2<int, int>;
+    using JobModel = Job::ModelIO<Split, Input, Output>;
+
+    void run(const TestContextPointer& context, const Input& input, Output& output) {
+        if (input == 0) {
+            ++numEarlyRuns;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        output.edit0() = input * 10;
+        output.edit1() = input * 100;
+    }
+};
+
+class Abort {
+public:
+    using Input = int;
+    using Output = int;
+    using JobModel = Job::ModelIO<Abort, Input, Output>;
+
+    void run(const TestContextPointer& context, const Input& input, Output& output) {
+        context->taskFlow.abortTask();
+        output = input;
+    }
+};
+
+// A=1  B=2
+//  \  / |
+//   AB  |    Split(AB) = (30, 300)
+//   |   |
+// C = 30 + A   D = 300 + B
+//    \  /
+//     E = 333
+class DiamondTask {
+public:
+    using Output = VaryingSet2<int, int>;
+    using JobModel = Task::ModelO<DiamondTask, Output>;
+
+    void build(JobModel& task, const Varying& input, Varying& output) {
+        const auto a = task.addJob<Constant>("A", 1);
+        const auto b = task.addJob<Constant>("B", 2);
+        const auto ab = task.addJob<Sum>("AB", Sum::Input(a, b).asVarying());
+        const auto split = task.addJob<Split>("Split", ab);
+        const auto c = task.addJob<Sum>("C", Sum::Input(split.getN<Split::Output>(0), a).asVarying());
+        const auto d = task.addJob<Sum>("D", Sum::Input(split.getN<Split::Output>(1), b).asVarying());
+        const auto e = task.addJob<Sum>("E", Sum::Input(c, d).asVarying());
+        output = Output(e, ab);
+    }
+};
+
+class AbortTask {
+public:
+    using Output = VaryingSet2<int, int>;
+    using JobModel = Task::ModelO<AbortTask, Output>;
+
+    void build(JobModel& task, const Varying& input, Varying& output) {
+        const auto a = task.addJob<Constant>("A", 1);
+        const auto aborted = task.addJob<Abort>("Abort", a);
+        const auto skipped = task.addJob<Sum>("Skipped", Sum::Input(aborted, a).asVarying());
+        output = Output(skipped, a);
+    }
+};
+
+}
+
+void JobGraphTests::testDependencies() {
+    using Pair = task::VaryingSet2<int, int>;
+
+    // the same bindings as DiamondTask
+    task::Varying a(0);
+    task::Varying b(0);
+    task::Varying ab(0);
+    task::Varying split(Pair());
+    task::Varying c(0);
+    task::Varying d(0);
+    task::Varying e(0);
+    const auto& splitElements = split.get<Pair>();
+
+    std::vector<task::Varying> inputs {
+        task::Varying(task::JobNoIO()),
+        task::Varying(task::JobNoIO()),
+        Pair(a, b).asVarying(),
+        ab,
+        Pair(splitElements[0], a).asVarying(),
+        Pair(splitElements[1], b).asVarying(),
+        Pair(c, d).asVarying()
+    };
+    std::vector<task::Varying> outputs { a, b, ab, split, c, d, e };
+
+    task::JobGraph graph;
+    graph.build(inputs, outputs);
+    QCOMPARE(graph.getNumJobs(), 7);
+
+    std::vector<std::vector<int>> expected { {}, {}, { 0, 1 }, { 2 }, { 0, 3 }, { 1, 3 }, { 4, 5 } };
+    for (int i = 0; i < graph.getNumJobs(); ++i) {
+        QVERIFY(graph.getDependencies(i) == expected[i]);
+    }
+
+    // whatever order the pool picks, every job starts after the jobs it depends on are done
+    for (int run = 0; run < 100; ++run) {
+        std::vector<std::atomic<bool>> isDone(graph.getNumJobs());
+        std::atomic<int> numOutOfOrder { 0 };
+        bool isComplete = graph.run([&](int jobIndex) {
+            for (auto dependency : graph.getDependencies(jobIndex)) {
+                if (!isDone[dependency]) {
+                    ++numOutOfOrder;
+                }
+            }
+            isDone[jobIndex] = true;
+            return true;
+        });
+        QVERIFY(isComplete);
+        QCOMPARE(numOutOfOrder.load(), 0);
+        for (const auto& done : isDone) {
+            QVERIFY(done);
+        }
+    }
+}
+
+void JobGraphTests::testParallelRun() {
+    numEarlyRuns = 0;
+
+    Engine sequential(DiamondTask::JobModel::create("Diamond"), std::make_shared<TestContext>(true));
+    sequential.run();
+    const auto& expected = sequential.getOutput().get<DiamondTask::Output>();
+    QCOMPARE(expected.get0(), 333);
+    QCOMPARE(expected.get1(), 3);
+
+    Engine parallel(DiamondTask::JobModel::create("Diamond"), std::make_shared<TestContext>(true));
+    auto config = parallel.getConfiguration();
+    config->setParallel(true);
+    for (int run = 0; run < 100; ++run) {
+        parallel.run();
+        const auto& output = parallel.getOutput().get<DiamondTask::Output>();
+        QCOMPARE(output.get0(), expected.get0());
+        QCOMPARE(output.get1(), expected.get1());
+    }
+    QCOMPARE(numEarlyRuns.load(), 0);
+
+    // each job still reports its own run time
+    QVERIFY(config->getJobConfig("Split")->getCPURunTime() >= 1.0);
+}
+
+void JobGraphTests::testAbort() {
+    auto context = std::make_shared<TestContext>(true);
+    Engine engine(AbortTask::JobModel::create("Abort"), context);
+    engine.getConfiguration()->setParallel(true);
+
+    for (int run = 0; run < 10; ++run) {
+        engine.run();
+        const auto& output = engine.getOutput().get<AbortTask::Output>();
+        QCOMPARE(output.get0(), 0);
+        QCOMPARE(output.get1(), 1);
+        QVERIFY(!context->taskFlow.doAbortTask());
+    }
+}
+
+void JobGraphTests::testSequentialFallback() {
+    numEarlyRuns = 0;
+
+    // a context that can't be cloned runs the jobs in order even when asked to run them in parallel
+    Engine engine(DiamondTask::JobModel::create("Diamond"), std::make_shared<TestContext>(false));
+    engine.getConfiguration()->setParallel(true);
+    engine.run();
+
+    const auto& output = engine.getOutput().get<DiamondTask::Output>();
+    QCOMPARE(output.get0(), 333);
+    QCOMPARE(output.get1(), 3);
+    QCOMPARE(numEarlyRuns.load(), 0);
+}
@@ -0,0 +1,26 @@
+//
+//  JobGraphTests.h
+//  tests/task/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_JobGraphTests_h
+#define hifi_JobGraphTests_h
+
+#include <QtTest/QtTest>
+
+class JobGraphTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testDependencies();
+    void testParallelRun();
+    void testAbort();
+    void testSequentialFallback();
+};
+
+#endif // hifi_JobGraphTests_h
@@ -13,6 +13,8 @@
 
 #include <iostream>
 
+#include <glm/gtx/norm.hpp>
+
 #include <workload/Space.h>
 #include <StreamUtils.h>
 #include <SharedUtil.h>
@@ -22,94 +24,111 @@ const float INV_SQRT_3 = 1.0f / sqrtf(3.0f);
 
 QTEST_MAIN(SpaceTests)
 
+using Changes = std::vector<workload::Space::Change>;
+
+static workload::View makeView(const glm::vec3& center, float near, float mid, float far) {
+    workload::View view;
+    view.origin = center;
+    view.regions[workload::Region::R1] = workload::Sphere(center, near);
+    view.regions[workload::Region::R2] = workload::Sphere(center, mid);
+    view.regions[workload::Region::R3] = workload::Sphere(center, far);
+    return view;
+}
+
+static void processTransaction(workload::Space& space, const workload::Transaction& transaction) {
+    space.enqueueTransaction(transaction);
+    space.enqueueFrame();
+    space.processTransactionQueue();
+}
+
 void SpaceTests::testOverlaps() {
     workload::Space space;
-    using Changes = std::vector<workload::Space::Change>;
-    using Views = std::vector<workload::Space::View>;
 
     glm::vec3 viewCenter(0.0f, 0.0f, 0.0f);
     float near = 1.0f;
     float mid = 2.0f;
     float far = 3.0f;
 
-    Views views;
-    views.push_back(workload::Space::View(viewCenter, near, mid, far));
+    workload::Views views;
+    views.push_back(makeView(viewCenter, near, mid, far));
     space.setViews(views);
 
     int32_t proxyId = 0;
     const float DELTA = 0.001f;
     float proxyRadius = 0.5f;
     glm::vec3 proxyPosition = viewCenter + glm::vec3(0.0f, 0.0f, far + proxyRadius + DELTA);
-    workload::Space::Sphere proxySphere(proxyPosition, proxyRadius);
+    workload::Sphere proxySphere(proxyPosition, proxyRadius);
 
     { // create very_far proxy
-        proxyId = space.createProxy(proxySphere);
+        proxyId = space.allocateID();
+        workload::Transaction transaction;
+        transaction.reset(proxyId, proxySphere, workload::Owner());
+        processTransaction(space, transaction);
         QVERIFY(space.getNumObjects() == 1);
 
         Changes changes;
         space.categorizeAndGetChanges(changes);
-        QVERIFY(changes.size() == 0);
+        QVERIFY(changes.size() == 1);
+        QVERIFY(changes[0].proxyId == proxyId);
+        QVERIFY(changes[0].region == workload::Region::R4);
+        QVERIFY(changes[0].prevRegion == workload::Region::UNKNOWN);
     }
 
     { // move proxy far
         float newRadius = 1.0f;
         glm::vec3 newPosition = viewCenter + glm::vec3(0.0f, 0.0f, far + newRadius - DELTA);
-        workload::Space::Sphere newSphere(newPosition, newRadius);
-        std::vector<workload::Space::ProxyUpdate> updates;
-        updates.push_back(workload::Space::ProxyUpdate(proxyId, newSphere));
-        space.updateProxies(updates);
+        workload::Transaction transaction;
+        transaction.update(proxyId, workload::Sphere(newPosition, newRadius));
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 1);
         QVERIFY(changes[0].proxyId == proxyId);
-        QVERIFY(changes[0].region == workload::Space::REGION_FAR);
-        QVERIFY(changes[0].prevRegion == workload::Space::REGION_UNKNOWN);
+        QVERIFY(changes[0].region == workload::Region::R3);
+        QVERIFY(changes[0].prevRegion == workload::Region::R4);
     }
 
     { // move proxy mid
         float newRadius = 1.0f;
         glm::vec3 newPosition = viewCenter + glm::vec3(0.0f, 0.0f, mid + newRadius - DELTA);
-        workload::Space::Sphere newSphere(newPosition, newRadius);
-        std::vector<workload::Space::ProxyUpdate> updates;
-        updates.push_back(workload::Space::ProxyUpdate(proxyId, newSphere));
-        space.updateProxies(updates);
+        workload::Transaction transaction;
+        transaction.update(proxyId, workload::Sphere(newPosition, newRadius));
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 1);
         QVERIFY(changes[0].proxyId == proxyId);
-        QVERIFY(changes[0].region == workload::Space::REGION_MIDDLE);
-        QVERIFY(changes[0].prevRegion == workload::Space::REGION_FAR);
+        QVERIFY(changes[0].region == workload::Region::R2);
+        QVERIFY(changes[0].prevRegion == workload::Region::R3);
     }
 
     { // move proxy near
         float newRadius = 1.0f;
         glm::vec3 newPosition = viewCenter + glm::vec3(0.0f, 0.0f, near + newRadius - DELTA);
-        workload::Space::Sphere newSphere(newPosition, newRadius);
-        std::vector<workload::Space::ProxyUpdate> updates;
-        updates.push_back(workload::Space::ProxyUpdate(proxyId, newSphere));
-        space.updateProxies(updates);
+        workload::Transaction transaction;
+        transaction.update(proxyId, workload::Sphere(newPosition, newRadius));
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 1);
         QVERIFY(changes[0].proxyId == proxyId);
-        QVERIFY(changes[0].region == workload::Space::REGION_NEAR);
-        QVERIFY(changes[0].prevRegion == workload::Space::REGION_MIDDLE);
+        QVERIFY(changes[0].region == workload::Region::R1);
+        QVERIFY(changes[0].prevRegion == workload::Region::R2);
     }
 
     { // delete proxy
         // NOTE: atm deleting a proxy doesn't result in a "Change"
-        std::vector<int32_t> deadProxies;
-        deadProxies.push_back(proxyId);
-        space.deleteProxies(deadProxies);
+        workload::Transaction transaction;
+        transaction.remove(proxyId);
+        processTransaction(space, transaction);
         Changes changes;
         space.categorizeAndGetChanges(changes);
         QVERIFY(changes.size() == 0);
         QVERIFY(space.getNumObjects() == 0);
+        QVERIFY(space.getRegion(proxyId) == workload::Region::INVALID);
     }
 }
 
-#ifdef MANUAL_TEST
-
 const float WORLD_WIDTH = 1000.0f;
 const float MIN_RADIUS = 1.0f;
 const float MAX_RADIUS = 100.0f;
@@ -123,35 +142,117 @@ glm::vec3 randomVec3() {
     return v;
 }
 
-void generateSpheres(uint32_t numProxies, std::vector<workload::Space::Sphere>& spheres) {
+void generateSpheres(uint32_t numProxies, std::vector<workload::Sphere>& spheres) {
     spheres.reserve(numProxies);
     for (uint32_t i = 0; i < numProxies; ++i) {
-        workload::Space::Sphere sphere(
+        workload::Sphere sphere(
                 WORLD_WIDTH * randomFloat(),
                 WORLD_WIDTH * randomFloat(),
                 WORLD_WIDTH * randomFloat(),
-                (MIN_RADIUS + (MAX_RADIUS - MIN_RADIUS)) * randomFloat());
+                MIN_RADIUS + (MAX_RADIUS - MIN_RADIUS) * 0.5f * (randomFloat() + 1.0f));
         spheres.push_back(sphere);
     }
 }
 
-void generatePositions(uint32_t numProxies, std::vector<glm::vec3>& positions) {
-    positions.reserve(numProxies);
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        positions.push_back(WORLD_WIDTH * randomVec3());
+static workload::Views makeViews(const glm::vec3& offset) {
+    workload::Views views;
+    float radius0 = 0.25f * WORLD_WIDTH;
+    float radius1 = 0.50f * WORLD_WIDTH;
+    float radius2 = 0.75f * WORLD_WIDTH;
+    views.push_back(makeView(offset, radius0, radius1, radius2));
+    views.push_back(makeView(offset + glm::vec3(0.0f, 0.0f, 0.1f * WORLD_WIDTH), radius0, radius1, radius2));
+    return views;
+}
+
+// the straightforward per proxy, per view loop categorizeAndGetChanges() used to run
+static uint8_t referenceRegion(const workload::Sphere& proxy, const workload::Views& views) {
+    uint8_t region = workload::Region::R4;
+    for (const auto& view : views) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = proxy.w + view.regions[k].w;
+            if (glm::distance2(glm::vec3(proxy), glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
     }
+    return region;
 }
 
-void generateRadiuses(uint32_t numRadiuses, std::vector<float>& radiuses) {
-    radiuses.reserve(numRadiuses);
-    for (uint32_t i = 0; i < numRadiuses; ++i) {
-        radiuses.push_back(MIN_RADIUS + (MAX_RADIUS - MIN_RADIUS) * randomFloat());
+void SpaceTests::testCategorizeManyProxies() {
+    // enough proxies to be split into several chunks, and a count that isn't a multiple of four
+    const uint32_t NUM_PROXIES = 50001;
+    srand(42);
+
+    workload::Space space;
+    workload::Views views = makeViews(glm::vec3(0.0f));
+    space.setViews(views);
+
+    std::vector<workload::Sphere> spheres;
+    generateSpheres(NUM_PROXIES, spheres);
+    std::vector<int32_t> proxyIds;
+    workload::Transaction transaction;
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        proxyIds.push_back(space.allocateID());
+        transaction.reset(proxyIds.back(), spheres[i], workload::Owner());
+    }
+    // removed proxies must not be categorized
+    const uint32_t REMOVED_STEP = 7;
+    for (uint32_t i = 0; i < NUM_PROXIES; i += REMOVED_STEP) {
+        transaction.remove(proxyIds[i]);
+    }
+    processTransaction(space, transaction);
+
+    Changes changes;
+    space.categorizeAndGetChanges(changes);
+
+    Changes expected;
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        if (i % REMOVED_STEP != 0) {
+            expected.emplace_back(proxyIds[i], referenceRegion(spheres[i], views), workload::Region::UNKNOWN);
+        }
+    }
+    QCOMPARE(changes.size(), expected.size());
+    for (size_t i = 0; i < changes.size(); ++i) {
+        QCOMPARE(changes[i].proxyId, expected[i].proxyId);
+        QCOMPARE(changes[i].region, expected[i].region);
+        QCOMPARE(changes[i].prevRegion, expected[i].prevRegion);
+        QCOMPARE(space.getRegion(changes[i].proxyId), changes[i].region);
+    }
+
+    // nothing moved, nothing changes
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    QCOMPARE(changes.size(), (size_t)0);
+
+    // moving the views changes exactly the proxies whose reference region changed
+    workload::Views movedViews = makeViews(glm::vec3(0.2f * WORLD_WIDTH, 0.0f, 0.0f));
+    space.setViews(movedViews);
+    changes.clear();
+    space.categorizeAndGetChanges(changes);
+    expected.clear();
+    for (uint32_t i = 0; i < NUM_PROXIES; ++i) {
+        if (i % REMOVED_STEP != 0) {
+            uint8_t before = referenceRegion(spheres[i], views);
+            uint8_t after = referenceRegion(spheres[i], movedViews);
+            if (before != after) {
+                expected.emplace_back(proxyIds[i], after, before);
+            }
+        }
+    }
+    QCOMPARE(changes.size(), expected.size());
+    for (size_t i = 0; i < changes.size(); ++i) {
+        QCOMPARE(changes[i].proxyId, expected[i].proxyId);
+        QCOMPARE(changes[i].region, expected[i].region);
+        QCOMPARE(changes[i].prevRegion, expected[i].prevRegion);
     }
 }
 
+#ifdef MANUAL_TEST
+
 void SpaceTests::benchmark() {
-    uint32_t numProxies[] = { 100, 1000, 10000, 100000 };
-    uint32_t numTests = 4;
+    uint32_t numProxies[] = { 100, 1000, 10000, 100000, 1000000 };
+    uint32_t numTests = 5;
     std::vector<uint64_t> timeToAddAll;
     std::vector<uint64_t> timeToMoveView;
     std::vector<uint64_t> timeToMoveProxies;
@@ -159,52 +260,33 @@ void SpaceTests::benchmark() {
     for (uint32_t i = 0; i < numTests; ++i) {
 
         workload::Space space;
-
-        { // build the views
-            std::vector<glm::vec3> viewPositions;
-            viewPositions.push_back(glm::vec3(0.0f, 0.0f, 0.0f));
-            viewPositions.push_back(glm::vec3(0.0f, 0.0f, 0.1f * WORLD_WIDTH));
-            float radius0 = 0.25f * WORLD_WIDTH;
-            float radius1 = 0.50f * WORLD_WIDTH;
-            float radius2 = 0.75f * WORLD_WIDTH;
-            std::vector<workload::Space::View> views;
-            views.push_back(workload::Space::View(viewPositions[0], radius0, radius1, radius2));
-            views.push_back(workload::Space::View(viewPositions[1], radius0, radius1, radius2));
-            space.setViews(views);
-        }
+        space.setViews(makeViews(glm::vec3(0.0f)));
 
         // build the proxies
         uint32_t n = numProxies[i];
-        std::vector<workload::Space::Sphere> proxySpheres;
+        std::vector<workload::Sphere> proxySpheres;
         generateSpheres(n, proxySpheres);
         std::vector<int32_t> proxyKeys;
         proxyKeys.reserve(n);
 
         // measure time to put proxies in the space
         uint64_t startTime = usecTimestampNow();
-        for (uint32_t j = 0; j < n; ++j) {
-            int32_t key = space.createProxy(proxySpheres[j]);
-            proxyKeys.push_back(key);
+        {
+            workload::Transaction transaction;
+            for (uint32_t j = 0; j < n; ++j) {
+                int32_t key = space.allocateID();
+                transaction.reset(key, proxySpheres[j], workload::Owner());
+                proxyKeys.push_back(key);
+            }
+            processTransaction(space, transaction);
         }
         uint64_t usec = usecTimestampNow() - startTime;
         timeToAddAll.push_back(usec);
 
-        {
-            // build the views
-            std::vector<glm::vec3> viewPositions;
-            viewPositions.push_back(glm::vec3(1.0f, 2.0f, 3.0f));
-            viewPositions.push_back(glm::vec3(1.0f, 2.0f, 3.0f + 0.1f * WORLD_WIDTH));
-            float radius0 = 0.25f * WORLD_WIDTH;
-            float radius1 = 0.50f * WORLD_WIDTH;
-            float radius2 = 0.75f * WORLD_WIDTH;
-            std::vector<workload::Space::View> views;
-            views.push_back(workload::Space::View(viewPositions[0], radius0, radius1, radius2));
-            views.push_back(workload::Space::View(viewPositions[1], radius0, radius1, radius2));
-            space.setViews(views);
-        }
+        space.setViews(makeViews(glm::vec3(1.0f, 2.0f, 3.0f)));
 
         // measure time to categorizeAndGetChanges everything
-        std::vector<workload::Space::Change> changes;
+        Changes changes;
         startTime = usecTimestampNow();
         space.categorizeAndGetChanges(changes);
         usec = usecTimestampNow() - startTime;
@@ -212,27 +294,17 @@ void SpaceTests::benchmark() {
 
         // move every 10th proxy around
         const float proxySpeed = 1.0f;
-        std::vector<workload::Space::Sphere> newSpheres;
-        uint32_t numMovingProxies = n / 10;
-        uint32_t jstep = n / numMovingProxies;
-        uint32_t maxJ = numMovingProxies * jstep - 1;
-        glm::vec3 direction;
-        for (uint32_t j = 0; j < maxJ - jstep; j += jstep) {
-            glm::vec3 position = (glm::vec3)proxySpheres[j];
-            glm::vec3 destination = (glm::vec3)proxySpheres[j + jstep];
-            direction = glm::normalize(destination - position);
-            glm::vec3 newPosition = position + proxySpeed * direction;
-            newSpheres.push_back(workload::Space::Sphere(newPosition, proxySpheres[j].w));
-        }
-        glm::vec3 position = (glm::vec3)proxySpheres[maxJ = jstep];
-        glm::vec3 destination = (glm::vec3)proxySpheres[0];
-        direction = glm::normalize(destination - position);
-        direction = position + proxySpeed * direction;
-        newSpheres.push_back(workload::Space::Sphere(direction, proxySpheres[0].w));
-        uint32_t k = 0;
+        uint32_t jstep = 10;
         startTime = usecTimestampNow();
-        for (uint32_t j = 0; j < maxJ; j += jstep) {
-            space.updateProxy(proxyKeys[j], newSpheres[k++]);
+        {
+            workload::Transaction transaction;
+            for (uint32_t j = 0; j + jstep < n; j += jstep) {
+                glm::vec3 position = (glm::vec3)proxySpheres[j];
+                glm::vec3 destination = (glm::vec3)proxySpheres[j + jstep];
+                glm::vec3 newPosition = position + proxySpeed * glm::normalize(destination - position);
+                transaction.update(proxyKeys[j], workload::Sphere(newPosition, proxySpheres[j].w));
+            }
+            processTransaction(space, transaction);
         }
         changes.clear();
         space.categorizeAndGetChanges(changes);
@@ -241,8 +313,10 @@ void SpaceTests::benchmark() {
 
         // measure time to remove proxies from space
         startTime = usecTimestampNow();
-        for (uint32_t j = 0; j < n; ++j) {
-            space.deleteProxy(proxyKeys[j]);
+        {
+            workload::Transaction transaction;
+            transaction.remove(proxyKeys);
+            processTransaction(space, transaction);
         }
         usec = usecTimestampNow() - startTime;
         timeToRemoveAll.push_back(usec);
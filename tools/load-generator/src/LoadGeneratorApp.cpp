@@ -0,0 +1,414 @@
+//
+//  LoadGeneratorApp.cpp
+//  tools/load-generator/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LoadGeneratorApp.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QLoggingCategory>
+
+#include <AudioConstants.h>
+#include <AvatarHashMap.h>
+#include <DependencyManager.h>
+#include <DomainHandler.h>
+#include <NetworkLogging.h>
+#include <NodeList.h>
+#include <plugins/PluginManager.h>
+#include <recording/Clip.h>
+#include <SharedLogging.h>
+
+static const int DEFAULT_NUM_NODES = 10;
+static const int DEFAULT_DURATION_SECS = 60;
+static const int DEFAULT_REPORT_INTERVAL_SECS = 5;
+static const int DEFAULT_RAMP_MSECS = 50;
+static const float DEFAULT_SPREAD = 20.0f;
+
+// don't try to catch up on more audio frames than this after a stall, the mixer would drop them anyway
+static const quint64 MAX_AUDIO_FRAMES_PER_TICK = 5;
+
+static QJsonObject percentilesToJson(std::vector<quint32> samples) {
+    QJsonObject json;
+    json["count"] = (int)samples.size();
+    if (samples.empty()) {
+        return json;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](float fraction) {
+        size_t index = (size_t)std::ceil(fraction * samples.size());
+        return (double)samples[std::max(index, (size_t)1) - 1];
+    };
+    json["p50"] = percentile(0.50f);
+    json["p95"] = percentile(0.95f);
+    json["p99"] = percentile(0.99f);
+    json["max"] = (double)samples.back();
+    return json;
+}
+
+static QJsonObject jitterToJson(const std::vector<float>& samples) {
+    QJsonObject json;
+    json["count"] = (int)samples.size();
+    if (samples.empty()) {
+        return json;
+    }
+
+    double sum = 0.0;
+    for (auto sample : samples) {
+        sum += sample;
+    }
+    json["mean"] = sum / samples.size();
+    json["max"] = (double)*std::max_element(samples.begin(), samples.end());
+    return json;
+}
+
+static QJsonObject streamToJson(const LoadStats::Stream& stream, float seconds) {
+    QJsonObject json;
+    json["packets"] = (double)stream.packets;
+    json["bytes"] = (double)stream.bytes;
+    if (seconds > 0.0f) {
+        json["packets_per_second"] = stream.packets / seconds;
+        json["kbps"] = stream.bytes * 8 / 1000.0 / seconds;
+    }
+    return json;
+}
+
+LoadGeneratorApp::LoadGeneratorApp(int argc, char* argv[]) :
+    QCoreApplication(argc, argv)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs many simulated clients against a domain, sending avatar data and "
+                                     "microphone audio, and reports mixer round trip times and jitter.");
+
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption verboseOutput("v", "verbose output");
+    parser.addOption(verboseOutput);
+
+    const QCommandLineOption domainAddressOption("d", "domain-server address",
+                                                 "address", "127.0.0.1:" + QString::number(DEFAULT_DOMAIN_SERVER_PORT));
+    parser.addOption(domainAddressOption);
+
+    const QCommandLineOption numNodesOption("n", "number of virtual nodes", "count", QString::number(DEFAULT_NUM_NODES));
+    parser.addOption(numNodesOption);
+
+    const QCommandLineOption clipOption("clip", "recording to play back as every node's avatar, instead of walking "
+                                        "in circles", "file");
+    parser.addOption(clipOption);
+
+    const QCommandLineOption codecOption("codec", "offer only this audio codec to the audio mixer, \"pcm\" for none",
+                                         "name");
+    parser.addOption(codecOption);
+
+    const QCommandLineOption noAudioOption("no-audio", "don't connect to the audio mixer");
+    parser.addOption(noAudioOption);
+
+    const QCommandLineOption noAvatarsOption("no-avatars", "don't connect to the avatar mixer");
+    parser.addOption(noAvatarsOption);
+
+    const QCommandLineOption durationOption("duration", "seconds to run for, 0 to run until killed", "seconds",
+                                            QString::number(DEFAULT_DURATION_SECS));
+    parser.addOption(durationOption);
+
+    const QCommandLineOption reportOption("report", "seconds between reports", "seconds",
+                                          QString::number(DEFAULT_REPORT_INTERVAL_SECS));
+    parser.addOption(reportOption);
+
+    const QCommandLineOption spreadOption("spread", "width in meters of the square the nodes are spread over", "meters",
+                                          QString::number(DEFAULT_SPREAD));
+    parser.addOption(spreadOption);
+
+    const QCommandLineOption rampOption("ramp", "milliseconds between starting each node", "msecs",
+                                        QString::number(DEFAULT_RAMP_MSECS));
+    parser.addOption(rampOption);
+
+    const QCommandLineOption outputOption("output", "write the final summary to this JSON file", "file");
+    parser.addOption(outputOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << Qt::endl;
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        Q_UNREACHABLE();
+    }
+
+    if (!parser.isSet(verboseOutput)) {
+        QLoggingCategory::setFilterRules("qt.network.ssl.warning=false");
+
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtDebugMsg, false);
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtInfoMsg, false);
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtWarningMsg, false);
+
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtDebugMsg, false);
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtInfoMsg, false);
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtWarningMsg, false);
+    }
+
+    QString domainServerAddress = parser.value(domainAddressOption);
+    QString hostname = domainServerAddress.section(':', 0, 0);
+    quint16 port = DEFAULT_DOMAIN_SERVER_PORT;
+    if (domainServerAddress.contains(':')) {
+        port = domainServerAddress.section(':', 1, 1).toUShort();
+    }
+    _nodeSettings.domainServer = SockAddr(hostname, port, true);
+    if (_nodeSettings.domainServer.getAddress().isNull()) {
+        qCritical() << "Could not resolve domain-server address" << domainServerAddress;
+        ::exit(EXIT_FAILURE);
+    }
+
+    _numNodes = std::max(parser.value(numNodesOption).toInt(), 1);
+    _spread = std::max(parser.value(spreadOption).toFloat(), 0.0f);
+    _nodeSettings.sendAudio = !parser.isSet(noAudioOption);
+    _nodeSettings.sendAvatarData = !parser.isSet(noAvatarsOption);
+    _outputPath = parser.value(outputOption);
+
+    if (parser.isSet(clipOption)) {
+        _nodeSettings.clip = recording::Clip::fromFile(parser.value(clipOption));
+        if (!_nodeSettings.clip) {
+            qCritical() << "Could not load recording" << parser.value(clipOption);
+            ::exit(EXIT_FAILURE);
+        }
+    }
+
+    if (_nodeSettings.sendAudio) {
+        DependencyManager::set<PluginManager>()->instantiate();
+        auto codecs = PluginManager::getInstance()->getCodecPlugins();
+
+        if (parser.isSet(codecOption)) {
+            QString codecName = parser.value(codecOption);
+            auto it = std::find_if(codecs.begin(), codecs.end(), [&](const CodecPluginPointer& codec) {
+                return codec->getName() == codecName;
+            });
+            if (it != codecs.end()) {
+                _nodeSettings.codecs = { *it };
+            } else if (codecName != "pcm") {
+                qCritical() << "Unknown audio codec" << codecName;
+                ::exit(EXIT_FAILURE);
+            }
+        } else {
+            _nodeSettings.codecs = codecs;
+        }
+    }
+
+    qDebug() << "Starting" << _numNodes << "virtual nodes against" << _nodeSettings.domainServer;
+
+    connect(&_rampTimer, &QTimer::timeout, this, &LoadGeneratorApp::startNextNode);
+    _rampTimer.start(std::max(parser.value(rampOption).toInt(), 0));
+
+    _audioTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_audioTimer, &QTimer::timeout, this, &LoadGeneratorApp::sendAudioFrames);
+    if (_nodeSettings.sendAudio) {
+        _audioClock.start();
+        _audioTimer.start((int)(AudioConstants::NETWORK_FRAME_USECS / USECS_PER_MSEC));
+    }
+
+    _avatarTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_avatarTimer, &QTimer::timeout, this, &LoadGeneratorApp::sendAvatarUpdates);
+    if (_nodeSettings.sendAvatarData) {
+        _avatarClock.start();
+        _avatarTimer.start((int)(MSECS_PER_SECOND / CLIENT_TO_AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND));
+    }
+
+    connect(&_heartbeatTimer, &QTimer::timeout, this, &LoadGeneratorApp::sendHeartbeats);
+    _heartbeatTimer.start((int)DOMAIN_SERVER_CHECK_IN_MSECS);
+
+    connect(&_reportTimer, &QTimer::timeout, this, &LoadGeneratorApp::report);
+    _reportTimer.start(std::max(parser.value(reportOption).toInt(), 1) * (int)MSECS_PER_SECOND);
+
+    int duration = parser.value(durationOption).toInt();
+    if (duration > 0) {
+        QTimer::singleShot(duration * (int)MSECS_PER_SECOND, this, &LoadGeneratorApp::finish);
+    }
+
+    _runTime.start();
+    _reportClock.start();
+}
+
+LoadGeneratorApp::~LoadGeneratorApp() {
+    _nodes.clear();
+    if (_nodeSettings.sendAudio) {
+        _nodeSettings.codecs.clear();
+        DependencyManager::destroy<PluginManager>();
+    }
+}
+
+void LoadGeneratorApp::startNextNode() {
+    int index = (int)_nodes.size();
+    if (index >= _numNodes) {
+        _rampTimer.stop();
+        return;
+    }
+
+    // spread the nodes over a grid, so both mixers have to work out who can see and hear whom
+    int gridSize = (int)std::ceil(std::sqrt((float)_numNodes));
+    float spacing = gridSize > 1 ? _spread / (gridSize - 1) : 0.0f;
+
+    auto settings = _nodeSettings;
+    settings.position = glm::vec3((index % gridSize) * spacing - _spread / 2.0f, 0.0f,
+                                  (index / gridSize) * spacing - _spread / 2.0f);
+    settings.toneFrequency = 200.0f + (index % 20) * 20.0f;
+    if (_nodeSettings.clip) {
+        settings.clip = _nodeSettings.clip->duplicate();
+    }
+
+    _nodes.emplace_back(new VirtualNode(index, settings));
+    _nodes.back()->start();
+}
+
+void LoadGeneratorApp::sendAudioFrames() {
+    // send as many frames as are due, so a late timer doesn't slow the streams down
+    quint64 framesDue = (quint64)_audioClock.nsecsElapsed() / NSECS_PER_USEC / AudioConstants::NETWORK_FRAME_USECS;
+    quint64 numFrames = std::min(framesDue - _audioFramesSent, MAX_AUDIO_FRAMES_PER_TICK);
+    _audioFramesSent = framesDue;
+
+    for (quint64 i = 0; i < numFrames; ++i) {
+        for (auto& node : _nodes) {
+            node->sendAudioFrame();
+        }
+    }
+}
+
+void LoadGeneratorApp::sendAvatarUpdates() {
+    float deltaTime = (float)_avatarClock.nsecsElapsed() / NSECS_PER_SECOND;
+    _avatarClock.restart();
+
+    for (auto& node : _nodes) {
+        node->sendAvatarUpdate(deltaTime);
+    }
+}
+
+void LoadGeneratorApp::sendHeartbeats() {
+    for (auto& node : _nodes) {
+        node->sendHeartbeat();
+    }
+}
+
+LoadGeneratorApp::Report LoadGeneratorApp::collectReport() {
+    Report report;
+    for (auto& node : _nodes) {
+        auto stats = node->takeStats();
+        if (node->isConnected()) {
+            ++report.numConnected;
+        }
+        if (stats.receivedAudio.packets > 0) {
+            report.audioJitterUsecs.push_back(stats.audioJitterUsecs);
+        }
+        if (stats.receivedAvatars.packets > 0) {
+            report.avatarJitterUsecs.push_back(stats.avatarJitterUsecs);
+        }
+        report.stats.merge(stats);
+    }
+    _totals.merge(report.stats);
+    return report;
+}
+
+QJsonObject LoadGeneratorApp::reportToJson(const Report& report, float seconds) const {
+    QJsonObject json;
+    json["nodes"] = (int)_nodes.size();
+    json["connected"] = report.numConnected;
+    json["sent"] = streamToJson(report.stats.sent, seconds);
+    json["received_audio"] = streamToJson(report.stats.receivedAudio, seconds);
+    json["received_avatars"] = streamToJson(report.stats.receivedAvatars, seconds);
+    json["received_other"] = streamToJson(report.stats.receivedOther, seconds);
+    json["audio_sequence_gaps"] = (double)report.stats.audioSequenceGaps;
+    json["audio_mixer_rtt_usecs"] = percentilesToJson(report.stats.audioMixerRoundTripUsecs);
+    json["avatar_mixer_rtt_usecs"] = percentilesToJson(report.stats.avatarMixerRoundTripUsecs);
+    json["audio_jitter_usecs"] = jitterToJson(report.audioJitterUsecs);
+    json["avatar_jitter_usecs"] = jitterToJson(report.avatarJitterUsecs);
+    return json;
+}
+
+QJsonObject LoadGeneratorApp::summaryToJson() const {
+    float seconds = (float)_runTime.elapsed() / MSECS_PER_SECOND;
+
+    // the totals cover the whole run, the jitter estimates are the ones at the end of it
+    Report totals = _lastReport;
+    totals.stats = _totals;
+
+    QJsonObject json = reportToJson(totals, seconds);
+    json["seconds"] = seconds;
+    json["domain"] = _nodeSettings.domainServer.toString();
+    json["clip"] = _nodeSettings.clip ? _nodeSettings.clip->getName() : QString();
+
+    QJsonArray codecs;
+    for (auto& codec : _nodeSettings.codecs) {
+        codecs.push_back(codec->getName());
+    }
+    json["codecs"] = codecs;
+    return json;
+}
+
+void LoadGeneratorApp::report() {
+    float seconds = (float)_reportClock.restart() / MSECS_PER_SECOND;
+    _lastReport = collectReport();
+
+    auto json = reportToJson(_lastReport, seconds);
+    auto audioRTT = json["audio_mixer_rtt_usecs"].toObject();
+    auto avatarRTT = json["avatar_mixer_rtt_usecs"].toObject();
+    auto audioJitter = json["audio_jitter_usecs"].toObject();
+    auto avatarJitter = json["avatar_jitter_usecs"].toObject();
+    auto rate = [&](const char* stream) {
+        return json[stream].toObject()["packets_per_second"].toDouble();
+    };
+
+    qDebug().noquote() << QString("%1/%2 connected | sent %3 pps | audio in %4 pps, %5 gaps, rtt p50/p99 %6/%7 us, "
+                                  "jitter mean/max %8/%9 us | avatars in %10 pps, rtt p50/p99 %11/%12 us, "
+                                  "jitter mean/max %13/%14 us")
+        .arg(_lastReport.numConnected).arg(_nodes.size())
+        .arg(rate("sent"), 0, 'f', 0)
+        .arg(rate("received_audio"), 0, 'f', 0)
+        .arg(_lastReport.stats.audioSequenceGaps)
+        .arg(audioRTT["p50"].toDouble()).arg(audioRTT["p99"].toDouble())
+        .arg(audioJitter["mean"].toDouble(), 0, 'f', 0).arg(audioJitter["max"].toDouble(), 0, 'f', 0)
+        .arg(rate("received_avatars"), 0, 'f', 0)
+        .arg(avatarRTT["p50"].toDouble()).arg(avatarRTT["p99"].toDouble())
+        .arg(avatarJitter["mean"].toDouble(), 0, 'f', 0).arg(avatarJitter["max"].toDouble(), 0, 'f', 0);
+}
+
+void LoadGeneratorApp::finish() {
+    if (_isFinished) {
+        return;
+    }
+    _isFinished = true;
+
+    _rampTimer.stop();
+    _audioTimer.stop();
+    _avatarTimer.stop();
+    _heartbeatTimer.stop();
+    _reportTimer.stop();
+
+    report();
+    for (auto& node : _nodes) {
+        node->stop();
+    }
+
+    QByteArray summary = QJsonDocument(summaryToJson()).toJson(QJsonDocument::Indented);
+    if (_outputPath.isEmpty()) {
+        printf("%s", summary.constData());
+    } else {
+        QFile outputFile(_outputPath);
+        if (outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            outputFile.write(summary);
+        } else {
+            qCritical() << "Could not write summary to" << _outputPath;
+        }
+    }
+
+    QTimer::singleShot(0, this, &QCoreApplication::quit);
+}
@@ -0,0 +1,76 @@
+//
+//  LoadGeneratorApp.h
+//  tools/load-generator/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_LoadGeneratorApp_h
+#define hifi_LoadGeneratorApp_h
+
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTimer>
+
+#include "VirtualNode.h"
+
+/// Runs many VirtualNodes against one domain from a single thread, feeding them avatar and audio frames at the
+/// rates Interface sends them, and reports what comes back from the mixers.
+class LoadGeneratorApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    LoadGeneratorApp(int argc, char* argv[]);
+    ~LoadGeneratorApp();
+
+private slots:
+    void startNextNode();
+    void sendAudioFrames();
+    void sendAvatarUpdates();
+    void sendHeartbeats();
+    void report();
+    void finish();
+
+private:
+    struct Report {
+        LoadStats stats;
+        std::vector<float> audioJitterUsecs;
+        std::vector<float> avatarJitterUsecs;
+        int numConnected { 0 };
+    };
+
+    Report collectReport();
+    QJsonObject reportToJson(const Report& report, float seconds) const;
+    QJsonObject summaryToJson() const;
+
+    int _numNodes { 0 };
+    float _spread { 0.0f };
+    VirtualNode::Settings _nodeSettings;
+    QString _outputPath;
+
+    std::vector<std::unique_ptr<VirtualNode>> _nodes;
+
+    QTimer _rampTimer;
+    QTimer _audioTimer;
+    QTimer _avatarTimer;
+    QTimer _heartbeatTimer;
+    QTimer _reportTimer;
+
+    QElapsedTimer _runTime;
+    QElapsedTimer _audioClock;
+    quint64 _audioFramesSent { 0 };
+    QElapsedTimer _avatarClock;
+    QElapsedTimer _reportClock;
+
+    LoadStats _totals;
+    Report _lastReport;
+    bool _isFinished { false };
+};
+
+#endif // hifi_LoadGeneratorApp_h
@@ -0,0 +1,717 @@
+//
+//  VirtualNode.cpp
+//  tools/load-generator/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "VirtualNode.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QDebug>
+
+#include <AudioConstants.h>
+#include <ConicalViewFrustum.h>
+#include <GLMHelpers.h>
+#include <LimitedNodeList.h>
+#include <NodePermissions.h>
+#include <ReceivedMessage.h>
+#include <recording/Clip.h>
+#include <recording/Frame.h>
+#include <shared/NetworkUtils.h>
+#include <SharedUtil.h>
+#include <udt/PacketHeaders.h>
+#include <UUID.h>
+#include <ViewFrustum.h>
+
+using namespace std::chrono;
+
+static const float TALK_SPURT_SECS = 2.0f;
+static const float TALK_CYCLE_SECS = 3.0f;
+static const float TONE_AMPLITUDE = 0.25f;
+static const float WALK_RADIUS = 2.0f;
+static const float WALK_SPEED = 1.0f; // meters per second
+
+// packets that arrive closer together than this are treated as one burst, e.g. one mixer frame of BulkAvatarData
+static const quint64 MIN_ARRIVAL_INTERVAL_USECS = 1000;
+
+// sequence number jumps larger than this are a mixer restart rather than loss
+static const int MAX_SEQUENCE_GAP = 1000;
+
+void LoadStats::merge(const LoadStats& other) {
+    auto mergeStream = [](Stream& stream, const Stream& otherStream) {
+        stream.packets += otherStream.packets;
+        stream.bytes += otherStream.bytes;
+    };
+    mergeStream(sent, other.sent);
+    mergeStream(receivedAudio, other.receivedAudio);
+    mergeStream(receivedAvatars, other.receivedAvatars);
+    mergeStream(receivedOther, other.receivedOther);
+    audioSequenceGaps += other.audioSequenceGaps;
+
+    audioMixerRoundTripUsecs.insert(audioMixerRoundTripUsecs.end(),
+                                    other.audioMixerRoundTripUsecs.begin(), other.audioMixerRoundTripUsecs.end());
+    avatarMixerRoundTripUsecs.insert(avatarMixerRoundTripUsecs.end(),
+                                     other.avatarMixerRoundTripUsecs.begin(), other.avatarMixerRoundTripUsecs.end());
+
+    audioJitterUsecs = std::max(audioJitterUsecs, other.audioJitterUsecs);
+    avatarJitterUsecs = std::max(avatarJitterUsecs, other.avatarJitterUsecs);
+}
+
+void VirtualNode::ArrivalJitter::record(quint64 nowUsecs) {
+    if (lastArrivalUsecs == 0) {
+        lastArrivalUsecs = nowUsecs;
+        return;
+    }
+
+    quint64 interval = nowUsecs - lastArrivalUsecs;
+    if (expectedIntervalUsecs == 0 && interval < MIN_ARRIVAL_INTERVAL_USECS) {
+        return;
+    }
+    lastArrivalUsecs = nowUsecs;
+
+    float expected;
+    if (expectedIntervalUsecs > 0) {
+        expected = (float)expectedIntervalUsecs;
+    } else {
+        if (averageIntervalUsecs == 0.0f) {
+            averageIntervalUsecs = (float)interval;
+        }
+        expected = averageIntervalUsecs;
+        averageIntervalUsecs += ((float)interval - averageIntervalUsecs) / 16.0f;
+    }
+
+    // the smoothed interarrival jitter estimate from RFC 3550
+    float deviation = std::abs((float)interval - expected);
+    jitterUsecs += (deviation - jitterUsecs) / 16.0f;
+}
+
+VirtualNode::VirtualNode(int index, const Settings& settings, QObject* parent) :
+    QObject(parent),
+    _index(index),
+    _settings(settings),
+    _socket(this)
+{
+    _avatarFrameType = recording::Frame::registerFrameType(AvatarData::FRAME_NAME);
+    _audioArrival.expectedIntervalUsecs = AudioConstants::NETWORK_FRAME_USECS;
+
+    _avatar.setDisplayName(QString("load-generator %1").arg(index));
+    _avatar.setWorldPosition(_settings.position);
+    _walkAngle = (float)index;
+
+    _socket.setPacketHandler([this](std::unique_ptr<udt::Packet> packet) {
+        handlePacket(std::move(packet));
+    });
+    _socket.setMessageHandler([this](std::unique_ptr<udt::Packet> packet) {
+        handlePacket(std::move(packet));
+    });
+}
+
+VirtualNode::~VirtualNode() {
+    if (_codec && _encoder) {
+        _codec->releaseEncoder(_encoder);
+    }
+}
+
+void VirtualNode::start() {
+    _socket.bind(QHostAddress::AnyIPv4);
+    sendHeartbeat();
+}
+
+void VirtualNode::stop() {
+    if (isConnected()) {
+        auto disconnectPacket = NLPacket::create(PacketType::DomainDisconnectRequest, 0);
+        sendPacket(*disconnectPacket, _settings.domainServer);
+    }
+    _sessionLocalID = NLPacket::NULL_LOCAL_ID;
+    _mixers.clear();
+}
+
+void VirtualNode::sendHeartbeat() {
+    if (_wasDenied) {
+        return;
+    }
+
+    sendDomainCheckIn();
+
+    for (auto& mixer : _mixers) {
+        sendPings(mixer);
+        if (mixer.type == NodeType::AvatarMixer && !mixer.activeSocket.isNull()) {
+            sendAvatarQuery(mixer);
+        }
+    }
+}
+
+void VirtualNode::sendDomainCheckIn() {
+    bool isConnectRequest = !isConnected();
+    auto packetType = isConnectRequest ? PacketType::DomainConnectRequest : PacketType::DomainListRequest;
+    auto domainPacket = NLPacket::create(packetType);
+    QDataStream packetStream(domainPacket.get());
+
+    if (isConnectRequest) {
+        packetStream << QUuid();
+
+        QByteArray protocolVersionSig = protocolVersionsSignature();
+        packetStream.writeBytes(protocolVersionSig.constData(), protocolVersionSig.size());
+
+        // no hardware address, and a fingerprint of our own so the domain-server sees every node as a separate machine
+        packetStream << QString() << _machineFingerprint << QByteArray();
+        packetStream << (quint32)LimitedNodeList::Connect << (quint64)0;
+    }
+
+    packetStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
+
+    // a null public address makes the domain-server use the address it sees us at
+    bool isLoopback = _settings.domainServer.getAddress().isLoopback();
+    SockAddr publicSockAddr(QHostAddress(), _socket.localPort());
+    SockAddr localSockAddr(isLoopback ? QHostAddress(QHostAddress::LocalHost) : getGuessedLocalAddress(), _socket.localPort());
+
+    QList<NodeType_t> interestList;
+    if (_settings.sendAudio) {
+        interestList << NodeType::AudioMixer;
+    }
+    if (_settings.sendAvatarData) {
+        interestList << NodeType::AvatarMixer;
+    }
+
+    packetStream << NodeType::Agent << publicSockAddr << localSockAddr << interestList;
+    packetStream << QString(); // place name
+
+    if (!isConnectRequest) {
+        // the last DomainList we received in full, so the domain-server only sends what changed since
+        packetStream << _domainListVersion;
+    }
+
+    if (isConnectRequest) {
+        packetStream << QString() << QString(""); // anonymous, no username signature
+    }
+
+    sendPacket(*domainPacket, _settings.domainServer);
+}
+
+void VirtualNode::sendAvatarUpdate(float deltaTime) {
+    Mixer* avatarMixer = findMixer(NodeType::AvatarMixer);
+    if (!avatarMixer || avatarMixer->activeSocket.isNull()) {
+        return;
+    }
+
+    if (_settings.clip) {
+        playClip(deltaTime);
+    } else {
+        walkInCircle(deltaTime);
+    }
+
+    // like AvatarData::sendAvatarDataPacket, send everything now and then in case a change was lost
+    bool cullSmallData = randFloat() < AVATAR_SEND_FULL_UPDATE_RATIO;
+    auto dataDetail = cullSmallData ? AvatarData::SendAllData : AvatarData::CullSmallData;
+    QByteArray avatarByteArray = _avatar.toByteArrayStateful(dataDetail);
+
+    int maximumByteArraySize = NLPacket::maxPayloadSize(PacketType::AvatarData) - sizeof(AvatarDataSequenceNumber);
+    if (avatarByteArray.size() > maximumByteArraySize) {
+        avatarByteArray = _avatar.toByteArrayStateful(dataDetail, true);
+        if (avatarByteArray.size() > maximumByteArraySize) {
+            avatarByteArray = _avatar.toByteArrayStateful(AvatarData::MinimumData, true);
+        }
+    }
+    _avatar.doneEncoding(cullSmallData);
+
+    auto avatarPacket = NLPacket::create(PacketType::AvatarData, avatarByteArray.size() + sizeof(_avatarSequenceNumber));
+    avatarPacket->writePrimitive(_avatarSequenceNumber++);
+    avatarPacket->write(avatarByteArray);
+    sendPacket(*avatarPacket, avatarMixer->activeSocket, avatarMixer);
+}
+
+void VirtualNode::sendAudioFrame() {
+    Mixer* audioMixer = findMixer(NodeType::AudioMixer);
+    if (!audioMixer || audioMixer->activeSocket.isNull() || _selectedCodecName.isNull()) {
+        return;
+    }
+
+    // talk spurts are staggered between nodes, so the mixer always has a mix of talking and silent streams
+    auto frameTime = [this](quint64 frame) {
+        return (float)frame * AudioConstants::NETWORK_FRAME_SECS + (float)_index * (TALK_CYCLE_SECS / 7.0f);
+    };
+    quint64 frame = _audioFrameCount++;
+    bool isTalking = std::fmod(frameTime(frame), TALK_CYCLE_SECS) < TALK_SPURT_SECS;
+    bool wasTalking = frame > 0 && std::fmod(frameTime(frame - 1), TALK_CYCLE_SECS) < TALK_SPURT_SECS;
+
+    // the codec must be flushed with one frame of silence before switching to silent packets
+    auto packetType = isTalking || wasTalking ? PacketType::MicrophoneAudioNoEcho : PacketType::SilentAudioFrame;
+
+    auto audioPacket = NLPacket::create(packetType);
+    audioPacket->writePrimitive(_outgoingAudioSequenceNumber++);
+    audioPacket->writeString(_selectedCodecName);
+
+    if (packetType == PacketType::SilentAudioFrame) {
+        quint16 numSilentSamples = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+        audioPacket->writePrimitive(numSilentSamples);
+    } else {
+        quint8 channelFlag = 0;
+        audioPacket->writePrimitive(channelFlag);
+    }
+
+    audioPacket->writePrimitive(_avatar.getWorldPosition());
+    audioPacket->writePrimitive(_avatar.getWorldOrientation());
+    audioPacket->writePrimitive(_avatar.getWorldPosition());
+    audioPacket->writePrimitive(glm::vec3(0.0f));
+
+    if (packetType != PacketType::SilentAudioFrame) {
+        QByteArray samples(AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL, 0);
+        if (isTalking) {
+            auto data = reinterpret_cast<int16_t*>(samples.data());
+            quint64 firstSample = frame * AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+            float phaseStep = TWO_PI * _settings.toneFrequency / (float)AudioConstants::SAMPLE_RATE;
+            for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; ++i) {
+                float phase = std::fmod((float)((firstSample + i) % AudioConstants::SAMPLE_RATE) * phaseStep, TWO_PI);
+                data[i] = (int16_t)(TONE_AMPLITUDE * AudioConstants::MAX_SAMPLE_VALUE * std::sin(phase));
+            }
+        }
+
+        QByteArray encodedBuffer;
+        if (_encoder) {
+            _encoder->encode(samples, encodedBuffer);
+        } else {
+            encodedBuffer = samples;
+        }
+        audioPacket->write(encodedBuffer);
+    }
+
+    sendPacket(*audioPacket, audioMixer->activeSocket, audioMixer);
+}
+
+LoadStats VirtualNode::takeStats() {
+    _stats.audioJitterUsecs = _audioArrival.jitterUsecs;
+    _stats.avatarJitterUsecs = _avatarArrival.jitterUsecs;
+
+    LoadStats stats;
+    std::swap(stats, _stats);
+    return stats;
+}
+
+void VirtualNode::handlePacket(std::unique_ptr<udt::Packet> packet) {
+    auto nlPacket = NLPacket::fromBase(std::move(packet));
+    auto packetType = nlPacket->getType();
+    auto size = (quint64)nlPacket->getDataSize();
+
+    // messages are only counted, nothing the load generator measures is sent as more than one packet
+    if (nlPacket->isPartOfMessage() && nlPacket->getPacketPosition() != udt::Packet::ONLY) {
+        ++_stats.receivedOther.packets;
+        _stats.receivedOther.bytes += size;
+        return;
+    }
+
+    ReceivedMessage message(*nlPacket);
+    Mixer* sendingMixer = nullptr;
+    if (!PacketTypeEnum::getNonSourcedPackets().contains(packetType)) {
+        sendingMixer = findMixer(message.getSourceID());
+    }
+
+    switch (packetType) {
+        case PacketType::DomainList:
+            processDomainList(message);
+            break;
+        case PacketType::DomainServerAddedNode: {
+            QDataStream packetStream(message.getMessage());
+            parseNode(packetStream);
+            break;
+        }
+        case PacketType::DomainServerRemovedNode:
+            removeMixer(QUuid::fromRfc4122(message.readWithoutCopy(NUM_BYTES_RFC4122_UUID)));
+            break;
+        case PacketType::DomainConnectionDenied:
+            processDomainConnectionDenied(message);
+            break;
+        case PacketType::Ping:
+            if (sendingMixer) {
+                processPing(message, *sendingMixer);
+            }
+            break;
+        case PacketType::PingReply:
+            if (sendingMixer) {
+                processPingReply(message, *sendingMixer);
+            }
+            break;
+        case PacketType::SelectedAudioFormat:
+            processSelectedAudioFormat(message);
+            break;
+        case PacketType::MixedAudio:
+        case PacketType::SilentAudioFrame:
+            processMixedAudio(message);
+            break;
+        case PacketType::BulkAvatarData:
+            _avatarArrival.record(usecTimestampNow());
+            ++_stats.receivedAvatars.packets;
+            _stats.receivedAvatars.bytes += size;
+            return;
+        default:
+            break;
+    }
+
+    if (packetType != PacketType::MixedAudio && packetType != PacketType::SilentAudioFrame) {
+        ++_stats.receivedOther.packets;
+        _stats.receivedOther.bytes += size;
+    }
+}
+
+void VirtualNode::processDomainList(ReceivedMessage& message) {
+    QDataStream packetStream(message.getMessage());
+
+    QUuid domainUUID;
+    NLPacket::LocalID domainLocalID;
+    QUuid sessionUUID;
+    NLPacket::LocalID sessionLocalID;
+    NodePermissions permissions;
+    bool isAuthenticated;
+    quint64 connectRequestTimestamp;
+    quint64 domainServerPingSendTime;
+    quint64 domainServerCheckinProcessingTime;
+    bool newConnection;
+
+    packetStream >> domainUUID >> domainLocalID >> sessionUUID >> sessionLocalID >> permissions >> isAuthenticated
+                 >> connectRequestTimestamp >> domainServerPingSendTime >> domainServerCheckinProcessingTime
+                 >> newConnection;
+    auto listHeader = NodeRoster::readListHeader(packetStream);
+
+    if (isConnected() && (sessionLocalID != _sessionLocalID || sessionUUID != _sessionUUID)) {
+        // the domain-server forgot about us, start over with new mixer secrets
+        qDebug() << "Virtual node" << _index << "was given a new session by the domain-server";
+        _mixers.clear();
+        _domainListVersion = NodeRoster::NO_VERSION;
+    }
+
+    _domainUUID = domainUUID;
+    _sessionUUID = sessionUUID;
+    _sessionLocalID = sessionLocalID;
+    _isAuthenticated = isAuthenticated;
+    _avatar.setSessionUUID(sessionUUID);
+
+    // a list can span several packets, any of which can be lost
+    if (listHeader.listID != _pendingDomainList.header.listID) {
+        _pendingDomainList = { listHeader, 0 };
+    }
+
+    while (packetStream.device()->pos() < message.getSize()) {
+        quint8 entryType;
+        packetStream >> entryType;
+
+        if (entryType == NodeRoster::RemovedNodeEntry) {
+            QUuid nodeUUID;
+            packetStream >> nodeUUID;
+            removeMixer(nodeUUID);
+        } else {
+            parseNode(packetStream);
+        }
+        ++_pendingDomainList.numEntriesReceived;
+    }
+
+    // acknowledge the list the same way NodeList does
+    if (_pendingDomainList.numEntriesReceived == _pendingDomainList.header.numEntries &&
+        NodeRoster::canAcknowledge(_domainListVersion, _pendingDomainList.header)) {
+        _domainListVersion = _pendingDomainList.header.version;
+    }
+}
+
+void VirtualNode::processDomainConnectionDenied(ReceivedMessage& message) {
+    quint8 reasonCode;
+    message.readPrimitive(&reasonCode);
+
+    quint16 reasonSize;
+    message.readPrimitive(&reasonSize);
+    QString reason = QString::fromUtf8(message.readWithoutCopy(reasonSize));
+
+    qWarning() << "Virtual node" << _index << "was denied a connection to the domain:" << reason;
+    _wasDenied = true;
+}
+
+void VirtualNode::parseNode(QDataStream& packetStream) {
+    qint8 type;
+    QUuid uuid;
+    SockAddr publicSocket;
+    SockAddr localSocket;
+    NodePermissions permissions;
+    bool isReplicated;
+    NLPacket::LocalID localID;
+    QUuid connectionSecretUUID;
+
+    packetStream >> type >> uuid >> publicSocket >> localSocket >> permissions >> isReplicated >> localID
+                 >> connectionSecretUUID;
+
+    if (type != NodeType::AudioMixer && type != NodeType::AvatarMixer) {
+        return;
+    }
+
+    // the node is reachable at the same IP as the domain-server
+    if (publicSocket.getAddress().isNull()) {
+        publicSocket.setAddress(_settings.domainServer.getAddress());
+    }
+
+    Mixer* mixer = findMixer((NodeType_t)type);
+    if (mixer && mixer->uuid == uuid) {
+        return;
+    }
+    if (mixer) {
+        removeMixer(mixer->uuid);
+    }
+
+    Mixer newMixer;
+    newMixer.type = (NodeType_t)type;
+    newMixer.uuid = uuid;
+    newMixer.localID = localID;
+    newMixer.publicSocket = publicSocket;
+    newMixer.localSocket = localSocket;
+    newMixer.authenticateHash.reset(new HMACAuth());
+    newMixer.authenticateHash->setKey(connectionSecretUUID);
+    _mixers.push_back(std::move(newMixer));
+
+    sendPings(_mixers.back());
+}
+
+void VirtualNode::removeMixer(const QUuid& uuid) {
+    auto it = std::find_if(_mixers.begin(), _mixers.end(), [&](const Mixer& mixer) {
+        return mixer.uuid == uuid;
+    });
+    if (it == _mixers.end()) {
+        return;
+    }
+
+    if (it->type == NodeType::AudioMixer) {
+        // renegotiate with the next audio mixer
+        _selectedCodecName = QString();
+        _hasMixedAudio = false;
+    }
+    _mixers.erase(it);
+}
+
+void VirtualNode::processPing(ReceivedMessage& message, Mixer& mixer) {
+    PingType_t typeFromOriginalPing;
+    quint64 timeFromOriginalPing;
+    message.readPrimitive(&typeFromOriginalPing);
+    message.readPrimitive(&timeFromOriginalPing);
+
+    auto replyPacket = NLPacket::create(PacketType::PingReply, sizeof(PingType_t) + sizeof(quint64) + sizeof(quint64));
+    replyPacket->writePrimitive(typeFromOriginalPing);
+    replyPacket->writePrimitive(timeFromOriginalPing);
+    replyPacket->writePrimitive(usecTimestampNow());
+    sendPacket(*replyPacket, message.getSenderSockAddr(), &mixer);
+}
+
+void VirtualNode::processPingReply(ReceivedMessage& message, Mixer& mixer) {
+    PingType_t pingType;
+    quint64 timeFromOriginalPing;
+    message.readPrimitive(&pingType);
+    message.readPrimitive(&timeFromOriginalPing);
+
+    quint64 now = usecTimestampNow();
+    if (now >= timeFromOriginalPing) {
+        auto& roundTrips = mixer.type == NodeType::AudioMixer
+            ? _stats.audioMixerRoundTripUsecs : _stats.avatarMixerRoundTripUsecs;
+        roundTrips.push_back((quint32)std::min(now - timeFromOriginalPing, (quint64)UINT32_MAX));
+    }
+
+    bool wasActive = !mixer.activeSocket.isNull();
+    if (pingType == PingType::Local && mixer.activeSocket != mixer.localSocket) {
+        mixer.activeSocket = mixer.localSocket;
+    } else if (pingType == PingType::Public && !wasActive) {
+        mixer.activeSocket = mixer.publicSocket;
+    }
+
+    if (!wasActive && !mixer.activeSocket.isNull()) {
+        if (mixer.type == NodeType::AudioMixer) {
+            negotiateAudioFormat(mixer);
+        } else {
+            sendAvatarIdentity(mixer);
+            sendAvatarQuery(mixer);
+        }
+    }
+}
+
+void VirtualNode::processSelectedAudioFormat(ReceivedMessage& message) {
+    QString selectedCodecName = message.readString();
+    if (selectedCodecName == _selectedCodecName && !_selectedCodecName.isNull()) {
+        return;
+    }
+
+    if (_codec && _encoder) {
+        _codec->releaseEncoder(_encoder);
+        _encoder = nullptr;
+    }
+    _codec.reset();
+
+    // a non-null name, even if empty, tells sendAudioFrame the format is settled
+    _selectedCodecName = selectedCodecName.isNull() ? QString("") : selectedCodecName;
+    for (auto& codec : _settings.codecs) {
+        if (codec->getName() == _selectedCodecName) {
+            _codec = codec;
+            _encoder = codec->createEncoder(AudioConstants::SAMPLE_RATE, AudioConstants::MONO);
+            break;
+        }
+    }
+}
+
+void VirtualNode::processMixedAudio(ReceivedMessage& message) {
+    _audioArrival.record(usecTimestampNow());
+    ++_stats.receivedAudio.packets;
+    _stats.receivedAudio.bytes += message.getSize();
+
+    quint16 sequenceNumber;
+    message.readPrimitive(&sequenceNumber);
+    if (_hasMixedAudio) {
+        quint16 gap = sequenceNumber - _lastMixedAudioSequenceNumber - 1;
+        if (gap > 0 && gap < MAX_SEQUENCE_GAP) {
+            _stats.audioSequenceGaps += gap;
+        }
+    }
+    _lastMixedAudioSequenceNumber = sequenceNumber;
+    _hasMixedAudio = true;
+}
+
+VirtualNode::Mixer* VirtualNode::findMixer(NodeType_t type) {
+    for (auto& mixer : _mixers) {
+        if (mixer.type == type) {
+            return &mixer;
+        }
+    }
+    return nullptr;
+}
+
+VirtualNode::Mixer* VirtualNode::findMixer(NLPacket::LocalID localID) {
+    for (auto& mixer : _mixers) {
+        if (mixer.localID == localID) {
+            return &mixer;
+        }
+    }
+    return nullptr;
+}
+
+void VirtualNode::sendPings(Mixer& mixer) {
+    auto makePing = [](PingType_t pingType) {
+        auto pingPacket = NLPacket::create(PacketType::Ping, sizeof(PingType_t) + sizeof(quint64) + sizeof(int64_t));
+        pingPacket->writePrimitive(pingType);
+        pingPacket->writePrimitive(usecTimestampNow());
+        pingPacket->writePrimitive((int64_t)0);
+        return pingPacket;
+    };
+
+    if (mixer.activeSocket.isNull()) {
+        // punch both sockets until one of them replies
+        sendPacket(*makePing(PingType::Local), mixer.localSocket, &mixer);
+        sendPacket(*makePing(PingType::Public), mixer.publicSocket, &mixer);
+    } else {
+        sendPacket(*makePing(PingType::Agnostic), mixer.activeSocket, &mixer);
+    }
+}
+
+void VirtualNode::sendAvatarIdentity(Mixer& mixer) {
+    // the identity is small enough to go as a single reliable packet rather than a packet list
+    QByteArray identityData = _avatar.identityByteArray();
+    auto identityPacket = NLPacket::create(PacketType::AvatarIdentity, identityData.size(), true);
+    identityPacket->write(identityData);
+    sendReliablePacket(std::move(identityPacket), mixer);
+}
+
+void VirtualNode::sendAvatarQuery(Mixer& mixer) {
+    ViewFrustum view;
+    view.setPosition(_avatar.getWorldPosition());
+    view.setOrientation(_avatar.getWorldOrientation());
+    view.setProjection(DEFAULT_FIELD_OF_VIEW_DEGREES, DEFAULT_ASPECT_RATIO, DEFAULT_NEAR_CLIP, DEFAULT_FAR_CLIP);
+    view.calculate();
+    ConicalViewFrustum conicalView { view };
+
+    auto avatarPacket = NLPacket::create(PacketType::AvatarQuery);
+    auto destinationBuffer = reinterpret_cast<unsigned char*>(avatarPacket->getPayload());
+    auto bufferStart = destinationBuffer;
+
+    uint8_t numFrustums = 1;
+    memcpy(destinationBuffer, &numFrustums, sizeof(numFrustums));
+    destinationBuffer += sizeof(numFrustums);
+    destinationBuffer += conicalView.serialize(destinationBuffer);
+    avatarPacket->setPayloadSize(destinationBuffer - bufferStart);
+
+    sendPacket(*avatarPacket, mixer.activeSocket, &mixer);
+}
+
+void VirtualNode::negotiateAudioFormat(Mixer& mixer) {
+    auto negotiateFormatPacket = NLPacket::create(PacketType::NegotiateAudioFormat);
+    quint8 numberOfCodecs = (quint8)_settings.codecs.size();
+    negotiateFormatPacket->writePrimitive(numberOfCodecs);
+    for (auto& codec : _settings.codecs) {
+        negotiateFormatPacket->writeString(codec->getName());
+    }
+    sendPacket(*negotiateFormatPacket, mixer.activeSocket, &mixer);
+}
+
+void VirtualNode::fillPacketHeader(const NLPacket& packet, Mixer* mixer) {
+    static const auto NON_SOURCED_PACKETS = PacketTypeEnum::getNonSourcedPackets();
+    static const auto NON_VERIFIED_PACKETS = PacketTypeEnum::getNonVerifiedPackets();
+
+    if (NON_SOURCED_PACKETS.contains(packet.getType())) {
+        return;
+    }
+    packet.writeSourceID(_sessionLocalID);
+
+    if (_isAuthenticated && mixer && !NON_VERIFIED_PACKETS.contains(packet.getType())) {
+        packet.writeVerificationHash(*mixer->authenticateHash);
+    }
+}
+
+void VirtualNode::sendPacket(const NLPacket& packet, const SockAddr& sockAddr, Mixer* mixer) {
+    fillPacketHeader(packet, mixer);
+    _socket.writePacket(packet, sockAddr);
+
+    ++_stats.sent.packets;
+    _stats.sent.bytes += packet.getDataSize();
+}
+
+void VirtualNode::sendReliablePacket(std::unique_ptr<NLPacket> packet, Mixer& mixer) {
+    fillPacketHeader(*packet, &mixer);
+
+    ++_stats.sent.packets;
+    _stats.sent.bytes += packet->getDataSize();
+
+    _socket.writePacket(std::move(packet), mixer.activeSocket);
+}
+
+void VirtualNode::playClip(float deltaTime) {
+    auto& clip = _settings.clip;
+    float duration = clip->duration();
+    if (duration <= 0.0f) {
+        return;
+    }
+
+    _clipTime += deltaTime;
+    if (_clipTime >= duration) {
+        _clipTime = std::fmod(_clipTime, duration);
+        clip->seekFrameTime(0);
+    }
+
+    // apply the latest avatar frame at or before the current time
+    auto frameTime = recording::Frame::secondsToFrameTime(_clipTime);
+    recording::FrameConstPointer avatarFrame;
+    for (auto frame = clip->peekFrame(); frame && frame->timeOffset <= frameTime; frame = clip->peekFrame()) {
+        clip->skipFrame();
+        if (frame->type == _avatarFrameType) {
+            avatarFrame = frame;
+        }
+    }
+
+    if (avatarFrame) {
+        AvatarData::fromFrame(avatarFrame->data, _avatar, false);
+        // recordings are made at one spot, spread the nodes out around their spawn points
+        _avatar.setWorldPosition(_avatar.getWorldPosition() + _settings.position);
+    }
+}
+
+void VirtualNode::walkInCircle(float deltaTime) {
+    _walkAngle += deltaTime * WALK_SPEED / WALK_RADIUS;
+    glm::vec3 offset(WALK_RADIUS * std::cos(_walkAngle), 0.0f, WALK_RADIUS * std::sin(_walkAngle));
+    _avatar.setWorldPosition(_settings.position + offset);
+    _avatar.setWorldOrientation(glm::angleAxis(-_walkAngle, Vectors::UNIT_Y));
+}
@@ -0,0 +1,182 @@
+//
+//  VirtualNode.h
+//  tools/load-generator/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_VirtualNode_h
+#define hifi_VirtualNode_h
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QUuid>
+
+#include <glm/glm.hpp>
+
+#include <AvatarData.h>
+#include <HMACAuth.h>
+#include <NLPacket.h>
+#include <NodeRoster.h>
+#include <NodeType.h>
+#include <plugins/CodecPlugin.h>
+#include <plugins/Forward.h>
+#include <recording/Forward.h>
+#include <SockAddr.h>
+#include <udt/Socket.h>
+
+class ReceivedMessage;
+
+/// Counters a virtual node collects between two reports.
+struct LoadStats {
+    struct Stream {
+        quint64 packets { 0 };
+        quint64 bytes { 0 };
+    };
+
+    Stream sent;
+    Stream receivedAudio;
+    Stream receivedAvatars;
+    Stream receivedOther;
+    quint32 audioSequenceGaps { 0 };
+
+    std::vector<quint32> audioMixerRoundTripUsecs;
+    std::vector<quint32> avatarMixerRoundTripUsecs;
+
+    // smoothed deviation of packet arrival times from the stream's interval, at the time of the report
+    float audioJitterUsecs { 0.0f };
+    float avatarJitterUsecs { 0.0f };
+
+    void merge(const LoadStats& other);
+};
+
+/// One simulated client session: its own socket, domain-server check-ins, session and local IDs, and the
+/// connection secrets for each mixer, so many of them can share one process and one event loop.
+///
+/// The owner drives it with sendHeartbeat() once a second, sendAvatarUpdate() at the avatar send rate and
+/// sendAudioFrame() once per network audio frame.
+class VirtualNode : public QObject {
+    Q_OBJECT
+public:
+    struct Settings {
+        SockAddr domainServer;
+        glm::vec3 position;
+        float toneFrequency { 220.0f };
+        recording::ClipPointer clip; // this node's own copy, may be null
+        CodecPluginList codecs; // offered to the audio mixer, PCM is sent if it picks none of them
+        bool sendAudio { true };
+        bool sendAvatarData { true };
+    };
+
+    VirtualNode(int index, const Settings& settings, QObject* parent = nullptr);
+    ~VirtualNode();
+
+    void start();
+    void stop();
+
+    bool isConnected() const { return _sessionLocalID != NLPacket::NULL_LOCAL_ID; }
+    bool wasDenied() const { return _wasDenied; }
+
+    /// Domain-server check-in, mixer pings (hole punching, then round trip times) and the avatar view query.
+    void sendHeartbeat();
+    void sendAvatarUpdate(float deltaTime);
+    void sendAudioFrame();
+
+    LoadStats takeStats();
+
+private:
+    struct Mixer {
+        NodeType_t type { NodeType::Unassigned };
+        QUuid uuid;
+        NLPacket::LocalID localID { NLPacket::NULL_LOCAL_ID };
+        SockAddr publicSocket;
+        SockAddr localSocket;
+        SockAddr activeSocket;
+        std::unique_ptr<HMACAuth> authenticateHash;
+    };
+
+    struct ArrivalJitter {
+        // with no fixed interval, the expected interval is a running average of the observed ones
+        quint64 expectedIntervalUsecs { 0 };
+        quint64 lastArrivalUsecs { 0 };
+        float averageIntervalUsecs { 0.0f };
+        float jitterUsecs { 0.0f };
+
+        void record(quint64 nowUsecs);
+    };
+
+    void sendDomainCheckIn();
+    void handlePacket(std::unique_ptr<udt::Packet> packet);
+
+    void processDomainList(ReceivedMessage& message);
+    void processDomainConnectionDenied(ReceivedMessage& message);
+    void parseNode(QDataStream& packetStream);
+    void processPing(ReceivedMessage& message, Mixer& mixer);
+    void processPingReply(ReceivedMessage& message, Mixer& mixer);
+    void processSelectedAudioFormat(ReceivedMessage& message);
+    void processMixedAudio(ReceivedMessage& message);
+    void removeMixer(const QUuid& uuid);
+
+    Mixer* findMixer(NodeType_t type);
+    Mixer* findMixer(NLPacket::LocalID localID);
+
+    void sendPings(Mixer& mixer);
+    void sendAvatarIdentity(Mixer& mixer);
+    void sendAvatarQuery(Mixer& mixer);
+    void negotiateAudioFormat(Mixer& mixer);
+
+    void fillPacketHeader(const NLPacket& packet, Mixer* mixer);
+    void sendPacket(const NLPacket& packet, const SockAddr& sockAddr, Mixer* mixer = nullptr);
+    void sendReliablePacket(std::unique_ptr<NLPacket> packet, Mixer& mixer);
+
+    void playClip(float deltaTime);
+    void walkInCircle(float deltaTime);
+
+    int _index;
+    Settings _settings;
+    udt::Socket _socket;
+
+    QUuid _sessionUUID;
+    NLPacket::LocalID _sessionLocalID { NLPacket::NULL_LOCAL_ID };
+    QUuid _domainUUID;
+    QUuid _machineFingerprint { QUuid::createUuid() };
+    bool _isAuthenticated { true };
+    bool _wasDenied { false };
+
+    // the roster version acknowledged in check-ins, and the list being received
+    struct PendingDomainList {
+        NodeRoster::ListHeader header;
+        quint32 numEntriesReceived { 0 };
+    };
+    NodeRoster::Version _domainListVersion { NodeRoster::NO_VERSION };
+    PendingDomainList _pendingDomainList;
+
+    std::vector<Mixer> _mixers;
+
+    AvatarData _avatar;
+    AvatarDataSequenceNumber _avatarSequenceNumber { 0 };
+    float _clipTime { 0.0f };
+    float _walkAngle { 0.0f };
+    recording::FrameType _avatarFrameType;
+
+    QString _selectedCodecName;
+    CodecPluginPointer _codec;
+    Encoder* _encoder { nullptr };
+    quint16 _outgoingAudioSequenceNumber { 0 };
+    quint64 _audioFrameCount { 0 };
+
+    quint16 _lastMixedAudioSequenceNumber { 0 };
+    bool _hasMixedAudio { false };
+    ArrivalJitter _audioArrival;
+    ArrivalJitter _avatarArrival;
+
+    LoadStats _stats;
+};
+
+#endif // hifi_VirtualNode_h
@@ -0,0 +1,450 @@
+//
+//  PhysicsReplayApp.cpp
+//  tools/physics-replay/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsReplayApp.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <QCommandLineParser>
+#include <QFile>
+#include <QJsonDocument>
+#include <QTextStream>
+#include <QUuid>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <DependencyManager.h>
+#include <EntityDynamicFactoryInterface.h>
+#include <EntityEditPacketSender.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <NodeList.h>
+#include <ObjectActionOffset.h>
+#include <ObjectActionTractor.h>
+#include <ObjectActionTravelOriented.h>
+#include <ObjectConstraintBallSocket.h>
+#include <ObjectConstraintConeTwist.h>
+#include <ObjectConstraintHinge.h>
+#include <ObjectConstraintSlider.h>
+#include <PhysicalEntitySimulation.h>
+#include <PhysicsEngine.h>
+#include <PhysicsHelpers.h>
+#include <ShapeManager.h>
+#include <SimulationOwner.h>
+#include <SpatialParentFinder.h>
+#include <workload/Space.h>
+
+using Clock = std::chrono::high_resolution_clock;
+
+// how long to wait for the shapes that are built on other threads before giving up on them
+static const std::chrono::seconds MAX_SHAPE_WAIT(60);
+
+// a view that puts every entity in R1, so everything that can be physical is
+static const float WORKLOAD_REGION_RADIUS = 2.0f * (float)TREE_SCALE;
+
+// the same as InterfaceDynamicFactory, less the actions that follow an avatar
+class ReplayDynamicFactory : public EntityDynamicFactoryInterface {
+public:
+    EntityDynamicPointer factory(EntityDynamicType type, const QUuid& id, EntityItemPointer ownerEntity,
+                                 QVariantMap arguments) override {
+        EntityDynamicPointer dynamic = create(type, id, ownerEntity);
+        if (dynamic && dynamic->updateArguments(arguments) && !dynamic->lifetimeIsOver()) {
+            return dynamic;
+        }
+        return nullptr;
+    }
+
+    EntityDynamicPointer factoryBA(EntityItemPointer ownerEntity, QByteArray data) override {
+        QDataStream serializedArgumentStream(data);
+        EntityDynamicType type;
+        QUuid id;
+        serializedArgumentStream >> type;
+        serializedArgumentStream >> id;
+
+        EntityDynamicPointer dynamic = create(type, id, ownerEntity);
+        if (dynamic) {
+            dynamic->deserialize(data);
+            if (dynamic->lifetimeIsOver()) {
+                return nullptr;
+            }
+        }
+        return dynamic;
+    }
+
+private:
+    static EntityDynamicPointer create(EntityDynamicType type, const QUuid& id, EntityItemPointer ownerEntity) {
+        switch (type) {
+            case DYNAMIC_TYPE_OFFSET:
+                return std::make_shared<ObjectActionOffset>(id, ownerEntity);
+            case DYNAMIC_TYPE_SPRING:
+            case DYNAMIC_TYPE_TRACTOR:
+                return std::make_shared<ObjectActionTractor>(id, ownerEntity);
+            case DYNAMIC_TYPE_TRAVEL_ORIENTED:
+                return std::make_shared<ObjectActionTravelOriented>(id, ownerEntity);
+            case DYNAMIC_TYPE_HINGE:
+                return std::make_shared<ObjectConstraintHinge>(id, ownerEntity);
+            case DYNAMIC_TYPE_SLIDER:
+                return std::make_shared<ObjectConstraintSlider>(id, ownerEntity);
+            case DYNAMIC_TYPE_BALL_SOCKET:
+                return std::make_shared<ObjectConstraintBallSocket>(id, ownerEntity);
+            case DYNAMIC_TYPE_CONE_TWIST:
+                return std::make_shared<ObjectConstraintConeTwist>(id, ownerEntity);
+            default:
+                return EntityDynamicPointer();
+        }
+    }
+};
+
+// entities can only be parented to other entities here, there are no avatars
+class ReplayParentFinder : public SpatialParentFinder {
+public:
+    ReplayParentFinder(EntityTreePointer tree) : _tree(tree) {}
+
+    SpatiallyNestableWeakPointer find(QUuid parentID, bool& success, SpatialParentTree* entityTree = nullptr) const override {
+        SpatiallyNestableWeakPointer parent;
+        if (parentID.isNull()) {
+            success = true;
+            return parent;
+        }
+        if (entityTree) {
+            parent = entityTree->findByID(parentID);
+        } else {
+            parent = _tree->findEntityByEntityItemID(parentID);
+        }
+        success = !parent.expired();
+        return parent;
+    }
+
+private:
+    EntityTreePointer _tree;
+};
+
+void PhysicsReplayApp::PhaseTimer::add(Clock::duration duration) {
+    uint64_t usecs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    _numSamples++;
+    _totalUsecs += usecs;
+    _maxUsecs = std::max(_maxUsecs, usecs);
+}
+
+QJsonObject PhysicsReplayApp::PhaseTimer::toJson() const {
+    QJsonObject result;
+    result["totalUsecs"] = (double)_totalUsecs;
+    result["meanUsecs"] = _numSamples > 0 ? (double)_totalUsecs / (double)_numSamples : 0.0;
+    result["maxUsecs"] = (double)_maxUsecs;
+    return result;
+}
+
+PhysicsReplayApp::PhysicsReplayApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Steps the physics of an entity snapshot without rendering and reports timings as JSON");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption inputFilenameOption("i", "entity snapshot, .json or .json.gz", "filename");
+    parser.addOption(inputFilenameOption);
+
+    const QCommandLineOption outputFilenameOption("o", "write results to a file instead of stdout", "filename");
+    parser.addOption(outputFilenameOption);
+
+    const QCommandLineOption secondsOption("s", "seconds of simulation to step", "seconds", "10");
+    parser.addOption(secondsOption);
+
+    const QCommandLineOption frameRateOption("f", "frames per second, one stepSimulation() per frame", "rate", "60");
+    parser.addOption(frameRateOption);
+
+    const QCommandLineOption multithreadedOption("multithreaded", "solve islands on the thread pool (results are not repeatable)");
+    parser.addOption(multithreadedOption);
+
+    const QCommandLineOption ownOption("own", "start out owning every entity rather than bidding for the ones that move");
+    parser.addOption(ownOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << Qt::endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    if (!parser.isSet(inputFilenameOption)) {
+        qCritical() << "An input snapshot is required";
+        _returnCode = 1;
+        return;
+    }
+
+    bool ok = false;
+    float seconds = parser.value(secondsOption).toFloat(&ok);
+    float framesPerSecond = ok ? parser.value(frameRateOption).toFloat(&ok) : 0.0f;
+    if (!ok || seconds <= 0.0f || framesPerSecond <= 0.0f) {
+        qCritical() << "Seconds and frame rate must be positive numbers";
+        _returnCode = 1;
+        return;
+    }
+
+    QJsonObject results;
+    _returnCode = run(parser.value(inputFilenameOption), seconds, framesPerSecond, parser.isSet(multithreadedOption),
+                      parser.isSet(ownOption), results);
+    if (_returnCode != 0) {
+        return;
+    }
+
+    QByteArray json = QJsonDocument(results).toJson(QJsonDocument::Indented);
+    if (parser.isSet(outputFilenameOption)) {
+        QFile file(parser.value(outputFilenameOption));
+        if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size()) {
+            qCritical() << "Failed to write" << file.fileName();
+            _returnCode = 3;
+        }
+    } else {
+        QTextStream(stdout) << json;
+    }
+}
+
+PhysicsReplayApp::~PhysicsReplayApp() {
+    DependencyManager::destroy<SpatialParentFinder>();
+    DependencyManager::destroy<EntityDynamicFactoryInterface>();
+    DependencyManager::destroy<NodeList>();
+}
+
+int PhysicsReplayApp::run(const QString& inputFilename, float seconds, float framesPerSecond, bool multithreaded, bool own,
+                          QJsonObject& results) {
+    // the edit packet sender wants a NodeList, with no entity-server to send to it just queues the packets
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (VircadiaPhysicsReplay)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent, INVALID_PORT);
+    DependencyManager::registerInheritance<EntityDynamicFactoryInterface, ReplayDynamicFactory>();
+    DependencyManager::set<ReplayDynamicFactory>();
+
+    QUuid sessionID = QUuid::createUuid();
+    Physics::setSessionUUID(sessionID);
+
+    ShapeManager shapeManager;
+    ObjectMotionState::setShapeManager(&shapeManager);
+
+    PhysicsEnginePointer physicsEngine = std::make_shared<PhysicsEngine>(Vectors::ZERO);
+    physicsEngine->init();
+    physicsEngine->setMultithreaded(multithreaded);
+
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    DependencyManager::registerInheritance<SpatialParentFinder, ReplayParentFinder>();
+    DependencyManager::set<ReplayParentFinder>(tree);
+
+    auto space = std::make_shared<workload::Space>();
+    EntityEditPacketSender packetSender;
+    PhysicalEntitySimulationPointer simulation = std::make_shared<PhysicalEntitySimulation>();
+    simulation->setWorkloadSpace(space);
+    simulation->init(tree, physicsEngine, &packetSender);
+    tree->setSimulation(simulation);
+
+    // load
+    auto loadStart = Clock::now();
+    if (!tree->readFromFile(inputFilename.toLocal8Bit().constData())) {
+        qCritical() << "Failed to read" << inputFilename;
+        return 2;
+    }
+    auto loadTime = Clock::now() - loadStart;
+
+    std::vector<EntityItemPointer> entities;
+    tree->withReadLock([&] {
+        tree->recurseTreeWithOperation([&](const OctreeElementPointer& element, void*) {
+            std::static_pointer_cast<EntityTreeElement>(element)->forEachEntity([&](const EntityItemPointer& entity) {
+                entities.push_back(entity);
+            });
+            return true;
+        });
+    });
+
+    // give every entity a workload proxy so PhysicalEntitySimulation sees it in a region where it can be physical
+    workload::Transaction transaction;
+    for (auto& entity : entities) {
+        int32_t spaceIndex = space->allocateID();
+        SpatiallyNestablePointer nestable = std::static_pointer_cast<SpatiallyNestable>(entity);
+        transaction.reset(spaceIndex, workload::Sphere(entity->getWorldPosition(), entity->getBoundingRadius()),
+                          workload::Owner(nestable));
+        entity->setSpaceIndex(spaceIndex);
+        if (own) {
+            entity->setSimulationOwner(sessionID, VOLUNTEER_SIMULATION_PRIORITY);
+        }
+    }
+    space->enqueueTransaction(transaction);
+    space->enqueueFrame();
+    space->processTransactionQueue();
+
+    workload::View view;
+    for (uint32_t i = 0; i < workload::Region::NUM_TRACKED_REGIONS; i++) {
+        view.regions[i] = workload::Sphere(glm::vec3(0.0f), WORKLOAD_REGION_RADIUS);
+    }
+    space->setViews({ view });
+    workload::Space::Changes regionChanges;
+    space->categorizeAndGetChanges(regionChanges);
+    tree->withWriteLock([&] {
+        for (const auto& change : regionChanges) {
+            auto nestable = space->getOwner(change.proxyId).get<SpatiallyNestablePointer>();
+            if (nestable && nestable->getNestableType() == NestableType::Entity) {
+                simulation->changeEntity(std::static_pointer_cast<EntityItem>(nestable));
+            }
+        }
+    });
+
+    auto buildPhysicsTransaction = [&] {
+        tree->preUpdate();
+        simulation->removeDeadEntities();
+        PhysicsEngine::Transaction physicsTransaction;
+        tree->withWriteLock([&] {
+            simulation->buildPhysicsTransaction(physicsTransaction);
+        });
+        physicsEngine->processTransaction(physicsTransaction);
+        simulation->handleProcessedPhysicsTransaction(physicsTransaction);
+    };
+
+    // add everything that can be added before the clock starts, so every run steps the same set of objects
+    auto shapeStart = Clock::now();
+    uint32_t numIdlePasses = 0;
+    while (numIdlePasses < 2) {
+        buildPhysicsTransaction();
+        QCoreApplication::processEvents();
+        if (shapeManager.getNumPendingShapes() > 0) {
+            numIdlePasses = 0;
+            if (Clock::now() - shapeStart > MAX_SHAPE_WAIT) {
+                qWarning() << "Gave up waiting for" << shapeManager.getNumPendingShapes() << "shapes";
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        } else {
+            numIdlePasses++;
+        }
+    }
+    auto shapeTime = Clock::now() - shapeStart;
+    // a request is counted every time a shape is asked for while its build is pending, a delivery once per build
+    uint32_t numShapeWorkRequests = shapeManager.getWorkRequestCount();
+    uint32_t numShapesBuiltOffThread = shapeManager.getWorkDeliveryCount();
+    int32_t numPhysicalObjects = physicsEngine->getNumCollisionObjects();
+    uint64_t numBidsBeforeStep = simulation->getNumBidsSent();
+    uint64_t numUpdatesBeforeStep = simulation->getNumUpdatesSent();
+
+    // step
+    PhaseTimer prePhysicsTimer;
+    PhaseTimer stepTimer;
+    PhaseTimer handleChangesTimer;
+    PhaseTimer collisionEventsTimer;
+    PhaseTimer frameTimer;
+    uint64_t numCollisionEvents = 0;
+    uint64_t numContactPoints = 0;
+    int maxManifolds = 0;
+    int maxContactPoints = 0;
+
+    const float frameTime = 1.0f / framesPerSecond;
+    const uint32_t numFrames = (uint32_t)(seconds * framesPerSecond + 0.5f);
+    auto stepStart = Clock::now();
+    for (uint32_t frame = 0; frame < numFrames; frame++) {
+        auto t0 = Clock::now();
+        buildPhysicsTransaction();
+        simulation->applyDynamicChanges();
+        physicsEngine->forEachDynamic([&](EntityDynamicPointer dynamic) {
+            dynamic->prepareForPhysicsSimulation();
+        });
+        auto t1 = Clock::now();
+        tree->withWriteLock([&] {
+            physicsEngine->stepSimulation(frameTime);
+        });
+        auto t2 = Clock::now();
+        auto t3 = t2;
+        if (physicsEngine->hasOutgoingChanges()) {
+            auto& collisionEvents = physicsEngine->getCollisionEvents();
+            numCollisionEvents += collisionEvents.size();
+            tree->withWriteLock([&] {
+                simulation->handleChangedMotionStates(physicsEngine->getChangedMotionStates());
+                simulation->handleDeactivatedMotionStates(physicsEngine->getDeactivatedMotionStates());
+            });
+            t3 = Clock::now();
+            simulation->handleCollisionEvents(collisionEvents);
+        }
+        tree->update(true);
+        auto t4 = Clock::now();
+
+        prePhysicsTimer.add(t1 - t0);
+        stepTimer.add(t2 - t1);
+        handleChangesTimer.add(t3 - t2);
+        collisionEventsTimer.add(t4 - t3);
+        frameTimer.add(t4 - t0);
+
+        btDispatcher* dispatcher = physicsEngine->getDynamicsWorld()->getDispatcher();
+        int numManifolds = dispatcher->getNumManifolds();
+        int numPoints = 0;
+        for (int i = 0; i < numManifolds; i++) {
+            numPoints += dispatcher->getManifoldByIndexInternal(i)->getNumContacts();
+        }
+        numContactPoints += numPoints;
+        maxManifolds = std::max(maxManifolds, numManifolds);
+        maxContactPoints = std::max(maxContactPoints, numPoints);
+    }
+    auto stepTime = Clock::now() - stepStart;
+
+    auto toUsecs = [](Clock::duration duration) {
+        return (double)std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+
+    QJsonObject setup;
+    setup["input"] = inputFilename;
+    setup["numEntities"] = (double)entities.size();
+    setup["numPhysicalObjects"] = numPhysicalObjects;
+    setup["multithreaded"] = multithreaded;
+    setup["owned"] = own;
+    setup["loadUsecs"] = toUsecs(loadTime);
+    results["setup"] = setup;
+
+    QJsonObject shapes;
+    shapes["waitUsecs"] = toUsecs(shapeTime);
+    shapes["numShapes"] = shapeManager.getNumShapes();
+    shapes["numBuiltOffThread"] = (double)numShapesBuiltOffThread;
+    shapes["numOffThreadRequests"] = (double)numShapeWorkRequests;
+    shapes["numPending"] = shapeManager.getNumPendingShapes();
+    results["shapes"] = shapes;
+
+    QJsonObject step;
+    step["seconds"] = seconds;
+    step["numFrames"] = (double)numFrames;
+    step["numSubsteps"] = (double)physicsEngine->getNumSubsteps();
+    step["totalUsecs"] = toUsecs(stepTime);
+    results["step"] = step;
+
+    QJsonObject phases;
+    phases["prePhysics"] = prePhysicsTimer.toJson();
+    phases["stepSimulation"] = stepTimer.toJson();
+    phases["handleChanges"] = handleChangesTimer.toJson();
+    phases["collisionEvents"] = collisionEventsTimer.toJson();
+    phases["frame"] = frameTimer.toJson();
+    results["phases"] = phases;
+
+    QJsonObject contacts;
+    contacts["numCollisionEvents"] = (double)numCollisionEvents;
+    contacts["meanContactPoints"] = numFrames > 0 ? (double)numContactPoints / (double)numFrames : 0.0;
+    contacts["maxContactPoints"] = maxContactPoints;
+    contacts["maxManifolds"] = maxManifolds;
+    results["contacts"] = contacts;
+
+    QJsonObject ownership;
+    ownership["numBids"] = (double)(simulation->getNumBidsSent() - numBidsBeforeStep);
+    ownership["numUpdates"] = (double)(simulation->getNumUpdatesSent() - numUpdatesBeforeStep);
+    results["ownership"] = ownership;
+
+    tree->withWriteLock([&] {
+        simulation->clearEntities();
+    });
+    tree->setSimulation(nullptr);
+    return 0;
+}
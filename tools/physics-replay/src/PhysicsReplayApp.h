@@ -0,0 +1,49 @@
+//
+//  PhysicsReplayApp.h
+//  tools/physics-replay/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsReplayApp_h
+#define hifi_PhysicsReplayApp_h
+
+#include <chrono>
+
+#include <QCoreApplication>
+#include <QJsonObject>
+
+// Loads an entity JSON snapshot into an EntityTree with a PhysicalEntitySimulation and no renderer, waits for the
+// collision shapes to be built, then steps the PhysicsEngine for a number of seconds at a fixed frame rate.  Prints
+// the time spent in each part of the physics loop, the number of contacts and the ownership traffic as JSON.
+class PhysicsReplayApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    PhysicsReplayApp(int argc, char* argv[]);
+    ~PhysicsReplayApp();
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    class PhaseTimer {
+    public:
+        void add(std::chrono::high_resolution_clock::duration duration);
+        QJsonObject toJson() const;
+
+    private:
+        uint64_t _numSamples { 0 };
+        uint64_t _totalUsecs { 0 };
+        uint64_t _maxUsecs { 0 };
+    };
+
+    int run(const QString& inputFilename, float seconds, float framesPerSecond, bool multithreaded, bool own,
+            QJsonObject& results);
+
+    int _returnCode { 0 };
+};
+
+#endif // hifi_PhysicsReplayApp_h
@@ -0,0 +1,24 @@
+//
+//  main.cpp
+//  tools/physics-replay/src
+//
+//  Created by Vircadia contributors on 2026/10/16
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <SettingHandle.h>
+#include <SharedUtil.h>
+
+#include "PhysicsReplayApp.h"
+
+int main(int argc, char* argv[]) {
+    setupHifiApplication("Physics Replay");
+
+    Setting::init();
+
+    PhysicsReplayApp app(argc, argv);
+    return app.getReturnCode();
+}